@@ -63,11 +63,13 @@ from .pyfiction import (  # type: ignore[import-not-found]
     cartesian_layout,
     cartesian_obstruction_layout,
     charge_configuration_to_string,
+    charge_distribution_format,
     charge_distribution_history,
     charge_distribution_mode,
     charge_distribution_surface,
     charge_distribution_surface_100,
     charge_distribution_surface_111,
+    charge_enumeration,
     charge_index_mode,
     charge_state_to_sign,
     chebyshev_distance,
@@ -81,6 +83,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     color_mode,
     color_routing,
     color_routing_params,
+    compact_population_stability_information,
     convert_layout_to_siqad_coordinates,
     create_and3_tt,
     create_and_tt,
@@ -219,6 +222,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     operational_analysis_strategy,
     operational_condition,
     operational_domain,
+    operational_domain_adaptive_refinement,
     operational_domain_contour_tracing,
     operational_domain_flood_fill,
     operational_domain_grid_search,
@@ -237,6 +241,9 @@ from .pyfiction import (  # type: ignore[import-not-found]
     parameter_point,
     physical_population_stability_100,
     physical_population_stability_111,
+    physical_population_stability_batch_100,
+    physical_population_stability_batch_111,
+    physical_population_stability_batch_params,
     physical_population_stability_params,
     physically_valid_parameters,
     physically_valid_parameters_domain,
@@ -247,10 +254,13 @@ from .pyfiction import (  # type: ignore[import-not-found]
     post_layout_optimization,
     post_layout_optimization_params,
     post_layout_optimization_stats,
+    potential_precision,
     potential_to_distance_conversion,
     qca_layout,
     qca_technology,
     quickexact,
+    quickexact_batch,
+    quickexact_batch_params,
     quickexact_params,
     quicksim,
     quicksim_params,
@@ -278,6 +288,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     sidb_defect_type,
     sidb_lattice_mode,
     sidb_layout,
+    sidb_layout_delta,
     sidb_nm_distance_100,
     sidb_nm_distance_111,
     sidb_nm_position,
@@ -289,6 +300,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     sidb_technology,
     sign_to_charge_state,
     simulate,
+    simulation_result_mode,
     siqad_area,
     siqad_coordinate,
     siqad_volume,
@@ -297,6 +309,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     state_type,
     substitution_strategy,
     sweep_parameter,
+    symmetry_reduction,
     technology_constraints,
     technology_mapping,
     technology_mapping_params,
@@ -304,6 +317,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     technology_network,
     termination_condition,
     time_to_solution,
+    time_to_solution_batch,
     time_to_solution_for_given_simulation_results,
     time_to_solution_params,
     time_to_solution_stats,
@@ -315,6 +329,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     undefined_cell_label_exception,
     unrecognized_cell_definition_exception,
     unsupported_character_exception,
+    validity_calculation,
     wiring_reduction,
     wiring_reduction_params,
     wiring_reduction_stats,
@@ -378,11 +393,13 @@ __all__ = [
     "cartesian_layout",
     "cartesian_obstruction_layout",
     "charge_configuration_to_string",
+    "charge_distribution_format",
     "charge_distribution_history",
     "charge_distribution_mode",
     "charge_distribution_surface",
     "charge_distribution_surface_100",
     "charge_distribution_surface_111",
+    "charge_enumeration",
     "charge_index_mode",
     "charge_state_to_sign",
     "chebyshev_distance",
@@ -396,6 +413,7 @@ __all__ = [
     "color_mode",
     "color_routing",
     "color_routing_params",
+    "compact_population_stability_information",
     "convert_layout_to_siqad_coordinates",
     "create_and3_tt",
     "create_and_tt",
@@ -534,6 +552,7 @@ __all__ = [
     "operational_analysis_strategy",
     "operational_condition",
     "operational_domain",
+    "operational_domain_adaptive_refinement",
     "operational_domain_contour_tracing",
     "operational_domain_flood_fill",
     "operational_domain_grid_search",
@@ -552,6 +571,9 @@ __all__ = [
     "parameter_point",
     "physical_population_stability_100",
     "physical_population_stability_111",
+    "physical_population_stability_batch_100",
+    "physical_population_stability_batch_111",
+    "physical_population_stability_batch_params",
     "physical_population_stability_params",
     "physically_valid_parameters",
     "physically_valid_parameters_domain",
@@ -562,10 +584,13 @@ __all__ = [
     "post_layout_optimization",
     "post_layout_optimization_params",
     "post_layout_optimization_stats",
+    "potential_precision",
     "potential_to_distance_conversion",
     "qca_layout",
     "qca_technology",
     "quickexact",
+    "quickexact_batch",
+    "quickexact_batch_params",
     "quickexact_params",
     "quicksim",
     "quicksim_params",
@@ -593,6 +618,7 @@ __all__ = [
     "sidb_defect_type",
     "sidb_lattice_mode",
     "sidb_layout",
+    "sidb_layout_delta",
     "sidb_nm_distance_100",
     "sidb_nm_distance_111",
     "sidb_nm_position",
@@ -604,6 +630,7 @@ __all__ = [
     "sidb_technology",
     "sign_to_charge_state",
     "simulate",
+    "simulation_result_mode",
     "siqad_area",
     "siqad_coordinate",
     "siqad_volume",
@@ -612,6 +639,7 @@ __all__ = [
     "state_type",
     "substitution_strategy",
     "sweep_parameter",
+    "symmetry_reduction",
     "technology_constraints",
     "technology_mapping",
     "technology_mapping_params",
@@ -619,6 +647,7 @@ __all__ = [
     "technology_network",
     "termination_condition",
     "time_to_solution",
+    "time_to_solution_batch",
     "time_to_solution_for_given_simulation_results",
     "time_to_solution_params",
     "time_to_solution_stats",
@@ -630,6 +659,7 @@ __all__ = [
     "undefined_cell_label_exception",
     "unrecognized_cell_definition_exception",
     "unsupported_character_exception",
+    "validity_calculation",
     "wiring_reduction",
     "wiring_reduction_params",
     "wiring_reduction_stats",
@@ -367,6 +367,10 @@ May pass through, and thereby throw, an
 `unsupported_gate_orientation_exception` and any further custom
 exceptions of the gate libraries.
 
+If `params` provides a `number_of_threads` greater than `1`, the tiles
+are set up concurrently, and the first exception cancels all tiles
+that have not been started yet.
+
 Args:
     lyt: The gate-level layout.
     params: Parameter for the gate library.
@@ -393,6 +397,10 @@ May pass through, and thereby throw, an
 `unsupported_gate_orientation_exception` and any further custom
 exceptions of the gate libraries.
 
+If `params` provides a `number_of_threads` greater than `1`, the tiles
+are set up concurrently, and the first exception cancels all tiles
+that have not been started yet.
+
 Args:
     lyt: The gate-level layout.
     params: Parameter for the gate library.
@@ -658,6 +666,42 @@ Returns:
 
 )doc";
 
+static const char *mkd_doc_fiction_band_bending_resilience_batch =
+R"doc(Calculates the band bending resilience of each of the given layouts,
+e.g., of all gates of a library. The layouts are distributed over
+`params.number_of_threads` threads.
+
+Args:
+    layouts: Layouts for which the band bending resilience is
+             calculated.
+    spec: Expected Boolean function of the layouts, provided as a
+          multi-output truth table.
+    params: Parameters for assessing the band bending resilience of
+            many layouts.
+    transition_type: The optional type of charge transition to
+                     consider.
+
+Template Args:
+    Lyt: SiDB cell-level layout type.
+    TT: Truth table type.
+
+Returns:
+    The band bending resilience (in V) of each layout, in the order of
+    `layouts`.
+
+)doc";
+
+static const char *mkd_doc_fiction_band_bending_resilience_batch_params =
+R"doc(This struct stores the parameters required to simulate the band
+bending resilience of many SiDB layouts.)doc";
+
+static const char *mkd_doc_fiction_band_bending_resilience_batch_params_number_of_threads =
+R"doc(Number of threads to distribute the layouts over. Values below `1` are
+treated as `1`.)doc";
+
+static const char *mkd_doc_fiction_band_bending_resilience_batch_params_resilience_params =
+R"doc(Parameters of each band bending resilience simulation.)doc";
+
 static const char *mkd_doc_fiction_band_bending_resilience_params =
 R"doc(This struct stores the parameters required to simulate the band
 bending resilience of an SiDB layout)doc";
@@ -1593,6 +1637,8 @@ Args:
     lyt: The layout to be analyzed.
     sim_params: Physical parameters used to determine whether
                 positively charged SiDBs can occur.
+    geometry: Optional geometry cache of `lyt` to avoid computing the
+              potential matrix from scratch.
 
 Template Args:
     Lyt: SiDB cell-level layout type.
@@ -2782,6 +2828,23 @@ R"doc(The previous charge distribution is not used. Hence, the local
 electrostatic potential of the given charge distribution is calculated
 from scratch.)doc";
 
+static const char *mkd_doc_fiction_charge_distribution_format =
+R"doc(Format in which SiDB simulation algorithms store the determined charge
+distributions.)doc";
+
+static const char *mkd_doc_fiction_charge_distribution_format_COMPACT =
+R"doc(Each charge distribution is stored as a `compact_charge_distribution`
+in `sidb_simulation_result::compact_charge_distributions`. All of them
+share a single charge distribution surface that holds the geometry and
+the electrostatic potentials of the layout. Full charge distribution
+surfaces are only created on request. This considerably reduces the
+memory footprint of large simulation results.)doc";
+
+static const char *mkd_doc_fiction_charge_distribution_format_FULL =
+R"doc(Each charge distribution is stored as a full
+`charge_distribution_surface` in
+`sidb_simulation_result::charge_distributions`.)doc";
+
 static const char *mkd_doc_fiction_charge_distribution_mode =
 R"doc(An enumeration of modes for handling the charge distribution when
 assigning a charge index to the charge distribution surface.)doc";
@@ -3340,10 +3403,22 @@ reduction to overlapping witnesses for larger cluster sizes that could
 be runtime-impairing, then limiting specifically the length of the
 input to the factorial call.)doc";
 
+static const char *mkd_doc_fiction_clustercomplete_params_number_of_lowest_energy_states =
+R"doc(Number of charge distributions that are returned in
+`simulation_result_mode::LOWEST_K` mode. Values below `1` are treated
+as `1`.)doc";
+
 static const char *mkd_doc_fiction_clustercomplete_params_report_gss_stats =
 R"doc(Option to decide if the *Ground State Space* statistics are reported
 to the standard output. By default, this option is disabled.)doc";
 
+static const char *mkd_doc_fiction_clustercomplete_params_result_mode =
+R"doc(Selects which of the physically valid charge distributions are
+returned. In `LOWEST_K` and `GROUND_STATE_ONLY` mode, only the
+currently best charge distributions are kept while the charge space is
+unfolded, which bounds the memory consumption by the number of
+selected charge distributions.)doc";
+
 static const char *mkd_doc_fiction_clustercomplete_params_simulation_parameters = R"doc(Physical simulation parameters.)doc";
 
 static const char *mkd_doc_fiction_clustercomplete_params_validity_witness_partitioning_max_cluster_size_gss =
@@ -3469,6 +3544,51 @@ Returns:
 
 )doc";
 
+static const char *mkd_doc_fiction_compact_population_stability_information =
+R"doc(Compact counterpart of `population_stability_information`, which does
+not depend on the layout type. Instead of maps keyed by the transition
+type, it stores the minimum electrostatic potential and the critical
+SiDB of each transition type in arrays indexed by the underlying value
+of `transition_type`. The critical SiDBs are given as indices into the
+SiDB order of the charge distribution surface, i.e., into the
+ascending order of the SiDB cells. The distances corresponding to the
+potentials are not computed; they can be obtained via
+`potential_to_distance_conversion` if needed.)doc";
+
+static const char *mkd_doc_fiction_compact_population_stability_information_critical_sidb_indices =
+R"doc(Index of the SiDB that is closest to each transition type. It is the
+maximum value of `uint64_t` if no SiDB can undergo the transition.)doc";
+
+static const char *mkd_doc_fiction_compact_population_stability_information_minimum_transition_potential =
+R"doc(Returns the minimum electrostatic potential required to conduct any
+charge transition.
+
+Returns:
+    The minimum electrostatic potential (unit: V) over all transition
+    types.
+
+)doc";
+
+static const char *mkd_doc_fiction_compact_population_stability_information_system_energy =
+R"doc(Total electrostatic energy (unit: eV) of the charge distribution.)doc";
+
+static const char *mkd_doc_fiction_compact_population_stability_information_transition_potential =
+R"doc(Returns the minimum electrostatic potential required to conduct the
+given transition type.
+
+Args:
+    type: Transition type.
+
+Returns:
+    The minimum electrostatic potential (unit: V) required for the
+    transition.
+
+)doc";
+
+static const char *mkd_doc_fiction_compact_population_stability_information_transition_potentials =
+R"doc(Minimum electrostatic potential (unit: V) required to conduct each
+transition type. It is infinite if no SiDB can undergo the transition.)doc";
+
 static const char *mkd_doc_fiction_convert_array =
 R"doc(Converts an array of size `N` and type `T` to an array of size `N` and
 type `ElementType` by applying `static_cast` at compile time.
@@ -4157,7 +4277,11 @@ Raises:
                            layout without `LOGIC` cells. Flood fill
                            and contour tracing additionally require at
                            least two sweep dimensions; grid search and
-                           random sampling accept any number.
+                           random sampling accept any number. Also
+                           thrown if the header of the journal file
+                           does not match the sweep.
+    std::ofstream::failure: if the journal file could not be opened or
+                            its cut-off row could not be removed.
 
 )doc";
 
@@ -4222,7 +4346,11 @@ Raises:
                            layout without `LOGIC` cells. Flood fill
                            and contour tracing additionally require at
                            least two sweep dimensions; grid search and
-                           random sampling accept any number.
+                           random sampling accept any number. Also
+                           thrown if the header of the journal file
+                           does not match the sweep.
+    std::ofstream::failure: if the journal file could not be opened or
+                            its cut-off row could not be removed.
 
 )doc";
 
@@ -4285,7 +4413,11 @@ Raises:
                            or if the operational domain sketch is
                            requested without rejecting kinks or on a
                            layout without `LOGIC` cells. Any number of
-                           sweep dimensions is accepted.
+                           sweep dimensions is accepted. Also thrown
+                           if the header of the journal file does not
+                           match the sweep.
+    std::ofstream::failure: if the journal file could not be opened or
+                            its cut-off row could not be removed.
 
 )doc";
 
@@ -4341,7 +4473,11 @@ Raises:
                            or if the operational domain sketch is
                            requested without rejecting kinks or on a
                            layout without `LOGIC` cells. Any number of
-                           sweep dimensions is accepted.
+                           sweep dimensions is accepted. Also thrown
+                           if the header of the journal file does not
+                           match the sweep.
+    std::ofstream::failure: if the journal file could not be opened or
+                            its cut-off row could not be removed.
 
 )doc";
 
@@ -4460,6 +4596,12 @@ static const char *mkd_doc_fiction_critical_temperature_params_max_temperature =
 R"doc(Maximum simulation temperature beyond which no simulation will be
 conducted (~ 126 °C by default) (unit: K).)doc";
 
+static const char *mkd_doc_fiction_critical_temperature_params_number_of_threads =
+R"doc(Number of threads to distribute the input patterns of a gate-based
+simulation over. Defaults to the number of hardware threads, and to
+`1` where that count is not detectable. Values below `1` are treated
+as `1`.)doc";
+
 static const char *mkd_doc_fiction_critical_temperature_params_operational_params =
 R"doc(The parameters used to determine if a layout is `operational` or `non-
 operational`.)doc";
@@ -5024,6 +5166,10 @@ static const char *mkd_doc_fiction_defect_influence_stats_num_non_influencing_de
 R"doc(Number of parameter combinations, for which the layout is not
 influenced.)doc";
 
+static const char *mkd_doc_fiction_defect_influence_stats_num_screened_defect_positions =
+R"doc(Number of defect positions whose influence on the ground state was
+determined without simulating the layout in presence of the defect.)doc";
+
 static const char *mkd_doc_fiction_defect_influence_stats_num_simulator_invocations = R"doc(Number of simulator invocations.)doc";
 
 static const char *mkd_doc_fiction_defect_influence_stats_time_total = R"doc(The total runtime of the defect influence computation.)doc";
@@ -5156,6 +5302,17 @@ R"doc(This struct contains parameters and settings to design SiDB gates.
 Template Args:
     CellType: Cell type.)doc";
 
+static const char *mkd_doc_fiction_design_sidb_gates_params_cache_input_pattern_geometries =
+R"doc(If `true`, *QuickCell* computes the distances and potentials between
+the SiDBs of the skeleton with each input pattern applied and all
+cells within the canvas once, such that the charge distribution
+surfaces of all canvas layouts copy them from the resulting geometry
+caches. The designed gates are the same either way.
+
+Note:
+    This parameter has no effect unless *QuickCell* or its pruning is
+    used.)doc";
+
 static const char *mkd_doc_fiction_design_sidb_gates_params_canvas = R"doc(Canvas spanned by the northwest and southeast cell.)doc";
 
 static const char *mkd_doc_fiction_design_sidb_gates_params_design_mode = R"doc(Gate design mode.)doc";
@@ -5178,14 +5335,51 @@ static const char *mkd_doc_fiction_design_sidb_gates_params_design_sidb_gates_mo
 
 static const char *mkd_doc_fiction_design_sidb_gates_params_number_of_canvas_sidbs = R"doc(Number of SiDBs placed in the canvas to create a working gate.)doc";
 
+static const char *mkd_doc_fiction_design_sidb_gates_params_number_of_threads =
+R"doc(Number of threads to be used for the design process. Values below `1`
+are treated as `1`.)doc";
+
 static const char *mkd_doc_fiction_design_sidb_gates_params_operational_params = R"doc(Parameters for the `is_operational` function.)doc";
 
+static const char *mkd_doc_fiction_design_sidb_gates_params_symmetry =
+R"doc(Exploitation of the mirror symmetry of the design problem. A design
+problem is mirror-symmetric if the skeleton including its atomic
+defects, the canvas, and the BDL wires are symmetric under mirroring
+at the vertical axis through the center of the canvas, and the
+specification is invariant under the resulting permutation of inputs
+and outputs, as is, e.g., an AND, OR, XOR, or MAJ gate whose input
+wires mirror each other. The mirror image of an operational gate is
+then operational as well, so that only canonical canvas layouts need
+to be evaluated, which roughly halves the search space.
+
+Note:
+    This parameter has no effect on the random gate design.)doc";
+
+static const char *mkd_doc_fiction_design_sidb_gates_params_symmetry_reduction =
+R"doc(Selector for the exploitation of the mirror symmetry of a design
+problem.)doc";
+
+static const char *mkd_doc_fiction_design_sidb_gates_params_symmetry_reduction_CANONICAL_AND_MIRRORED =
+R"doc(Like `CANONICAL_ONLY`, but the mirror images of the designs found are
+returned as well.)doc";
+
+static const char *mkd_doc_fiction_design_sidb_gates_params_symmetry_reduction_CANONICAL_ONLY =
+R"doc(If the design problem is mirror-symmetric, only one canvas layout of
+each pair of mirror images is evaluated, and only the designs found
+among them are returned.)doc";
+
+static const char *mkd_doc_fiction_design_sidb_gates_params_symmetry_reduction_NONE =
+R"doc(All canvas layouts are evaluated.)doc";
+
 static const char *mkd_doc_fiction_design_sidb_gates_params_termination_cond =
 R"doc(The design process is terminated after a valid SiDB gate design is
 found.
 
 Note:
-    This parameter has no effect unless the gate design is exhaustive.)doc";
+    This parameter has no effect unless the gate design is exhaustive.
+    The canvas layouts are evaluated in a random order, so which
+    designs are returned with `AFTER_FIRST_SOLUTION` may differ
+    between runs.)doc";
 
 static const char *mkd_doc_fiction_design_sidb_gates_params_termination_condition =
 R"doc(Selector for the different termination conditions for the SiDB gate
@@ -5201,6 +5395,10 @@ within the canvas are enumerated.)doc";
 
 static const char *mkd_doc_fiction_design_sidb_gates_stats = R"doc(Statistics for the design of SiDB gates.)doc";
 
+static const char *mkd_doc_fiction_design_sidb_gates_stats_mirror_symmetric =
+R"doc(Whether the design problem is mirror-symmetric. This is only
+determined if symmetry reduction is enabled.)doc";
+
 static const char *mkd_doc_fiction_design_sidb_gates_stats_number_of_layouts = R"doc(The number of all possible layouts.)doc";
 
 static const char *mkd_doc_fiction_design_sidb_gates_stats_number_of_layouts_after_first_pruning =
@@ -5215,6 +5413,10 @@ static const char *mkd_doc_fiction_design_sidb_gates_stats_number_of_layouts_aft
 R"doc(The number of layouts that remain after third pruning (discarding
 layouts with unstable I/O signals).)doc";
 
+static const char *mkd_doc_fiction_design_sidb_gates_stats_number_of_skipped_mirror_images =
+R"doc(The number of layouts that were not evaluated since they are the
+mirror image of an evaluated layout.)doc";
+
 static const char *mkd_doc_fiction_design_sidb_gates_stats_pruning_total = R"doc(The runtime of the pruning process.)doc";
 
 static const char *mkd_doc_fiction_design_sidb_gates_stats_report =
@@ -5513,6 +5715,10 @@ based on their corresponding positions and types. Optionally, it
 performs post-layout optimization and sets the layout name if certain
 conditions are met.
 
+If `params` provides a `number_of_threads` greater than `1`, the gates
+of all tiles are set up concurrently before they are assigned to the
+cell-level layout.
+
 Args:
     params: Parameters used for the SiDB on-the-fly gate library.
     defect_surface: Optional defect surface.
@@ -5545,6 +5751,32 @@ Returns:
 
 )doc";
 
+static const char *mkd_doc_fiction_detail_apply_gate_library_impl_set_up_gates_concurrently =
+R"doc(Sets up the gates of all tiles of the gate-level layout concurrently
+on `params.number_of_threads` threads. The tiles only share the
+read-only gate-level layout and defect surface, so their gates can be
+designed independently. If the parameters provide a `design_cache` but
+none is set, a temporary one is shared by all tiles such that
+identical design problems are only solved once.
+
+As soon as the set-up of a tile throws, all tiles that have not been
+started yet are skipped, and the exception is rethrown once the
+running tiles have finished. If several tiles throw, the first
+exception is passed on.
+
+Args:
+    params: Parameters used for the gate library.
+    defect_surface: Optional defect surface.
+
+Template Args:
+    Params: Type of the parameters used for the gate library.
+
+Returns:
+    The non-constant nodes of the gate-level layout paired with their
+    gates, in the order of `foreach_node`.
+
+)doc";
+
 static const char *mkd_doc_fiction_detail_calculate_offset_matrix =
 R"doc(Calculate an offset matrix based on a to-delete list in a
 `wiring_reduction_layout`.
@@ -6533,6 +6765,37 @@ Returns:
 
 )doc";
 
+static const char *mkd_doc_fiction_detail_defect_influence_impl_does_defect_influence_groundstate_2 =
+R"doc(This function checks if the defect at position `defect_pos` changes
+the given ground states of the layout.
+
+Args:
+    lyt_without_defect: Layout without the defect.
+    ground_states: Ground states of the layout without the defect.
+    defect_pos: Position of the defect.
+
+Returns:
+    The influence status of the defect.
+
+)doc";
+
+static const char *mkd_doc_fiction_detail_defect_influence_impl_does_defect_influence_reference_groundstates =
+R"doc(This function checks if the defect at position `defect_cell` changes
+the ground state of any input pattern. Since the electrostatic
+potential of the defect superposes with the local potentials of the
+defect-free layout, the defect is influential without any simulation
+if it makes positive charges possible or renders a defect-free ground
+state physically invalid. Otherwise, the layout is simulated with the
+defect and compared to the stored defect-free ground states.
+
+Args:
+    defect_cell: Position of the defect.
+
+Returns:
+    The influence status of the defect.
+
+)doc";
+
 static const char *mkd_doc_fiction_detail_defect_influence_impl_find_last_non_influential_defect_position_moving_right =
 R"doc(This function identifies the most recent non-influential defect
 position while traversing from left to right towards the SiDB layout.
@@ -6580,6 +6843,33 @@ Returns:
 
 )doc";
 
+static const char *mkd_doc_fiction_detail_defect_influence_impl_ground_state_reference =
+R"doc(The defect-free ground states of an input pattern, which are simulated
+once instead of once per defect position.)doc";
+
+static const char *mkd_doc_fiction_detail_defect_influence_impl_ground_state_reference_all_negative =
+R"doc(The layout with all SiDBs negatively charged, i.e., with maximal local
+electrostatic potentials.)doc";
+
+static const char *mkd_doc_fiction_detail_defect_influence_impl_ground_state_reference_ground_states =
+R"doc(Ground states of the layout without the defect.)doc";
+
+static const char *mkd_doc_fiction_detail_defect_influence_impl_ground_state_reference_layout =
+R"doc(Layout of the input pattern without the defect.)doc";
+
+static const char *mkd_doc_fiction_detail_defect_influence_impl_ground_state_references =
+R"doc(Defect-free references of all input patterns. It is only filled if the
+influence is defined as a change of the ground state.)doc";
+
+static const char *mkd_doc_fiction_detail_defect_influence_impl_ground_state_simulation_params =
+R"doc(Parameters of the *QuickExact* simulations that determine the ground
+states.
+
+Returns:
+    *QuickExact* parameters that only return the ground states.
+
+)doc";
+
 static const char *mkd_doc_fiction_detail_defect_influence_impl_influence_domain = R"doc(The defect influence domain of the layout.)doc";
 
 static const char *mkd_doc_fiction_detail_defect_influence_impl_is_defect_influential =
@@ -6617,6 +6907,10 @@ Returns:
 
 static const char *mkd_doc_fiction_detail_defect_influence_impl_num_evaluated_defect_positions = R"doc(Number of evaluated defect positions.)doc";
 
+static const char *mkd_doc_fiction_detail_defect_influence_impl_num_screened_defect_positions =
+R"doc(Number of defect positions whose influence on the ground state was
+determined without simulation.)doc";
+
 static const char *mkd_doc_fiction_detail_defect_influence_impl_num_simulator_invocations = R"doc(Number of simulator invocations.)doc";
 
 static const char *mkd_doc_fiction_detail_defect_influence_impl_num_threads =
@@ -6692,6 +6986,16 @@ static const char *mkd_doc_fiction_detail_defect_influence_impl_se_bb_layout = R
 
 static const char *mkd_doc_fiction_detail_defect_influence_impl_se_cell = R"doc(South-east cell.)doc";
 
+static const char *mkd_doc_fiction_detail_defect_influence_impl_simulate_ground_state_references =
+R"doc(Simulates the defect-free ground states of all input patterns if the
+influence is defined as a change of the ground state. Otherwise, no
+reference is stored.
+
+Args:
+    spec: The optional truth table to be used for the simulation.
+
+)doc";
+
 static const char *mkd_doc_fiction_detail_defect_influence_impl_stats = R"doc(The statistics of the defect influence domain computation.)doc";
 
 static const char *mkd_doc_fiction_detail_delete_virtual_pis_impl = R"doc()doc";
@@ -6746,22 +7050,63 @@ Template Args:
 
 static const char *mkd_doc_fiction_detail_design_sidb_gates_impl = R"doc()doc";
 
-static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_all_canvas_layouts = R"doc(All Canvas SiDB layout (without I/O pins).)doc";
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_add_canvas_sidbs =
+R"doc(This function adds SiDBs (given by indices) to a copy of the skeleton
+layout. Cells that are already occupied by the skeleton or by an
+atomic defect are skipped.
 
-static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_all_sidbs_in_canvas = R"doc(All cells within the canvas.)doc";
+Args:
+    lyt: Copy of the skeleton layout to which the SiDBs are added.
+    cell_indices: A vector of indices of cells to be added to the
+                  layout.
+    added_cells: Buffer that is overwritten with the cells that were
+                 added.
 
-static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_design_canvas_layout =
-R"doc(This function designs canvas SiDB layouts based on given indices.
+)doc";
+
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_add_canvas_sidbs_2 =
+R"doc(This function adds the given canvas SiDBs to copies of the input
+pattern skeletons.
 
 Args:
-    cell_indices: A vector of indices of cells to be added to the
-                  skeleton layout.
+    lyts: Copies of the input pattern skeletons to which the SiDBs are
+          added.
+    added_cells: Cells that `add_canvas_sidbs` added to the copy of
+                 the skeleton layout.
+
+)doc";
+
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_add_mirror_images =
+R"doc(Appends the mirror image of each given design that is not
+mirror-symmetric itself, if requested via
+`symmetry_reduction::CANONICAL_AND_MIRRORED` and the design problem is
+mirror-symmetric.
+
+Args:
+    designs: Designs found among the canonical canvas layouts.
+
+)doc";
+
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_all_sidbs_in_canvas = R"doc(All cells within the canvas.)doc";
+
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_canvas_mirror_indices =
+R"doc(Index of the mirror image of each cell within the canvas if symmetry
+reduction is enabled and the design problem is mirror-symmetric, and
+`std::nullopt` otherwise.)doc";
+
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_clone_input_pattern_skeletons =
+R"doc(Creates independent copies of the input pattern skeletons.
 
 Returns:
-    An SiDB cell-level layout consisting of canvas SidBs.
+    A copy of each input pattern skeleton, indexed by input pattern.
 
 )doc";
 
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_combinations_per_task =
+R"doc(Number of consecutive combinations that form one task of the canvas
+enumeration. Each task unranks its first combination and advances to
+the following ones in place.)doc";
+
 static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_design_sidb_gates_impl =
 R"doc(This constructor initializes an instance of the *SiDB Gate Designer*
 implementation with the provided skeleton layout and configuration
@@ -6776,19 +7121,141 @@ Args:
 
 )doc";
 
-static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_determine_all_possible_canvas_layouts =
-R"doc(This function calculates all combinations of distributing a given
-number of SiDBs across a specified number of positions in the canvas.
-Each combination is then used to create a gate layout candidate.
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_determine_canvas_mirror_indices =
+R"doc(Determines whether the design problem is symmetric under mirroring
+at the vertical axis through the center of the canvas. This is the
+case if
+
+- the skeleton with its atomic defects and the canvas are mapped
+onto themselves,
+
+- each input and output BDL wire is mapped onto a wire of the same
+kind such that the charge states encoding a bit are mapped onto the
+ones that encode the same bit,
+
+- the layout of each input pattern is mapped onto the layout of the
+input pattern with the permuted bits, and
+
+- the specification is invariant under the permutation of inputs and
+outputs.
+
+Since the electrostatic model only depends on the distances between
+SiDBs, the mirror image of a canvas layout is then operational if and
+only if the layout itself is.
+
+Returns:
+    The index of the mirror image of each cell within the canvas, or
+    `std::nullopt` if the design problem is not mirror-symmetric.
+
+)doc";
+
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_determine_number_of_canvas_layouts =
+R"doc(Determines the number of canvas layouts, i.e., of combinations of
+distributing the canvas SiDBs on the cells within the canvas that do
+not place any SiDB on an atomic defect of the skeleton.
 
 Returns:
-    A vector containing all possible gate layouts generated from the
-    combinations.
+    The number of canvas layouts.
+
+)doc";
+
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_for_each_canvas_combination =
+R"doc(Enumerates all combinations of distributing the canvas SiDBs on the
+cells within the canvas without storing them. The combinations are
+split into tasks of `combinations_per_task` consecutive ranks, which
+are distributed over the threads with work stealing. The tasks are
+visited in a random order such that an early termination does not
+favor the combinations of lowest rank. Each task works on its own copy
+of the skeleton layout and of the input pattern skeletons, which `fn`
+may modify as long as it restores them before returning. If the design
+problem is mirror-symmetric, `fn` is only called for canonical
+combinations.
+
+Args:
+    fn: Function that is called with each combination of canvas cell
+        indices, the skeleton layout of the current task, the input
+        pattern skeletons of the current task (empty if they were not
+        initialized), and a buffer for the cells it adds. Returning
+        `false` stops the enumeration.
+
+Template Args:
+    Fn: Functor type with signature `bool(const
+        std::vector<std::size_t>&, Lyt&, std::vector<Lyt>&,
+        std::vector<cell<Lyt>>&)`.
 
 )doc";
 
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_initialize_input_pattern_skeletons =
+R"doc(Applies each input pattern to the skeleton and caches the geometry of
+the resulting layouts together with all cells within the canvas. This
+is done once before the canvas layouts are evaluated.)doc";
+
 static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_input_bdl_wires = R"doc(Input BDL wires.)doc";
 
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_input_pattern_geometries =
+R"doc(Geometry caches of the input pattern skeletons, indexed by input
+pattern. Each of them covers all cells within the canvas in addition
+to the SiDBs of its skeleton. The charge distribution surfaces of all
+canvas layouts thus copy their distance and potential matrices from
+these caches instead of recomputing the interactions between the
+skeleton SiDBs.)doc";
+
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_input_pattern_skeletons =
+R"doc(The skeleton with each input pattern applied, indexed by input
+pattern. Together with `input_pattern_geometries`, it forms the
+context that *QuickCell* shares between all canvas layouts.)doc";
+
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_is_canonical_combination =
+R"doc(Checks whether the given combination of canvas cells is canonical,
+i.e., whether it does not succeed its mirror image in lexicographical
+order. If the design problem is not mirror-symmetric, every
+combination is canonical.
+
+Args:
+    combination: Ascending indices of the canvas cells.
+    mirrored_combination: Buffer that is overwritten with the
+                          ascending indices of the mirror image.
+
+Returns:
+    `true` iff `combination` is canonical.
+
+)doc";
+
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_is_placed_on_defect =
+R"doc(Checks whether any of the given canvas cells is occupied by an atomic
+defect of the skeleton.
+
+Args:
+    cell_indices: Indices of the canvas cells.
+
+Returns:
+    `true` iff any of the cells is empty in the skeleton and occupied
+    by an atomic defect.
+
+)doc";
+
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_multiply_modulo =
+R"doc(Computes `(a * b) mod n` without overflow for `a, b < n` by doubling
+and adding.
+
+Args:
+    a: First factor.
+    b: Second factor.
+    n: Modulus.
+
+Returns:
+    `(a * b) mod n`.
+
+)doc";
+
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_number_of_canvas_combinations =
+R"doc(Number of combinations of distributing the canvas SiDBs on the cells
+within the canvas.)doc";
+
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_number_of_canvas_layouts =
+R"doc(Number of canvas layouts, i.e., of combinations that do not place any
+canvas SiDB on an atomic defect.)doc";
+
 static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_number_of_discarded_layouts_at_first_pruning = R"doc(Number of discarded layouts at first pruning.)doc";
 
 static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_number_of_discarded_layouts_at_second_pruning = R"doc(Number of discarded layouts at second pruning.)doc";
@@ -6805,6 +7272,16 @@ static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_output_bdl_wire
 
 static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_params = R"doc(Parameters for the *SiDB Gate Designer*.)doc";
 
+static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_remove_canvas_sidbs =
+R"doc(This function removes the SiDBs that `add_canvas_sidbs` added, which
+restores the skeleton layout.
+
+Args:
+    lyt: Layout from which the SiDBs are removed.
+    added_cells: Cells that were added.
+
+)doc";
+
 static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_run_automatic_exhaustive_gate_designer =
 R"doc(Design gates by using the *Automatic Exhaustive Gate Designer*. This
 algorithm was proposed in \"Minimal Design of SiDB Gates: An Optimal
@@ -6859,20 +7336,6 @@ R"doc(The skeleton layout serves as a starting layout to which SiDBs are
 added to create unique SiDB layouts and, if possible, working gates.
 It defines input and output wires.)doc";
 
-static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_skeleton_layout_with_canvas_sidbs =
-R"doc(This function adds SiDBs (given by indices) to the skeleton layout
-that is returned afterwards.
-
-Args:
-    cell_indices: A vector of indices of cells to be added to the
-                  skeleton layout.
-
-Returns:
-    A copy of the original layout (`skeleton_layout`) with SiDB cells
-    added at specified indices.
-
-)doc";
-
 static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_stats = R"doc(The statistics of the gate design.)doc";
 
 static const char *mkd_doc_fiction_detail_design_sidb_gates_impl_truth_table = R"doc(Truth table of the given gate.)doc";
@@ -7091,6 +7554,22 @@ robustness computation parameters.
 
 )doc";
 
+static const char *mkd_doc_fiction_detail_displacement_robustness_domain_impl_displaced_sidb_layout =
+R"doc(This function generates the SiDB layout with displacements that has
+the given rank among all combinations of the possible displacements of
+each SiDB. Layouts in which two or more SiDBs would be on the same
+spot due to displacement are discarded.
+
+Args:
+    rank: The rank of the displacement combination in the order of
+          `cartesian_combinations`.
+
+Returns:
+    The SiDB layout with displacements if it is valid, `std::nullopt`
+    otherwise.
+
+)doc";
+
 static const char *mkd_doc_fiction_detail_displacement_robustness_domain_impl_displacement_robustness_domain_impl =
 R"doc(Standard constructor. Initializes the layout, the truth table, the
 parameters, and the statistics.
@@ -7105,16 +7584,6 @@ Args:
 
 )doc";
 
-static const char *mkd_doc_fiction_detail_displacement_robustness_domain_impl_generate_valid_displaced_sidb_layouts =
-R"doc(This function generates all SiDB layouts with displacements based on
-the original layout. It filters out layouts where two or more SiDBs
-would be on the same spot due to displacement.
-
-Returns:
-    A vector containing all valid SiDB layouts with displacements.
-
-)doc";
-
 static const char *mkd_doc_fiction_detail_displacement_robustness_domain_impl_generator =
 R"doc(Mersenne Twister random number generator. Generates high-quality
 pseudo-random numbers using a random seed from 'rd'.)doc";
@@ -9043,6 +9512,25 @@ Args:
 
 )doc";
 
+static const char *mkd_doc_fiction_detail_ground_state_population_stability =
+R"doc(Determines the population stability of the ground state of the given
+layout. Only the ground state is kept during the exact simulation, and
+no distances are computed.
+
+Args:
+    lyt: Layout to simulate.
+    params: Simulation parameters.
+
+Template Args:
+    Lyt: SiDB cell-level layout type.
+
+Returns:
+    The compact population stability information of the ground state,
+    or `std::nullopt` if the layout has no physically valid charge
+    distribution.
+
+)doc";
+
 static const char *mkd_doc_fiction_detail_ground_state_space_impl = R"doc()doc";
 
 static const char *mkd_doc_fiction_detail_ground_state_space_impl_add_pot_projection =
@@ -10573,12 +11061,10 @@ Args:
                  status is to be simulated.
 
 Note:
-    The distribution of the work among threads is a simple slice-based
-    approach. If your step points are ordered, consider shuffling the
-    vector first for better load balancing. Otherwise, some threads
-    might finish early if they got assigned a slice with mainly non-
-    operational samples, which are faster to compute due to the early
-    termination condition.
+    The work is distributed with work stealing. Hence, the order of the
+    step points does not affect the load balance, even though non-
+    operational points are usually clustered and faster to compute due
+    to the early termination condition.
 
 )doc";
 
@@ -10746,89 +11232,6 @@ transition.
 Template Args:
     Lyt: SiDB cell-level layout type.)doc";
 
-static const char *mkd_doc_fiction_detail_physical_population_stability_impl_collect_energy_and_charge_index =
-R"doc(Collects the system energy with the corresponding charge index
-information of all physically valid charge distributions of a given
-SiDB layout.
-
-Args:
-    sim_results: The simulation results, including all physically
-                 valid charge distributions.
-
-Returns:
-    A vector of energy_and_charge_index pairs, where each pair
-    consists of a double value representing the system energy and a
-    uint64_t representing the unique charge index. The vector is
-    sorted in ascending order of the energy values.
-
-)doc";
-
-static const char *mkd_doc_fiction_detail_physical_population_stability_impl_energy_and_charge_index =
-R"doc(This struct represents the electrostatic energy and charge index of a
-charge distribution.)doc";
-
-static const char *mkd_doc_fiction_detail_physical_population_stability_impl_energy_and_charge_index_charge_index = R"doc(Charge index of the charge distribution.)doc";
-
-static const char *mkd_doc_fiction_detail_physical_population_stability_impl_energy_and_charge_index_energy = R"doc(Electrostatic energy of the charge distribution (unit: eV).)doc";
-
-static const char *mkd_doc_fiction_detail_physical_population_stability_impl_handle_negative_charges =
-R"doc(This function checks if the absolute difference between the given
-local potential and µ- is smaller than the current minimum potential
-difference to transition for a negatively charged SiDB. If `true`, it
-updates the population stability information with the new minimum
-difference and critical cell.
-
-Args:
-    local_potential: The local potential associated with the cell.
-    c: The cell for which the charge state is being considered (SiDB
-       is negatively charged).
-    pop_stability_information: The current population stability
-                               information.
-
-Returns:
-    An updated population stability information with potential
-    transition details.
-
-)doc";
-
-static const char *mkd_doc_fiction_detail_physical_population_stability_impl_handle_neutral_charges =
-R"doc(This function checks if the absolute difference between the given
-local potential and µ- or µ+ is smaller than the current minimum
-potential difference. If `true`, it updates the population stability
-information with the new minimum difference and critical cell.
-
-Args:
-    local_potential: The local potential associated with the cell.
-    c: The cell for which the charge state is being considered (SiDB
-       is neutrally charged).
-    pop_stability_information: The current population stability
-                               information.
-
-Returns:
-    An updated population stability information with potential
-    transition details.
-
-)doc";
-
-static const char *mkd_doc_fiction_detail_physical_population_stability_impl_handle_positive_charges =
-R"doc(This function checks if the absolute difference between the given
-local potential and µ+ is smaller than the current minimum potential
-difference. If true`, it updates the population stability information
-with the new minimum difference and critical cell.
-
-Args:
-    local_potential: The local potential associated with the cell.
-    c: The cell for which the charge state is being considered (SiDB
-       is positively charged).
-    pop_stability_information: The current population stability
-                               information.
-
-Returns:
-    An updated population stability information with potential
-    transition details.
-
-)doc";
-
 static const char *mkd_doc_fiction_detail_physical_population_stability_impl_layout = R"doc(Layout to analyze.)doc";
 
 static const char *mkd_doc_fiction_detail_physical_population_stability_impl_params = R"doc(Parameters required to simulate the population stability.)doc";
@@ -11690,7 +12093,8 @@ left.)doc";
 
 static const char *mkd_doc_fiction_detail_sweep_parameter_to_string =
 R"doc(Converts a sweep parameter to a string representation. This is used to
-write the parameter name to the CSV file.
+write the parameter name to CSV files, i.e., to written operational
+domains and to operational domain journals.
 
 Args:
     param: The sweep parameter to be converted.
@@ -18101,6 +18505,17 @@ Raises:
 
 static const char *mkd_doc_fiction_is_operational_params = R"doc(Parameters for the `is_operational` algorithm.)doc";
 
+static const char *mkd_doc_fiction_is_operational_params_early_termination =
+R"doc(If `true` and *QuickExact* is used, the charge distributions are
+enumerated by branch and bound, and the simulation of an input pattern
+is aborted as soon as a charge distribution that is proven to be a
+ground state does not encode the expected output (or shows kinks if
+they are rejected). Since most candidates are non-operational during
+design space exploration, this avoids paying for a full simulation per
+rejection. The operational status is not affected, but for layouts
+whose degenerate ground states fail for different reasons, the
+reported reason of non-operationality might differ.)doc";
+
 static const char *mkd_doc_fiction_is_operational_params_input_bdl_iterator_params = R"doc(Parameters for the BDL input iterator.)doc";
 
 static const char *mkd_doc_fiction_is_operational_params_op_condition =
@@ -18164,6 +18579,14 @@ static const char *mkd_doc_fiction_is_operational_params_operational_condition_T
 R"doc(Even if the I/O pins show kinks, the layout is still considered as
 operational.)doc";
 
+static const char *mkd_doc_fiction_is_operational_params_precision =
+R"doc(Floating-point precision of the local potential updates in the
+filtering steps and in *QuickSim*. With `potential_precision::MIXED`,
+a single-precision copy of the potential matrix is read during the
+enumeration, and each charge distribution that appears physically
+valid is confirmed in double precision before its energy is used. The
+exact simulation engines are not affected.)doc";
+
 static const char *mkd_doc_fiction_is_operational_params_sim_engine =
 R"doc(The simulation engine to be used for the operational domain
 computation.)doc";
@@ -18176,6 +18599,13 @@ static const char *mkd_doc_fiction_is_operational_params_strategy_to_analyze_ope
 R"doc(Strategy to determine whether a layout is operational or non-
 operational.)doc";
 
+static const char *mkd_doc_fiction_is_operational_params_warm_start_iteration_steps =
+R"doc(Number of *QuickSim* iterations that are conducted if the simulation
+is warm-started from a seed that is still physically valid (see
+`detail::is_operational_impl::enable_warm_start`). Since such a seed
+is a good candidate for the ground state, fewer iterations than the
+500 of a simulation from scratch suffice to confirm or improve it.)doc";
+
 static const char *mkd_doc_fiction_is_positively_charged_defect =
 R"doc(Checks whether the given defect has a positive charge value assigned
 to it. This function is irrespective of the associated defect type.
@@ -18869,6 +19299,27 @@ Template Args:
 
 )doc";
 
+static const char *mkd_doc_fiction_next_combination_of_distributing_k_entities_on_n_positions =
+R"doc(This function advances a combination of distributing k entities onto n
+positions to its successor in the lexicographic order of
+`determine_all_combinations_of_distributing_k_entities_on_n_positions`.
+Together with
+`unrank_combination_of_distributing_k_entities_on_n_positions`, it
+allows a contiguous range of ranks to be enumerated in a single
+buffer.
+
+Args:
+    combination: The ascending positions of the k entities, which are
+                 replaced by those of the successor.
+    n: The number of positions available for distribution.
+
+Returns:
+    `true` if `combination` had a successor, `false` if it was the
+    last combination. In the latter case, `combination` is left
+    unchanged.
+
+)doc";
+
 static const char *mkd_doc_fiction_normalize_layout_coordinates =
 R"doc(A new layout is constructed and returned that is equivalent to the
 given cell-level layout. However, its coordinates are normalized,
@@ -18923,6 +19374,22 @@ Returns:
 
 )doc";
 
+static const char *mkd_doc_fiction_number_of_cartesian_combinations =
+R"doc(This function counts the combinations that `cartesian_combinations`
+generates for the given sets, without generating them.
+
+Args:
+    sets: The sets whose Cartesian product is counted.
+
+Template Args:
+    VectorDataType: The type of elements in the vectors.
+
+Returns:
+    The product of the sizes of the sets. Saturates at the maximum
+    value of `uint64_t`.
+
+)doc";
+
 static const char *mkd_doc_fiction_obstruction_layout =
 R"doc(A layout type to layer on top of any coordinate layout. It implements
 a unified obstruction interface that determines whether a coordinate
@@ -19396,6 +19863,80 @@ defined as the set of all parameter combinations for which the layout
 is operational. Different techniques for performing these sweep are
 implemented.)doc";
 
+static const char *mkd_doc_fiction_operational_domain_adaptive_refinement =
+R"doc(Computes the operational domain of the given SiDB cell-level layout.
+The operational domain is the set of all parameter combinations for
+which the layout is logically operational. Logical operation is
+defined as the layout implementing the given truth table. The input
+BDL pairs of the layout are assumed to be in the same order as the
+inputs of the truth table.
+
+This algorithm uses adaptive refinement to approximate the result of a
+grid search. It first evaluates a coarse grid that samples every
+`initial_spacing`-th step in each sweep dimension. The coarse grid
+partitions the parameter space into cells (quadtree cells in two
+dimensions, octree cells in three), and each cell whose corners
+disagree in their operational status is recursively subdivided down to
+the step size of the sweep, as is each cell that shares a face with a
+subdivided cell whose evaluated points on that face disagree with its
+corners. All grid points inside the remaining cells are assigned the
+status of their corners without being simulated. Therefore, the
+returned operational domain holds a status for every grid point, just
+like the one of a grid search, but for smooth operational domains, the
+number of operational checks scales with the size of the boundary of
+the operational domain rather than with the size of the parameter
+space. Unlike contour tracing, the algorithm finds disconnected
+operational "islands" without a random sampling phase, as long as each
+island contains or touches a coarse grid point. Islands or holes that
+fit entirely within a coarse cell may be missed, which
+`initial_spacing` trades off against the number of simulations.
+
+Note:
+    The result is an approximation of the grid search. Each simulated
+    point has its simulated status, but an inferred point may not. For
+    example, sweeping :math:`\epsilon_r` and :math:`\lambda_{TF}` of
+    the SiQAD AND gate from 1 to 10 in steps of 0.1 with an initial
+    spacing of 8 misclassifies 5 of the 8281 grid points, which form
+    an operational island that lies between the points of the coarse
+    grid.
+
+Each operational check consists of up to :math:`2^n` exact ground
+state simulations, where :math:`n` is the number of inputs of the
+layout. Each exact ground state simulation has exponential complexity
+in of itself. Therefore, the algorithm is only feasible for small
+layouts with few inputs.
+
+Args:
+    lyt: Layout to compute the operational domain for.
+    spec: Expected Boolean function of the layout given as a
+          multi-output truth table.
+    initial_spacing: Number of steps between two neighboring points of
+                     the initial coarse grid in each sweep dimension.
+                     A spacing of `1` evaluates every grid point like
+                     a grid search.
+    params: Operational domain computation parameters.
+    stats: Operational domain computation statistics.
+
+Template Args:
+    Lyt: SiDB cell-level layout type.
+    TT: Truth table type.
+
+Returns:
+    The operational domain of the layout.
+
+Raises:
+    std::invalid_argument: if the given sweep parameters are invalid,
+                           or if the operational domain sketch is
+                           requested without rejecting kinks or on a
+                           layout without `LOGIC` cells. Any number of
+                           sweep dimensions is accepted. Also thrown
+                           if the header of the journal file does not
+                           match the sweep.
+    std::ofstream::failure: if the journal file could not be opened or
+                            its cut-off row could not be removed.
+
+)doc";
+
 static const char *mkd_doc_fiction_operational_domain_add_dimension =
 R"doc(Adds a dimension to sweep over. The first dimension is the x
 dimension, the second dimension is the y dimension, etc.
@@ -19457,7 +19998,11 @@ Raises:
                            layout without `LOGIC` cells. Flood fill
                            and contour tracing additionally require at
                            least two sweep dimensions; grid search and
-                           random sampling accept any number.
+                           random sampling accept any number. Also
+                           thrown if the header of the journal file
+                           does not match the sweep.
+    std::ofstream::failure: if the journal file could not be opened or
+                            its cut-off row could not be removed.
 
 )doc";
 
@@ -19519,7 +20064,11 @@ Raises:
                            layout without `LOGIC` cells. Flood fill
                            and contour tracing additionally require at
                            least two sweep dimensions; grid search and
-                           random sampling accept any number.
+                           random sampling accept any number. Also
+                           thrown if the header of the journal file
+                           does not match the sweep.
+    std::ofstream::failure: if the journal file could not be opened or
+                            its cut-off row could not be removed.
 
 )doc";
 
@@ -19584,7 +20133,11 @@ Raises:
                            or if the operational domain sketch is
                            requested without rejecting kinks or on a
                            layout without `LOGIC` cells. Any number of
-                           sweep dimensions is accepted.
+                           sweep dimensions is accepted. Also thrown
+                           if the header of the journal file does not
+                           match the sweep.
+    std::ofstream::failure: if the journal file could not be opened or
+                            its cut-off row could not be removed.
 
 )doc";
 
@@ -19602,6 +20155,21 @@ static const char *mkd_doc_fiction_operational_domain_params =
 R"doc(Parameters for the operational domain computation. The parameters are
 used across the different operational domain computation algorithms.)doc";
 
+static const char *mkd_doc_fiction_operational_domain_params_journal_file =
+R"doc(Path of a journal file that records the operational domain (or
+critical temperature domain) computation. If empty, no journal is
+kept.
+
+Each parameter point is appended to the journal as soon as its
+evaluation completes, in the CSV format of `write_operational_domain`.
+If the file already exists, the parameter points recorded in it are
+loaded first and not evaluated again, such that an interrupted sweep
+can be resumed by restarting it with the same journal. Only rows whose
+parameter values lie on the grid of the current sweep are loaded, and
+a row that was cut off by the interruption is discarded. The journal
+has to stem from the same layout, truth table, and operational
+parameters; this is not checked.)doc";
+
 static const char *mkd_doc_fiction_operational_domain_params_number_of_threads =
 R"doc(Number of worker threads to distribute the parameter points over.
 Defaults to the number of hardware threads, which is the behavior this
@@ -19621,6 +20189,24 @@ R"doc(The dimensions to sweep over together with their value ranges, ordered
 by priority. The first dimension is the x dimension, the second
 dimension is the y dimension, etc.)doc";
 
+static const char *mkd_doc_fiction_operational_domain_params_warm_start =
+R"doc(If `true`, the simulations of a parameter point are warm-started from
+the ground states of an already evaluated neighboring parameter point.
+Since the ground states rarely change between adjacent parameter
+points, they are usually still physically valid. *QuickSim* then adds
+them to its result and conducts fewer iterations. If
+`is_operational_params::early_termination` is set, *QuickExact* tries
+them first in its branch-and-bound enumeration, such that their energy
+bounds the search from the start; the operational status is the same
+as without warm-starting. The other simulation engines are not
+affected.
+
+Warm-starting pays off for the algorithms that evaluate neighboring
+parameter points one after another, i.e., flood fill, contour tracing,
+adaptive refinement, and grid search on few threads. The ground states
+of the evaluated parameter points are kept in memory for the duration
+of the computation.)doc";
+
 static const char *mkd_doc_fiction_operational_domain_random_sampling =
 R"doc(Computes the operational domain of the given SiDB cell-level layout.
 The operational domain is the set of all parameter combinations for
@@ -19659,7 +20245,11 @@ Raises:
                            or if the operational domain sketch is
                            requested without rejecting kinks or on a
                            layout without `LOGIC` cells. Any number of
-                           sweep dimensions is accepted.
+                           sweep dimensions is accepted. Also thrown
+                           if the header of the journal file does not
+                           match the sweep.
+    std::ofstream::failure: if the journal file could not be opened or
+                            its cut-off row could not be removed.
 
 )doc";
 
@@ -19707,16 +20297,29 @@ used across the different operational domain computation algorithms.)doc";
 
 static const char *mkd_doc_fiction_operational_domain_stats_num_evaluated_parameter_combinations = R"doc(Number of evaluated parameter combinations.)doc";
 
+static const char *mkd_doc_fiction_operational_domain_stats_num_inferred_parameter_combinations =
+R"doc(Number of parameter combinations whose operational status was inferred
+by adaptive refinement from the corners of the enclosing cell instead
+of being evaluated.)doc";
+
 static const char *mkd_doc_fiction_operational_domain_stats_num_non_operational_parameter_combinations =
 R"doc(Number of parameter combinations, for which the layout is non-
 operational.)doc";
 
 static const char *mkd_doc_fiction_operational_domain_stats_num_operational_parameter_combinations = R"doc(Number of parameter combinations, for which the layout is operational.)doc";
 
+static const char *mkd_doc_fiction_operational_domain_stats_num_resumed_parameter_combinations =
+R"doc(Number of parameter combinations that were loaded from the journal of
+a previous run instead of being evaluated.)doc";
+
 static const char *mkd_doc_fiction_operational_domain_stats_num_simulator_invocations = R"doc(Number of simulator invocations.)doc";
 
 static const char *mkd_doc_fiction_operational_domain_stats_num_total_parameter_points = R"doc(Total number of parameter points in the parameter space.)doc";
 
+static const char *mkd_doc_fiction_operational_domain_stats_num_warm_started_parameter_combinations =
+R"doc(Number of evaluated parameter combinations whose simulations were
+warm-started from the ground states of a neighboring parameter point.)doc";
+
 static const char *mkd_doc_fiction_operational_domain_stats_time_total = R"doc(The total runtime of the operational domain computation.)doc";
 
 static const char *mkd_doc_fiction_operational_domain_value_range =
@@ -20086,6 +20689,42 @@ Returns:
 
 )doc";
 
+static const char *mkd_doc_fiction_physical_population_stability_batch =
+R"doc(This function simulates the population stability of many SiDB layouts
+at once, e.g., of all gates of a library or of all candidates of a
+design run. The layouts are distributed over
+`params.number_of_threads` threads. Contrary to
+`physical_population_stability`, the results are stored in the compact
+format, i.e., the critical SiDBs are given as indices and the
+distances corresponding to the potentials are not computed.
+
+Args:
+    layouts: The layouts for which the population stability is
+             simulated.
+    params: Parameters used to simulate the population stability.
+
+Template Args:
+    Lyt: SiDB cell-level layout type.
+
+Returns:
+    For each layout, in the order of `layouts`, the compact population
+    stability information of all its physically valid charge
+    distributions in ascending energy order.
+
+)doc";
+
+static const char *mkd_doc_fiction_physical_population_stability_batch_params =
+R"doc(This struct stores the parameters required to simulate the population
+stability of many layouts.)doc";
+
+static const char *mkd_doc_fiction_physical_population_stability_batch_params_number_of_threads =
+R"doc(Number of threads to distribute the layouts over. Values below `1` are
+treated as `1`.)doc";
+
+static const char *mkd_doc_fiction_physical_population_stability_batch_params_stability_params =
+R"doc(Parameters of each population stability simulation. The precision of
+the distance conversion is ignored, since no distances are computed.)doc";
+
 static const char *mkd_doc_fiction_physical_population_stability_params =
 R"doc(This struct stores the parameters required to simulate the population
 stability.)doc";
@@ -20297,6 +20936,29 @@ R"doc(This map collects all charge transition types, the corresponding
 critical cells and the required electrostatic potential (unit: V)
 required to conduct the transition.)doc";
 
+static const char *mkd_doc_fiction_population_stability_of_charge_distribution =
+R"doc(This function determines the population stability of a single charge
+distribution, i.e., the minimum electrostatic potential required to
+change the charge state of any of its SiDBs per transition type, and
+the SiDBs for which this is the case. The local potentials of the
+SiDBs that can undergo each transition are gathered in one contiguous
+array per transition type, and the minimum distance to the respective
+charge transition level is determined by a vectorized kernel.
+
+Args:
+    cds: Charge distribution whose local potentials are up to date.
+    params: Simulation parameters that define the charge transition
+            levels.
+
+Template Args:
+    Lyt: SiDB cell-level layout type.
+
+Returns:
+    The compact population stability information of the charge
+    distribution.
+
+)doc";
+
 static const char *mkd_doc_fiction_port_direction =
 R"doc(A port direction is a relative (cardinal) direction of a port within a
 tile. Useful, when no exact port locations within a tile are needed.)doc";
@@ -20674,6 +21336,22 @@ Args:
 
 )doc";
 
+static const char *mkd_doc_fiction_potential_precision =
+R"doc(An enumeration of floating-point precisions for the electrostatic
+potential computations.)doc";
+
+static const char *mkd_doc_fiction_potential_precision_DOUBLE =
+R"doc(The chargeless potentials between SiDBs are stored and processed in
+double precision.)doc";
+
+static const char *mkd_doc_fiction_potential_precision_MIXED =
+R"doc(The chargeless potentials between SiDBs are additionally stored in
+single precision, which is read by the updates of the local
+electrostatic potentials. The local potentials, the energy, and all
+accumulations remain in double precision. This halves the memory
+traffic of the potential updates at the cost of a relative error of
+about :math:`10^{-7}` per potential.)doc";
+
 static const char *mkd_doc_fiction_potential_projection =
 R"doc(This struct defines the type of an electrostatic potential projection,
 which pairs a multiset charge configuration with the potential value
@@ -21202,6 +21880,82 @@ Returns:
 
 )doc";
 
+static const char *mkd_doc_fiction_quickexact_2 =
+R"doc(Runs *QuickExact* and reports each ground state to the given callback
+as soon as it is proven to be one. If the callback returns `false`,
+the simulation is aborted and the returned result only contains the
+charge distributions found so far. This allows callers that check a
+property of the ground states (e.g., `is_operational`) to stop the
+simulation on the first ground state that violates it.
+
+With `quickexact_params::charge_enumeration::BRANCH_AND_BOUND`, a
+charge distribution is proven to be a ground state during the search
+as soon as the energy lower bound of the unexplored part of the search
+tree does not fall below its energy by more than
+`constants::ERROR_MARGIN`. All other enumerations can only prove the
+ground states once they are complete, i.e., the ground states are
+reported after the simulation.
+
+Args:
+    lyt: Layout to simulate.
+    params: Parameter required for the simulation.
+    fn: Function that is invoked once with each ground state.
+        Returning `false` aborts the simulation.
+
+Template Args:
+    Lyt: SiDB cell-level layout type.
+    Fn: Functor type that is convertible to
+        `ground_state_callback<Lyt>`.
+
+Returns:
+    Simulation Results.
+
+)doc";
+
+static const char *mkd_doc_fiction_quickexact_batch =
+R"doc(Simulates many layouts that share a common skeleton with *QuickExact*.
+Each layout is given by the SiDBs in which it differs from the
+skeleton, e.g., the canvas SiDBs of a gate design candidate or the
+perturbers of an input pattern.
+
+The distances and chargeless potentials between all SiDBs of the
+skeleton and all added SiDBs are computed once and stored in a shared
+`sidb_geometry_cache`. The charge distribution surface of each layout
+then copies its matrices from this cache instead of computing them
+from scratch. The layouts are simulated in parallel and the results
+are returned in the order of `deltas`.
+
+Template Args:
+    Lyt: SiDB cell-level layout type.
+
+Args:
+    skeleton: Layout that all simulated layouts are derived from.
+    deltas: Modifications of the skeleton, one per layout to simulate.
+    params: Parameters of the batch simulation.
+
+Returns:
+    Simulation results, one per entry of `deltas` in the same order.)doc";
+
+static const char *mkd_doc_fiction_quickexact_batch_params =
+R"doc(This struct stores the parameters for the batch simulation of many
+layouts with *QuickExact*.
+
+Template Args:
+    CellType: Cell type.)doc";
+
+static const char *mkd_doc_fiction_quickexact_batch_params_number_of_threads =
+R"doc(Number of threads to distribute the layouts over. The layouts are
+distributed with work stealing, such that layouts of different
+simulation runtimes are balanced. Defaults to `1` like
+`quickexact_params::number_of_threads`, since the batch simulation is
+frequently invoked by algorithms that already parallelize. Values
+below `1` are treated as `1`.)doc";
+
+static const char *mkd_doc_fiction_quickexact_batch_params_simulation_params =
+R"doc(Parameters of each *QuickExact* simulation. A `geometry_cache` given
+here is ignored, since the batch simulation builds a cache of the
+skeleton and all added SiDBs itself.)doc";
+
 static const char *mkd_doc_fiction_quickexact_params =
 R"doc(This struct stores the parameters for the *QuickExact* algorithm.
 
@@ -21224,6 +21978,44 @@ R"doc(If `ON`, *QuickExact* checks which base number is required for the
 simulation, i.e., whether 3-state is necessary or 2-state simulation
 is sufficient.)doc";
 
+static const char *mkd_doc_fiction_quickexact_params_charge_enumeration =
+R"doc(Strategies to enumerate the charge distributions of the SiDBs that are
+not pre-assigned to be negatively charged.)doc";
+
+static const char *mkd_doc_fiction_quickexact_params_charge_enumeration_BRANCH_AND_BOUND =
+R"doc(The charge states are assigned to one SiDB at a time in a depth-first
+search. Since the charge states of the unassigned SiDBs can only shift
+the local electrostatic potentials within known bounds, a partial
+charge distribution is discarded as soon as one of the SiDBs cannot be
+population stable anymore, no matter which charge states the remaining
+SiDBs take. The search is conducted on a single thread.)doc";
+
+static const char *mkd_doc_fiction_quickexact_params_charge_enumeration_GRAY_CODE =
+R"doc(All charge distributions are traversed in Gray code order, and each of
+them is checked for physical validity.)doc";
+
+static const char *mkd_doc_fiction_quickexact_params_charge_state_hint =
+R"doc(Charge states that the `BRANCH_AND_BOUND` enumeration tries first for
+the given SiDBs, e.g., those of a ground state of the same layout
+under slightly different physical parameters. If the hinted charge
+distribution is still physically valid, it is the first one to be
+found, and its energy bounds the search from the start. The hint only
+affects the order in which the charge distributions are enumerated,
+not the simulation result. It is ignored by the `GRAY_CODE`
+enumeration.)doc";
+
+static const char *mkd_doc_fiction_quickexact_params_enumeration =
+R"doc(Strategy to enumerate the charge distributions. `BRANCH_AND_BOUND`
+pays off for layouts with many SiDBs that are not pre-assigned to be
+negatively charged, where most of the Gray code sequence is not
+population stable.)doc";
+
+static const char *mkd_doc_fiction_quickexact_params_geometry_cache =
+R"doc(Optional geometry cache of the layout to simulate. If provided, the
+distance and potential matrices are copied from the cache instead of
+being computed from scratch, which speeds up repeated simulations of
+the same layout under different physical parameters.)doc";
+
 static const char *mkd_doc_fiction_quickexact_params_global_potential =
 R"doc(Global external electrostatic potential. Value is applied on each cell
 in the layout.)doc";
@@ -21232,6 +22024,33 @@ static const char *mkd_doc_fiction_quickexact_params_local_external_potential =
 R"doc(Local external electrostatic potentials (e.g., locally applied
 electrodes).)doc";
 
+static const char *mkd_doc_fiction_quickexact_params_number_of_threads =
+R"doc(Number of threads to distribute the enumeration of charge distributions
+over. The charge index space is split into contiguous Gray code blocks,
+one per thread, each of which is simulated on its own clone of the
+charge distribution surface. Defaults to `1` since *QuickExact* is
+frequently invoked by algorithms that already parallelize over many
+simulations (e.g., the operational domain computation). Values below
+`1` are treated as `1`.)doc";
+
+static const char *mkd_doc_fiction_quickexact_params_number_of_lowest_energy_states =
+R"doc(Number of charge distributions that are returned in
+`simulation_result_mode::LOWEST_K` mode. Values below `1` are treated
+as `1`.)doc";
+
+static const char *mkd_doc_fiction_quickexact_params_result_format =
+R"doc(Format in which the physically valid charge distributions are stored
+in the simulation result. The compact format drastically reduces the
+memory consumption of layouts with many metastable states.)doc";
+
+static const char *mkd_doc_fiction_quickexact_params_result_mode =
+R"doc(Selects which of the physically valid charge distributions are
+returned. In `LOWEST_K` and `GROUND_STATE_ONLY` mode, only the
+currently best charge distributions are kept during the enumeration,
+which bounds the memory consumption. In `BRANCH_AND_BOUND` mode,
+partial charge distributions whose electrostatic potential energy is
+bound to exceed the energies kept so far are discarded as well.)doc";
+
 static const char *mkd_doc_fiction_quickexact_params_simulation_parameters = R"doc(All parameters for physical SiDB simulations.)doc";
 
 static const char *mkd_doc_fiction_quicksim =
@@ -21273,6 +22092,15 @@ static const char *mkd_doc_fiction_quicksim_params_number_threads =
 R"doc(Number of threads to spawn. By default the number of threads is set to
 the number of available hardware threads.)doc";
 
+static const char *mkd_doc_fiction_quicksim_params_precision =
+R"doc(Floating-point precision of the local potential updates during the
+search. With `potential_precision::MIXED`, the search reads a single-
+precision copy of the potential matrix, and every charge distribution
+it accepts is re-evaluated in double precision before it is added to
+the result. Charge distributions whose validity is decided within the
+single-precision rounding error may thus be missed, which is in line
+with the heuristic nature of *QuickSim*.)doc";
+
 static const char *mkd_doc_fiction_quicksim_params_simulation_parameters = R"doc(Simulation parameters for the simulation of the physical SiDB system.)doc";
 
 static const char *mkd_doc_fiction_quicksim_params_timeout = R"doc(Timeout limit (in ms).)doc";
@@ -21850,6 +22678,29 @@ Returns:
 
 )doc";
 
+static const char *mkd_doc_fiction_sample_distinct_ranks =
+R"doc(This function draws distinct ranks uniformly at random from the
+interval [0, `num_ranks`) via Robert Floyd's sampling algorithm. Its
+memory scales with the number of drawn ranks instead of `num_ranks`,
+which makes it suitable to sample from combinations that are too many
+to be generated, in conjunction with an unranking function such as
+`unrank_combination_of_distributing_k_entities_on_n_positions` or
+`unrank_cartesian_combination`.
+
+Args:
+    num_ranks: The number of ranks to draw from.
+    num_samples: The number of ranks to draw. At most `num_ranks`
+                 ranks are drawn.
+    generator: The random number generator.
+
+Template Args:
+    Generator: Uniform random bit generator type.
+
+Returns:
+    The drawn ranks in ascending order.
+
+)doc";
+
 static const char *mkd_doc_fiction_searchable_priority_queue =
 R"doc(An extension of `std::priority_queue` that allows searching the
 underlying container. The implementation is based on
@@ -22589,6 +23440,173 @@ static const char *mkd_doc_fiction_sidb_defect_type_THREE_BY_ONE = R"doc(A colle
 
 static const char *mkd_doc_fiction_sidb_defect_type_UNKNOWN = R"doc(Unknown defect.)doc";
 
+static const char *mkd_doc_fiction_sidb_gate_design_cache =
+R"doc(A content-addressed cache of SiDB gate designs. Designing a gate with
+`design_sidb_gates` is expensive, yet the tiles of a layout frequently
+share their port configuration, their Boolean function, and the atomic
+defects in their vicinity. Keyed by `sidb_gate_design_cache_key`, this
+cache stores the gate found for each such combination, or the fact
+that none exists, so that every distinct design problem is solved only
+once.
+
+By default, the cache lives in memory only. If constructed with a file
+path, all entries of that file are loaded, and every new entry is
+appended to it. This way, re-running the on-the-fly circuit design on
+the same or a slightly modified wafer reuses all designs of previous
+runs.
+
+The file stores one entry per line: the key, followed by a space and
+either `-` if no gate exists or the gate's rows with each cell written
+as the character of its type and empty cells written as `.`. Lines
+that do not follow this format, e.g., a line that was cut short by an
+interrupted run, are skipped on loading. Since the keys describe their
+design problems exactly, a file can be shared between builds and
+platforms, and a cached gate is only ever returned for the very design
+problem it was designed for.
+
+The cache is safe to be shared by concurrently designed gates.
+Identical design problems that are requested at the same time via
+`find_or_design` are solved only once.
+
+Template Args:
+    GateSizeX: Width of the cached gates.
+    GateSizeY: Height of the cached gates.)doc";
+
+static const char *mkd_doc_fiction_sidb_gate_design_cache_entries = R"doc(Cached designs by their key.)doc";
+
+static const char *mkd_doc_fiction_sidb_gate_design_cache_find =
+R"doc(Looks up the design stored under the given key.
+
+Args:
+    key: Key of the design problem as computed by
+         `sidb_gate_design_cache_key`. It must not contain line
+         breaks.
+
+Returns:
+    `std::nullopt` if the cache holds no entry for `key`. Otherwise,
+    the stored entry, which is itself `std::nullopt` if no gate exists
+    for `key`.
+
+)doc";
+
+static const char *mkd_doc_fiction_sidb_gate_design_cache_find_or_design =
+R"doc(Returns the design stored under the given key. If there is none,
+`design` is invoked to solve the design problem, and its outcome is
+stored. Concurrent requests of the same key are de-duplicated: while
+one thread designs the gate, all other threads that request the same
+key wait for its outcome instead of designing the gate as well.
+
+If `design` throws, the exception is passed on to all threads that
+requested the key, and nothing is stored.
+
+Template Args:
+    Fn: Functor type with signature `std::optional<gate>()`.
+
+Args:
+    key: Key of the design problem as computed by
+         `sidb_gate_design_cache_key`. It must not contain line
+         breaks.
+    design: Function that designs the gate, returning `std::nullopt`
+            if no gate exists.
+
+Returns:
+    The designed gate, or `std::nullopt` if no gate exists.
+
+)doc";
+
+static const char *mkd_doc_fiction_sidb_gate_design_cache_insert =
+R"doc(Stores the outcome of a design problem. If the cache is backed by a
+file, the entry is appended to it. An existing entry for the same key
+is left untouched.
+
+Args:
+    key: Key of the design problem as computed by
+         `sidb_gate_design_cache_key`. It must not contain line
+         breaks.
+    design: The designed gate, or `std::nullopt` if no gate exists.
+
+)doc";
+
+static const char *mkd_doc_fiction_sidb_gate_design_cache_insert_entry =
+R"doc(Adds an entry and, if the cache is backed by a file, appends it to the
+file. An existing entry for the same key is left untouched. The mutex
+must be held by the caller.
+
+Args:
+    key: Key of the design problem.
+    design: The designed gate, or `std::nullopt` if no gate exists.
+
+)doc";
+
+static const char *mkd_doc_fiction_sidb_gate_design_cache_key =
+R"doc(Computes the key under which the design of an SiDB gate is stored in
+an `sidb_gate_design_cache`. The key is a canonical textual
+description of everything the outcome of `design_sidb_gates` depends
+on: the skeleton including its cell types and, if it is an
+`sidb_defect_surface`, the atomic defects clipped into it, the truth
+tables of the specification, and the physical and operational
+parameters of the design process. Two design problems thus share a key
+if and only if they are identical, independent of the order in which
+the cells and defects were added.
+
+Template Args:
+    Lyt: SiDB cell-level layout type of the skeleton.
+    TT: Truth table type.
+
+Args:
+    skeleton: Skeleton of the gate, i.e., its input and output wires
+              and, if any, nearby atomic defects.
+    spec: Expected Boolean function of the gate given as a
+          multi-output truth table.
+    params: Parameters of the gate design process.
+
+Returns:
+    Key of the gate design, which contains no whitespace.
+
+)doc";
+
+static const char *mkd_doc_fiction_sidb_gate_design_cache_mutex =
+R"doc(Mutex that guards the entries, the pending designs, and the file.)doc";
+
+static const char *mkd_doc_fiction_sidb_gate_design_cache_parse_entry =
+R"doc(Parses a line of the cache file and adds its entry. Malformed lines
+are ignored.
+
+Args:
+    line: Line to parse.
+
+)doc";
+
+static const char *mkd_doc_fiction_sidb_gate_design_cache_pending =
+R"doc(Outcomes of the design problems that are currently being solved by
+their key.)doc";
+
+static const char *mkd_doc_fiction_sidb_gate_design_cache_sidb_gate_design_cache =
+R"doc(Standard constructor. Creates an in-memory cache.)doc";
+
+static const char *mkd_doc_fiction_sidb_gate_design_cache_sidb_gate_design_cache_2 =
+R"doc(Constructor. Loads all entries stored in the given file, if it exists,
+and appends every new entry to it.
+
+Args:
+    path: File that persists the cache.
+
+Raises:
+    std::ofstream::failure: If the file cannot be opened for writing.
+
+)doc";
+
+static const char *mkd_doc_fiction_sidb_gate_design_cache_size =
+R"doc(Returns the number of cached design problems.
+
+Returns:
+    Number of entries in the cache.
+
+)doc";
+
+static const char *mkd_doc_fiction_sidb_gate_design_cache_store =
+R"doc(File the new entries are appended to, if any.)doc";
+
 static const char *mkd_doc_fiction_sidb_lattice =
 R"doc(A layout type to layer on top of an SiDB cell-level layout. It
 implements an interface for different lattice orientations of the H-Si
@@ -22601,6 +23619,17 @@ Template Args:
                                 SiDB lattice interface is already
                                 present.)doc";
 
+static const char *mkd_doc_fiction_sidb_layout_delta =
+R"doc(Describes a layout by the SiDBs in which it differs from a skeleton
+layout.
+
+Template Args:
+    CellType: Cell type.)doc";
+
+static const char *mkd_doc_fiction_sidb_layout_delta_added_sidbs = R"doc(SiDBs that are added to the skeleton as `NORMAL` cells.)doc";
+
+static const char *mkd_doc_fiction_sidb_layout_delta_removed_sidbs = R"doc(SiDBs of the skeleton that are removed.)doc";
+
 static const char *mkd_doc_fiction_sidb_nm_distance =
 R"doc(Computes the distance between two SiDB cells in nanometers (unit: nm).
 
@@ -22695,7 +23724,10 @@ R"doc(This function designs an SiDB gate for a given Boolean function at a
 given tile and a given rotation. If atomic defects exist, they are
 incorporated into the design process.
 
-An exception is thrown in case there is no possible gate design.
+An exception is thrown in case there is no possible gate design. If a
+design cache is given in `parameters`, it is consulted first, and the
+outcome of a new design process, including its failure, is stored in
+it.
 
 Args:
     skeleton: Skeleton with atomic defects if available.
@@ -22773,6 +23805,12 @@ static const char *mkd_doc_fiction_sidb_on_the_fly_gate_library_params_complex_g
 
 static const char *mkd_doc_fiction_sidb_on_the_fly_gate_library_params_complex_gate_design_policy_USING_PREDEFINED = R"doc(Use predefined complex gates if possible.)doc";
 
+static const char *mkd_doc_fiction_sidb_on_the_fly_gate_library_params_design_cache =
+R"doc(Optional cache of gate designs. If set, each design problem is looked
+up in the cache before `design_sidb_gates` is invoked, and its outcome
+is stored afterward. Sharing a cache across tiles, layouts, or runs
+avoids designing the same gate repeatedly.)doc";
+
 static const char *mkd_doc_fiction_sidb_on_the_fly_gate_library_params_design_gate_params = R"doc(This struct holds parameters to design SiDB gates.)doc";
 
 static const char *mkd_doc_fiction_sidb_on_the_fly_gate_library_params_influence_radius_charged_defects =
@@ -22780,6 +23818,14 @@ R"doc(This variable specifies the radius in nanometers around the center of
 the hexagon where atomic defects are incorporated into the gate
 design.)doc";
 
+static const char *mkd_doc_fiction_sidb_on_the_fly_gate_library_params_number_of_threads =
+R"doc(Number of tiles that are designed concurrently when the library is
+applied to a gate-level layout. With more than one thread, identical
+design problems of different tiles are only solved once, and the first
+tile that cannot be designed cancels all tiles that have not been
+started yet. Defaults to `1`, i.e., the tiles are designed one after
+another.)doc";
+
 static const char *mkd_doc_fiction_sidb_on_the_fly_gate_library_params_using_predefined_crossing_and_double_wire_if_possible = R"doc(This variable specifies the policy for complex gate design.)doc";
 
 static const char *mkd_doc_fiction_sidb_on_the_fly_gate_library_set_up_gate =
@@ -22866,6 +23912,23 @@ Template Args:
 
 )doc";
 
+static const char *mkd_doc_fiction_sidb_simulation_domain_for_each_in_place =
+R"doc(Applies a callable to all key-value pairs in the container without
+copying it, which makes it the better choice for large domains once
+they are no longer modified, e.g., to write or evaluate a computed
+operational domain. Each internal submap is locked while it is
+visited. Concurrent calls of `add_value` are therefore safe, but the
+added pairs may or may not be visited, and `fn` must not access this
+domain.
+
+Args:
+    fn: Functor to apply to each key-value pair.
+
+Template Args:
+    Fn: Functor type.
+
+)doc";
+
 static const char *mkd_doc_fiction_sidb_simulation_domain_sidb_simulation_domain = R"doc(Constructs a new `sidb_simulation_domain` instance.)doc";
 
 static const char *mkd_doc_fiction_sidb_simulation_domain_size =
@@ -22980,8 +24043,20 @@ static const char *mkd_doc_fiction_sidb_simulation_result_algorithm_name = R"doc
 
 static const char *mkd_doc_fiction_sidb_simulation_result_charge_distributions = R"doc(Charge distributions determined by the algorithm.)doc";
 
+static const char *mkd_doc_fiction_sidb_simulation_result_compact_charge_distribution_context =
+R"doc(Charge distribution surface shared by all compact charge
+distributions. It holds the geometry and the electrostatic potentials
+of the simulated layout, its charge distribution is meaningless.)doc";
+
+static const char *mkd_doc_fiction_sidb_simulation_result_compact_charge_distributions =
+R"doc(Charge distributions determined by the algorithm if it was instructed
+to use `charge_distribution_format::COMPACT`. The SiDB indices refer to
+the SiDB order of `compact_charge_distribution_context`.)doc";
+
 static const char *mkd_doc_fiction_sidb_simulation_result_groundstates =
 R"doc(This function computes the ground state of the charge distributions.
+Compact charge distributions are considered as well, where only the
+ground states among them are materialized.
 
 Returns:
     A vector of charge distributions with the minimal energy.
@@ -22993,6 +24068,32 @@ Note:
 
 )doc";
 
+static const char *mkd_doc_fiction_sidb_simulation_result_materialize =
+R"doc(Restores the full charge distribution surface of the given compact
+charge distribution.
+
+Parameter ``compact_cds``:
+    Compact charge distribution of this simulation result.
+
+Returns:
+    Charge distribution surface with the charge distribution of
+    `compact_cds` assigned.)doc";
+
+static const char *mkd_doc_fiction_sidb_simulation_result_materialize_charge_distributions =
+R"doc(Returns all determined charge distributions as full charge
+distribution surfaces. Compact charge distributions are materialized
+and appended after the full ones.
+
+Returns:
+    A vector of all charge distributions.)doc";
+
+static const char *mkd_doc_fiction_sidb_simulation_result_num_charge_distributions =
+R"doc(Returns the number of determined charge distributions regardless of
+the format they are stored in.
+
+Returns:
+    Number of full and compact charge distributions.)doc";
+
 static const char *mkd_doc_fiction_sidb_simulation_result_sidb_simulation_result =
 R"doc(Default constructor. It only exists to allow for the use of
 `static_assert` statements that restrict the type of `Lyt`.
@@ -23339,6 +24440,23 @@ Returns:
 
 )doc";
 
+static const char *mkd_doc_fiction_simulation_result_mode =
+R"doc(Selects which of the physically valid charge distributions an exact
+SiDB simulation algorithm returns.)doc";
+
+static const char *mkd_doc_fiction_simulation_result_mode_ALL_VALID =
+R"doc(All physically valid charge distributions are returned.)doc";
+
+static const char *mkd_doc_fiction_simulation_result_mode_GROUND_STATE_ONLY =
+R"doc(Only the ground state(s) are returned, i.e., all physically valid
+charge distributions whose electrostatic potential energy equals the
+lowest one.)doc";
+
+static const char *mkd_doc_fiction_simulation_result_mode_LOWEST_K =
+R"doc(Only the physically valid charge distributions with the `k` lowest
+electrostatic potential energies are returned, sorted by increasing
+energy.)doc";
+
 static const char *mkd_doc_fiction_singleton_multiset_conf_to_charge_state =
 R"doc(Function to convert a singleton cluster charge state in its compressed
 form to a charge state.
@@ -24378,6 +25496,27 @@ Template Args:
 
 )doc";
 
+static const char *mkd_doc_fiction_time_to_solution_batch =
+R"doc(This function determines the time-to-solution (TTS) and the accuracy
+(acc) of the *QuickSim* algorithm for each of the given layouts, e.g.,
+for a benchmark suite of layouts read via `read_sqd_layout`. The
+layouts are distributed over `tts_params.number_of_threads` threads,
+while the repetitions of each layout are run sequentially.
+
+Args:
+    layouts: Layouts that are used for the simulation.
+    quicksim_params: Parameters required for the *QuickSim* algorithm.
+    tts_params: Parameters used for the time-to-solution calculation.
+
+Template Args:
+    Lyt: SiDB cell-level layout type.
+
+Returns:
+    The time-to-solution statistics of each layout, in the order of
+    `layouts`.
+
+)doc";
+
 static const char *mkd_doc_fiction_time_to_solution_for_given_simulation_results =
 R"doc(This function calculates the Time-to-Solution (TTS) by analyzing the
 simulation results of a heuristic algorithm in comparison to those of
@@ -24418,6 +25557,15 @@ static const char *mkd_doc_fiction_time_to_solution_params_engine =
 R"doc(Exhaustive simulation algorithm used to simulate the ground state as
 reference.)doc";
 
+static const char *mkd_doc_fiction_time_to_solution_params_number_of_threads =
+R"doc(Number of threads over which the *QuickSim* repetitions of
+`time_to_solution` and the layouts of `time_to_solution_batch` are
+distributed. Concurrent simulations compete for the same cores and
+memory bandwidth, which inflates the measured runtimes. Therefore, it
+defaults to `1`, and *QuickSim*'s own
+`quicksim_params::number_threads` should be reduced accordingly if it
+is increased. Values below `1` are treated as `1`.)doc";
+
 static const char *mkd_doc_fiction_time_to_solution_params_repetitions =
 R"doc(Number of iterations of the heuristic algorithm used to determine the
 simulation accuracy (`repetitions = 100` means that accuracy is
@@ -24449,6 +25597,11 @@ static const char *mkd_doc_fiction_time_to_solution_stats_single_runtime_exact =
 R"doc(Single simulation runtime of the exact ground state simulation
 algorithm.)doc";
 
+static const char *mkd_doc_fiction_time_to_solution_stats_single_runtimes =
+R"doc(Runtime of each *QuickSim* repetition in seconds, in order of the
+repetitions. It makes the runtime distribution available beyond its
+mean, e.g., its median or tail.)doc";
+
 static const char *mkd_doc_fiction_time_to_solution_stats_time_to_solution = R"doc(Time-to-solution in seconds.)doc";
 
 static const char *mkd_doc_fiction_to_sidb_cluster =
@@ -24672,6 +25825,49 @@ Template Args:
 
 static const char *mkd_doc_fiction_unit_cost_functor_unit_cost_functor = R"doc()doc";
 
+static const char *mkd_doc_fiction_unrank_cartesian_combination =
+R"doc(This function determines the combination with the given rank in the
+order of `cartesian_combinations`, in which the last dimension varies
+fastest, without generating any of the other combinations. Thereby,
+the combinations can be enumerated or sampled in memory that does not
+depend on their number.
+
+Args:
+    sets: The sets of the Cartesian product. None of them may be
+          empty.
+    rank: The rank of the combination. Must be smaller than
+          `number_of_cartesian_combinations(sets)`.
+
+Template Args:
+    VectorDataType: The type of elements in the vectors.
+
+Returns:
+    The combination with the given rank, consisting of one element
+    from each dimension.
+
+)doc";
+
+static const char *mkd_doc_fiction_unrank_combination_of_distributing_k_entities_on_n_positions =
+R"doc(This function determines the combination of distributing k entities
+onto n positions that has the given rank in the lexicographic order of
+`determine_all_combinations_of_distributing_k_entities_on_n_positions`,
+without generating any of the other combinations. Since there are
+`binomial_coefficient(n, k)` combinations, this allows enumerating or
+sampling them in memory that does not depend on their number, e.g., by
+distributing their ranks over threads.
+
+Args:
+    rank: The rank of the combination. Must be smaller than
+          `binomial_coefficient(n, k)`.
+    k: The number of entities to distribute.
+    n: The number of positions available for distribution.
+
+Returns:
+    The ascending positions of the k entities in the combination with
+    the given rank.
+
+)doc";
+
 static const char *mkd_doc_fiction_unrecognized_cell_definition_exception = R"doc()doc";
 
 static const char *mkd_doc_fiction_unrecognized_cell_definition_exception_line = R"doc()doc";
@@ -24807,6 +26003,18 @@ Returns:
 
 )doc";
 
+static const char *mkd_doc_fiction_validity_calculation =
+R"doc(An enumeration of modes for the evaluation of the physical validity of
+a given charge distribution.)doc";
+
+static const char *mkd_doc_fiction_validity_calculation_KEEP_OLD_VALIDITY =
+R"doc(The physical validity of a given charge distribution is not updated
+after it is changed.)doc";
+
+static const char *mkd_doc_fiction_validity_calculation_UPDATE_VALIDITY =
+R"doc(The physical validity of a given charge distribution is updated after
+it is changed.)doc";
+
 static const char *mkd_doc_fiction_verify_logic_match =
 R"doc(Checks if a given charge distribution correctly encodes the expected
 logic for a specified input pattern, based on a provided truth table.
@@ -80,6 +80,20 @@ void design_sidb_gates(nanobind::module_& m)
         .value("ALL_COMBINATIONS_ENUMERATED",
                fiction::design_sidb_gates_params<
                    fiction::offset::ucoord_t>::termination_condition::ALL_COMBINATIONS_ENUMERATED);
+    /**
+     * Symmetry reduction selector type.
+     */
+    py::enum_<typename fiction::design_sidb_gates_params<fiction::offset::ucoord_t>::symmetry_reduction>(
+        m, "symmetry_reduction", DOC(fiction_design_sidb_gates_params_symmetry_reduction))
+        .value("NONE", fiction::design_sidb_gates_params<fiction::offset::ucoord_t>::symmetry_reduction::NONE,
+               DOC(fiction_design_sidb_gates_params_symmetry_reduction_NONE))
+        .value("CANONICAL_ONLY",
+               fiction::design_sidb_gates_params<fiction::offset::ucoord_t>::symmetry_reduction::CANONICAL_ONLY,
+               DOC(fiction_design_sidb_gates_params_symmetry_reduction_CANONICAL_ONLY))
+        .value(
+            "CANONICAL_AND_MIRRORED",
+            fiction::design_sidb_gates_params<fiction::offset::ucoord_t>::symmetry_reduction::CANONICAL_AND_MIRRORED,
+            DOC(fiction_design_sidb_gates_params_symmetry_reduction_CANONICAL_AND_MIRRORED));
 
     /**
      * Parameters.
@@ -97,7 +111,14 @@ void design_sidb_gates(nanobind::module_& m)
                 &fiction::design_sidb_gates_params<fiction::offset::ucoord_t>::number_of_canvas_sidbs,
                 DOC(fiction_design_sidb_gates_params_number_of_canvas_sidbs))
         .def_rw("termination_cond", &fiction::design_sidb_gates_params<fiction::offset::ucoord_t>::termination_cond,
-                DOC(fiction_design_sidb_gates_params_termination_condition));
+                DOC(fiction_design_sidb_gates_params_termination_condition))
+        .def_rw("symmetry", &fiction::design_sidb_gates_params<fiction::offset::ucoord_t>::symmetry,
+                DOC(fiction_design_sidb_gates_params_symmetry))
+        .def_rw("cache_input_pattern_geometries",
+                &fiction::design_sidb_gates_params<fiction::offset::ucoord_t>::cache_input_pattern_geometries,
+                DOC(fiction_design_sidb_gates_params_cache_input_pattern_geometries))
+        .def_rw("number_of_threads", &fiction::design_sidb_gates_params<fiction::offset::ucoord_t>::number_of_threads,
+                DOC(fiction_design_sidb_gates_params_number_of_threads));
 
     detail::design_sidb_gates_impl<py_sidb_100_lattice>(m);
     detail::design_sidb_gates_impl<py_sidb_111_lattice>(m);
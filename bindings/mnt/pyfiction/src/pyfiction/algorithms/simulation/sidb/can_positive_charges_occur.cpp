@@ -22,8 +22,11 @@ void can_positive_charges_occur_impl(nanobind::module_& m)
 {
     namespace py = nanobind;  // NOLINT(misc-unused-alias-decls)
 
-    m.def("can_positive_charges_occur", &fiction::can_positive_charges_occur<Lyt>, py::arg("lyt"),
-          py::arg("sim_params"), DOC(fiction_can_positive_charges_occur));
+    m.def(
+        "can_positive_charges_occur",
+        [](const Lyt& lyt, const fiction::sidb_simulation_parameters& sim_params)
+        { return fiction::can_positive_charges_occur<Lyt>(lyt, sim_params); },
+        py::arg("lyt"), py::arg("sim_params"), DOC(fiction_can_positive_charges_occur));
 }
 
 }  // namespace detail
@@ -67,7 +67,11 @@ void clustercomplete(nanobind::module_& m)
         .def_rw("available_threads", &fiction::clustercomplete_params<>::available_threads,
                 DOC(fiction_clustercomplete_params_available_threads))
         .def_rw("report_gss_stats", &fiction::clustercomplete_params<>::report_gss_stats,
-                DOC(fiction_clustercomplete_params_report_gss_stats));
+                DOC(fiction_clustercomplete_params_report_gss_stats))
+        .def_rw("result_mode", &fiction::clustercomplete_params<>::result_mode,
+                DOC(fiction_clustercomplete_params_result_mode))
+        .def_rw("number_of_lowest_energy_states", &fiction::clustercomplete_params<>::number_of_lowest_energy_states,
+                DOC(fiction_clustercomplete_params_number_of_lowest_energy_states));
 
     // NOTE be careful with the order of the following calls! Python will resolve the first matching overload!
 
@@ -95,7 +95,9 @@ void critical_temperature(nanobind::module_& m)
         .def_rw("confidence_level", &fiction::critical_temperature_params::confidence_level,
                 DOC(fiction_critical_temperature_params_confidence_level))
         .def_rw("max_temperature", &fiction::critical_temperature_params::max_temperature,
-                DOC(fiction_critical_temperature_params_max_temperature));
+                DOC(fiction_critical_temperature_params_max_temperature))
+        .def_rw("number_of_threads", &fiction::critical_temperature_params::number_of_threads,
+                DOC(fiction_critical_temperature_params_number_of_threads));
 
     // NOTE be careful with the order of the following calls! Python will resolve the first matching overload!
 
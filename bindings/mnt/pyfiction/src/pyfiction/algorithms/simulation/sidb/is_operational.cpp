@@ -131,7 +131,13 @@ void is_operational(nanobind::module_& m)
                 DOC(fiction_is_operational_params_op_condition))
         .def_rw("strategy_to_analyze_operational_status",
                 &fiction::is_operational_params::strategy_to_analyze_operational_status,
-                DOC(fiction_is_operational_params_strategy_to_analyze_operational_status));
+                DOC(fiction_is_operational_params_strategy_to_analyze_operational_status))
+        .def_rw("precision", &fiction::is_operational_params::precision,
+                DOC(fiction_is_operational_params_precision))
+        .def_rw("early_termination", &fiction::is_operational_params::early_termination,
+                DOC(fiction_is_operational_params_early_termination))
+        .def_rw("warm_start_iteration_steps", &fiction::is_operational_params::warm_start_iteration_steps,
+                DOC(fiction_is_operational_params_warm_start_iteration_steps));
 
     // NOTE be careful with the order of the following calls! Python will resolve the first matching overload!
     detail::is_operational_impl<py_sidb_100_lattice>(m);
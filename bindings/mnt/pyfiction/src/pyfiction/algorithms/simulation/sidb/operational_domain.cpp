@@ -19,6 +19,7 @@
 #include <nanobind/stl/pair.h>           // NOLINT(misc-include-cleaner)
 #include <nanobind/stl/set.h>            // NOLINT(misc-include-cleaner)
 #include <nanobind/stl/shared_ptr.h>     // NOLINT(misc-include-cleaner)
+#include <nanobind/stl/string.h>         // NOLINT(misc-include-cleaner)
 #include <nanobind/stl/tuple.h>          // NOLINT(misc-include-cleaner)
 #include <nanobind/stl/unordered_map.h>  // NOLINT(misc-include-cleaner)
 #include <nanobind/stl/unordered_set.h>  // NOLINT(misc-include-cleaner)
@@ -50,6 +51,11 @@ void operational_domain_impl(nanobind::module_& m)
     m.def("operational_domain_contour_tracing", &fiction::operational_domain_contour_tracing<Lyt, py_tt>,
           py::arg("lyt"), py::arg("spec"), py::arg("samples"), py::arg("params") = fiction::operational_domain_params{},
           py::arg("stats") = nullptr, DOC(fiction_operational_domain_contour_tracing));
+
+    m.def("operational_domain_adaptive_refinement", &fiction::operational_domain_adaptive_refinement<Lyt, py_tt>,
+          py::arg("lyt"), py::arg("spec"), py::arg("initial_spacing"),
+          py::arg("params") = fiction::operational_domain_params{}, py::arg("stats") = nullptr,
+          DOC(fiction_operational_domain_adaptive_refinement));
 }
 
 template <typename Lyt>
@@ -296,7 +302,11 @@ void operational_domain(nanobind::module_& m)
         .def_rw("sweep_dimensions", &fiction::operational_domain_params::sweep_dimensions,
                 DOC(fiction_operational_domain_params_sweep_dimensions))
         .def_rw("number_of_threads", &fiction::operational_domain_params::number_of_threads,
-                DOC(fiction_operational_domain_params_number_of_threads));
+                DOC(fiction_operational_domain_params_number_of_threads))
+        .def_rw("journal_file", &fiction::operational_domain_params::journal_file,
+                DOC(fiction_operational_domain_params_journal_file))
+        .def_rw("warm_start", &fiction::operational_domain_params::warm_start,
+                DOC(fiction_operational_domain_params_warm_start));
 
     py::class_<fiction::operational_domain_stats>(m, "operational_domain_stats", DOC(fiction_operational_domain_stats))
         .def(py::init<>(), "Default constructor.")
@@ -315,6 +325,15 @@ void operational_domain(nanobind::module_& m)
                 DOC(fiction_operational_domain_stats_num_non_operational_parameter_combinations))
         .def_ro("num_total_parameter_points", &fiction::operational_domain_stats::num_total_parameter_points,
                 DOC(fiction_operational_domain_stats_num_total_parameter_points))
+        .def_ro("num_resumed_parameter_combinations",
+                &fiction::operational_domain_stats::num_resumed_parameter_combinations,
+                DOC(fiction_operational_domain_stats_num_resumed_parameter_combinations))
+        .def_ro("num_inferred_parameter_combinations",
+                &fiction::operational_domain_stats::num_inferred_parameter_combinations,
+                DOC(fiction_operational_domain_stats_num_inferred_parameter_combinations))
+        .def_ro("num_warm_started_parameter_combinations",
+                &fiction::operational_domain_stats::num_warm_started_parameter_combinations,
+                DOC(fiction_operational_domain_stats_num_warm_started_parameter_combinations))
 
         ;
 
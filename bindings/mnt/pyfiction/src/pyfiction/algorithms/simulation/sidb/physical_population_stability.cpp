@@ -44,6 +44,11 @@ void physical_population_stability_impl(nanobind::module_& m, const std::string&
           &fiction::physical_population_stability<Lyt>, py::arg("lyt"),
           py::arg("params") = fiction::physical_population_stability_params{},
           DOC(fiction_physical_population_stability));
+
+    m.def(fmt::format("physical_population_stability_batch_{}", lattice).c_str(),
+          &fiction::physical_population_stability_batch<Lyt>, py::arg("layouts"),
+          py::arg("params") = fiction::physical_population_stability_batch_params{},
+          DOC(fiction_physical_population_stability_batch));
 }
 
 }  // namespace detail
@@ -74,6 +79,32 @@ void physical_population_stability(nanobind::module_& m)
                 &fiction::physical_population_stability_params::precision_for_distance_corresponding_to_potential,
                 DOC(fiction_physical_population_stability_params_precision_for_distance_corresponding_to_potential));
 
+    py::class_<fiction::physical_population_stability_batch_params>(
+        m, "physical_population_stability_batch_params", DOC(fiction_physical_population_stability_batch_params))
+        .def(py::init<>(), "Default constructor.")
+        .def_rw("stability_params", &fiction::physical_population_stability_batch_params::stability_params,
+                DOC(fiction_physical_population_stability_batch_params_stability_params))
+        .def_rw("number_of_threads", &fiction::physical_population_stability_batch_params::number_of_threads,
+                DOC(fiction_physical_population_stability_batch_params_number_of_threads));
+
+    /**
+     * Compact results.
+     */
+    py::class_<fiction::compact_population_stability_information>(
+        m, "compact_population_stability_information", DOC(fiction_compact_population_stability_information))
+        .def(py::init<>(), "Default constructor.")
+        .def_rw("transition_potentials", &fiction::compact_population_stability_information::transition_potentials,
+                DOC(fiction_compact_population_stability_information_transition_potentials))
+        .def_rw("critical_sidb_indices", &fiction::compact_population_stability_information::critical_sidb_indices,
+                DOC(fiction_compact_population_stability_information_critical_sidb_indices))
+        .def_rw("system_energy", &fiction::compact_population_stability_information::system_energy,
+                DOC(fiction_compact_population_stability_information_system_energy))
+        .def("transition_potential", &fiction::compact_population_stability_information::transition_potential,
+             py::arg("type"), DOC(fiction_compact_population_stability_information_transition_potential))
+        .def("minimum_transition_potential",
+             &fiction::compact_population_stability_information::minimum_transition_potential,
+             DOC(fiction_compact_population_stability_information_minimum_transition_potential));
+
     // NOTE be careful with the order of the following calls! Python will resolve the first matching overload!
     detail::physical_population_stability_impl<py_sidb_100_lattice>(m, "100");
     detail::physical_population_stability_impl<py_sidb_111_lattice>(m, "111");
@@ -25,6 +25,8 @@ void quickexact_impl(nanobind::module_& m)
 
     m.def("quickexact", &fiction::quickexact<Lyt>, py::arg("lyt"), py::arg("params") = fiction::quickexact_params<>{},
           DOC(fiction_quickexact));
+    m.def("quickexact_batch", &fiction::quickexact_batch<Lyt>, py::arg("skeleton"), py::arg("deltas"),
+          py::arg("params") = fiction::quickexact_batch_params<>{}, DOC(fiction_quickexact_batch));
 }
 
 }  // namespace detail
@@ -40,6 +42,13 @@ void quickexact(nanobind::module_& m)
         .value("OFF", fiction::quickexact_params<>::automatic_base_number_detection::OFF,
                DOC(fiction_quickexact_params_automatic_base_number_detection_OFF));
 
+    py::enum_<fiction::quickexact_params<>::charge_enumeration>(m, "charge_enumeration",
+                                                                DOC(fiction_quickexact_params_charge_enumeration))
+        .value("GRAY_CODE", fiction::quickexact_params<>::charge_enumeration::GRAY_CODE,
+               DOC(fiction_quickexact_params_charge_enumeration_GRAY_CODE))
+        .value("BRANCH_AND_BOUND", fiction::quickexact_params<>::charge_enumeration::BRANCH_AND_BOUND,
+               DOC(fiction_quickexact_params_charge_enumeration_BRANCH_AND_BOUND));
+
     /**
      * QuickExact parameters.
      */
@@ -52,7 +61,37 @@ void quickexact(nanobind::module_& m)
         .def_rw("local_external_potential", &fiction::quickexact_params<>::local_external_potential,
                 DOC(fiction_quickexact_params_local_external_potential))
         .def_rw("global_potential", &fiction::quickexact_params<>::global_potential,
-                DOC(fiction_quickexact_params_global_potential));
+                DOC(fiction_quickexact_params_global_potential))
+        .def_rw("number_of_threads", &fiction::quickexact_params<>::number_of_threads,
+                DOC(fiction_quickexact_params_number_of_threads))
+        .def_rw("result_format", &fiction::quickexact_params<>::result_format,
+                DOC(fiction_quickexact_params_result_format))
+        .def_rw("enumeration", &fiction::quickexact_params<>::enumeration,
+                DOC(fiction_quickexact_params_enumeration))
+        .def_rw("result_mode", &fiction::quickexact_params<>::result_mode, DOC(fiction_quickexact_params_result_mode))
+        .def_rw("number_of_lowest_energy_states", &fiction::quickexact_params<>::number_of_lowest_energy_states,
+                DOC(fiction_quickexact_params_number_of_lowest_energy_states))
+        .def_rw("charge_state_hint", &fiction::quickexact_params<>::charge_state_hint,
+                DOC(fiction_quickexact_params_charge_state_hint));
+
+    /**
+     * SiDB layout delta.
+     */
+    py::class_<fiction::sidb_layout_delta<>>(m, "sidb_layout_delta", DOC(fiction_sidb_layout_delta))
+        .def(py::init<>(), "Default constructor.")
+        .def_rw("added_sidbs", &fiction::sidb_layout_delta<>::added_sidbs, DOC(fiction_sidb_layout_delta_added_sidbs))
+        .def_rw("removed_sidbs", &fiction::sidb_layout_delta<>::removed_sidbs,
+                DOC(fiction_sidb_layout_delta_removed_sidbs));
+
+    /**
+     * QuickExact batch parameters.
+     */
+    py::class_<fiction::quickexact_batch_params<>>(m, "quickexact_batch_params", DOC(fiction_quickexact_batch_params))
+        .def(py::init<>(), "Default constructor.")
+        .def_rw("simulation_params", &fiction::quickexact_batch_params<>::simulation_params,
+                DOC(fiction_quickexact_batch_params_simulation_params))
+        .def_rw("number_of_threads", &fiction::quickexact_batch_params<>::number_of_threads,
+                DOC(fiction_quickexact_batch_params_number_of_threads));
 
     // NOTE be careful with the order of the following calls! Python will resolve the first matching overload!
     detail::quickexact_impl<py_sidb_100_lattice>(m);
@@ -46,6 +46,7 @@ void quicksim(nanobind::module_& m)
         .def_rw("number_threads", &fiction::quicksim_params::number_threads,
                 DOC(fiction_quicksim_params_number_threads))
         .def_rw("timeout", &fiction::quicksim_params::timeout, DOC(fiction_quicksim_params_timeout))
+        .def_rw("precision", &fiction::quicksim_params::precision, DOC(fiction_quicksim_params_precision))
 
         ;
 
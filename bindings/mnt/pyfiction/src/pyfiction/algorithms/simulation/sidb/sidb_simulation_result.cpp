@@ -1,6 +1,7 @@
 #include "pyfiction/documentation.hpp"
 #include "pyfiction/types.hpp"
 
+#include <fiction/algorithms/simulation/sidb/charge_distribution_selection.hpp>
 #include <fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp>
 
 #include <any>
@@ -102,6 +103,11 @@ void sidb_simulation_result_impl(nanobind::module_& m, const std::string& lattic
             DOC(fiction_sidb_simulation_result_additional_simulation_parameters))
         .def("groundstates", &fiction::sidb_simulation_result<Lyt>::groundstates,
              DOC(fiction_sidb_simulation_result_groundstates))
+        .def("num_charge_distributions", &fiction::sidb_simulation_result<Lyt>::num_charge_distributions,
+             DOC(fiction_sidb_simulation_result_num_charge_distributions))
+        .def("materialize_charge_distributions",
+             &fiction::sidb_simulation_result<Lyt>::materialize_charge_distributions,
+             DOC(fiction_sidb_simulation_result_materialize_charge_distributions))
 
         ;
 }
@@ -110,6 +116,20 @@ void sidb_simulation_result_impl(nanobind::module_& m, const std::string& lattic
 
 void sidb_simulation_result(nanobind::module_& m)
 {
+    namespace py = nanobind;  // NOLINT(misc-unused-alias-decls)
+
+    py::enum_<fiction::charge_distribution_format>(m, "charge_distribution_format",
+                                                   DOC(fiction_charge_distribution_format))
+        .value("FULL", fiction::charge_distribution_format::FULL, DOC(fiction_charge_distribution_format_FULL))
+        .value("COMPACT", fiction::charge_distribution_format::COMPACT,
+               DOC(fiction_charge_distribution_format_COMPACT));
+
+    py::enum_<fiction::simulation_result_mode>(m, "simulation_result_mode", DOC(fiction_simulation_result_mode))
+        .value("ALL_VALID", fiction::simulation_result_mode::ALL_VALID, DOC(fiction_simulation_result_mode_ALL_VALID))
+        .value("LOWEST_K", fiction::simulation_result_mode::LOWEST_K, DOC(fiction_simulation_result_mode_LOWEST_K))
+        .value("GROUND_STATE_ONLY", fiction::simulation_result_mode::GROUND_STATE_ONLY,
+               DOC(fiction_simulation_result_mode_GROUND_STATE_ONLY));
+
     // Define simulation result for specific lattices
     detail::sidb_simulation_result_impl<py_sidb_100_lattice>(m, "_100");
     detail::sidb_simulation_result_impl<py_sidb_111_lattice>(m, "_111");
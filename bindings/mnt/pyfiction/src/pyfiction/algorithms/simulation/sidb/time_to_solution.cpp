@@ -36,6 +36,9 @@ void time_to_solution_impl(nanobind::module_& m)
     m.def("time_to_solution_for_given_simulation_results", &fiction::time_to_solution_for_given_simulation_results<Lyt>,
           py::arg("results_exact"), py::arg("results_heuristic"), py::arg("confidence_level") = 0.997,
           py::arg("ps") = nullptr, DOC(fiction_time_to_solution_for_given_simulation_results));
+    m.def("time_to_solution_batch", &fiction::time_to_solution_batch<Lyt>, py::arg("layouts"),
+          py::arg("quicksim_params"), py::arg("tts_params") = fiction::time_to_solution_params{},
+          DOC(fiction_time_to_solution_batch));
 }
 
 }  // namespace detail
@@ -53,7 +56,9 @@ void time_to_solution(nanobind::module_& m)
         .def_rw("repetitions", &fiction::time_to_solution_params::repetitions,
                 DOC(fiction_time_to_solution_params_repetitions))
         .def_rw("confidence_level", &fiction::time_to_solution_params::confidence_level,
-                DOC(fiction_time_to_solution_params_confidence_level));
+                DOC(fiction_time_to_solution_params_confidence_level))
+        .def_rw("number_of_threads", &fiction::time_to_solution_params::number_of_threads,
+                DOC(fiction_time_to_solution_params_number_of_threads));
     /**
      * Statistics.
      */
@@ -76,6 +81,8 @@ void time_to_solution(nanobind::module_& m)
                 DOC(fiction_time_to_solution_stats_mean_single_runtime))
         .def_ro("single_runtime_exact", &fiction::time_to_solution_stats::single_runtime_exact,
                 DOC(fiction_time_to_solution_stats_single_runtime_exact))
+        .def_ro("single_runtimes", &fiction::time_to_solution_stats::single_runtimes,
+                DOC(fiction_time_to_solution_stats_single_runtimes))
         .def_ro("algorithm", &fiction::time_to_solution_stats::algorithm, DOC(fiction_time_to_solution_stats_algorithm))
 
         ;
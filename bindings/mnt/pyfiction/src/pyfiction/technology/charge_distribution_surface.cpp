@@ -69,6 +69,8 @@ void charge_distribution_surface_layout(nanobind::module_& m, const std::string&
         .def("assign_cell_type", &py_cds::assign_cell_type, py::arg("c"), py::arg("ct"))
         .def("assign_physical_parameters", &py_cds::assign_physical_parameters, py::arg("params"))
         .def("get_phys_params", &py_cds::get_simulation_params)
+        .def("assign_potential_precision", &py_cds::assign_potential_precision, py::arg("precision"))
+        .def("get_potential_precision", &py_cds::get_potential_precision)
         .def("charge_exists", &py_cds::charge_exists, py::arg("cs"))
         .def("cell_to_index", &py_cds::cell_to_index, py::arg("c"))
         .def("assign_charge_state", &py_cds::assign_charge_state, py::arg("c"), py::arg("cs"),
@@ -114,6 +116,10 @@ void charge_distribution_surface_layout(nanobind::module_& m, const std::string&
              py::arg("dep_cell")                = fiction::dependent_cell_mode::FIXED,
              py::arg("energy_calculation_mode") = fiction::energy_calculation::UPDATE_ENERGY,
              py::arg("history_mode")            = fiction::charge_distribution_history::NEGLECT)
+        .def("flip_charge", &py_cds::flip_charge, py::arg("index"), py::arg("new_state"),
+             py::arg("validity_calculation_mode") = fiction::validity_calculation::UPDATE_VALIDITY)
+        .def("recompute_in_double_precision", &py_cds::recompute_in_double_precision,
+             py::arg("energy_calculation_mode") = fiction::energy_calculation::UPDATE_ENERGY)
         .def("validity_check", &py_cds::validity_check)
         .def("is_physically_valid", &py_cds::is_physically_valid)
         .def("charge_distribution_to_index_general", &py_cds::charge_distribution_to_index_general)
@@ -243,6 +249,17 @@ void charge_distribution_surfaces(nanobind::module_& m)
 
         ;
 
+    /**
+     * Validity calculation.
+     */
+    py::enum_<fiction::validity_calculation>(m, "validity_calculation", DOC(fiction_validity_calculation))
+        .value("KEEP_OLD_VALIDITY", fiction::validity_calculation::KEEP_OLD_VALIDITY,
+               DOC(fiction_validity_calculation_KEEP_OLD_VALIDITY))
+        .value("UPDATE_VALIDITY", fiction::validity_calculation::UPDATE_VALIDITY,
+               DOC(fiction_validity_calculation_UPDATE_VALIDITY))
+
+        ;
+
     /**
      * Charge distribution mode.
      */
@@ -275,6 +292,13 @@ void charge_distribution_surfaces(nanobind::module_& m)
         .value("NEGLECT", fiction::charge_distribution_history::NEGLECT,
                DOC(fiction_charge_distribution_history_NEGLECT));
 
+    /**
+     * Potential precision.
+     */
+    py::enum_<fiction::potential_precision>(m, "potential_precision", DOC(fiction_potential_precision))
+        .value("DOUBLE", fiction::potential_precision::DOUBLE, DOC(fiction_potential_precision_DOUBLE))
+        .value("MIXED", fiction::potential_precision::MIXED, DOC(fiction_potential_precision_MIXED));
+
     /**
      * Charge transition threshold bounds.
      */
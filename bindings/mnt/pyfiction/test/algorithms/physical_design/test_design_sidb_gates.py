@@ -21,6 +21,7 @@ from mnt.pyfiction import (
     sidb_111_lattice,
     sidb_simulation_engine,
     sidb_technology,
+    symmetry_reduction,
     termination_condition,
 )
 
@@ -100,6 +101,55 @@ def test_siqad_and_gate_skeleton_100():
 
     assert len(designed_gates) == 23
 
+    params.number_of_threads = 1
+
+    assert len(design_sidb_gates(layout, [create_and_tt()], params)) == 23
+
+
+def test_siqad_and_gate_skeleton_100_symmetry_reduction():
+    layout = sidb_100_lattice((20, 20))
+
+    layout.assign_cell_type((0, 1), sidb_technology.cell_type.INPUT)
+    layout.assign_cell_type((2, 3), sidb_technology.cell_type.INPUT)
+
+    layout.assign_cell_type((20, 1), sidb_technology.cell_type.INPUT)
+    layout.assign_cell_type((18, 3), sidb_technology.cell_type.INPUT)
+
+    layout.assign_cell_type((4, 5), sidb_technology.cell_type.NORMAL)
+    layout.assign_cell_type((6, 7), sidb_technology.cell_type.NORMAL)
+
+    layout.assign_cell_type((14, 7), sidb_technology.cell_type.NORMAL)
+    layout.assign_cell_type((16, 5), sidb_technology.cell_type.NORMAL)
+
+    layout.assign_cell_type((10, 12), sidb_technology.cell_type.OUTPUT)
+    layout.assign_cell_type((10, 14), sidb_technology.cell_type.OUTPUT)
+
+    layout.assign_cell_type((10, 19), sidb_technology.cell_type.NORMAL)
+
+    params = design_sidb_gates_params()
+    params.operational_params.simulation_parameters.base = 2
+    params.operational_params.simulation_parameters.mu_minus = -0.28
+    params.design_mode = design_sidb_gates_mode.AUTOMATIC_EXHAUSTIVE_GATE_DESIGNER
+    params.termination_cond = termination_condition.ALL_COMBINATIONS_ENUMERATED
+    # canvas centered on the mirror axis of the skeleton
+    params.canvas = [(5, 8), (15, 11)]
+    params.number_of_canvas_sidbs = 1
+    params.operational_params.sim_engine = sidb_simulation_engine.QUICKEXACT
+
+    assert params.symmetry == symmetry_reduction.NONE
+
+    designed_gates = design_sidb_gates(layout, [create_and_tt()], params)
+
+    assert len(designed_gates) == 25
+
+    params.symmetry = symmetry_reduction.CANONICAL_ONLY
+
+    assert len(design_sidb_gates(layout, [create_and_tt()], params)) == 14
+
+    params.symmetry = symmetry_reduction.CANONICAL_AND_MIRRORED
+
+    assert len(design_sidb_gates(layout, [create_and_tt()], params)) == 25
+
 
 def test_nor_gate_111(nor_gate_skeleton):
     layout = nor_gate_skeleton
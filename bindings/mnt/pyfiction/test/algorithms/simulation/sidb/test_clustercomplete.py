@@ -18,6 +18,7 @@ from mnt.pyfiction import (
     sidb_111_lattice,
     sidb_charge_state,
     sidb_technology,
+    simulation_result_mode,
 )
 
 
@@ -86,3 +87,38 @@ def test_perturber_and_sidb_pair_111():
     assert groundstate[0].get_charge_state((1, 0)) == sidb_charge_state.NEUTRAL
     assert groundstate[0].get_charge_state((2, 0)) == sidb_charge_state.NEUTRAL
     assert groundstate[0].get_charge_state((3, 0)) == sidb_charge_state.NEGATIVE
+
+
+def test_result_mode():
+    layout = sidb_100_lattice((16, 2))
+
+    for x in range(0, 17, 4):
+        layout.assign_cell_type((x, 0), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((x, 2), sidb_technology.cell_type.NORMAL)
+
+    params = clustercomplete_params()
+    params.simulation_parameters.base = 2
+    params.simulation_parameters.mu_minus = -0.25
+
+    assert params.result_mode == simulation_result_mode.ALL_VALID
+    assert params.number_of_lowest_energy_states == 1
+
+    result_all_valid = clustercomplete(layout, params)
+    energies = sorted(cds.get_electrostatic_potential_energy() for cds in result_all_valid.charge_distributions)
+
+    params.result_mode = simulation_result_mode.LOWEST_K
+    params.number_of_lowest_energy_states = 3
+    assert params.number_of_lowest_energy_states == 3
+
+    result_lowest = clustercomplete(layout, params)
+
+    assert len(result_lowest.charge_distributions) == min(3, len(energies))
+    for cds, energy in zip(result_lowest.charge_distributions, energies, strict=False):
+        assert abs(cds.get_electrostatic_potential_energy() - energy) < 1e-6
+
+    params.result_mode = simulation_result_mode.GROUND_STATE_ONLY
+    assert params.result_mode == simulation_result_mode.GROUND_STATE_ONLY
+
+    result_ground_states = clustercomplete(layout, params)
+
+    assert len(result_ground_states.charge_distributions) == len(result_all_valid.groundstates())
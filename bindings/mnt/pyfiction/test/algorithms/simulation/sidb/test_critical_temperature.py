@@ -124,6 +124,29 @@ def test_bestagon_inv_with_different_mu(resources_dir):
     assert stats.algorithm_name == "QuickExact"
 
 
+def test_number_of_threads(resources_dir):
+    layout = read_sqd_layout_100(str(resources_dir / "hex_21_inputsdbp_xor_v1.sqd"), "xor_gate")
+    spec = [create_xor_tt()]
+
+    params = critical_temperature_params()
+    params.operational_params.simulation_parameters.base = 2
+    params.operational_params.sim_engine = sidb_simulation_engine.QUICKEXACT
+    params.number_of_threads = 1
+
+    assert params.number_of_threads == 1
+
+    reference_stats = critical_temperature_stats()
+    reference_ct = critical_temperature_gate_based(layout, spec, params, reference_stats)
+
+    params.number_of_threads = 4
+
+    stats = critical_temperature_stats()
+
+    # the input patterns are combined in order, so the result does not depend on the number of threads
+    assert critical_temperature_gate_based(layout, spec, params, stats) == reference_ct
+    assert stats.num_valid_lyt == reference_stats.num_valid_lyt
+
+
 def test_critical_temperature_with_input_pattern_layouts():
     lyt = sidb_100_lattice()
 
@@ -201,6 +201,24 @@ def test_and_gate_kinks(resources_dir):
     assert op_status == operational_status.NON_OPERATIONAL
 
 
+def test_and_gate_kinks_with_early_termination(resources_dir):
+    lyt = read_sqd_layout_100(str(resources_dir / "AND_mu_032_kinks.sqd"))
+
+    params = is_operational_params()
+    params.simulation_parameters = sidb_simulation_parameters(2, -0.32)
+    params.early_termination = True
+
+    [op_status, _evaluated_input_combinations] = is_operational(lyt, [create_and_tt()], params)
+
+    assert op_status == operational_status.OPERATIONAL
+
+    params.op_condition = operational_condition.REJECT_KINKS
+
+    [op_status, _evaluated_input_combinations] = is_operational(lyt, [create_and_tt()], params)
+
+    assert op_status == operational_status.NON_OPERATIONAL
+
+
 def test_and_gate_non_operational_due_to_kinks(resources_dir):
     lyt = read_sqd_layout_100(str(resources_dir / "AND_mu_032_kinks.sqd"))
 
@@ -24,6 +24,7 @@ from mnt.pyfiction import (
     operational_analysis_strategy,
     operational_condition,
     operational_domain,
+    operational_domain_adaptive_refinement,
     operational_domain_contour_tracing,
     operational_domain_flood_fill,
     operational_domain_grid_search,
@@ -126,6 +127,118 @@ def test_number_of_threads(resources_dir):
     assert stats_single.num_evaluated_parameter_combinations == stats_default.num_evaluated_parameter_combinations
 
 
+def test_journal_file(resources_dir, tmp_path):
+    """A sweep that is restarted with its journal skips all parameter points evaluated before."""
+    lyt = read_sqd_layout_100(str(resources_dir / "siqad_or_gate.sqd"))
+
+    params = operational_domain_params()
+    params.operational_params.sim_engine = sidb_simulation_engine.QUICKEXACT
+    params.operational_params.simulation_parameters.base = 2
+    params.operational_params.simulation_parameters.mu_minus = -0.28
+    params.operational_params.input_bdl_iterator_params.bdl_wire_params.threshold_bdl_interdistance = 1.5
+    params.operational_params.op_condition = operational_condition.TOLERATE_KINKS
+
+    params.sweep_dimensions = [
+        operational_domain_value_range(sweep_parameter.EPSILON_R, 5.70, 5.75, 0.01),
+        operational_domain_value_range(sweep_parameter.LAMBDA_TF, 3.00, 3.05, 0.01),
+    ]
+
+    # no journal is kept by default
+    assert not params.journal_file
+
+    journal = tmp_path / "or_gate_journal.csv"
+    params.journal_file = str(journal)
+
+    stats_first = operational_domain_stats()
+    op_domain_first = operational_domain_grid_search(lyt, [create_or_tt()], params, stats_first)
+
+    assert stats_first.num_resumed_parameter_combinations == 0
+    assert len(journal.read_text().splitlines()) == stats_first.num_evaluated_parameter_combinations + 1
+
+    stats_resumed = operational_domain_stats()
+    op_domain_resumed = operational_domain_grid_search(lyt, [create_or_tt()], params, stats_resumed)
+
+    assert stats_resumed.num_evaluated_parameter_combinations == 0
+    assert stats_resumed.num_resumed_parameter_combinations == stats_first.num_evaluated_parameter_combinations
+    assert len(op_domain_resumed) == len(op_domain_first)
+    assert stats_resumed.num_operational_parameter_combinations == stats_first.num_operational_parameter_combinations
+
+    # a journal of a different sweep is rejected
+    params.sweep_dimensions = [
+        operational_domain_value_range(sweep_parameter.LAMBDA_TF, 3.00, 3.05, 0.01),
+        operational_domain_value_range(sweep_parameter.EPSILON_R, 5.70, 5.75, 0.01),
+    ]
+
+    with pytest.raises(ValueError, match="journal"):
+        operational_domain_grid_search(lyt, [create_or_tt()], params)
+
+
+def test_adaptive_refinement(resources_dir):
+    """Adaptive refinement assigns a status to every grid point, but only simulates the refined cells."""
+    lyt = read_sqd_layout_100(str(resources_dir / "siqad_or_gate.sqd"))
+
+    params = operational_domain_params()
+    params.operational_params.sim_engine = sidb_simulation_engine.QUICKEXACT
+    params.operational_params.simulation_parameters.base = 2
+    params.operational_params.simulation_parameters.mu_minus = -0.28
+    params.operational_params.input_bdl_iterator_params.bdl_wire_params.threshold_bdl_interdistance = 1.5
+    params.operational_params.op_condition = operational_condition.TOLERATE_KINKS
+
+    params.sweep_dimensions = [
+        operational_domain_value_range(sweep_parameter.EPSILON_R, 5.70, 5.90, 0.01),
+        operational_domain_value_range(sweep_parameter.LAMBDA_TF, 3.00, 3.20, 0.01),
+    ]
+
+    stats_grid = operational_domain_stats()
+    op_domain_grid = operational_domain_grid_search(lyt, [create_or_tt()], params, stats_grid)
+
+    stats_adaptive = operational_domain_stats()
+    op_domain_adaptive = operational_domain_adaptive_refinement(lyt, [create_or_tt()], 4, params, stats_adaptive)
+
+    assert len(op_domain_adaptive) == len(op_domain_grid)
+    assert (
+        stats_adaptive.num_evaluated_parameter_combinations + stats_adaptive.num_inferred_parameter_combinations
+        == stats_grid.num_evaluated_parameter_combinations
+    )
+    assert stats_adaptive.num_evaluated_parameter_combinations < stats_grid.num_evaluated_parameter_combinations
+    assert stats_grid.num_inferred_parameter_combinations == 0
+
+
+def test_warm_start(resources_dir):
+    """Warm-starting the simulations from the ground states of neighboring parameter points keeps the domain."""
+    lyt = read_sqd_layout_100(str(resources_dir / "siqad_or_gate.sqd"))
+
+    params = operational_domain_params()
+    params.operational_params.sim_engine = sidb_simulation_engine.QUICKEXACT
+    params.operational_params.simulation_parameters.base = 2
+    params.operational_params.simulation_parameters.mu_minus = -0.28
+    params.operational_params.input_bdl_iterator_params.bdl_wire_params.threshold_bdl_interdistance = 1.5
+    params.operational_params.op_condition = operational_condition.TOLERATE_KINKS
+    params.operational_params.early_termination = True
+    params.number_of_threads = 1
+
+    params.sweep_dimensions = [
+        operational_domain_value_range(sweep_parameter.EPSILON_R, 5.70, 5.90, 0.01),
+        operational_domain_value_range(sweep_parameter.LAMBDA_TF, 3.00, 3.20, 0.01),
+    ]
+
+    assert not params.warm_start
+    assert params.operational_params.warm_start_iteration_steps == 100
+
+    stats_cold = operational_domain_stats()
+    op_domain_cold = operational_domain_grid_search(lyt, [create_or_tt()], params, stats_cold)
+
+    params.warm_start = True
+
+    stats_warm = operational_domain_stats()
+    op_domain_warm = operational_domain_grid_search(lyt, [create_or_tt()], params, stats_warm)
+
+    assert len(op_domain_warm) == len(op_domain_cold)
+    assert stats_warm.num_operational_parameter_combinations == stats_cold.num_operational_parameter_combinations
+    assert stats_cold.num_warm_started_parameter_combinations == 0
+    assert stats_warm.num_warm_started_parameter_combinations > 0
+
+
 def test_three_dimensional_operational_domain_sketch(wire_with_canvas):
     """The sketch and the boundary-following strategies work over three sweep dimensions."""
     lyt = wire_with_canvas
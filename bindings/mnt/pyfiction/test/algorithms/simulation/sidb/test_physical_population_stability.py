@@ -8,13 +8,18 @@
 
 from __future__ import annotations
 
+import pytest
+
 from mnt.pyfiction import (
     physical_population_stability_100,
     physical_population_stability_111,
+    physical_population_stability_batch_100,
+    physical_population_stability_batch_params,
     physical_population_stability_params,
     sidb_100_lattice,
     sidb_111_lattice,
     sidb_technology,
+    transition_type,
 )
 
 
@@ -50,3 +55,32 @@ def test_three_sidbs_111_lattice():
     params.simulation_parameters.mu_minus = -0.32
     result = physical_population_stability_111(layout, params)
     assert len(result) == 2
+
+
+def test_batch_of_layouts():
+    layout = sidb_100_lattice((2, 3))
+    layout.assign_cell_type((0, 1), sidb_technology.cell_type.NORMAL)
+    layout.assign_cell_type((0, 3), sidb_technology.cell_type.NORMAL)
+    layout.assign_cell_type((1, 1), sidb_technology.cell_type.NORMAL)
+
+    params = physical_population_stability_batch_params()
+    params.stability_params.simulation_parameters.mu_minus = -0.25
+    params.number_of_threads = 2
+
+    results = physical_population_stability_batch_100([layout, sidb_100_lattice((0, 0)), layout], params)
+    assert len(results) == 3
+    assert len(results[1]) == 0
+
+    single_result = physical_population_stability_100(layout, params.stability_params)
+
+    for result in (results[0], results[2]):
+        assert len(result) == len(single_result)
+
+        for compact, full in zip(result, single_result):
+            assert compact.system_energy == pytest.approx(full.system_energy)
+            assert compact.minimum_transition_potential() == pytest.approx(
+                min(potential for _, potential in full.transition_potentials.values())
+            )
+            assert compact.transition_potential(transition_type.NEUTRAL_TO_POSITIVE) == pytest.approx(
+                full.transition_potentials[transition_type.NEUTRAL_TO_POSITIVE][1]
+            )
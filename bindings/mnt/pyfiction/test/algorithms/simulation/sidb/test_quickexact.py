@@ -10,16 +10,22 @@ from __future__ import annotations
 
 from mnt.pyfiction import (
     automatic_base_number_detection,
+    charge_distribution_format,
     charge_distribution_surface_100,
     charge_distribution_surface_111,
+    charge_enumeration,
     quickexact,
+    quickexact_batch,
+    quickexact_batch_params,
     quickexact_params,
     read_sqd_layout_100,
     sidb_100_lattice,
     sidb_111_lattice,
     sidb_charge_state,
+    sidb_layout_delta,
     sidb_simulation_parameters,
     sidb_technology,
+    simulation_result_mode,
 )
 
 
@@ -85,6 +91,185 @@ def test_perturber_and_sidb_pair_111():
     assert groundstate[0].get_charge_state((3, 0)) == sidb_charge_state.NEGATIVE
 
 
+def test_number_of_threads(resources_dir):
+    """The thread count is configurable and does not change the simulation result."""
+    and_gate = read_sqd_layout_100(str(resources_dir / "Bestagon_AND_mu_025_v0.sqd"))
+
+    params = quickexact_params()
+    params.simulation_parameters.base = 2
+    params.simulation_parameters.mu_minus = -0.25
+
+    # defaults to a single thread
+    assert params.number_of_threads == 1
+
+    result_single = quickexact(and_gate, params)
+
+    params.number_of_threads = 4
+    assert params.number_of_threads == 4
+
+    result_multi = quickexact(and_gate, params)
+
+    assert len(result_multi.charge_distributions) == len(result_single.charge_distributions)
+    assert len(result_multi.groundstates()) == len(result_single.groundstates())
+
+
+def test_compact_result_format(resources_dir):
+    """Compact charge distributions yield the same ground states as full ones."""
+    and_gate = read_sqd_layout_100(str(resources_dir / "Bestagon_AND_mu_025_v0.sqd"))
+
+    params = quickexact_params()
+    params.simulation_parameters.base = 2
+    params.simulation_parameters.mu_minus = -0.25
+
+    assert params.result_format == charge_distribution_format.FULL
+
+    result_full = quickexact(and_gate, params)
+
+    params.result_format = charge_distribution_format.COMPACT
+    assert params.result_format == charge_distribution_format.COMPACT
+
+    result_compact = quickexact(and_gate, params)
+
+    assert len(result_compact.charge_distributions) == 0
+    assert result_compact.num_charge_distributions() == result_full.num_charge_distributions()
+    assert len(result_compact.materialize_charge_distributions()) == len(result_full.charge_distributions)
+
+    groundstates_full = result_full.groundstates()
+    groundstates_compact = result_compact.groundstates()
+
+    assert len(groundstates_compact) == len(groundstates_full)
+    for gs_compact, gs_full in zip(groundstates_compact, groundstates_full):
+        assert gs_compact.get_all_sidb_charges() == gs_full.get_all_sidb_charges()
+
+
+def test_branch_and_bound_enumeration(resources_dir):
+    """Branch-and-bound finds the same charge distributions as the Gray code enumeration."""
+    and_gate = read_sqd_layout_100(str(resources_dir / "Bestagon_AND_mu_025_v0.sqd"))
+
+    params = quickexact_params()
+    params.simulation_parameters.base = 2
+    params.simulation_parameters.mu_minus = -0.25
+
+    assert params.enumeration == charge_enumeration.GRAY_CODE
+    assert params.result_mode == simulation_result_mode.ALL_VALID
+
+    result_gray_code = quickexact(and_gate, params)
+
+    params.enumeration = charge_enumeration.BRANCH_AND_BOUND
+    assert params.enumeration == charge_enumeration.BRANCH_AND_BOUND
+
+    result_bnb = quickexact(and_gate, params)
+
+    assert len(result_bnb.charge_distributions) == len(result_gray_code.charge_distributions)
+
+    params.result_mode = simulation_result_mode.GROUND_STATE_ONLY
+    assert params.result_mode == simulation_result_mode.GROUND_STATE_ONLY
+
+    result_ground_states = quickexact(and_gate, params)
+
+    assert len(result_ground_states.charge_distributions) == len(result_gray_code.groundstates())
+    assert (
+        result_ground_states.charge_distributions[0].get_all_sidb_charges()
+        == result_gray_code.groundstates()[0].get_all_sidb_charges()
+    )
+
+
+def test_charge_state_hint(resources_dir):
+    """A hint changes the order of the branch-and-bound enumeration, but not the ground states."""
+    and_gate = read_sqd_layout_100(str(resources_dir / "Bestagon_AND_mu_025_v0.sqd"))
+
+    params = quickexact_params()
+    params.simulation_parameters.base = 2
+    params.simulation_parameters.mu_minus = -0.25
+    params.enumeration = charge_enumeration.BRANCH_AND_BOUND
+    params.result_mode = simulation_result_mode.GROUND_STATE_ONLY
+
+    assert params.charge_state_hint == {}
+
+    expected = quickexact(and_gate, params).charge_distributions[0].get_all_sidb_charges()
+
+    # the ground state at a slightly different chemical potential serves as the hint
+    params.simulation_parameters.mu_minus = -0.26
+    neighbor = quickexact(and_gate, params).charge_distributions[0]
+
+    params.simulation_parameters.mu_minus = -0.25
+    params.charge_state_hint = {c: neighbor.get_charge_state(c) for c in neighbor.cells()}
+
+    result = quickexact(and_gate, params)
+
+    assert len(result.charge_distributions) == 1
+    assert result.charge_distributions[0].get_all_sidb_charges() == expected
+
+
+def test_result_mode(resources_dir):
+    """Only the charge distributions of the lowest energies are kept."""
+    and_gate = read_sqd_layout_100(str(resources_dir / "Bestagon_AND_mu_025_v0.sqd"))
+
+    params = quickexact_params()
+    params.simulation_parameters.base = 2
+    params.simulation_parameters.mu_minus = -0.25
+
+    assert params.result_mode == simulation_result_mode.ALL_VALID
+    assert params.number_of_lowest_energy_states == 1
+
+    result_all_valid = quickexact(and_gate, params)
+    energies = sorted(cds.get_electrostatic_potential_energy() for cds in result_all_valid.charge_distributions)
+
+    params.result_mode = simulation_result_mode.LOWEST_K
+    params.number_of_lowest_energy_states = 2
+    assert params.result_mode == simulation_result_mode.LOWEST_K
+    assert params.number_of_lowest_energy_states == 2
+
+    result_lowest = quickexact(and_gate, params)
+
+    assert len(result_lowest.charge_distributions) == min(2, len(energies))
+    for cds, energy in zip(result_lowest.charge_distributions, energies, strict=False):
+        assert abs(cds.get_electrostatic_potential_energy() - energy) < 1e-6
+
+    params.result_mode = simulation_result_mode.GROUND_STATE_ONLY
+
+    result_ground_states = quickexact(and_gate, params)
+
+    assert len(result_ground_states.charge_distributions) == len(result_all_valid.groundstates())
+
+
+def test_batch_simulation_of_and_gate_inputs(resources_dir):
+    """Simulating the input patterns as deltas of the gate yields the same results as individual simulations."""
+    and_gate = read_sqd_layout_100(str(resources_dir / "Bestagon_AND_mu_025_v0.sqd"))
+
+    params = quickexact_batch_params()
+    assert params.number_of_threads == 1
+    params.simulation_params.simulation_parameters.base = 2
+    params.simulation_params.simulation_parameters.mu_minus = -0.25
+    params.number_of_threads = 2
+    assert params.number_of_threads == 2
+
+    # remove one SiDB of each input BDL pair to encode the input patterns 00, 01, 10, and 11
+    deltas = []
+    for removed_sidbs in ([(2, 2), (24, 2)], [(2, 2), (26, 0)], [(0, 0), (24, 2)], [(0, 0), (26, 0)]):
+        delta = sidb_layout_delta()
+        delta.removed_sidbs = removed_sidbs
+        assert len(delta.added_sidbs) == 0
+        deltas.append(delta)
+
+    results = quickexact_batch(and_gate, deltas, params)
+
+    assert len(results) == len(deltas)
+
+    for delta, result in zip(deltas, results):
+        for c in delta.removed_sidbs:
+            and_gate.assign_cell_type(c, sidb_technology.cell_type.EMPTY)
+
+        expected = quickexact(and_gate, params.simulation_params)
+
+        for c in delta.removed_sidbs:
+            and_gate.assign_cell_type(c, sidb_technology.cell_type.INPUT)
+
+        assert result.algorithm_name == "QuickExact"
+        assert len(result.charge_distributions) == len(expected.charge_distributions)
+        assert result.groundstates()[0].get_all_sidb_charges() == expected.groundstates()[0].get_all_sidb_charges()
+
+
 def test_simulate_all_inputs_of_and_gate(resources_dir):
     and_gate = read_sqd_layout_100(str(resources_dir / "Bestagon_AND_mu_025_v0.sqd"))
     physical_parameters = sidb_simulation_parameters()
@@ -11,6 +11,7 @@ from __future__ import annotations
 from mnt.pyfiction import (
     charge_distribution_surface,
     charge_distribution_surface_111,
+    potential_precision,
     quicksim,
     quicksim_params,
     sidb_100_lattice,
@@ -56,6 +57,28 @@ def test_perturber_and_sidb_pair():
     assert groundstate.get_charge_state((6, 1)) == sidb_charge_state.NEGATIVE
 
 
+def test_mixed_precision():
+    layout = sidb_100_lattice((10, 10))
+    layout.assign_cell_type((0, 1), sidb_technology.cell_type.NORMAL)
+    layout.assign_cell_type((4, 1), sidb_technology.cell_type.NORMAL)
+    layout.assign_cell_type((6, 1), sidb_technology.cell_type.NORMAL)
+
+    params = quicksim_params()
+    assert params.precision == potential_precision.DOUBLE
+
+    params.precision = potential_precision.MIXED
+    assert params.precision == potential_precision.MIXED
+
+    result = quicksim(layout, params)
+
+    groundstate = result.groundstates()[0]
+
+    assert groundstate.get_potential_precision() == potential_precision.DOUBLE
+    assert groundstate.get_charge_state((0, 1)) == sidb_charge_state.NEGATIVE
+    assert groundstate.get_charge_state((4, 1)) == sidb_charge_state.NEUTRAL
+    assert groundstate.get_charge_state((6, 1)) == sidb_charge_state.NEGATIVE
+
+
 def test_perturber_and_sidb_pair_111():
     layout = sidb_111_lattice((4, 1))
     layout.assign_cell_type((0, 0), sidb_technology.cell_type.NORMAL)
@@ -26,6 +26,7 @@ from mnt.pyfiction import (
     sidb_simulation_parameters,
     sidb_technology,
     time_to_solution,
+    time_to_solution_batch,
     time_to_solution_for_given_simulation_results,
     time_to_solution_params,
     time_to_solution_stats,
@@ -121,3 +122,33 @@ def test_time_to_solution_with_simulation_results():
         # To avoid division by zero, ensure st.acc is not 1.0
         tts_calculated = st.mean_single_runtime * math.log(1.0 - 0.997) / math.log(1.0 - st.acc / 100)
         assert st.time_to_solution == pytest.approx(tts_calculated, abs=1e-6)
+
+
+def test_time_to_solution_batch():
+    layout = sidb_100_lattice((0, 0))
+    layout.assign_cell_type((1, 3, 0), sidb_technology.cell_type.NORMAL)
+    layout.assign_cell_type((3, 3, 0), sidb_technology.cell_type.NORMAL)
+    layout.assign_cell_type((5, 3, 0), sidb_technology.cell_type.NORMAL)
+
+    quicksim_parameter = quicksim_params()
+    quicksim_parameter.simulation_parameters = sidb_simulation_parameters(2, -0.3)
+    quicksim_parameter.number_threads = 1
+
+    tts_params = time_to_solution_params()
+    tts_params.repetitions = 10
+    tts_params.number_of_threads = 2
+    assert tts_params.number_of_threads == 2
+
+    stats = time_to_solution_batch([layout, sidb_100_lattice((0, 0)), layout], quicksim_parameter, tts_params)
+
+    assert len(stats) == 3
+
+    assert stats[0].acc == 100
+    assert len(stats[0].single_runtimes) == 10
+    assert stats[0].mean_single_runtime == pytest.approx(sum(stats[0].single_runtimes) / 10)
+
+    # an empty layout has no ground state to find
+    assert stats[1].acc == 0
+    assert math.isinf(stats[1].time_to_solution)
+
+    assert stats[2].acc == 100
@@ -17,6 +17,7 @@ from mnt.pyfiction import (
     sidb_charge_state,
     sidb_layout,
     sidb_technology,
+    validity_calculation,
 )
 
 
@@ -56,6 +57,29 @@ def test_initialization():
     assert charge_lyt.get_electrostatic_potential_energy() == 0
 
 
+def test_flip_charge():
+    layout_one = sidb_layout((10, 10))
+    layout_one.assign_cell_type((0, 1), sidb_technology.cell_type.NORMAL)
+    layout_one.assign_cell_type((4, 1), sidb_technology.cell_type.NORMAL)
+    layout_one.assign_cell_type((6, 1), sidb_technology.cell_type.NORMAL)
+
+    charge_lyt = charge_distribution_surface(layout_one)
+    charge_lyt.update_after_charge_change()
+    assert not charge_lyt.is_physically_valid()
+
+    charge_lyt.flip_charge(1, sidb_charge_state.NEUTRAL)
+    assert charge_lyt.get_charge_state((4, 1)) == sidb_charge_state.NEUTRAL
+    assert charge_lyt.is_physically_valid()
+
+    # the validity of the previous charge distribution is kept until it is checked again
+    charge_lyt.flip_charge(1, sidb_charge_state.NEGATIVE, validity_calculation.KEEP_OLD_VALIDITY)
+    assert charge_lyt.get_charge_state((4, 1)) == sidb_charge_state.NEGATIVE
+    assert charge_lyt.is_physically_valid()
+
+    charge_lyt.validity_check()
+    assert not charge_lyt.is_physically_valid()
+
+
 def test_initialization_111_lattice():
     layout_one = sidb_111_lattice((10, 10))
     layout_one.assign_cell_type((0, 1), sidb_technology.cell_type.NORMAL)
@@ -32,6 +32,8 @@ namespace alice
  *  - Contour tracing: Evaluates a specified number of random parameter combinations and then performs contour tracing
  *  to find the edges of the operational domain. Requires at least two sweep dimensions; in three, it collects the
  *  boundary surface instead of walking a closed curve.
+ * - Adaptive refinement: Evaluates a coarse grid and recursively subdivides only the cells whose corners disagree in
+ *  their operational status. All other parameter combinations inherit the status of their cell's corners.
  *
  * Each flavor can determine the operational status either by physical simulation or, with `--sketch`, by filtering
  * alone. The latter is the *operational domain sketch*: dramatically faster, never rejecting a point that is
@@ -81,6 +83,10 @@ class opdom_command final : public command
      * Number of random samples.
      */
     std::size_t num_random_samples{};
+    /**
+     * Number of steps between neighboring points of the coarse grid of adaptive refinement.
+     */
+    std::size_t initial_spacing{};
     /**
      * User input for the x dimension sweep parameter.
      */
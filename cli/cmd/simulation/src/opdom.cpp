@@ -48,6 +48,9 @@ opdom_command::opdom_command(const environment::ptr& e) :
     add_option("--contour_tracing,-c", num_random_samples,
                "Use contour tracing instead of grid search with this many random samples (needs 2 or more sweep "
                "dimensions; collects the boundary surface in 3 dimensions)");
+    add_option("--adaptive_refinement,-a", initial_spacing,
+               "Use adaptive refinement instead of grid search, starting from a coarse grid with this many steps "
+               "between neighboring points");
 
     add_option("filename", filename, "CSV filename to write the operational domain to")->required();
     add_flag("--omit_non_op_samples,-o", omit_non_operational_samples,
@@ -126,7 +129,7 @@ void opdom_command::execute()
 
     // make sure that at most one algorithm is selected
     const std::array algorithm_selections = {is_set("random_sampling"), is_set("flood_fill"),
-                                             is_set("contour_tracing")};
+                                             is_set("contour_tracing"), is_set("adaptive_refinement")};
     if (std::ranges::count(algorithm_selections, true) > 1)
     {
         env->out() << "[e] only one algorithm can be selected at a time\n";
@@ -142,6 +145,14 @@ void opdom_command::execute()
         return;
     }
 
+    // require a positive spacing of the coarse grid for adaptive refinement
+    if (is_set("adaptive_refinement") && initial_spacing == 0)
+    {
+        env->out() << "[e] initial spacing must be > 0 for adaptive refinement\n";
+        reset_params();
+        return;
+    }
+
     // make sure that z is not set if y is not, and that y is not set if x is not
     if (is_set("z_sweep") && !is_set("y_sweep"))
     {
@@ -324,6 +335,11 @@ void opdom_command::execute()
                     op_domain = fiction::operational_domain_contour_tracing(*lyt_ptr, std::vector{*tt_ptr},
                                                                             num_random_samples, params, &stats);
                 }
+                else if (is_set("adaptive_refinement"))
+                {
+                    op_domain = fiction::operational_domain_adaptive_refinement(*lyt_ptr, std::vector{*tt_ptr},
+                                                                                initial_spacing, params, &stats);
+                }
                 else
                 {
                     op_domain = fiction::operational_domain_grid_search(*lyt_ptr, std::vector{*tt_ptr}, params, &stats);
@@ -0,0 +1,277 @@
+//
+// Created by Jan Drewniok on 17.10.26.
+//
+
+#include "fiction_experiments.hpp"
+
+#include <fiction/algorithms/simulation/sidb/quicksim.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
+#include <fiction/algorithms/simulation/sidb/time_to_solution.hpp>
+#include <fiction/io/read_sqd_layout.hpp>
+#include <fiction/types.hpp>
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace fiction;
+
+namespace
+{
+
+/**
+ * Determines the given quantile of a set of runtimes by the nearest-rank method.
+ *
+ * @param runtimes Runtimes to determine the quantile of.
+ * @param q Quantile in the interval [0, 1].
+ * @return The `q`-quantile of `runtimes`, or `0.0` if `runtimes` is empty.
+ */
+double quantile(std::vector<double> runtimes, const double q)
+{
+    if (runtimes.empty())
+    {
+        return 0.0;
+    }
+
+    std::sort(runtimes.begin(), runtimes.end());
+
+    const auto rank = static_cast<std::size_t>(std::ceil(q * static_cast<double>(runtimes.size())));
+
+    return runtimes[std::clamp(rank, std::size_t{1}, runtimes.size()) - 1];
+}
+
+}  // namespace
+
+/**
+ * This program benchmarks the time-to-solution (TTS) of *QuickSim* on all .sqd layouts of a folder. Each layout is
+ * simulated by an exact engine as reference, and by *QuickSim* for a number of repetitions. The accuracy, the exact
+ * runtime, the distribution of the *QuickSim* runtimes, and the TTS of each layout are stored in the experiment's JSON
+ * file, while the single *QuickSim* runtimes are additionally written to a CSV file. If the version of a previous run
+ * is given as baseline, each layout is compared to it, such that regressions of *QuickSim* across releases, or of
+ * different `iteration_steps` and `alpha` values on the same workload, become visible.
+ *
+ * @param argc The number of command-line arguments.
+ * @param argv An array of C-style strings containing the command-line arguments.
+ * @return Returns 0 on successful execution, or EXIT_FAILURE if an error occurs or a layout regressed compared to the
+ * baseline.
+ *
+ * Command-line Options:
+ *   --folder <path>            Folder of .sqd layouts, relative to the experiments folder.
+ *   --iteration_steps <value>  Number of iterations of each *QuickSim* run.
+ *   --alpha <value>            *QuickSim*'s `alpha` parameter.
+ *   --mu_minus <value>         Energy transition level (0/-) in eV.
+ *   --repetitions <value>      Number of *QuickSim* runs per layout.
+ *   --threads <value>          Number of layouts that are simulated in parallel.
+ *   --engine <name>            Exact reference engine ("QUICKEXACT", "CLUSTERCOMPLETE" if ALGLIB is
+ * enabled, or "EXGS").
+ *   --csv <path>               CSV file of the single *QuickSim* runtimes, relative to the experiments folder.
+ *   --baseline <version>       Version of a previous run in the experiment's JSON file to compare against.
+ *   --tts_tolerance <value>    Relative TTS increase tolerated before a layout is reported as regressed.
+ *   --acc_tolerance <value>    Accuracy decrease in percentage points tolerated before a layout is reported as
+ * regressed.
+ *
+ * Example Usage:
+ *   To benchmark the Bestagon gates with 4 threads and compare the result to the run of version abc1234:
+ *   ./time_to_solution_benchmark --threads 4 --baseline abc1234
+ */
+int main(int argc, const char* argv[])  // NOLINT
+{
+    std::unordered_map<std::string, std::string> options{{"--folder", "sidb_gate_libraries/bestagon_gates/"},
+                                                         {"--iteration_steps", "80"},
+                                                         {"--alpha", "0.7"},
+                                                         {"--mu_minus", "-0.32"},
+                                                         {"--repetitions", "100"},
+                                                         {"--threads", "1"},
+                                                         {"--engine", "QUICKEXACT"},
+                                                         {"--csv", "time_to_solution_benchmark_runtimes.csv"},
+                                                         {"--baseline", ""},
+                                                         {"--tts_tolerance", "0.25"},
+                                                         {"--acc_tolerance", "5"}};
+
+    std::vector<std::string> arguments(argv + 1, argv + argc);  // Convert argv to a vector of strings
+
+    // Parse command-line arguments
+    for (size_t i = 0; i < arguments.size(); ++i)
+    {
+        const std::string& arg = arguments[i];
+        if (options.count(arg) > 0)
+        {
+            if (i + 1 < arguments.size())
+            {
+                options[arg] = arguments[i + 1];
+                ++i;  // Skip the next argument
+            }
+            else
+            {
+                std::cerr << fmt::format("Error: Argument {} is missing a value\n", arg);
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    quicksim_params qs_params{sidb_simulation_parameters{2, std::stod(options["--mu_minus"])}};
+    qs_params.iteration_steps = std::stoull(options["--iteration_steps"]);
+    qs_params.alpha           = std::stod(options["--alpha"]);
+    // the layouts are distributed over the threads instead
+    qs_params.number_threads = 1;
+
+    time_to_solution_params tts_params{};
+    tts_params.repetitions       = std::stoull(options["--repetitions"]);
+    tts_params.number_of_threads = std::stoull(options["--threads"]);
+
+    if (const auto& engine = options["--engine"]; engine == "EXGS")
+    {
+        tts_params.engine = exact_sidb_simulation_engine::EXGS;
+    }
+#if (FICTION_ALGLIB_ENABLED)
+    else if (engine == "CLUSTERCOMPLETE")
+    {
+        tts_params.engine = exact_sidb_simulation_engine::CLUSTERCOMPLETE;
+    }
+#endif  // FICTION_ALGLIB_ENABLED
+    else
+    {
+        tts_params.engine = exact_sidb_simulation_engine::QUICKEXACT;
+    }
+
+    const auto tts_tolerance = std::stod(options["--tts_tolerance"]);
+    const auto acc_tolerance = std::stod(options["--acc_tolerance"]);
+
+    // collect all .sqd files of the folder in a deterministic order
+    std::vector<std::filesystem::path> files{};
+
+    try
+    {
+        for (const auto& file : std::filesystem::directory_iterator(fmt::format("{}{}", EXPERIMENTS_PATH,
+                                                                                options["--folder"])))
+        {
+            if (file.path().extension() == ".sqd")
+            {
+                files.push_back(file.path());
+            }
+        }
+    }
+    catch (const std::filesystem::filesystem_error& e)
+    {
+        std::cerr << fmt::format("Error: {}\n", e.what());
+        return EXIT_FAILURE;
+    }
+
+    std::sort(files.begin(), files.end());
+
+    std::vector<sidb_100_cell_clk_lyt_siqad> layouts{};
+    layouts.reserve(files.size());
+
+    for (const auto& file : files)
+    {
+        layouts.push_back(read_sqd_layout<sidb_100_cell_clk_lyt_siqad>(file.string()));
+    }
+
+    const auto stats = time_to_solution_batch(layouts, qs_params, tts_params);
+
+    experiments::experiment<std::string, uint64_t, std::string, double, double, double, double, double, double>
+        tts_exp{"time_to_solution_benchmark",
+                "Layout",
+                "#SiDBs",
+                "Exact Engine",
+                "Exact Runtime [s]",
+                "QuickSim Accuracy [%]",
+                "QuickSim Mean Runtime [s]",
+                "QuickSim Median Runtime [s]",
+                "QuickSim P90 Runtime [s]",
+                "QuickSim TTS [s]"};
+
+    std::ofstream csv{fmt::format("{}{}", EXPERIMENTS_PATH, options["--csv"])};
+    csv << "layout,repetition,runtime_s\n";
+
+    for (std::size_t i = 0; i < layouts.size(); ++i)
+    {
+        const auto name = files[i].stem().string();
+
+        tts_exp(name, layouts[i].num_cells(), stats[i].algorithm, stats[i].single_runtime_exact, stats[i].acc,
+                stats[i].mean_single_runtime, quantile(stats[i].single_runtimes, 0.5),
+                quantile(stats[i].single_runtimes, 0.9), stats[i].time_to_solution);
+
+        for (std::size_t r = 0; r < stats[i].single_runtimes.size(); ++r)
+        {
+            csv << fmt::format("{},{},{}\n", name, r, stats[i].single_runtimes[r]);
+        }
+    }
+
+    tts_exp.save();
+    tts_exp.table();
+
+    if (options["--baseline"].empty())
+    {
+        return EXIT_SUCCESS;
+    }
+
+    // compare the layouts to the run of the baseline version in the experiment's JSON file
+    std::ifstream json_file{fmt::format("{}time_to_solution_benchmark.json", EXPERIMENTS_PATH)};
+
+    const auto runs = nlohmann::json::parse(json_file, nullptr, false);
+
+    if (!runs.is_array())
+    {
+        std::cerr << "Error: no previous runs found\n";
+        return EXIT_FAILURE;
+    }
+
+    const auto baseline = std::find_if(runs.cbegin(), runs.cend(), [&options](const auto& run)
+                                       { return run.value("version", "") == options["--baseline"]; });
+
+    if (baseline == runs.cend())
+    {
+        std::cerr << fmt::format("Error: no run of version {} found\n", options["--baseline"]);
+        return EXIT_FAILURE;
+    }
+
+    std::size_t num_regressions = 0;
+
+    for (std::size_t i = 0; i < layouts.size(); ++i)
+    {
+        const auto name = files[i].stem().string();
+
+        const auto entry = std::find_if((*baseline)["entries"].cbegin(), (*baseline)["entries"].cend(),
+                                        [&name](const auto& e) { return e["Layout"] == name; });
+
+        if (entry == (*baseline)["entries"].cend())
+        {
+            std::cout << fmt::format("[i] {} is not part of the baseline\n", name);
+            continue;
+        }
+
+        // TTS values are infinite if QuickSim never found the ground state, which JSON stores as null
+        const auto baseline_tts = (*entry)["QuickSim TTS [s]"].is_number() ?
+                                      (*entry)["QuickSim TTS [s]"].template get<double>() :
+                                      std::numeric_limits<double>::infinity();
+        const auto baseline_acc = (*entry)["QuickSim Accuracy [%]"].template get<double>();
+
+        if (stats[i].time_to_solution > baseline_tts * (1.0 + tts_tolerance) ||
+            stats[i].acc < baseline_acc - acc_tolerance)
+        {
+            std::cout << fmt::format("[w] {} regressed: TTS {:.6f} s (baseline {:.6f} s), accuracy {:.2f} % "
+                                     "(baseline {:.2f} %)\n",
+                                     name, stats[i].time_to_solution, baseline_tts, stats[i].acc, baseline_acc);
+            ++num_regressions;
+        }
+    }
+
+    std::cout << fmt::format("[i] {} of {} layouts regressed compared to version {}\n", num_regressions,
+                             layouts.size(), options["--baseline"]);
+
+    return num_regressions == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
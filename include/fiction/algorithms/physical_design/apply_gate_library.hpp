@@ -8,6 +8,7 @@
 #include "fiction/traits.hpp"
 #include "fiction/utils/layout_utils.hpp"
 #include "fiction/utils/name_utils.hpp"
+#include "fiction/utils/work_stealing_thread_pool.hpp"
 
 #include <optional>
 
@@ -19,8 +20,15 @@
 #include <mockturtle/traits.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 // data types cannot properly be converted to bit field types
 #pragma GCC diagnostic push
@@ -138,6 +146,9 @@ class apply_gate_library_impl
      * gate-level layout and maps gates to cell implementations based on their corresponding positions and types.
      * Optionally, it performs post-layout optimization and sets the layout name if certain conditions are met.
      *
+     * If `params` provides a `number_of_threads` greater than `1`, the gates of all tiles are set up concurrently
+     * before they are assigned to the cell-level layout.
+     *
      * @tparam Params Type of the Parameters used for the SiDB on-the-fly gate library.
      * @param params Parameters used for the SiDB on-the-fly gate library.
      * @param defect_surface Optional defect surface.
@@ -157,28 +168,60 @@ class apply_gate_library_impl
             GateLibrary::post_layout_optimization(gate_lyt);
         }
 
-        gate_lyt.foreach_node(
-            [&, this](const auto& n, [[maybe_unused]] auto i)
+        bool designed_concurrently = false;
+
+        if constexpr (requires { params.number_of_threads; })
+        {
+            if (params.number_of_threads > 1)
             {
-                if (!gate_lyt.is_constant(n))
+                const auto gates = set_up_gates_concurrently(params, defect_surface);
+
+                for (std::size_t i = 0; i < gates.size(); ++i)
                 {
-                    const auto t = gate_lyt.get_tile(n);
+                    const auto& [n, g] = gates[i];
 
-                    // retrieve the top-leftmost cell in tile t
+                    // retrieve the top-leftmost cell in the tile of n
                     const auto c =
                         relative_to_absolute_cell_position<GateLibrary::gate_x_size(), GateLibrary::gate_y_size(),
-                                                           GateLyt, CellLyt>(gate_lyt, t, cell<CellLyt>{0, 0});
+                                                           GateLyt, CellLyt>(gate_lyt, gate_lyt.get_tile(n),
+                                                                             cell<CellLyt>{0, 0});
 
-                    assign_gate(c,
-                                GateLibrary::template set_up_gate<GateLyt, CellLyt, Params>(gate_lyt, t, params,
-                                                                                            defect_surface),
-                                n);
+                    assign_gate(c, g, n);
+#if (PROGRESS_BARS)
+                    // update progress
+                    bar(i);
+#endif
                 }
+
+                designed_concurrently = true;
+            }
+        }
+
+        if (!designed_concurrently)
+        {
+            gate_lyt.foreach_node(
+                [&, this](const auto& n, [[maybe_unused]] auto i)
+                {
+                    if (!gate_lyt.is_constant(n))
+                    {
+                        const auto t = gate_lyt.get_tile(n);
+
+                        // retrieve the top-leftmost cell in tile t
+                        const auto c =
+                            relative_to_absolute_cell_position<GateLibrary::gate_x_size(), GateLibrary::gate_y_size(),
+                                                               GateLyt, CellLyt>(gate_lyt, t, cell<CellLyt>{0, 0});
+
+                        assign_gate(c,
+                                    GateLibrary::template set_up_gate<GateLyt, CellLyt, Params>(gate_lyt, t, params,
+                                                                                                defect_surface),
+                                    n);
+                    }
 #if (PROGRESS_BARS)
-                // update progress
-                bar(i);
+                    // update progress
+                    bar(i);
 #endif
-            });
+                });
+        }
 
         // if available, recover layout name
         cell_lyt.set_layout_name(get_name(gate_lyt));
@@ -211,6 +254,100 @@ class apply_gate_library_impl
      * Cell-level layout.
      */
     CellLyt cell_lyt;
+    /**
+     * Sets up the gates of all tiles of the gate-level layout concurrently on `params.number_of_threads` threads. The
+     * tiles only share the read-only gate-level layout and defect surface, so their gates can be designed
+     * independently.
+     * If the parameters provide a `design_cache` but none is set, a temporary one is shared by all tiles such that
+     * identical design problems are only solved once. Since the tiles already occupy all threads, the gate of each tile
+     * is designed on a single thread.
+     *
+     * As soon as the set-up of a tile throws, all tiles that have not been started yet are skipped, and the exception
+     * is rethrown once the running tiles have finished. If several tiles throw, the first exception is passed on.
+     *
+     * @tparam Params Type of the parameters used for the gate library.
+     * @param params Parameters used for the gate library.
+     * @param defect_surface Optional defect surface.
+     * @return The non-constant nodes of the gate-level layout paired with their gates, in the order of `foreach_node`.
+     */
+    template <typename Params>
+    [[nodiscard]] std::vector<std::pair<mockturtle::node<GateLyt>, typename GateLibrary::fcn_gate>>
+    set_up_gates_concurrently(const Params& params, const std::optional<CellLyt>& defect_surface) const
+    {
+        std::vector<mockturtle::node<GateLyt>> nodes{};
+        gate_lyt.foreach_node(
+            [this, &nodes](const auto& n)
+            {
+                if (!gate_lyt.is_constant(n))
+                {
+                    nodes.push_back(n);
+                }
+            });
+
+        auto tile_params = params;
+
+        if constexpr (requires { tile_params.design_cache; })
+        {
+            if (tile_params.design_cache == nullptr)
+            {
+                tile_params.design_cache =
+                    std::make_shared<typename decltype(tile_params.design_cache)::element_type>();
+            }
+        }
+
+        if constexpr (requires { tile_params.design_gate_params.number_of_threads; })
+        {
+            tile_params.design_gate_params.number_of_threads = 1;
+        }
+
+        std::vector<std::optional<typename GateLibrary::fcn_gate>> gates(nodes.size());
+
+        std::atomic<bool>  cancelled{false};
+        std::exception_ptr first_exception{};
+        std::mutex         exception_mutex{};
+
+        shared_work_stealing_thread_pool(params.number_of_threads)
+            .for_each_index(nodes.size(),
+                            [&, this](const std::size_t i)
+                            {
+                                if (cancelled.load(std::memory_order_relaxed))
+                                {
+                                    return;
+                                }
+
+                                try
+                                {
+                                    gates[i] = GateLibrary::template set_up_gate<GateLyt, CellLyt, Params>(
+                                        gate_lyt, gate_lyt.get_tile(nodes[i]), tile_params, defect_surface);
+                                }
+                                catch (...)
+                                {
+                                    const std::lock_guard lock{exception_mutex};
+
+                                    if (first_exception == nullptr)
+                                    {
+                                        first_exception = std::current_exception();
+                                    }
+
+                                    cancelled.store(true, std::memory_order_relaxed);
+                                }
+                            });
+
+        if (first_exception != nullptr)
+        {
+            std::rethrow_exception(first_exception);
+        }
+
+        std::vector<std::pair<mockturtle::node<GateLyt>, typename GateLibrary::fcn_gate>> result{};
+        result.reserve(nodes.size());
+
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+        {
+            result.emplace_back(nodes[i], gates[i].value());
+        }
+
+        return result;
+    }
     /**
      * This function assigns a given FCN gate implementation to the total cell layout.
      *
@@ -344,6 +481,9 @@ template <typename DefectLyt, typename GateLibrary, typename GateLyt>
  * May pass through, and thereby throw, an `unsupported_gate_type_exception`, an
  * `unsupported_gate_orientation_exception` and any further custom exceptions of the gate libraries.
  *
+ * If `params` provides a `number_of_threads` greater than `1`, the tiles are set up concurrently, and the first
+ * exception cancels all tiles that have not been started yet.
+ *
  * @tparam CellLyt Type of the returned cell-level layout.
  * @tparam GateLibrary Type of the gate library to apply.
  * @tparam GateLyt Type of the gate-level layout to apply the library to.
@@ -379,6 +519,9 @@ template <typename CellLyt, typename GateLibrary, typename GateLyt, typename Par
  * May pass through, and thereby throw, an `unsupported_gate_type_exception`, an
  * `unsupported_gate_orientation_exception` and any further custom exceptions of the gate libraries.
  *
+ * If `params` provides a `number_of_threads` greater than `1`, the tiles are set up concurrently, and the first
+ * exception cancels all tiles that have not been started yet.
+ *
  * @tparam DefectLyt Type of the returned cell-level layout.
  * @tparam GateLibrary Type of the gate library to apply.
  * @tparam GateLyt Type of the gate-level layout to apply the library to.
@@ -10,27 +10,41 @@
 #include "fiction/algorithms/simulation/sidb/is_operational.hpp"
 #include "fiction/algorithms/simulation/sidb/random_sidb_layout_generator.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp"
+#include "fiction/technology/cell_ports.hpp"
 #include "fiction/technology/cell_technologies.hpp"
 #include "fiction/technology/charge_distribution_surface.hpp"
 #include "fiction/technology/sidb_charge_state.hpp"
 #include "fiction/technology/sidb_defects.hpp"
+#include "fiction/technology/sidb_geometry_cache.hpp"
+#include "fiction/technology/sidb_nm_position.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/combination_utils.hpp"
 #include "fiction/utils/layout_utils.hpp"
+#include "fiction/utils/math_utils.hpp"
+#include "fiction/utils/work_stealing_thread_pool.hpp"
 
 #include <fmt/format.h>
+#include <kitty/bit_operations.hpp>
 #include <kitty/traits.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
 
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <numeric>
 #include <optional>
 #include <random>
+#include <ranges>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -86,6 +100,25 @@ struct design_sidb_gates_params
          */
         PRUNING_ONLY
     };
+    /**
+     * Selector for the exploitation of the mirror symmetry of a design problem.
+     */
+    enum class symmetry_reduction : uint8_t
+    {
+        /**
+         * All canvas layouts are evaluated.
+         */
+        NONE,
+        /**
+         * If the design problem is mirror-symmetric, only one canvas layout of each pair of mirror images is
+         * evaluated, and only the designs found among them are returned.
+         */
+        CANONICAL_ONLY,
+        /**
+         * Like `CANONICAL_ONLY`, but the mirror images of the designs found are returned as well.
+         */
+        CANONICAL_AND_MIRRORED
+    };
     /**
      * Parameters for the `is_operational` function.
      */
@@ -105,9 +138,33 @@ struct design_sidb_gates_params
     /**
      * The design process is terminated after a valid SiDB gate design is found.
      *
-     * @note This parameter has no effect unless the gate design is exhaustive.
+     * @note This parameter has no effect unless the gate design is exhaustive. The canvas layouts are evaluated in a
+     * random order, so which designs are returned with `AFTER_FIRST_SOLUTION` may differ between runs.
      */
     termination_condition termination_cond = termination_condition::AFTER_FIRST_SOLUTION;
+    /**
+     * Exploitation of the mirror symmetry of the design problem. A design problem is mirror-symmetric if the skeleton
+     * including its atomic defects, the canvas, and the BDL wires are symmetric under mirroring at the vertical axis
+     * through the center of the canvas, and the specification is invariant under the resulting permutation of inputs
+     * and outputs, as is, e.g., an AND, OR, XOR, or MAJ gate whose input wires mirror each other. The mirror image of
+     * an operational gate is then operational as well, so that only canonical canvas layouts need to be evaluated,
+     * which roughly halves the search space.
+     *
+     * @note This parameter has no effect on the random gate design.
+     */
+    symmetry_reduction symmetry = symmetry_reduction::NONE;
+    /**
+     * If `true`, *QuickCell* computes the distances and potentials between the SiDBs of the skeleton with each input
+     * pattern applied and all cells within the canvas once, such that the charge distribution surfaces of all canvas
+     * layouts copy them from the resulting geometry caches. The designed gates are the same either way.
+     *
+     * @note This parameter has no effect unless *QuickCell* or its pruning is used.
+     */
+    bool cache_input_pattern_geometries = true;
+    /**
+     * Number of threads to be used for the design process. Values below `1` are treated as `1`.
+     */
+    std::size_t number_of_threads{std::max(std::size_t{std::thread::hardware_concurrency()}, std::size_t{1})};
 };
 
 /**
@@ -144,6 +201,14 @@ struct design_sidb_gates_stats
      * The number of layouts that remain after third pruning (discarding layouts with unstable I/O signals).
      */
     std::size_t number_of_layouts_after_third_pruning{0};
+    /**
+     * Whether the design problem is mirror-symmetric. This is only determined if symmetry reduction is enabled.
+     */
+    bool mirror_symmetric{false};
+    /**
+     * The number of layouts that were not evaluated since they are the mirror image of an evaluated layout.
+     */
+    std::size_t number_of_skipped_mirror_images{0};
     /**
      * This function outputs the total time taken for the SiDB gate design process to the provided output stream.
      * If no output stream is provided, it defaults to standard output (`std::cout`).
@@ -187,10 +252,21 @@ class design_sidb_gates_impl
                                               bdl_wire_selection::OUTPUT)},
             number_of_input_wires{input_bdl_wires.size()},
             number_of_output_wires{output_bdl_wires.size()},
-            all_canvas_layouts{determine_all_possible_canvas_layouts()}
+            number_of_canvas_combinations{params.number_of_canvas_sidbs == 0 ?
+                                              0 :
+                                              binomial_coefficient(all_sidbs_in_canvas.size(),
+                                                                   params.number_of_canvas_sidbs)},
+            number_of_canvas_layouts{determine_number_of_canvas_layouts()}
     {
-        stats.number_of_layouts = all_canvas_layouts.size();
+        stats.number_of_layouts = static_cast<std::size_t>(number_of_canvas_layouts);
         stats.sim_engine        = params.operational_params.sim_engine;
+
+        if (params.symmetry != design_sidb_gates_params<cell<Lyt>>::symmetry_reduction::NONE &&
+            params.design_mode != design_sidb_gates_params<cell<Lyt>>::design_sidb_gates_mode::RANDOM)
+        {
+            canvas_mirror_indices  = determine_canvas_mirror_indices();
+            stats.mirror_symmetric = canvas_mirror_indices.has_value();
+        }
     }
 
     /**
@@ -207,86 +283,47 @@ class design_sidb_gates_impl
     {
         mockturtle::stopwatch stop{stats.time_total};
 
-        auto all_combinations = determine_all_combinations_of_distributing_k_entities_on_n_positions(
-            params.number_of_canvas_sidbs, static_cast<std::size_t>(all_sidbs_in_canvas.size()));
-
         std::vector<Lyt> designed_gate_layouts = {};
 
-        if (all_combinations.empty())
-        {
-            return designed_gate_layouts;
-        }
-
         std::mutex mutex_to_protect_designed_gate_layouts{};
 
         std::atomic<bool> solution_found = false;
 
-        // Shuffle the combinations before dividing them among threads
-        std::shuffle(all_combinations.begin(), all_combinations.end(),
-                     std::default_random_engine(std::random_device{}()));
-
-        const auto add_combination_to_layout_and_check_operation = [this, &mutex_to_protect_designed_gate_layouts,
-                                                                    &designed_gate_layouts,
-                                                                    &solution_found](const auto& combination) noexcept
-        {
-            // canvas SiDBs are added to the skeleton
-            const auto layout_with_added_cells = skeleton_layout_with_canvas_sidbs(combination);
-
-            if (const auto [status, sim_calls] = is_operational(
-                    layout_with_added_cells, truth_table, params.operational_params, input_bdl_wires, output_bdl_wires);
-                status == operational_status::OPERATIONAL)
+        for_each_canvas_combination(
+            [this, &mutex_to_protect_designed_gate_layouts, &designed_gate_layouts,
+             &solution_found](const auto& combination, Lyt& layout_with_added_cells,
+                              [[maybe_unused]] std::vector<Lyt>& input_pattern_layouts,
+                              std::vector<cell<Lyt>>&            added_cells) noexcept
             {
+                if (solution_found &&
+                    (params.termination_cond ==
+                     design_sidb_gates_params<cell<Lyt>>::termination_condition::AFTER_FIRST_SOLUTION))
                 {
-                    const std::scoped_lock lock_vector{mutex_to_protect_designed_gate_layouts};
-                    designed_gate_layouts.push_back(layout_with_added_cells);
+                    return false;
                 }
 
-                solution_found = true;
-            }
-
-            if (solution_found && (params.termination_cond ==
-                                   design_sidb_gates_params<cell<Lyt>>::termination_condition::AFTER_FIRST_SOLUTION))
-            {
-                return;
-            }
-        };
-
-        const std::size_t num_threads = std::min(number_of_threads, all_combinations.size());
+                // canvas SiDBs are added to the skeleton
+                add_canvas_sidbs(layout_with_added_cells, combination, added_cells);
 
-        const std::size_t chunk_size = (all_combinations.size() + num_threads - 1) / num_threads;  // Ceiling division
-
-        std::vector<std::thread> threads{};
-        threads.reserve(num_threads);
-
-        for (std::size_t i = 0; i < num_threads; ++i)
-        {
-            threads.emplace_back(
-                [i, chunk_size, &all_combinations, &add_combination_to_layout_and_check_operation, &solution_found,
-                 this]()
+                if (const auto [status, sim_calls] = is_operational(layout_with_added_cells, truth_table,
+                                                                    params.operational_params, input_bdl_wires,
+                                                                    output_bdl_wires);
+                    status == operational_status::OPERATIONAL)
                 {
-                    const std::size_t start_index = i * chunk_size;
-                    const std::size_t end_index   = std::min(start_index + chunk_size, all_combinations.size());
-
-                    for (std::size_t j = start_index; j < end_index; ++j)
                     {
-                        if (solution_found &&
-                            (params.termination_cond ==
-                             design_sidb_gates_params<cell<Lyt>>::termination_condition::AFTER_FIRST_SOLUTION))
-                        {
-                            return;
-                        }
-                        add_combination_to_layout_and_check_operation(all_combinations[j]);
+                        const std::scoped_lock lock_vector{mutex_to_protect_designed_gate_layouts};
+                        designed_gate_layouts.push_back(layout_with_added_cells.clone());
                     }
-                });
-        }
 
-        for (auto& thread : threads)
-        {
-            if (thread.joinable())
-            {
-                thread.join();
-            }
-        }
+                    solution_found = true;
+                }
+
+                remove_canvas_sidbs(layout_with_added_cells, added_cells);
+
+                return true;
+            });
+
+        add_mirror_images(designed_gate_layouts);
 
         return designed_gate_layouts;
     }
@@ -308,77 +345,65 @@ class design_sidb_gates_impl
             params.canvas, params.number_of_canvas_sidbs,
             generate_random_sidb_layout_params<cell<Lyt>>::positive_charges::ALLOWED};
 
-        const auto num_threads = std::min(number_of_threads, all_canvas_layouts.size());
-
-        std::vector<std::thread> threads{};
-        threads.reserve(num_threads);
+        const auto num_threads = static_cast<std::size_t>(
+            std::min(static_cast<uint64_t>(number_of_threads), number_of_canvas_layouts));
 
         std::mutex mutex_to_protect_designed_gate_layouts{};  // used to control access to shared resources
 
         std::atomic<bool> gate_layout_is_found(false);
 
-        for (uint64_t z = 0u; z < num_threads; z++)
+        // each task keeps drawing random layouts until one of them finds an operational layout
+        const auto design_randomly = [this, &gate_layout_is_found, &mutex_to_protect_designed_gate_layouts, &parameter,
+                                      &randomly_designed_gate_layouts](const std::size_t)
         {
-            threads.emplace_back(
-                [this, &gate_layout_is_found, &mutex_to_protect_designed_gate_layouts, &parameter,
-                 &randomly_designed_gate_layouts]
-                {
-                    while (!gate_layout_is_found)
-                    {
-                        auto result_lyt = generate_random_sidb_layout<Lyt>(parameter, skeleton_layout);
-
-                        if (!result_lyt.has_value())
-                        {
-                            continue;
-                        }
+            while (!gate_layout_is_found)
+            {
+                auto result_lyt = generate_random_sidb_layout<Lyt>(parameter, skeleton_layout);
 
-                        if constexpr (has_get_sidb_defect_v<Lyt>)
-                        {
-                            result_lyt.value().foreach_sidb_defect(
-                                [&result_lyt](const auto& cd)
-                                {
-                                    if (is_neutrally_charged_defect(cd.second))
-                                    {
-                                        result_lyt.value().assign_sidb_defect(cd.first,
-                                                                              sidb_defect{sidb_defect_type::NONE});
-                                    }
-                                });
-                        }
+                if (!result_lyt.has_value())
+                {
+                    continue;
+                }
 
-                        if (const auto [status, sim_calls] =
-                                is_operational(result_lyt.value(), truth_table, params.operational_params,
-                                               input_bdl_wires, output_bdl_wires);
-                            status == operational_status::OPERATIONAL)
+                if constexpr (has_get_sidb_defect_v<Lyt>)
+                {
+                    result_lyt.value().foreach_sidb_defect(
+                        [&result_lyt](const auto& cd)
                         {
-                            const std::scoped_lock lock{mutex_to_protect_designed_gate_layouts};
-
-                            if constexpr (has_get_sidb_defect_v<Lyt>)
+                            if (is_neutrally_charged_defect(cd.second))
                             {
-                                skeleton_layout.foreach_sidb_defect(
-                                    [&result_lyt](const auto& cd)
-                                    {
-                                        if (is_neutrally_charged_defect(cd.second))
-                                        {
-                                            result_lyt.value().assign_sidb_defect(cd.first, cd.second);
-                                        }
-                                    });
+                                result_lyt.value().assign_sidb_defect(cd.first, sidb_defect{sidb_defect_type::NONE});
                             }
+                        });
+                }
 
-                            randomly_designed_gate_layouts.push_back(result_lyt.value());
-                            gate_layout_is_found = true;
-                            break;
-                        }
+                if (const auto [status, sim_calls] =
+                        is_operational(result_lyt.value(), truth_table, params.operational_params, input_bdl_wires,
+                                       output_bdl_wires);
+                    status == operational_status::OPERATIONAL)
+                {
+                    const std::scoped_lock lock{mutex_to_protect_designed_gate_layouts};
+
+                    if constexpr (has_get_sidb_defect_v<Lyt>)
+                    {
+                        skeleton_layout.foreach_sidb_defect(
+                            [&result_lyt](const auto& cd)
+                            {
+                                if (is_neutrally_charged_defect(cd.second))
+                                {
+                                    result_lyt.value().assign_sidb_defect(cd.first, cd.second);
+                                }
+                            });
                     }
-                });
-        }
 
-        for (auto& thread : threads)
-        {
-            if (thread.joinable())
-            {
-                thread.join();
+                    randomly_designed_gate_layouts.push_back(result_lyt.value());
+                    gate_layout_is_found = true;
+                    break;
+                }
             }
-        }
+        };
+
+        shared_work_stealing_thread_pool(number_of_threads).for_each_index(num_threads, design_randomly);
 
         return randomly_designed_gate_layouts;
     }
@@ -393,15 +418,16 @@ class design_sidb_gates_impl
         mockturtle::stopwatch stop{stats.time_total};
 
         std::vector<Lyt> gate_candidates{};
-        gate_candidates.reserve(all_canvas_layouts.size());
 
         {
             mockturtle::stopwatch stop_pruning{stats.pruning_total};
+
+            initialize_input_pattern_skeletons();
             gate_candidates = run_pruning();
         }
 
-        stats.number_of_layouts_after_first_pruning =
-            all_canvas_layouts.size() - number_of_discarded_layouts_at_first_pruning.load();
+        stats.number_of_layouts_after_first_pruning = stats.number_of_layouts - stats.number_of_skipped_mirror_images -
+                                                      number_of_discarded_layouts_at_first_pruning.load();
         stats.number_of_layouts_after_second_pruning =
             stats.number_of_layouts_after_first_pruning - number_of_discarded_layouts_at_second_pruning.load();
         stats.number_of_layouts_after_third_pruning =
@@ -419,6 +445,8 @@ class design_sidb_gates_impl
         {
             // If the design mode is PRUNING_ONLY, we only need to return the gate candidates that passed the pruning
             // steps.
+            add_mirror_images(gate_candidates);
+
             return gate_candidates;
         }
 
@@ -426,15 +454,12 @@ class design_sidb_gates_impl
 
         gate_layouts.reserve(gate_candidates.size());
 
-        const std::size_t num_threads = std::min(number_of_threads, gate_candidates.size());
-
-        const std::size_t chunk_size = (gate_candidates.size() + num_threads - 1) / num_threads;  // Ceiling division
-
-        std::vector<std::thread> threads;
-        threads.reserve(num_threads);
-
         std::atomic<bool> gate_design_found = false;
 
+        // pruning was already conducted above. Hence, SIMULATION_ONLY is chosen.
+        params.operational_params.strategy_to_analyze_operational_status =
+            is_operational_params::operational_analysis_strategy::SIMULATION_ONLY;
+
         const auto check_operational_status =
             [this, &gate_layouts, &mutex_to_protect_gate_designs, &gate_design_found](const auto& candidate) noexcept
         {
@@ -445,52 +470,47 @@ class design_sidb_gates_impl
                 return;
             }
 
-            // pruning was already conducted above. Hence, SIMULATION_ONLY is chosen.
-            params.operational_params.strategy_to_analyze_operational_status =
-                is_operational_params::operational_analysis_strategy::SIMULATION_ONLY;
+            auto candidate_input_pattern_layouts = clone_input_pattern_skeletons();
 
-            if (const auto [status, sim_calls] = is_operational(candidate, truth_table, params.operational_params,
-                                                                input_bdl_wires, output_bdl_wires);
-                status == operational_status::OPERATIONAL)
-            {
-                // Lock and update shared resources
-                {
-                    const std::scoped_lock lock{mutex_to_protect_gate_designs};
-                    gate_layouts.push_back(candidate);
-                }
-                gate_design_found = true;  // Notify all threads that a solution has been found
-            }
-        };
+            Lyt canvas_lyt{};
 
-        for (std::size_t i = 0; i < num_threads; ++i)
-        {
-            threads.emplace_back(
-                [this, i, chunk_size, &gate_candidates, &check_operational_status, &gate_design_found]()
+            candidate.foreach_cell(
+                [this, &candidate, &candidate_input_pattern_layouts, &canvas_lyt](const auto& c)
                 {
-                    const std::size_t start_index = i * chunk_size;
-                    const std::size_t end_index   = std::min(start_index + chunk_size, gate_candidates.size());
-
-                    for (std::size_t j = start_index; j < end_index; ++j)
+                    if (skeleton_layout.get_cell_type(c) == sidb_technology::cell_type::EMPTY)
                     {
-                        if (gate_design_found &&
-                            (params.termination_cond ==
-                             design_sidb_gates_params<cell<Lyt>>::termination_condition::AFTER_FIRST_SOLUTION))
+                        for (auto& lyt : candidate_input_pattern_layouts)
                         {
-                            return;
+                            lyt.assign_cell_type(c, sidb_technology::cell_type::LOGIC);
                         }
+                    }
 
-                        check_operational_status(gate_candidates[j]);
+                    if (candidate.get_cell_type(c) == sidb_technology::cell_type::LOGIC)
+                    {
+                        canvas_lyt.assign_cell_type(c, sidb_technology::cell_type::LOGIC);
                     }
                 });
-        }
 
-        for (auto& thread : threads)
-        {
-            if (thread.joinable())
+            detail::is_operational_impl<Lyt, TT> is_operational_impl{
+                candidate_input_pattern_layouts, truth_table, params.operational_params, input_bdl_wires,
+                output_bdl_wires,                canvas_lyt,  input_pattern_geometries_if_cached()};
+
+            if (const auto [status, _] = is_operational_impl.run(); status == operational_status::OPERATIONAL)
             {
-                thread.join();
+                // Lock and update shared resources
+                {
+                    const std::scoped_lock lock{mutex_to_protect_gate_designs};
+                    gate_layouts.push_back(candidate);
+                }
+                gate_design_found = true;  // Notify all threads that a solution has been found
             }
-        }
+        };
+
+        shared_work_stealing_thread_pool(number_of_threads)
+            .for_each_index(gate_candidates.size(), [&gate_candidates, &check_operational_status](const std::size_t i)
+                            { check_operational_status(gate_candidates[i]); });
+
+        add_mirror_images(gate_layouts);
 
         return gate_layouts;
     }
@@ -534,9 +554,18 @@ class design_sidb_gates_impl
      */
     const std::size_t number_of_output_wires;
     /**
-     * All Canvas SiDB layout (without I/O pins).
+     * Number of combinations of distributing the canvas SiDBs on the cells within the canvas.
+     */
+    const uint64_t number_of_canvas_combinations;
+    /**
+     * Number of canvas layouts, i.e., of combinations that do not place any canvas SiDB on an atomic defect.
      */
-    const std::vector<Lyt> all_canvas_layouts{};
+    const uint64_t number_of_canvas_layouts;
+    /**
+     * Number of consecutive combinations that form one task of the canvas enumeration. Each task unranks its first
+     * combination and advances to the following ones in place.
+     */
+    static constexpr uint64_t combinations_per_task = 64;
     /**
      * Number of discarded layouts at first pruning.
      */
@@ -552,7 +581,85 @@ class design_sidb_gates_impl
     /**
      * Number of threads to be used for the design process.
      */
-    std::size_t number_of_threads{std::thread::hardware_concurrency()};
+    const std::size_t number_of_threads{std::max(params.number_of_threads, std::size_t{1})};
+    /**
+     * The skeleton with each input pattern applied, indexed by input pattern. Together with `input_pattern_geometries`,
+     * it forms the context that *QuickCell* shares between all canvas layouts.
+     */
+    std::vector<Lyt> input_pattern_skeletons{};
+    /**
+     * Geometry caches of the input pattern skeletons, indexed by input pattern. Each of them covers all cells within
+     * the canvas in addition to the SiDBs of its skeleton. The charge distribution surfaces of all canvas layouts thus
+     * copy their distance and potential matrices from these caches instead of recomputing the interactions between the
+     * skeleton SiDBs.
+     */
+    std::vector<std::shared_ptr<const sidb_geometry_cache<cell<Lyt>>>> input_pattern_geometries{};
+    /**
+     * Index of the mirror image of each cell within the canvas if symmetry reduction is enabled and the design problem
+     * is mirror-symmetric, and `std::nullopt` otherwise.
+     */
+    std::optional<std::vector<std::size_t>> canvas_mirror_indices{};
+    /**
+     * Applies each input pattern to the skeleton and caches the geometry of the resulting layouts together with all
+     * cells within the canvas. This is done once before the canvas layouts are evaluated.
+     */
+    void initialize_input_pattern_skeletons() noexcept
+    {
+        input_pattern_skeletons = generate_bdl_input_pattern_layouts(
+            skeleton_layout, params.operational_params.input_bdl_iterator_params, input_bdl_wires);
+
+        input_pattern_geometries.clear();
+
+        if (!params.cache_input_pattern_geometries)
+        {
+            return;
+        }
+
+        input_pattern_geometries.reserve(input_pattern_skeletons.size());
+
+        for (const auto& skeleton : input_pattern_skeletons)
+        {
+            auto skeleton_with_canvas = skeleton.clone();
+
+            for (const auto& c : all_sidbs_in_canvas)
+            {
+                if (skeleton_with_canvas.get_cell_type(c) == sidb_technology::cell_type::EMPTY)
+                {
+                    skeleton_with_canvas.assign_cell_type(c, sidb_technology::cell_type::LOGIC);
+                }
+            }
+
+            input_pattern_geometries.push_back(
+                std::make_shared<const sidb_geometry_cache<cell<Lyt>>>(skeleton_with_canvas));
+        }
+    }
+    /**
+     * Returns the geometry caches of the input pattern skeletons if they are enabled.
+     *
+     * @return Pointer to the geometry caches of the input pattern skeletons, or `nullptr` if they are disabled.
+     */
+    [[nodiscard]] const std::vector<std::shared_ptr<const sidb_geometry_cache<cell<Lyt>>>>*
+    input_pattern_geometries_if_cached() const noexcept
+    {
+        return params.cache_input_pattern_geometries ? &input_pattern_geometries : nullptr;
+    }
+    /**
+     * Creates independent copies of the input pattern skeletons.
+     *
+     * @return A copy of each input pattern skeleton, indexed by input pattern.
+     */
+    [[nodiscard]] std::vector<Lyt> clone_input_pattern_skeletons() const noexcept
+    {
+        std::vector<Lyt> lyts{};
+        lyts.reserve(input_pattern_skeletons.size());
+
+        for (const auto& skeleton : input_pattern_skeletons)
+        {
+            lyts.push_back(skeleton.clone());
+        }
+
+        return lyts;
+    }
     /**
      * This function processes each layout to determine if it represents a valid gate implementation or if it can be
      * pruned by using three distinct physically-informed pruning steps. It leverages multi-threading to accelerate the
@@ -564,15 +671,23 @@ class design_sidb_gates_impl
     {
         std::vector<Lyt> gate_candidate = {};
 
-        if (all_canvas_layouts.empty())
-        {
-            return gate_candidate;
-        }
-
         std::mutex mutex_to_protect_gate_candidates{};  // used to control access to shared resources
 
+        // the canvas SiDBs that the skeleton already exhibits (partially filled canvas) are part of every canvas layout
+        Lyt skeleton_canvas_layout{};
+
+        skeleton_layout.foreach_cell(
+            [this, &skeleton_canvas_layout](const auto& c)
+            {
+                if (skeleton_layout.get_cell_type(c) == sidb_technology::cell_type::LOGIC)
+                {
+                    skeleton_canvas_layout.assign_cell_type(c, Lyt::technology::cell_type::LOGIC);
+                }
+            });
+
         // Function to check validity and add layout to all_designs
-        auto conduct_pruning_steps = [&](const Lyt& canvas_lyt)
+        const auto conduct_pruning_steps =
+            [&](const Lyt& current_layout, const std::vector<Lyt>& input_pattern_layouts, const Lyt& canvas_lyt)
         {
             // If the canvas layout is empty, skip further processing
             if (canvas_lyt.is_empty())
@@ -580,32 +695,15 @@ class design_sidb_gates_impl
                 return;
             }
 
-            auto current_layout = skeleton_layout.clone();
-
-            cell<Lyt> dependent_cell{};
-
-            canvas_lyt.foreach_cell(
-                [&current_layout, &dependent_cell](const auto& c)
-                {
-                    current_layout.assign_cell_type(c, Lyt::technology::cell_type::LOGIC);
-                    dependent_cell = c;
-                });
-
-            charge_distribution_surface<Lyt> cds_canvas{canvas_lyt, params.operational_params.simulation_parameters,
-                                                        sidb_charge_state::NEGATIVE,
-                                                        cds_configuration::CHARGE_LOCATION_ONLY};
-
-            cds_canvas.assign_dependent_cell(dependent_cell);
-
-            auto bii = bdl_input_iterator<Lyt>{current_layout, params.operational_params.input_bdl_iterator_params,
-                                               input_bdl_wires};
-
+            // the skeleton with each input pattern applied and the interactions between its SiDBs are shared by all
+            // canvas layouts; only the rows and columns of the canvas SiDBs are copied in from the geometry caches
             detail::is_operational_impl<Lyt, TT> is_operational_impl{
-                current_layout, truth_table, params.operational_params, input_bdl_wires, output_bdl_wires, canvas_lyt};
+                input_pattern_layouts, truth_table, params.operational_params, input_bdl_wires,
+                output_bdl_wires,      canvas_lyt,  input_pattern_geometries_if_cached()};
 
-            for (auto i = 0u; i < truth_table.front().num_bits(); ++i, ++bii)
+            for (auto i = 0u; i < truth_table.front().num_bits(); ++i)
             {
-                const auto reason_for_filtering = is_operational_impl.is_layout_invalid(bii.get_current_input_index());
+                const auto reason_for_filtering = is_operational_impl.is_layout_invalid(i);
 
                 if (reason_for_filtering.has_value())
                 {
@@ -636,114 +734,538 @@ class design_sidb_gates_impl
             }
 
             const std::scoped_lock lock{mutex_to_protect_gate_candidates};
-            gate_candidate.push_back(current_layout);
+            gate_candidate.push_back(current_layout.clone());
         };
 
-        gate_candidate.reserve(all_canvas_layouts.size());
+        for_each_canvas_combination(
+            [this, &skeleton_canvas_layout, &conduct_pruning_steps](
+                const auto& combination, Lyt& current_layout, std::vector<Lyt>& input_pattern_layouts,
+                std::vector<cell<Lyt>>& added_cells)
+            {
+                // SiDBs cannot be placed on positions which are already occupied by atomic defects
+                if (is_placed_on_defect(combination))
+                {
+                    return true;
+                }
 
-        const std::size_t num_threads = std::min(number_of_threads, all_canvas_layouts.size());
-        const std::size_t chunk_size  = (all_canvas_layouts.size() + num_threads - 1) / num_threads;
+                add_canvas_sidbs(current_layout, combination, added_cells);
+                add_canvas_sidbs(input_pattern_layouts, added_cells);
 
-        std::vector<std::thread> threads{};
-        threads.reserve(num_threads);
+                // the canvas layout only holds a handful of SiDBs and is therefore built from scratch
+                auto canvas_lyt = skeleton_canvas_layout.clone();
 
-        for (std::size_t i = 0; i < num_threads; ++i)
-        {
-            threads.emplace_back(
-                [i, chunk_size, this, &conduct_pruning_steps]()
+                for (const auto& c : added_cells)
                 {
-                    const std::size_t start_index = i * chunk_size;
-                    const std::size_t end_index   = std::min(start_index + chunk_size, all_canvas_layouts.size());
+                    canvas_lyt.assign_cell_type(c, Lyt::technology::cell_type::LOGIC);
+                }
 
-                    for (std::size_t j = start_index; j < end_index; ++j)
-                    {
-                        conduct_pruning_steps(all_canvas_layouts[j]);
-                    }
-                });
+                conduct_pruning_steps(current_layout, input_pattern_layouts, canvas_lyt);
+
+                remove_canvas_sidbs(current_layout, added_cells);
+
+                for (auto& lyt : input_pattern_layouts)
+                {
+                    remove_canvas_sidbs(lyt, added_cells);
+                }
+
+                return true;
+            });
+
+        return gate_candidate;
+    }
+    /**
+     * Determines the number of canvas layouts, i.e., of combinations of distributing the canvas SiDBs on the cells
+     * within the canvas that do not place any SiDB on an atomic defect of the skeleton.
+     *
+     * @return The number of canvas layouts.
+     */
+    [[nodiscard]] uint64_t determine_number_of_canvas_layouts() const noexcept
+    {
+        if (params.number_of_canvas_sidbs == 0)
+        {
+            return 0;
         }
 
-        for (auto& thread : threads)
+        uint64_t number_of_defect_positions = 0;
+
+        if constexpr (is_sidb_defect_surface_v<Lyt>)
         {
-            if (thread.joinable())
+            number_of_defect_positions = static_cast<uint64_t>(std::ranges::count_if(
+                all_sidbs_in_canvas,
+                [this](const auto& c)
+                {
+                    return skeleton_layout.get_cell_type(c) == sidb_technology::cell_type::EMPTY &&
+                           skeleton_layout.get_sidb_defect(c).type != sidb_defect_type::NONE;
+                }));
+        }
+
+        return binomial_coefficient(all_sidbs_in_canvas.size() - number_of_defect_positions,
+                                    params.number_of_canvas_sidbs);
+    }
+    /**
+     * Computes `(a * b) mod n` without overflow for `a, b < n` by doubling and adding.
+     *
+     * @param a First factor.
+     * @param b Second factor.
+     * @param n Modulus.
+     * @return `(a * b) mod n`.
+     */
+    [[nodiscard]] static uint64_t multiply_modulo(uint64_t a, uint64_t b, const uint64_t n) noexcept
+    {
+        uint64_t result = 0;
+
+        for (; b != 0; b >>= 1u)
+        {
+            if ((b & 1u) != 0)
             {
-                thread.join();
+                result = result >= n - a ? result - (n - a) : result + a;
             }
+
+            a = a >= n - a ? a - (n - a) : a + a;
         }
 
-        return gate_candidate;
+        return result;
     }
+    /**
+     * Enumerates all combinations of distributing the canvas SiDBs on the cells within the canvas without storing them.
+     * The combinations are split into tasks of `combinations_per_task` consecutive ranks, which are distributed over
+     * the threads with work stealing. The tasks are visited in a random order such that an early termination does not
+     * favor the combinations of lowest rank. Each task works on its own copy of the skeleton layout and of the input
+     * pattern skeletons, which `fn` may modify as long as it restores them before returning. If the design problem is
+     * mirror-symmetric, `fn` is only called for canonical combinations.
+     *
+     * @tparam Fn Functor type with signature
+     * `bool(const std::vector<std::size_t>&, Lyt&, std::vector<Lyt>&, std::vector<cell<Lyt>>&)`.
+     * @param fn Function that is called with each combination of canvas cell indices, the skeleton layout of the
+     * current task, the input pattern skeletons of the current task (empty if they were not initialized), and a buffer
+     * for the cells it adds. Returning `false` stops the enumeration.
+     */
+    template <typename Fn>
+    void for_each_canvas_combination(Fn&& fn) const noexcept
+    {
+        const auto number_of_tasks =
+            (number_of_canvas_combinations + combinations_per_task - 1) / combinations_per_task;
+
+        // the tasks are visited in the order of a random affine bijection i -> (offset + stride * i) mod n, whose
+        // stride is coprime to n, which shuffles them without materializing a permutation
+        std::mt19937_64                         generator{std::random_device{}()};
+        std::uniform_int_distribution<uint64_t> distribution{0, std::max(number_of_tasks, uint64_t{1}) - 1};
+
+        const auto offset = distribution(generator);
+        auto       stride = distribution(generator);
+
+        while (number_of_tasks > 1 && std::gcd(stride, number_of_tasks) != 1)
+        {
+            stride = (stride + 1) % number_of_tasks;
+        }
+
+        std::atomic<bool> stop = false;
+
+        std::atomic<std::size_t> number_of_skipped_mirror_images{0};
+
+        shared_work_stealing_thread_pool(number_of_threads)
+            .for_each_index(static_cast<std::size_t>(number_of_tasks),
+                            [this, &fn, &stop, &number_of_skipped_mirror_images, number_of_tasks, offset,
+                             stride](const std::size_t i) noexcept
+                            {
+                                const auto task =
+                                    (multiply_modulo(stride, static_cast<uint64_t>(i), number_of_tasks) + offset) %
+                                    number_of_tasks;
+
+                                const auto first_rank = task * combinations_per_task;
+                                const auto last_rank =
+                                    std::min(first_rank + combinations_per_task, number_of_canvas_combinations);
+
+                                auto combination = unrank_combination_of_distributing_k_entities_on_n_positions(
+                                    first_rank, params.number_of_canvas_sidbs, all_sidbs_in_canvas.size());
+
+                                auto layout                = skeleton_layout.clone();
+                                auto input_pattern_layouts = clone_input_pattern_skeletons();
+
+                                std::vector<cell<Lyt>> added_cells{};
+                                added_cells.reserve(params.number_of_canvas_sidbs);
+
+                                std::vector<std::size_t> mirrored_combination{};
+                                mirrored_combination.reserve(params.number_of_canvas_sidbs);
+
+                                for (auto rank = first_rank; rank < last_rank && !stop; ++rank)
+                                {
+                                    if (!is_canonical_combination(combination, mirrored_combination))
+                                    {
+                                        // combinations on atomic defects are not counted as canvas layouts
+                                        if (!is_placed_on_defect(combination))
+                                        {
+                                            ++number_of_skipped_mirror_images;
+                                        }
+                                    }
+                                    else if (!fn(combination, layout, input_pattern_layouts, added_cells))
+                                    {
+                                        stop = true;
+                                        return;
+                                    }
+
+                                    next_combination_of_distributing_k_entities_on_n_positions(
+                                        combination, all_sidbs_in_canvas.size());
+                                }
+                            });
 
+        stats.number_of_skipped_mirror_images = number_of_skipped_mirror_images.load();
+    }
     /**
-     * This function calculates all combinations of distributing a given number of SiDBs across a specified number of
-     * positions in the canvas. Each combination is then used to create a gate layout candidate.
+     * Determines whether the design problem is symmetric under mirroring at the vertical axis through the center of the
+     * canvas. This is the case if
+     * - the skeleton with its atomic defects and the canvas are mapped onto themselves,
+     * - each input and output BDL wire is mapped onto a wire of the same kind such that the charge states encoding a
+     * bit are mapped onto the ones that encode the same bit,
+     * - the layout of each input pattern is mapped onto the layout of the input pattern with the permuted bits, and
+     * - the specification is invariant under the permutation of inputs and outputs.
+     *
+     * Since the electrostatic model only depends on the distances between SiDBs, the mirror image of a canvas layout
+     * is then operational if and only if the layout itself is.
      *
-     * @return A vector containing all possible gate layouts generated from the combinations.
+     * @return The index of the mirror image of each cell within the canvas, or `std::nullopt` if the design problem is
+     * not mirror-symmetric.
      */
-    [[nodiscard]] std::vector<Lyt> determine_all_possible_canvas_layouts() const noexcept
+    [[nodiscard]] std::optional<std::vector<std::size_t>> determine_canvas_mirror_indices() const noexcept
     {
-        const auto all_combinations = determine_all_combinations_of_distributing_k_entities_on_n_positions(
-            params.number_of_canvas_sidbs, static_cast<std::size_t>(all_sidbs_in_canvas.size()));
+        if (all_sidbs_in_canvas.empty() || number_of_input_wires == 0 || truth_table.size() != number_of_output_wires)
+        {
+            return std::nullopt;
+        }
 
-        std::vector<Lyt> designed_gate_layouts = {};
-        designed_gate_layouts.reserve(all_combinations.size());
+        // positions are compared in units of 10 fm, which tells all lattice sites apart and absorbs rounding errors
+        const auto position_key = [this](const cell<Lyt>& c, const bool mirrored, const double axis = 0.0) noexcept
+        {
+            const auto [x, y] = sidb_nm_position(skeleton_layout, c);
+
+            return std::pair{std::llround((mirrored ? 2 * axis - x : x) * 1e5), std::llround(y * 1e5)};
+        };
 
-        const auto add_cell_combination_to_layout = [this, &designed_gate_layouts](const auto& combination) noexcept
+        const auto [min_x, max_x] = std::ranges::minmax(
+            all_sidbs_in_canvas | std::views::transform([this](const auto& c)
+                                                        { return sidb_nm_position(skeleton_layout, c).first; }));
+        const auto axis = (min_x + max_x) / 2;
+
+        // all cells that a skeleton cell, an atomic defect, or a canvas cell may be mapped onto
+        std::map<std::pair<long long, long long>, cell<Lyt>>   cells_by_position{};
+        std::map<std::pair<long long, long long>, std::size_t> canvas_indices_by_position{};
+
+        for (std::size_t i = 0; i < all_sidbs_in_canvas.size(); ++i)
         {
-            const auto layout_with_added_cells = design_canvas_layout(combination);
-            if (!layout_with_added_cells.has_value())
+            cells_by_position.emplace(position_key(all_sidbs_in_canvas[i], false), all_sidbs_in_canvas[i]);
+            canvas_indices_by_position.emplace(position_key(all_sidbs_in_canvas[i], false), i);
+        }
+
+        skeleton_layout.foreach_cell([&position_key, &cells_by_position](const auto& c)
+                                     { cells_by_position.emplace(position_key(c, false), c); });
+
+        if constexpr (is_sidb_defect_surface_v<Lyt>)
+        {
+            skeleton_layout.foreach_sidb_defect(
+                [&position_key, &cells_by_position](const auto& cd)
+                { cells_by_position.emplace(position_key(cd.first, false), cd.first); });
+        }
+
+        const auto mirror = [&position_key, &cells_by_position, axis](const cell<Lyt>& c) -> std::optional<cell<Lyt>>
+        {
+            if (const auto it = cells_by_position.find(position_key(c, true, axis)); it != cells_by_position.cend())
             {
-                return;
+                return it->second;
+            }
+
+            return std::nullopt;
+        };
+
+        const auto is_mirror_image = [&mirror](const Lyt& lyt, const Lyt& image)
+        {
+            if (lyt.num_cells() != image.num_cells())
+            {
+                return false;
             }
-            designed_gate_layouts.push_back(layout_with_added_cells.value());
+
+            bool mirrored = true;
+
+            lyt.foreach_cell(
+                [&mirror, &lyt, &image, &mirrored](const auto& c)
+                {
+                    const auto m = mirror(c);
+
+                    mirrored = m.has_value() && image.get_cell_type(*m) == lyt.get_cell_type(c);
+
+                    return mirrored;
+                });
+
+            return mirrored;
         };
 
-        for (const auto& combination : all_combinations)
+        if (!is_mirror_image(skeleton_layout, skeleton_layout))
         {
-            add_cell_combination_to_layout(combination);
+            return std::nullopt;
         }
 
-        return designed_gate_layouts;
+        if constexpr (is_sidb_defect_surface_v<Lyt>)
+        {
+            bool defects_mirrored = true;
+
+            skeleton_layout.foreach_sidb_defect(
+                [this, &mirror, &defects_mirrored](const auto& cd)
+                {
+                    const auto m = mirror(cd.first);
+
+                    defects_mirrored = m.has_value() && skeleton_layout.get_sidb_defect(*m) == cd.second;
+
+                    return defects_mirrored;
+                });
+
+            if (!defects_mirrored)
+            {
+                return std::nullopt;
+            }
+        }
+
+        std::vector<std::size_t> mirror_indices(all_sidbs_in_canvas.size());
+
+        for (std::size_t i = 0; i < all_sidbs_in_canvas.size(); ++i)
+        {
+            const auto it = canvas_indices_by_position.find(position_key(all_sidbs_in_canvas[i], true, axis));
+
+            if (it == canvas_indices_by_position.cend())
+            {
+                return std::nullopt;
+            }
+
+            mirror_indices[i] = it->second;
+        }
+
+        // the charge states that encode a bit depend on the direction of the wire, see `is_operational`
+        const auto encoding = [](const port_direction& port) noexcept -> uint8_t
+        {
+            if (port.dir == port_direction::SOUTH || port.dir == port_direction::EAST)
+            {
+                return 0;
+            }
+
+            return port.dir == port_direction::NONE ? 2 : 1;
+        };
+
+        const auto is_mirrored_wire = [&mirror, &encoding](const bdl_wire<Lyt>& wire, const bdl_wire<Lyt>& image)
+        {
+            return wire.pairs.size() == image.pairs.size() &&
+                   std::ranges::all_of(
+                       wire.pairs,
+                       [&](const auto& p)
+                       {
+                           const auto upper = mirror(p.upper);
+                           const auto lower = mirror(p.lower);
+
+                           return upper.has_value() && lower.has_value() &&
+                                  std::ranges::any_of(
+                                      image.pairs,
+                                      [&](const auto& q)
+                                      {
+                                          // if upper and lower swap, the encoding has to swap as well
+                                          if (q.upper == *upper && q.lower == *lower)
+                                          {
+                                              return encoding(wire.port) == encoding(image.port);
+                                          }
+                                          if (q.upper == *lower && q.lower == *upper)
+                                          {
+                                              return encoding(wire.port) + encoding(image.port) == 1;
+                                          }
+
+                                          return false;
+                                      });
+                       });
+        };
+
+        const auto wire_permutation =
+            [&is_mirrored_wire](const std::vector<bdl_wire<Lyt>>& wires) -> std::optional<std::vector<std::size_t>>
+        {
+            std::vector<std::size_t> permutation(wires.size());
+
+            for (std::size_t i = 0; i < wires.size(); ++i)
+            {
+                const auto it = std::ranges::find_if(wires, [&is_mirrored_wire, &wire = wires[i]](const auto& image)
+                                                     { return is_mirrored_wire(wire, image); });
+
+                if (it == wires.cend())
+                {
+                    return std::nullopt;
+                }
+
+                permutation[i] = static_cast<std::size_t>(std::distance(wires.cbegin(), it));
+            }
+
+            return permutation;
+        };
+
+        const auto input_permutation  = wire_permutation(input_bdl_wires);
+        const auto output_permutation = wire_permutation(output_bdl_wires);
+
+        if (!input_permutation.has_value() || !output_permutation.has_value())
+        {
+            return std::nullopt;
+        }
+
+        const auto input_patterns = generate_bdl_input_pattern_layouts(
+            skeleton_layout, params.operational_params.input_bdl_iterator_params, input_bdl_wires);
+
+        if (input_patterns.size() != truth_table.front().num_bits())
+        {
+            return std::nullopt;
+        }
+
+        for (uint64_t pattern = 0; pattern < input_patterns.size(); ++pattern)
+        {
+            // input wire i determines bit n - 1 - i of the input pattern
+            uint64_t mirrored_pattern = 0;
+
+            for (std::size_t i = 0; i < number_of_input_wires; ++i)
+            {
+                if ((pattern & (uint64_t{1ull} << (number_of_input_wires - 1 - i))) != 0ull)
+                {
+                    mirrored_pattern |= uint64_t{1ull} << (number_of_input_wires - 1 - (*input_permutation)[i]);
+                }
+            }
+
+            if (!is_mirror_image(input_patterns[pattern], input_patterns[mirrored_pattern]))
+            {
+                return std::nullopt;
+            }
+
+            for (std::size_t o = 0; o < number_of_output_wires; ++o)
+            {
+                if (kitty::get_bit(truth_table[o], pattern) !=
+                    kitty::get_bit(truth_table[(*output_permutation)[o]], mirrored_pattern))
+                {
+                    return std::nullopt;
+                }
+            }
+        }
+
+        return mirror_indices;
     }
+    /**
+     * Checks whether the given combination of canvas cells is canonical, i.e., whether it does not succeed its mirror
+     * image in lexicographical order. If the design problem is not mirror-symmetric, every combination is canonical.
+     *
+     * @param combination Ascending indices of the canvas cells.
+     * @param mirrored_combination Buffer that is overwritten with the ascending indices of the mirror image.
+     * @return `true` iff `combination` is canonical.
+     */
+    [[nodiscard]] bool is_canonical_combination(const std::vector<std::size_t>& combination,
+                                                std::vector<std::size_t>&       mirrored_combination) const noexcept
+    {
+        if (!canvas_mirror_indices.has_value())
+        {
+            return true;
+        }
 
+        mirrored_combination.clear();
+
+        for (const auto i : combination)
+        {
+            mirrored_combination.push_back((*canvas_mirror_indices)[i]);
+        }
+
+        std::ranges::sort(mirrored_combination);
+
+        return !std::ranges::lexicographical_compare(mirrored_combination, combination);
+    }
     /**
-     * This function adds SiDBs (given by indices) to the skeleton layout that is returned afterwards.
+     * Appends the mirror image of each given design that is not mirror-symmetric itself, if requested via
+     * `symmetry_reduction::CANONICAL_AND_MIRRORED` and the design problem is mirror-symmetric.
      *
-     * @param cell_indices A vector of indices of cells to be added to the skeleton layout.
-     * @return A copy of the original layout (`skeleton_layout`) with SiDB cells added at specified indices.
+     * @param designs Designs found among the canonical canvas layouts.
      */
-    [[nodiscard]] Lyt skeleton_layout_with_canvas_sidbs(const std::vector<std::size_t>& cell_indices) const noexcept
+    void add_mirror_images(std::vector<Lyt>& designs) const noexcept
     {
-        auto lyt_copy = skeleton_layout.clone();
+        if (!canvas_mirror_indices.has_value() ||
+            params.symmetry != design_sidb_gates_params<cell<Lyt>>::symmetry_reduction::CANONICAL_AND_MIRRORED)
+        {
+            return;
+        }
 
-        for (const auto i : cell_indices)
+        const auto number_of_designs = designs.size();
+        designs.reserve(2 * number_of_designs);
+
+        std::vector<std::size_t> canvas_sidbs{};
+        std::vector<std::size_t> mirrored_canvas_sidbs{};
+
+        for (std::size_t d = 0; d < number_of_designs; ++d)
         {
-            assert(i < all_sidbs_in_canvas.size() && "cell indices are out-of-range");
+            canvas_sidbs.clear();
 
-            if (lyt_copy.get_cell_type(all_sidbs_in_canvas[i]) == sidb_technology::cell_type::EMPTY)
+            for (std::size_t i = 0; i < all_sidbs_in_canvas.size(); ++i)
             {
-                if constexpr (is_sidb_defect_surface_v<Lyt>)
+                if (skeleton_layout.get_cell_type(all_sidbs_in_canvas[i]) == sidb_technology::cell_type::EMPTY &&
+                    designs[d].get_cell_type(all_sidbs_in_canvas[i]) != sidb_technology::cell_type::EMPTY)
                 {
-                    if (skeleton_layout.get_sidb_defect(all_sidbs_in_canvas[i]).type != sidb_defect_type::NONE)
-                    {
-                        continue;
-                    }
+                    canvas_sidbs.push_back(i);
                 }
-                lyt_copy.assign_cell_type(all_sidbs_in_canvas[i], sidb_technology::cell_type::LOGIC);
             }
-        }
 
-        return lyt_copy;
-    }
+            mirrored_canvas_sidbs.clear();
+
+            for (const auto i : canvas_sidbs)
+            {
+                mirrored_canvas_sidbs.push_back((*canvas_mirror_indices)[i]);
+            }
+
+            std::ranges::sort(mirrored_canvas_sidbs);
+
+            // designs that are mirror-symmetric themselves are their own mirror image
+            if (mirrored_canvas_sidbs == canvas_sidbs)
+            {
+                continue;
+            }
 
+            auto image = skeleton_layout.clone();
+
+            for (const auto i : mirrored_canvas_sidbs)
+            {
+                image.assign_cell_type(all_sidbs_in_canvas[i], sidb_technology::cell_type::LOGIC);
+            }
+
+            designs.push_back(std::move(image));
+        }
+    }
     /**
-     * This function designs canvas SiDB layouts based on given indices.
+     * Checks whether any of the given canvas cells is occupied by an atomic defect of the skeleton.
      *
-     * @param cell_indices A vector of indices of cells to be added to the skeleton layout.
-     * @return An SiDB cell-level layout consisting of canvas SidBs.
+     * @param cell_indices Indices of the canvas cells.
+     * @return `true` iff any of the cells is empty in the skeleton and occupied by an atomic defect.
      */
-    [[nodiscard]] std::optional<Lyt> design_canvas_layout(const std::vector<std::size_t>& cell_indices) const noexcept
+    [[nodiscard]] bool is_placed_on_defect(const std::vector<std::size_t>& cell_indices) const noexcept
     {
-        Lyt lyt{};
+        if constexpr (is_sidb_defect_surface_v<Lyt>)
+        {
+            return std::ranges::any_of(cell_indices,
+                                       [this](const auto i)
+                                       {
+                                           return skeleton_layout.get_cell_type(all_sidbs_in_canvas[i]) ==
+                                                      sidb_technology::cell_type::EMPTY &&
+                                                  skeleton_layout.get_sidb_defect(all_sidbs_in_canvas[i]).type !=
+                                                      sidb_defect_type::NONE;
+                                       });
+        }
+        else
+        {
+            return false;
+        }
+    }
+    /**
+     * This function adds SiDBs (given by indices) to a copy of the skeleton layout. Cells that are already occupied by
+     * the skeleton or by an atomic defect are skipped.
+     *
+     * @param lyt Copy of the skeleton layout to which the SiDBs are added.
+     * @param cell_indices A vector of indices of cells to be added to the layout.
+     * @param added_cells Buffer that is overwritten with the cells that were added.
+     */
+    void add_canvas_sidbs(Lyt& lyt, const std::vector<std::size_t>& cell_indices,
+                          std::vector<cell<Lyt>>& added_cells) const noexcept
+    {
+        added_cells.clear();
 
         for (const auto i : cell_indices)
         {
@@ -751,29 +1273,46 @@ class design_sidb_gates_impl
 
             if (skeleton_layout.get_cell_type(all_sidbs_in_canvas[i]) == sidb_technology::cell_type::EMPTY)
             {
-                // SiDBs cannot be placed on positions which are already occupied by atomic defects.
                 if constexpr (is_sidb_defect_surface_v<Lyt>)
                 {
                     if (skeleton_layout.get_sidb_defect(all_sidbs_in_canvas[i]).type != sidb_defect_type::NONE)
                     {
-                        return std::nullopt;
+                        continue;
                     }
                 }
                 lyt.assign_cell_type(all_sidbs_in_canvas[i], sidb_technology::cell_type::LOGIC);
+                added_cells.push_back(all_sidbs_in_canvas[i]);
             }
         }
-
-        // the skeleton can already exhibit some canvas SiDBs (partially filled canvas)
-        skeleton_layout.foreach_cell(
-            [this, &lyt](const auto& c)
+    }
+    /**
+     * This function adds the given canvas SiDBs to copies of the input pattern skeletons.
+     *
+     * @param lyts Copies of the input pattern skeletons to which the SiDBs are added.
+     * @param added_cells Cells that `add_canvas_sidbs` added to the copy of the skeleton layout.
+     */
+    static void add_canvas_sidbs(std::vector<Lyt>& lyts, const std::vector<cell<Lyt>>& added_cells) noexcept
+    {
+        for (auto& lyt : lyts)
+        {
+            for (const auto& c : added_cells)
             {
-                if (skeleton_layout.get_cell_type(c) == sidb_technology::cell_type::LOGIC)
-                {
-                    lyt.assign_cell_type(c, Lyt::technology::cell_type::LOGIC);
-                }
-            });
-
-        return lyt;
+                lyt.assign_cell_type(c, sidb_technology::cell_type::LOGIC);
+            }
+        }
+    }
+    /**
+     * This function removes the SiDBs that `add_canvas_sidbs` added, which restores the skeleton layout.
+     *
+     * @param lyt Layout from which the SiDBs are removed.
+     * @param added_cells Cells that were added.
+     */
+    static void remove_canvas_sidbs(Lyt& lyt, const std::vector<cell<Lyt>>& added_cells) noexcept
+    {
+        for (const auto& c : added_cells)
+        {
+            lyt.assign_cell_type(c, sidb_technology::cell_type::EMPTY);
+        }
     }
 };
 
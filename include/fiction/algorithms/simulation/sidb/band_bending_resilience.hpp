@@ -6,11 +6,17 @@
 #define FICTION_BAND_BENDING_RESILIENCE_HPP
 
 #include "fiction/algorithms/iter/bdl_input_iterator.hpp"
+#include "fiction/algorithms/simulation/sidb/charge_distribution_selection.hpp"
 #include "fiction/algorithms/simulation/sidb/physical_population_stability.hpp"
+#include "fiction/algorithms/simulation/sidb/quickexact.hpp"
+#include "fiction/utils/work_stealing_thread_pool.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <limits>
 #include <optional>
+#include <thread>
 #include <vector>
 
 namespace fiction
@@ -29,6 +35,57 @@ struct band_bending_resilience_params
      */
     bdl_input_iterator_params bdl_iterator_params{};
 };
+/**
+ * This struct stores the parameters required to simulate the band bending resilience of many SiDB layouts.
+ */
+struct band_bending_resilience_batch_params
+{
+    /**
+     * Parameters of each band bending resilience simulation.
+     */
+    band_bending_resilience_params resilience_params{};
+    /**
+     * Number of threads to distribute the layouts over. Values below `1` are treated as `1`.
+     */
+    std::size_t number_of_threads{std::thread::hardware_concurrency()};
+};
+
+namespace detail
+{
+/**
+ * Determines the population stability of the ground state of the given layout. Only the ground state is kept during the
+ * exact simulation, and no distances are computed.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @param lyt Layout to simulate.
+ * @param params Simulation parameters.
+ * @return The compact population stability information of the ground state, or `std::nullopt` if the layout has no
+ * physically valid charge distribution.
+ */
+template <typename Lyt>
+[[nodiscard]] std::optional<compact_population_stability_information>
+ground_state_population_stability(const Lyt& lyt, const sidb_simulation_parameters& params) noexcept
+{
+    quickexact_params<cell<Lyt>> qe_params{params};
+    qe_params.result_mode = simulation_result_mode::GROUND_STATE_ONLY;
+
+    const auto simulation_results = quickexact(lyt, qe_params);
+
+    if (simulation_results.charge_distributions.empty())
+    {
+        return std::nullopt;
+    }
+
+    const auto ground_state =
+        std::ranges::min_element(simulation_results.charge_distributions, [](const auto& lhs, const auto& rhs)
+                                 { return lhs.get_electrostatic_potential_energy() <
+                                          rhs.get_electrostatic_potential_energy(); });
+
+    return population_stability_of_charge_distribution(*ground_state, params);
+}
+
+}  // namespace detail
+
 /**
  * Calculates the band bending resilience. This is the minimum electrostatic potential required to induce a charge
  * change in an SiDB layout among all possible input combinations which was proposed in \"Unifying Figures of Merit: A
@@ -68,36 +125,52 @@ band_bending_resilience(const Lyt& lyt, const std::vector<TT>& spec, const band_
     // number of different input combinations
     for (auto i = 0u; i < spec.front().num_bits(); ++i, ++bii)
     {
-        const auto pop_stability = physical_population_stability<Lyt>(lyt, params.assess_population_stability_params);
-        if (!pop_stability.empty())
+        if (const auto ground_state_stability_for_given_input = detail::ground_state_population_stability(
+                lyt, params.assess_population_stability_params.simulation_parameters);
+            ground_state_stability_for_given_input.has_value())
         {
-            const auto ground_state_stability_for_given_input = pop_stability.front();
-
-            if (transition_type.has_value())
-            {
-                const auto potential_required_for_considered_transition =
-                    ground_state_stability_for_given_input.transition_potentials.at(transition_type.value()).second;
-                if (potential_required_for_considered_transition < minimal_pop_stability_for_all_inputs)
-                {
-                    minimal_pop_stability_for_all_inputs = potential_required_for_considered_transition;
-                }
-            }
-            else
-            {
-                // if no transition type is specified, we take the minimum potential required for any transition
-                for (const auto& transition : ground_state_stability_for_given_input.transition_potentials)
-                {
-                    const auto potential_required_for_transition = transition.second.second;
-                    if (potential_required_for_transition < minimal_pop_stability_for_all_inputs)
-                    {
-                        minimal_pop_stability_for_all_inputs = potential_required_for_transition;
-                    }
-                }
-            }
+            // if no transition type is specified, we take the minimum potential required for any transition
+            const auto potential_required_for_transition =
+                transition_type.has_value() ?
+                    ground_state_stability_for_given_input->transition_potential(transition_type.value()) :
+                    ground_state_stability_for_given_input->minimum_transition_potential();
+
+            minimal_pop_stability_for_all_inputs =
+                std::min(minimal_pop_stability_for_all_inputs, potential_required_for_transition);
         }
     }
     return minimal_pop_stability_for_all_inputs;
 }
+/**
+ * Calculates the band bending resilience of each of the given layouts, e.g., of all gates of a library. The layouts are
+ * distributed over `params.number_of_threads` threads.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @tparam TT Truth table type.
+ * @param layouts Layouts for which the band bending resilience is calculated.
+ * @param spec Expected Boolean function of the layouts, provided as a multi-output truth table.
+ * @param params Parameters for assessing the band bending resilience of many layouts.
+ * @param transition_type The optional type of charge transition to consider.
+ * @return The band bending resilience (in V) of each layout, in the order of `layouts`.
+ */
+template <typename Lyt, typename TT>
+[[nodiscard]] std::vector<double>
+band_bending_resilience_batch(const std::vector<Lyt>& layouts, const std::vector<TT>& spec,
+                              const band_bending_resilience_batch_params& params = {},
+                              const std::optional<transition_type>        transition_type = std::nullopt)
+{
+    std::vector<double> resilience(layouts.size(), std::numeric_limits<double>::infinity());
+
+    shared_work_stealing_thread_pool(std::max(params.number_of_threads, std::size_t{1}))
+        .for_each_index(layouts.size(),
+                        [&layouts, &spec, &params, &transition_type, &resilience](const std::size_t i)
+                        {
+                            resilience[i] =
+                                band_bending_resilience(layouts[i], spec, params.resilience_params, transition_type);
+                        });
+
+    return resilience;
+}
 
 }  // namespace fiction
 
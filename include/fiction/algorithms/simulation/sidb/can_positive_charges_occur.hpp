@@ -8,10 +8,12 @@
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
 #include "fiction/technology/charge_distribution_surface.hpp"
 #include "fiction/technology/sidb_charge_state.hpp"
+#include "fiction/technology/sidb_geometry_cache.hpp"
 #include "fiction/traits.hpp"
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 
 namespace fiction
 {
@@ -23,9 +25,12 @@ namespace fiction
  * @tparam Lyt SiDB cell-level layout type.
  * @param lyt The layout to be analyzed.
  * @param sim_params Physical parameters used to determine whether positively charged SiDBs can occur.
+ * @param geometry Optional geometry cache of `lyt` to avoid computing the potential matrix from scratch.
  */
 template <typename Lyt>
-[[nodiscard]] bool can_positive_charges_occur(const Lyt& lyt, const sidb_simulation_parameters& sim_params) noexcept
+[[nodiscard]] bool
+can_positive_charges_occur(const Lyt& lyt, const sidb_simulation_parameters& sim_params,
+                           const std::shared_ptr<const sidb_geometry_cache<cell<Lyt>>>& geometry = nullptr) noexcept
 {
     static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
     static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
@@ -33,9 +38,21 @@ template <typename Lyt>
     // The charge layout is initialized with negatively charged SiDBs. Therefore, the local electrostatic potentials are
     // maximal. In this extreme case, if the banding is not sufficient for any SiDB to be positively charged, it will
     // not be for any other charge distribution. Therefore, no positively charged SiDBs can occur.
-    charge_distribution_surface<Lyt> charge_lyt{lyt};
-    charge_lyt.assign_physical_parameters(sim_params);
-    charge_lyt.assign_all_charge_states(sidb_charge_state::NEGATIVE);
+    const auto charge_lyt = [&lyt, &sim_params, &geometry]
+    {
+        if constexpr (is_charge_distribution_surface_v<Lyt>)
+        {
+            charge_distribution_surface<Lyt> cds{lyt};
+            cds.assign_physical_parameters(sim_params);
+            cds.assign_all_charge_states(sidb_charge_state::NEGATIVE);
+
+            return cds;
+        }
+        else
+        {
+            return charge_distribution_surface<Lyt>{lyt, sim_params, geometry};
+        }
+    }();
 
     for (uint64_t i = 0; i < lyt.num_cells(); ++i)
     {
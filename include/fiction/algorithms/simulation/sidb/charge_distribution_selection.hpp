@@ -0,0 +1,247 @@
+//
+// Created by Jan Drewniok on 17.10.26.
+//
+
+#ifndef FICTION_CHARGE_DISTRIBUTION_SELECTION_HPP
+#define FICTION_CHARGE_DISTRIBUTION_SELECTION_HPP
+
+#include "fiction/technology/constants.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Selects which of the physically valid charge distributions an exact SiDB simulation algorithm returns.
+ */
+enum class simulation_result_mode : uint8_t
+{
+    /**
+     * All physically valid charge distributions are returned.
+     */
+    ALL_VALID,
+    /**
+     * Only the physically valid charge distributions with the `k` lowest electrostatic potential energies are returned,
+     * sorted by increasing energy.
+     */
+    LOWEST_K,
+    /**
+     * Only the ground state(s) are returned, i.e., all physically valid charge distributions whose electrostatic
+     * potential energy equals the lowest one.
+     */
+    GROUND_STATE_ONLY
+};
+/**
+ * Collects the charge distributions that are found during an exact SiDB simulation according to a
+ * `simulation_result_mode`. In `ALL_VALID` mode, all charge distributions are kept in the order in which they are
+ * added. In `LOWEST_K` mode, the charge distributions are kept in a max-heap of size `k` ordered by their electrostatic
+ * potential energy, such that each addition costs \f$\mathcal{O}(\log k)\f$ and memory is bounded by `k`. In
+ * `GROUND_STATE_ONLY` mode, only the charge distributions within `constants::ERROR_MARGIN` of the lowest energy seen so
+ * far are kept.
+ *
+ * Since adding a charge distribution that is not kept is a no-op, simulators can query `admits` with the energy first
+ * to avoid constructing charge distributions that would be discarded right away. Furthermore, `energy_bound` can be
+ * used to prune parts of the search space whose energy is bound to exceed it.
+ *
+ * @tparam ChargeDistribution Type of the stored charge distributions. It has to provide
+ * `get_electrostatic_potential_energy()`, e.g., `charge_distribution_surface` or `compact_charge_distribution`.
+ */
+template <typename ChargeDistribution>
+class charge_distribution_selection
+{
+  public:
+    /**
+     * Standard constructor.
+     *
+     * @param m Mode that determines which charge distributions are kept.
+     * @param k Number of charge distributions that are kept in `LOWEST_K` mode. Values below `1` are treated as `1`.
+     */
+    explicit charge_distribution_selection(const simulation_result_mode m = simulation_result_mode::ALL_VALID,
+                                           const uint64_t               k = 1) noexcept :
+            mode{m},
+            capacity{std::max(k, uint64_t{1})}
+    {}
+    /**
+     * Returns the mode that determines which charge distributions are kept.
+     *
+     * @return Selection mode.
+     */
+    [[nodiscard]] simulation_result_mode get_mode() const noexcept
+    {
+        return mode;
+    }
+    /**
+     * Returns the electrostatic potential energy that a charge distribution has to fall below in order to be kept. It
+     * is infinite in `ALL_VALID` mode and as long as fewer than `k` charge distributions are stored in `LOWEST_K` mode.
+     *
+     * @return Energy bound (unit: eV).
+     */
+    [[nodiscard]] double energy_bound() const noexcept
+    {
+        switch (mode)
+        {
+            case simulation_result_mode::LOWEST_K:
+            {
+                return charge_distributions.size() < capacity ?
+                           std::numeric_limits<double>::infinity() :
+                           charge_distributions.front().get_electrostatic_potential_energy();
+            }
+            case simulation_result_mode::GROUND_STATE_ONLY:
+            {
+                return lowest_energy + constants::ERROR_MARGIN;
+            }
+            default:
+            {
+                return std::numeric_limits<double>::infinity();
+            }
+        }
+    }
+    /**
+     * Checks whether a charge distribution with the given electrostatic potential energy would be kept if it was added
+     * now.
+     *
+     * @param energy Electrostatic potential energy of the charge distribution (unit: eV).
+     * @return `true` iff a charge distribution with energy `energy` would be kept.
+     */
+    [[nodiscard]] bool admits(const double energy) const noexcept
+    {
+        return mode == simulation_result_mode::ALL_VALID || energy < energy_bound();
+    }
+    /**
+     * Adds the given charge distribution if it is admitted. In `LOWEST_K` mode, this might evict the stored charge
+     * distribution of the highest energy. In `GROUND_STATE_ONLY` mode, all stored charge distributions that are no
+     * ground states anymore are evicted.
+     *
+     * @param cd Charge distribution to add.
+     */
+    void add(ChargeDistribution&& cd) noexcept
+    {
+        const auto energy = cd.get_electrostatic_potential_energy();
+
+        if (!admits(energy))
+        {
+            return;
+        }
+
+        switch (mode)
+        {
+            case simulation_result_mode::LOWEST_K:
+            {
+                if (charge_distributions.size() == capacity)
+                {
+                    std::ranges::pop_heap(charge_distributions, std::less<>{}, energy_of);
+                    charge_distributions.pop_back();
+                }
+
+                charge_distributions.push_back(std::move(cd));
+                std::ranges::push_heap(charge_distributions, std::less<>{}, energy_of);
+
+                break;
+            }
+            case simulation_result_mode::GROUND_STATE_ONLY:
+            {
+                if (energy < lowest_energy)
+                {
+                    lowest_energy = energy;
+
+                    std::erase_if(charge_distributions, [this](const auto& stored)
+                                  { return energy_of(stored) - lowest_energy >= constants::ERROR_MARGIN; });
+                }
+
+                charge_distributions.push_back(std::move(cd));
+
+                break;
+            }
+            default:
+            {
+                charge_distributions.push_back(std::move(cd));
+
+                break;
+            }
+        }
+    }
+    /**
+     * Adds all charge distributions of another selection in their insertion order (`ALL_VALID` mode) or in arbitrary
+     * order (other modes).
+     *
+     * @param other Selection whose charge distributions are moved into this one.
+     */
+    void merge(charge_distribution_selection&& other) noexcept
+    {
+        for (auto& cd : other.charge_distributions)
+        {
+            add(std::move(cd));
+        }
+
+        other.charge_distributions.clear();
+    }
+    /**
+     * Returns the number of stored charge distributions.
+     *
+     * @return Number of stored charge distributions.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return charge_distributions.size();
+    }
+    /**
+     * Checks whether no charge distribution is stored.
+     *
+     * @return `true` iff no charge distribution is stored.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return charge_distributions.empty();
+    }
+    /**
+     * Moves all stored charge distributions out of the selection. In `ALL_VALID` mode, they are returned in insertion
+     * order. In all other modes, they are sorted by increasing electrostatic potential energy.
+     *
+     * @return Stored charge distributions.
+     */
+    [[nodiscard]] std::vector<ChargeDistribution> extract() noexcept
+    {
+        if (mode != simulation_result_mode::ALL_VALID)
+        {
+            std::ranges::stable_sort(charge_distributions, std::less<>{}, energy_of);
+        }
+
+        lowest_energy = std::numeric_limits<double>::infinity();
+
+        return std::exchange(charge_distributions, {});
+    }
+
+  private:
+    /**
+     * Mode that determines which charge distributions are kept.
+     */
+    simulation_result_mode mode;
+    /**
+     * Number of charge distributions that are kept in `LOWEST_K` mode.
+     */
+    uint64_t capacity;
+    /**
+     * Stored charge distributions. In `LOWEST_K` mode, they form a max-heap with respect to their energy.
+     */
+    std::vector<ChargeDistribution> charge_distributions{};
+    /**
+     * Lowest energy of all charge distributions added so far (unit: eV). Only maintained in `GROUND_STATE_ONLY` mode.
+     */
+    double lowest_energy{std::numeric_limits<double>::infinity()};
+    /**
+     * Projection of a charge distribution onto its electrostatic potential energy.
+     */
+    static constexpr auto energy_of = [](const ChargeDistribution& cd) noexcept
+    { return cd.get_electrostatic_potential_energy(); };
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_CHARGE_DISTRIBUTION_SELECTION_HPP
@@ -7,6 +7,7 @@
 
 #if (FICTION_ALGLIB_ENABLED)
 
+#include "fiction/algorithms/simulation/sidb/charge_distribution_selection.hpp"
 #include "fiction/algorithms/simulation/sidb/ground_state_space.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
@@ -99,6 +100,17 @@ struct clustercomplete_params
      * option is disabled.
      */
     ground_state_space_reporting report_gss_stats = ground_state_space_reporting::OFF;
+    /**
+     * Selects which of the physically valid charge distributions are returned. In `LOWEST_K` and `GROUND_STATE_ONLY`
+     * mode, only the currently best charge distributions are kept while the charge space is unfolded, which bounds the
+     * memory consumption by the number of selected charge distributions.
+     */
+    simulation_result_mode result_mode{simulation_result_mode::ALL_VALID};
+    /**
+     * Number of charge distributions that are returned in `simulation_result_mode::LOWEST_K` mode. Values below `1` are
+     * treated as `1`.
+     */
+    uint64_t number_of_lowest_energy_states{1};
 };
 
 namespace detail
@@ -116,6 +128,7 @@ class clustercomplete_impl
      */
     clustercomplete_impl(const Lyt& lyt, const clustercomplete_params<cell<Lyt>>& params) noexcept :
             available_threads{std::max(uint64_t{1}, params.available_threads)},
+            selected_charge_distributions{params.result_mode, params.number_of_lowest_energy_states},
             charge_layout{initialize_charge_layout(lyt, params)},
             mu_bounds_with_error{constants::ERROR_MARGIN - params.simulation_parameters.mu_minus,
                                  -constants::ERROR_MARGIN - params.simulation_parameters.mu_minus,
@@ -211,6 +224,8 @@ class clustercomplete_impl
             }
         }
 
+        result.charge_distributions = selected_charge_distributions.extract();
+
         // The ClusterComplete runtime includes the runtime for the Ground State Space procedure
         result.simulation_runtime = time_counter + gss_stats.runtime;
 
@@ -234,6 +249,10 @@ class clustercomplete_impl
      * Vector containing all workers.
      */
     std::vector<std::unique_ptr<worker>> workers{};
+    /**
+     * Physically valid charge distributions that are selected for the simulation results.
+     */
+    charge_distribution_selection<charge_distribution_surface<Lyt>> selected_charge_distributions;
     /**
      * Mutex to protect the simulation results.
      */
@@ -394,7 +413,8 @@ class clustercomplete_impl
     /**
      * This function handles performs the last analysis step before collecting a simulation result. In order to judge
      * whether a population stable charge distribution is physically valid, the *configuration stability* needs to be
-     * tested. If this criterion passes, the charge distribution is added to the simulation results.
+     * tested. If this criterion passes, the charge distribution is added to the simulation results, unless its energy
+     * rules it out according to the requested result mode.
      *
      * @param clustering_state A clustering state consisting of only singleton clusters along with associated charge
      * states that make up a charge distribution that conforms to the *population stability* criterion.
@@ -440,7 +460,7 @@ class clustercomplete_impl
         {
             const std::scoped_lock lock{mutex_to_protect_the_simulation_results};
 
-            result.charge_distributions.emplace_back(charge_layout_copy);
+            selected_charge_distributions.add(std::move(charge_layout_copy));
         }
     }
     /**
@@ -0,0 +1,424 @@
+//
+// Created by Jan Drewniok on 17.10.26.
+//
+
+#ifndef FICTION_COMPACT_SIDB_SIMULATION_DOMAIN_HPP
+#define FICTION_COMPACT_SIDB_SIMULATION_DOMAIN_HPP
+
+#include "fiction/utils/phmap_utils.hpp"
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Storage backends of a `compact_sidb_simulation_domain`.
+ */
+enum class simulation_domain_storage : uint8_t
+{
+    /**
+     * The values are stored in a thread-safe hash map. The memory footprint scales with the number of stored values,
+     * which suits domains that are only sampled partially, e.g., by random sampling, flood fill, or contour tracing.
+     */
+    SPARSE,
+    /**
+     * The values are stored in a flat array with one slot per grid point, whose occupancy is tracked atomically. The
+     * memory footprint scales with the number of grid points, but lookups and insertions are lock-free, which suits
+     * domains that are sampled exhaustively, e.g., by grid search.
+     */
+    DENSE
+};
+
+/**
+ * A compact counterpart of `sidb_simulation_domain` for domains that are sampled on a regular grid. Instead of the
+ * parameter values, the key of a grid point is its step index in each dimension, packed into a single 64-bit integer
+ * with as many bits per dimension as the number of steps in that dimension requires. Keys are, therefore, compared and
+ * hashed as integers and neither allocate nor quantize floating-point values.
+ *
+ * All methods are thread-safe. Unlike `sidb_simulation_domain::for_each`, `for_each` does not copy the domain.
+ *
+ * @tparam MappedTypes Value types stored in the tuple.
+ */
+template <typename... MappedTypes>
+class compact_sidb_simulation_domain
+{
+  public:
+    /**
+     * Packed step indices of a grid point.
+     */
+    using key_type = uint64_t;
+    /**
+     * Value associated with a grid point.
+     */
+    using value_type = std::tuple<MappedTypes...>;
+    /**
+     * Constructs an empty domain without dimensions.
+     */
+    compact_sidb_simulation_domain() : compact_sidb_simulation_domain(std::vector<std::size_t>{}) {}
+    /**
+     * Standard constructor.
+     *
+     * @param num_steps Number of steps, i.e., grid points, in each dimension.
+     * @param backend Storage backend of the values.
+     * @throws std::invalid_argument if any dimension has no steps or if the step indices of all dimensions do not fit
+     * into 64 bits together.
+     */
+    explicit compact_sidb_simulation_domain(
+        const std::vector<std::size_t>& num_steps,
+        const simulation_domain_storage backend = simulation_domain_storage::SPARSE) :
+            extents{num_steps},
+            storage{backend}
+    {
+        static_assert(sizeof...(MappedTypes) > 0, "MappedTypes must not be empty");
+
+        std::size_t total_width = 0;
+
+        for (const auto extent : extents)
+        {
+            if (extent == 0)
+            {
+                throw std::invalid_argument("each dimension of a compact simulation domain needs at least one step");
+            }
+
+            const auto width = static_cast<std::size_t>(std::bit_width(static_cast<uint64_t>(extent - 1)));
+
+            offsets.push_back(total_width);
+            widths.push_back(width);
+
+            total_width += width;
+        }
+
+        if (total_width > std::numeric_limits<key_type>::digits)
+        {
+            throw std::invalid_argument("the step indices of a compact simulation domain do not fit into 64 bits");
+        }
+
+        if (storage == simulation_domain_storage::DENSE)
+        {
+            // the strides of the row-major slot index; the first dimension varies fastest
+            std::size_t num_slots = 1;
+
+            for (const auto extent : extents)
+            {
+                strides.push_back(num_slots);
+                num_slots *= extent;
+            }
+
+            dense = std::make_unique<dense_storage>(num_slots);
+        }
+    }
+    /**
+     * Packs the given step indices into a key.
+     *
+     * @param steps Step index in each dimension. Each has to be smaller than the number of steps of its dimension.
+     * @return The key of the grid point.
+     */
+    [[nodiscard]] key_type pack(const std::vector<std::size_t>& steps) const noexcept
+    {
+        key_type key = 0;
+
+        for (std::size_t d = 0; d < widths.size(); ++d)
+        {
+            if (widths[d] > 0)
+            {
+                key |= static_cast<key_type>(steps[d]) << offsets[d];
+            }
+        }
+
+        return key;
+    }
+    /**
+     * Unpacks the step indices of the given key.
+     *
+     * @param key Key of a grid point.
+     * @return The step index in each dimension.
+     */
+    [[nodiscard]] std::vector<std::size_t> unpack(const key_type key) const noexcept
+    {
+        std::vector<std::size_t> steps{};
+        steps.reserve(widths.size());
+
+        for (std::size_t d = 0; d < widths.size(); ++d)
+        {
+            steps.push_back(step_of(key, d));
+        }
+
+        return steps;
+    }
+    /**
+     * Adds a value to the domain unless the grid point already has one.
+     *
+     * @param key Key of the grid point.
+     * @param value The value to add.
+     */
+    void add_value(const key_type key, const value_type& value)
+    {
+        if (storage == simulation_domain_storage::SPARSE)
+        {
+            sparse.try_emplace(key, value);
+
+            return;
+        }
+
+        auto& slot = dense->slots[slot_index(key)];
+
+        // claim the slot, such that concurrent insertions of the same grid point do not write the value twice
+        if (auto expected = slot_state::EMPTY;
+            slot.state.compare_exchange_strong(expected, slot_state::WRITING, std::memory_order_acq_rel))
+        {
+            slot.value = value;
+            slot.state.store(slot_state::READY, std::memory_order_release);
+
+            dense->num_values.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    /**
+     * Retrieves the value of a grid point if present.
+     *
+     * @param key Key of the grid point.
+     * @return The value of the grid point if it exists, `std::nullopt` otherwise.
+     */
+    [[nodiscard]] std::optional<value_type> contains(const key_type key) const
+    {
+        if (storage == simulation_domain_storage::SPARSE)
+        {
+            std::optional<value_type> result{};
+
+            sparse.if_contains(key, [&result](const auto& entry) { result = entry.second; });
+
+            return result;
+        }
+
+        const auto& slot = dense->slots[slot_index(key)];
+
+        if (slot.state.load(std::memory_order_acquire) == slot_state::READY)
+        {
+            return slot.value;
+        }
+
+        return std::nullopt;
+    }
+    /**
+     * Counts the number of grid points that have a value.
+     *
+     * @return The size of the domain.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        if (storage == simulation_domain_storage::SPARSE)
+        {
+            return sparse.size();
+        }
+
+        return dense->num_values.load(std::memory_order_relaxed);
+    }
+    /**
+     * Checks whether the domain is empty.
+     *
+     * @return `true` if no grid point has a value, `false` otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+    /**
+     * Applies a callable to all key-value pairs in the domain without copying it. Values that are added concurrently
+     * may or may not be visited. Since the sparse backend locks each of its submaps while visiting it, `fn` must not
+     * access this domain.
+     *
+     * @tparam Fn Functor type with signature `void(key_type, const value_type&)`.
+     * @param fn Functor to apply to each key-value pair.
+     */
+    template <typename Fn>
+    void for_each(Fn&& fn) const
+    {
+        if (storage == simulation_domain_storage::SPARSE)
+        {
+            sparse.for_each([&fn](const auto& entry) { fn(entry.first, entry.second); });
+
+            return;
+        }
+
+        for (std::size_t i = 0; i < dense->slots.size(); ++i)
+        {
+            if (const auto& slot = dense->slots[i]; slot.state.load(std::memory_order_acquire) == slot_state::READY)
+            {
+                fn(slot_key(i), slot.value);
+            }
+        }
+    }
+    /**
+     * Returns the number of steps in each dimension.
+     *
+     * @return The number of steps in each dimension.
+     */
+    [[nodiscard]] const std::vector<std::size_t>& get_number_of_steps() const noexcept
+    {
+        return extents;
+    }
+    /**
+     * Returns the storage backend of the values.
+     *
+     * @return The storage backend.
+     */
+    [[nodiscard]] simulation_domain_storage get_storage() const noexcept
+    {
+        return storage;
+    }
+
+  private:
+    /**
+     * Number of steps in each dimension.
+     */
+    std::vector<std::size_t> extents;
+    /**
+     * Storage backend of the values.
+     */
+    simulation_domain_storage storage;
+    /**
+     * Bit offset of the step index of each dimension in a key.
+     */
+    std::vector<std::size_t> offsets{};
+    /**
+     * Number of bits of the step index of each dimension in a key.
+     */
+    std::vector<std::size_t> widths{};
+    /**
+     * Strides of the slot index in the dense backend.
+     */
+    std::vector<std::size_t> strides{};
+    /**
+     * States of a slot in the dense backend.
+     */
+    enum slot_state : uint8_t
+    {
+        /**
+         * The slot has no value.
+         */
+        EMPTY,
+        /**
+         * A thread is writing the value of the slot.
+         */
+        WRITING,
+        /**
+         * The slot has a value.
+         */
+        READY
+    };
+    /**
+     * A slot of the dense backend.
+     */
+    struct dense_slot
+    {
+        /**
+         * State of the slot.
+         */
+        std::atomic<slot_state> state{slot_state::EMPTY};
+        /**
+         * Value of the slot, which is only valid in state `READY`.
+         */
+        value_type value{};
+    };
+    /**
+     * The dense backend, which is kept behind a pointer to keep the domain movable despite its atomics.
+     */
+    struct dense_storage
+    {
+        /**
+         * Standard constructor.
+         *
+         * @param num_slots Number of grid points.
+         */
+        explicit dense_storage(const std::size_t num_slots) : slots(num_slots) {}
+        /**
+         * One slot per grid point.
+         */
+        std::vector<dense_slot> slots;
+        /**
+         * Number of slots in state `READY`.
+         */
+        std::atomic<std::size_t> num_values{0};
+    };
+    /**
+     * Values of the sparse backend.
+     */
+    locked_parallel_flat_hash_map<key_type, value_type> sparse{};
+    /**
+     * Values of the dense backend. Only allocated if the dense backend is used.
+     */
+    std::unique_ptr<dense_storage> dense{};
+    /**
+     * Extracts the step index of a dimension from a key.
+     *
+     * @param key Key of a grid point.
+     * @param dimension Dimension to extract the step index of.
+     * @return The step index of the grid point in the given dimension.
+     */
+    [[nodiscard]] std::size_t step_of(const key_type key, const std::size_t dimension) const noexcept
+    {
+        const auto width = widths[dimension];
+
+        if (width == 0)
+        {
+            return 0;
+        }
+
+        const auto mask = width == std::numeric_limits<key_type>::digits ? std::numeric_limits<key_type>::max() :
+                                                                            (key_type{1} << width) - 1;
+
+        return static_cast<std::size_t>((key >> offsets[dimension]) & mask);
+    }
+    /**
+     * Computes the slot index of a key in the dense backend.
+     *
+     * @param key Key of a grid point.
+     * @return The slot index of the grid point.
+     */
+    [[nodiscard]] std::size_t slot_index(const key_type key) const noexcept
+    {
+        std::size_t index = 0;
+
+        for (std::size_t d = 0; d < strides.size(); ++d)
+        {
+            index += step_of(key, d) * strides[d];
+        }
+
+        return index;
+    }
+    /**
+     * Computes the key of a slot index in the dense backend.
+     *
+     * @param index Slot index of a grid point.
+     * @return The key of the grid point.
+     */
+    [[nodiscard]] key_type slot_key(std::size_t index) const noexcept
+    {
+        key_type key = 0;
+
+        for (std::size_t d = 0; d < extents.size(); ++d)
+        {
+            if (widths[d] > 0)
+            {
+                key |= static_cast<key_type>(index % extents[d]) << offsets[d];
+            }
+
+            index /= extents[d];
+        }
+
+        return key;
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_COMPACT_SIDB_SIMULATION_DOMAIN_HPP
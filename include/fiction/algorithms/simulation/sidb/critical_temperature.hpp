@@ -23,17 +23,23 @@
 #include "fiction/technology/constants.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/math_utils.hpp"
+#include "fiction/utils/work_stealing_thread_pool.hpp"
 
 #include <fmt/format.h>
 #include <mockturtle/utils/stopwatch.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <limits>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -67,6 +73,11 @@ struct critical_temperature_params
      * Alpha parameter for the *QuickSim* algorithm (only applicable if engine == QUICKSIM).
      */
     double alpha{0.7};
+    /**
+     * Number of threads to distribute the input patterns of a gate-based simulation over. Defaults to the number of
+     * hardware threads, and to `1` where that count is not detectable. Values below `1` are treated as `1`.
+     */
+    std::size_t number_of_threads{std::max(std::size_t{std::thread::hardware_concurrency()}, std::size_t{1})};
 };
 
 /**
@@ -119,6 +130,258 @@ struct critical_temperature_stats
 namespace detail
 {
 
+/**
+ * The energy spectrum of the physically valid charge distributions of a layout for a single input pattern. The
+ * distinct energies are sorted in ascending order, and each one is stored with the number of all and of all erroneous
+ * charge distributions at that energy. Since the Boltzmann factors decrease along the spectrum, whether the occupation
+ * probability of the erroneous states exceeds a threshold is usually decided by the lowest few levels, without summing
+ * over the entire spectrum.
+ */
+class erroneous_state_spectrum
+{
+  public:
+    /**
+     * Constructs the spectrum of a gate-based simulation, in which a charge distribution is erroneous if its state
+     * type is `REJECTED`.
+     *
+     * @param energy_and_state_type Energies of all physically valid charge distributions with their state type.
+     */
+    explicit erroneous_state_spectrum(const sidb_energy_and_state_type& energy_and_state_type)
+    {
+        auto sorted = energy_and_state_type;
+        std::ranges::stable_sort(sorted, [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        for (const auto& [energy, type] : sorted)
+        {
+            add_states(energy, 1, type == state_type::REJECTED ? 1 : 0);
+        }
+
+        count_remaining_states();
+    }
+    /**
+     * Constructs the spectrum of a non-gate-based simulation, in which a charge distribution is erroneous if it is an
+     * excited state.
+     *
+     * @param distribution Energy distribution of all physically valid charge distributions.
+     */
+    explicit erroneous_state_spectrum(const energy_distribution& distribution)
+    {
+        if (distribution.empty())
+        {
+            return;
+        }
+
+        const auto min_energy = distribution.min_energy();
+
+        // the energy distribution is already sorted
+        distribution.for_each(
+            [this, min_energy](const double energy, const uint64_t degeneracy)
+            {
+                const auto is_excited =
+                    std::abs(round_to_n_decimal_places(energy, 6) - round_to_n_decimal_places(min_energy, 6)) >
+                    constants::ERROR_MARGIN;
+
+                add_states(energy, degeneracy, is_excited ? degeneracy : 0);
+            });
+
+        count_remaining_states();
+    }
+    /**
+     * Checks whether the occupation probability of the erroneous charge distributions exceeds the given threshold at
+     * the given temperature. Since the Boltzmann factors decrease along the spectrum, the levels that are not visited
+     * yet contribute at most the Boltzmann factor of the current level per charge distribution. The check, therefore,
+     * ends as soon as the outcome does not depend on how these remaining charge distributions are split into erroneous
+     * and correct ones.
+     *
+     * @param threshold Occupation probability threshold.
+     * @param temperature System temperature to assume (unit: K).
+     * @return `true` if the occupation probability of all erroneous states exceeds `threshold`.
+     */
+    [[nodiscard]] bool occupation_probability_exceeds(const double threshold, const double temperature) const noexcept
+    {
+        assert((temperature > 0.0) && "temperature should be slightly above 0 K");
+
+        // the occupation probability R / (R + A) exceeds the threshold t exactly when (1 - t) R - t A > 0, where R and
+        // A are the Boltzmann sums of the erroneous and of the correct states
+        double erroneous = 0.0;
+        double correct   = 0.0;
+
+        for (std::size_t l = 0; l < energies.size(); ++l)
+        {
+            const auto boltzmann_factor = calculate_boltzmann_factor(energies[l], energies.front(), temperature);
+            const auto remaining        = boltzmann_factor * num_remaining_states[l];
+
+            if ((1.0 - threshold) * erroneous - threshold * (correct + remaining) > 0.0)
+            {
+                return true;
+            }
+            if ((1.0 - threshold) * (erroneous + remaining) - threshold * correct <= 0.0)
+            {
+                return false;
+            }
+
+            erroneous += num_erroneous_states[l] * boltzmann_factor;
+            correct += (num_states[l] - num_erroneous_states[l]) * boltzmann_factor;
+        }
+
+        return (1.0 - threshold) * erroneous - threshold * correct > 0.0;
+    }
+    /**
+     * Determines the first of the temperatures \f$0.01 K, 0.02 K, \ldots\f$ at which the occupation probability of
+     * the erroneous states exceeds the given threshold.
+     *
+     * Let \f$R(T)\f$ and \f$A(T)\f$ be the Boltzmann sums of the erroneous and of the remaining states. The
+     * occupation probability exceeds the threshold \f$\theta\f$ exactly when \f$(1 - \theta) R(T) - \theta A(T) > 0\f$.
+     * By Descartes' rule of signs for exponential sums, the number of temperatures at which this difference vanishes is
+     * bounded by the number of sign changes of its coefficients along the spectrum. If there is at most one, the
+     * threshold is crossed at most once and a bisection finds the same temperature as a linear scan. Otherwise, the
+     * temperatures are scanned linearly.
+     *
+     * @param threshold Occupation probability threshold.
+     * @param num_steps Number of temperatures to consider, i.e., the last one is `num_steps / 100` K.
+     * @return The index of the first temperature at which the threshold is exceeded, counting from `1`, or
+     * `std::nullopt` if none of them exceeds it.
+     */
+    [[nodiscard]] std::optional<uint64_t> first_temperature_step_exceeding(const double   threshold,
+                                                                           const uint64_t num_steps) const noexcept
+    {
+        const auto exceeds = [this, threshold](const uint64_t step)
+        { return occupation_probability_exceeds(threshold, static_cast<double>(step) / 100.0); };
+
+        if (num_steps == 0)
+        {
+            return std::nullopt;
+        }
+
+        if (exceeds(1))
+        {
+            return 1;
+        }
+
+        if (num_coefficient_sign_changes(threshold) > 1)
+        {
+            for (uint64_t step = 2; step <= num_steps; ++step)
+            {
+                if (exceeds(step))
+                {
+                    return step;
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        if (!exceeds(num_steps))
+        {
+            return std::nullopt;
+        }
+
+        // the threshold is not exceeded at `low` but at `high`
+        uint64_t low  = 1;
+        uint64_t high = num_steps;
+
+        while (high - low > 1)
+        {
+            const auto mid = low + (high - low) / 2;
+
+            if (exceeds(mid))
+            {
+                high = mid;
+            }
+            else
+            {
+                low = mid;
+            }
+        }
+
+        return high;
+    }
+
+  private:
+    /**
+     * Distinct energies in ascending order (unit: eV).
+     */
+    std::vector<double> energies{};
+    /**
+     * Number of charge distributions at each energy.
+     */
+    std::vector<double> num_states{};
+    /**
+     * Number of erroneous charge distributions at each energy.
+     */
+    std::vector<double> num_erroneous_states{};
+    /**
+     * Number of charge distributions at each energy and all higher ones.
+     */
+    std::vector<double> num_remaining_states{};
+    /**
+     * Adds charge distributions of an energy that is not smaller than all previously added ones.
+     *
+     * @param energy Energy of the charge distributions (unit: eV).
+     * @param num Number of charge distributions.
+     * @param num_erroneous Number of erroneous charge distributions among them.
+     */
+    void add_states(const double energy, const uint64_t num, const uint64_t num_erroneous) noexcept
+    {
+        if (energies.empty() || energies.back() != energy)
+        {
+            energies.push_back(energy);
+            num_states.push_back(0.0);
+            num_erroneous_states.push_back(0.0);
+        }
+
+        num_states.back() += static_cast<double>(num);
+        num_erroneous_states.back() += static_cast<double>(num_erroneous);
+    }
+    /**
+     * Counts the charge distributions at or above each level once all of them have been added.
+     */
+    void count_remaining_states() noexcept
+    {
+        num_remaining_states.resize(num_states.size());
+
+        double num_remaining = 0.0;
+
+        for (std::size_t l = num_states.size(); l-- > 0;)
+        {
+            num_remaining += num_states[l];
+            num_remaining_states[l] = num_remaining;
+        }
+    }
+    /**
+     * Counts the sign changes of the coefficients \f$(1 - \theta) r - \theta a\f$ along the spectrum, where \f$r\f$
+     * and \f$a\f$ are the numbers of erroneous and of remaining charge distributions at an energy.
+     *
+     * @param threshold Occupation probability threshold \f$\theta\f$.
+     * @return Number of sign changes, ignoring vanishing coefficients.
+     */
+    [[nodiscard]] uint64_t num_coefficient_sign_changes(const double threshold) const noexcept
+    {
+        uint64_t sign_changes  = 0;
+        int      previous_sign = 0;
+
+        for (std::size_t l = 0; l < energies.size(); ++l)
+        {
+            const auto coefficient =
+                (1.0 - threshold) * num_erroneous_states[l] - threshold * (num_states[l] - num_erroneous_states[l]);
+
+            const auto sign = (coefficient > 0.0) - (coefficient < 0.0);
+
+            if (sign != 0)
+            {
+                if (previous_sign != 0 && sign != previous_sign)
+                {
+                    ++sign_changes;
+                }
+
+                previous_sign = sign;
+            }
+        }
+
+        return sign_changes;
+    }
+};
+
 template <typename Lyt>
 class critical_temperature_impl
 {
@@ -127,7 +390,6 @@ class critical_temperature_impl
             layout{lyt},
             params{ps},
             stats{st},
-            bii(bdl_input_iterator<Lyt>{layout, params.operational_params.input_bdl_iterator_params}),
             critical_temperature{ps.max_temperature}
     {
         stats.simulation_parameters = params.operational_params.simulation_parameters;
@@ -158,9 +420,6 @@ class critical_temperature_impl
             layout{input_pattern_lyts.front()},
             params{ps},
             stats{st},
-            // the input pattern layouts make the iterator redundant; this is the same no-op instantiation that
-            // `is_operational_impl` uses on its pre-generated-layouts path
-            bii(bdl_input_iterator<Lyt>{Lyt{}}),
             critical_temperature{ps.max_temperature},
             input_pattern_layouts{&input_pattern_lyts},
             pre_detected_output_bdl_pairs{&output_pairs},
@@ -223,60 +482,77 @@ class critical_temperature_impl
             const auto& output_bdl_wires =
                 pre_detected_output_bdl_wires != nullptr ? *pre_detected_output_bdl_wires : detected_output_bdl_wires;
 
+            // the input patterns are simulated concurrently, so each one needs its own layout instead of a shared
+            // iterator
+            const auto generated_input_pattern_layouts =
+                input_pattern_layouts != nullptr ?
+                    std::vector<Lyt>{} :
+                    generate_bdl_input_pattern_layouts(layout, params.operational_params.input_bdl_iterator_params);
+
+            const auto& pattern_layouts =
+                input_pattern_layouts != nullptr ? *input_pattern_layouts : generated_input_pattern_layouts;
+
             // number of different input combinations
-            for (auto i = 0u; i < spec.front().num_bits(); ++i)
-            {
-                const auto& lyt_with_input_pattern = layout_with_input_pattern(i);
+            const auto num_input_patterns = spec.front().num_bits();
 
-                // if positively charged SiDBs can occur, the SiDB layout is considered as non-operational
-                if (can_positive_charges_occur(lyt_with_input_pattern, params.operational_params.simulation_parameters))
-                {
-                    critical_temperature = 0.0;
-                    return;
-                }
+            assert(pattern_layouts.size() == num_input_patterns && "wrong number of input pattern layouts");
 
-                // performs physical simulation of a given SiDB layout at a given input combination
-                const auto sim_result = physical_simulation_of_layout(lyt_with_input_pattern);
+            std::vector<input_pattern_result> results(num_input_patterns);
 
-                if (sim_result.charge_distributions.empty())
+            // once an input pattern renders the layout non-operational, the ones after it are skipped. All input
+            // patterns before the first failing one are still simulated, since their results enter the statistics
+            std::atomic<std::size_t> first_failing_pattern{num_input_patterns};
+
+            const auto simulate_input_pattern = [&](const std::size_t i)
+            {
+                if (i > first_failing_pattern.load(std::memory_order_relaxed))
                 {
-                    critical_temperature = 0.0;
                     return;
                 }
-                stats.num_valid_lyt = sim_result.charge_distributions.size();
-                // The energy distribution of the physically valid charge configurations for the given layout is
-                // determined.
-                const auto distribution = calculate_energy_distribution(sim_result.charge_distributions);
 
-                sidb_energy_and_state_type energy_state_type{};
+                results[i] = simulate_input_pattern_layout(pattern_layouts[i], spec, i, output_bdl_pairs,
+                                                           input_bdl_wires, output_bdl_wires);
 
-                if (params.operational_params.op_condition ==
-                    is_operational_params::operational_condition::REJECT_KINKS)
+                if (!results[i].has_valid_charge_distributions)
                 {
-                    energy_state_type = calculate_energy_and_state_type_with_kinks_rejected<Lyt>(
-                        distribution, sim_result.charge_distributions, spec, i, input_bdl_wires, output_bdl_wires);
-                }
-                else
-                {
-                    // A label that indicates whether the state still fulfills the logic.
-                    energy_state_type = calculate_energy_and_state_type_with_kinks_accepted<Lyt>(
-                        distribution, sim_result.charge_distributions, output_bdl_pairs, spec, i);
-                }
+                    auto failing = first_failing_pattern.load(std::memory_order_relaxed);
 
-                const auto min_energy = energy_state_type.cbegin()->first;
-
-                auto ground_state_is_transparent = is_ground_state_transparent(energy_state_type, min_energy);
+                    while (i < failing &&
+                           !first_failing_pattern.compare_exchange_weak(failing, i, std::memory_order_relaxed))
+                    {}
+                }
+            };
 
-                if (ground_state_is_transparent)
+            if (params.number_of_threads > 1)
+            {
+                shared_work_stealing_thread_pool(params.number_of_threads)
+                    .for_each_index(num_input_patterns, simulate_input_pattern);
+            }
+            else
+            {
+                for (std::size_t i = 0; i < num_input_patterns; ++i)
                 {
-                    this->determine_critical_temperature(energy_state_type);
+                    simulate_input_pattern(i);
                 }
+            }
 
-                else
+            // the results are combined in the order of the input patterns, such that the outcome does not depend on
+            // the number of threads
+            for (const auto& result : results)
+            {
+                if (!result.has_valid_charge_distributions)
                 {
-                    critical_temperature = 0.0;  // If no ground state fulfills the logic, the Critical
-                                                 // Temperature is zero. May be worth it to change µ_.
+                    critical_temperature = 0.0;
+                    return;
                 }
+
+                stats.num_valid_lyt = result.num_valid_lyt;
+                stats.energy_between_ground_state_and_first_erroneous =
+                    std::min(stats.energy_between_ground_state_and_first_erroneous,
+                             result.energy_between_ground_state_and_first_erroneous);
+
+                // if no ground state fulfills the logic, the critical temperature is zero
+                critical_temperature = std::min(critical_temperature, result.critical_temperature);
             }
         }
     }
@@ -352,36 +628,11 @@ class critical_temperature_impl
             }
         }
 
-        std::vector<double> temp_values{};  // unit: K
+        // the number of temperature steps is rounded here, unlike in the gate-based simulation
+        const auto num_steps = static_cast<uint64_t>(std::round(params.max_temperature * 100));
 
-        // Calculate the number of iterations as an integer
-        const auto num_iterations = static_cast<uint64_t>(std::round(params.max_temperature * 100));
-        // Reserve space for the vector
-        temp_values.reserve(num_iterations);
-        for (uint64_t i = 1; i <= num_iterations; i++)
-        {
-            temp_values.emplace_back(static_cast<double>(i) / 100.0);
-        }
-
-        // This function determines the critical temperature for a given confidence level.
-        for (const auto& temp : temp_values)
-        {
-            // If the occupation probability of excited states exceeds the given threshold.
-            if (occupation_probability_non_gate_based(distribution, temp) > (1 - params.confidence_level) &&
-                (temp < critical_temperature))
-            {
-                // The current temperature is stored as the critical temperature.
-                critical_temperature = temp;
-
-                break;
-            }
-
-            if (std::abs(temp - params.max_temperature) < 0.001 && (temp < critical_temperature))
-            {
-                // Maximal temperature is stored as the Critical Temperature.
-                critical_temperature = params.max_temperature;
-            }
-        }
+        critical_temperature =
+            std::min(critical_temperature, critical_temperature_of(erroneous_state_spectrum{distribution}, num_steps));
     }
     /**
      * Returns the critical temperature.
@@ -394,6 +645,97 @@ class critical_temperature_impl
     }
 
   private:
+    /**
+     * Result of the simulation of a single input pattern.
+     */
+    struct input_pattern_result
+    {
+        /**
+         * `false` if the input pattern was skipped, if positively charged SiDBs can occur, or if no physically valid
+         * charge distribution was found.
+         */
+        bool has_valid_charge_distributions{false};
+        /**
+         * Number of physically valid charge distributions.
+         */
+        uint64_t num_valid_lyt{0};
+        /**
+         * Energy difference between the ground state and the first erroneous excited state (unit: meV).
+         */
+        double energy_between_ground_state_and_first_erroneous{std::numeric_limits<double>::infinity()};
+        /**
+         * Critical temperature of the input pattern, which is `0` if no ground state fulfills the logic (unit: K).
+         */
+        double critical_temperature{0.0};
+    };
+    /**
+     * Simulates the layout for a single input pattern and determines its critical temperature. Since it only reads the
+     * members of this object, it may be called for different input patterns concurrently.
+     *
+     * @tparam TT Type of the truth table.
+     * @param lyt_with_input_pattern The SiDB layout with the input pattern applied.
+     * @param spec Expected Boolean function of the layout given as a multi-output truth table.
+     * @param input_pattern The input pattern.
+     * @param output_bdl_pairs Output BDL pairs of the layout.
+     * @param input_bdl_wires BDL input wires of the layout.
+     * @param output_bdl_wires BDL output wires of the layout.
+     * @return The simulation result of the input pattern.
+     */
+    template <typename TT>
+    [[nodiscard]] input_pattern_result simulate_input_pattern_layout(
+        const Lyt& lyt_with_input_pattern, const std::vector<TT>& spec, const uint64_t input_pattern,
+        const std::vector<bdl_pair<cell<Lyt>>>& output_bdl_pairs, const std::vector<bdl_wire<Lyt>>& input_bdl_wires,
+        const std::vector<bdl_wire<Lyt>>& output_bdl_wires) const noexcept
+    {
+        input_pattern_result result{};
+
+        // if positively charged SiDBs can occur, the SiDB layout is considered as non-operational
+        if (can_positive_charges_occur(lyt_with_input_pattern, params.operational_params.simulation_parameters))
+        {
+            return result;
+        }
+
+        // performs physical simulation of a given SiDB layout at a given input combination
+        const auto sim_result = physical_simulation_of_layout(lyt_with_input_pattern);
+
+        if (sim_result.charge_distributions.empty())
+        {
+            return result;
+        }
+
+        result.has_valid_charge_distributions = true;
+        result.num_valid_lyt                  = sim_result.charge_distributions.size();
+
+        // The energy distribution of the physically valid charge configurations for the given layout is determined.
+        const auto distribution = calculate_energy_distribution(sim_result.charge_distributions);
+
+        sidb_energy_and_state_type energy_state_type{};
+
+        if (params.operational_params.op_condition == is_operational_params::operational_condition::REJECT_KINKS)
+        {
+            energy_state_type = calculate_energy_and_state_type_with_kinks_rejected<Lyt>(
+                distribution, sim_result.charge_distributions, spec, input_pattern, input_bdl_wires,
+                output_bdl_wires);
+        }
+        else
+        {
+            // A label that indicates whether the state still fulfills the logic.
+            energy_state_type = calculate_energy_and_state_type_with_kinks_accepted<Lyt>(
+                distribution, sim_result.charge_distributions, output_bdl_pairs, spec, input_pattern);
+        }
+
+        const auto min_energy = energy_state_type.cbegin()->first;
+
+        if (is_ground_state_transparent(energy_state_type, min_energy,
+                                        result.energy_between_ground_state_and_first_erroneous))
+        {
+            result.critical_temperature =
+                critical_temperature_of(erroneous_state_spectrum{energy_state_type},
+                                        static_cast<uint64_t>(params.max_temperature * 100));
+        }
+
+        return result;
+    }
     /**
      * The energy difference between the ground state and the first erroneous state is determined. Additionally, the
      * state type of the ground state is determined and returned.
@@ -401,10 +743,13 @@ class critical_temperature_impl
      * @param energy_and_state_type All energies of all physically valid charge distributions with the corresponding
      * state type (i.e. transparent, erroneous).
      * @param min_energy Minimal energy of all physically valid charge distributions of a given layout (unit: eV).
+     * @param energy_between_ground_state_and_first_erroneous Energy difference between the ground state and the first
+     * erroneous state, which is lowered to the one found here (unit: meV).
      * @return State type (i.e. transparent, erroneous) of the ground state is returned.
      */
-    [[nodiscard]] bool is_ground_state_transparent(const sidb_energy_and_state_type& energy_and_state_type,
-                                                   const double                      min_energy) const noexcept
+    [[nodiscard]] static bool
+    is_ground_state_transparent(const sidb_energy_and_state_type& energy_and_state_type, const double min_energy,
+                                double& energy_between_ground_state_and_first_erroneous) noexcept
     {
         bool ground_state_is_transparent = false;
 
@@ -421,48 +766,33 @@ class critical_temperature_impl
             }
 
             if ((state_type == state_type::REJECTED) && (energy > min_energy) && ground_state_is_transparent &&
-                (((energy - min_energy) * 1000) < stats.energy_between_ground_state_and_first_erroneous))
+                (((energy - min_energy) * 1000) < energy_between_ground_state_and_first_erroneous))
             {
                 // The energy difference is stored in meV.
-                stats.energy_between_ground_state_and_first_erroneous = (energy - min_energy) * 1000;
+                energy_between_ground_state_and_first_erroneous = (energy - min_energy) * 1000;
                 break;
             }
         }
         return ground_state_is_transparent;
     };
     /**
-     * The *Critical Temperature* is determined.
+     * The *Critical Temperature* of an energy spectrum is determined, i.e., the first of the temperatures from 0.01 K
+     * in 0.01 K steps at which the erroneous states are populated by more than \f$1 - \eta\f$.
      *
-     * @param energy_state_type All energies of all physically valid charge distributions with the corresponding
-     * state type (i.e. transparent, erroneous).
+     * @param spectrum Energy spectrum of all physically valid charge distributions.
+     * @param num_steps Number of temperature steps to consider.
+     * @return The critical temperature, or the maximum temperature if the threshold is not exceeded (unit: K).
      */
-    void determine_critical_temperature(const sidb_energy_and_state_type& energy_state_type) noexcept
+    [[nodiscard]] double critical_temperature_of(const erroneous_state_spectrum& spectrum,
+                                                 const uint64_t                  num_steps) const noexcept
     {
-        // Vector with temperature values from 0.01 to max_temperature * 100 K in 0.01 K steps is generated.
-        std::vector<double> temp_values{};
-        temp_values.reserve(static_cast<uint64_t>(params.max_temperature * 100));
-
-        for (uint64_t i = 1; i <= static_cast<uint64_t>(params.max_temperature * 100); i++)
-        {
-            temp_values.emplace_back(static_cast<double>(i) / 100.0);
-        }
-        // This function determines the Critical Temperature for a given confidence level.
-        for (const auto& temp : temp_values)
+        if (const auto step = spectrum.first_temperature_step_exceeding(1 - params.confidence_level, num_steps);
+            step.has_value())
         {
-            // If the occupation probability of erroneous states exceeds the given threshold...
-            if (occupation_probability_gate_based(energy_state_type, temp) > (1 - params.confidence_level) &&
-                (temp < critical_temperature))
-            {
-                // The current temperature is stored as Critical Temperature.
-                critical_temperature = temp;
-                break;
-            }
-            if (std::abs(temp - params.max_temperature) < 0.001 && (temp < critical_temperature))
-            {
-                // Maximal temperature is stored as Critical Temperature.
-                critical_temperature = params.max_temperature;
-            }
+            return static_cast<double>(step.value()) / 100.0;
         }
+
+        return params.max_temperature;
     }
 
     /**
@@ -477,17 +807,13 @@ class critical_temperature_impl
      * Statistics.
      */
     critical_temperature_stats& stats;
-    /**
-     * Iterator that iterates over all possible input states.
-     */
-    bdl_input_iterator<Lyt> bii;
     /**
      * Critical temperature [K].
      */
     double critical_temperature;
     /**
-     * Pre-generated layouts, one per input pattern, or `nullptr` if the BDL input iterator is used instead. Not owned
-     * by this object and only ever read.
+     * Pre-generated layouts, one per input pattern, or `nullptr` if they are to be generated here. Not owned by this
+     * object and only ever read.
      */
     const std::vector<Lyt>* input_pattern_layouts{nullptr};
     /**
@@ -503,28 +829,6 @@ class critical_temperature_impl
      */
     const std::vector<bdl_wire<Lyt>>* pre_detected_output_bdl_wires{nullptr};
 
-    /**
-     * Returns the layout with the given input pattern applied.
-     *
-     * Reads from the pre-generated input pattern layouts if they were supplied, and drives the BDL input iterator to
-     * the requested pattern otherwise.
-     *
-     * @param input_pattern The input pattern to apply.
-     * @return The layout with `input_pattern` applied.
-     */
-    [[nodiscard]] const Lyt& layout_with_input_pattern(const uint64_t input_pattern) noexcept
-    {
-        if (input_pattern_layouts != nullptr)
-        {
-            assert(input_pattern < input_pattern_layouts->size() && "input pattern out of range");
-
-            return (*input_pattern_layouts)[input_pattern];
-        }
-
-        bii = input_pattern;
-
-        return *bii;
-    }
     /**
      * This function conducts physical simulation of the given layout (gate layout with certain input combination).
      * The simulation results are stored in the `sim_result_100` variable.
@@ -532,7 +836,8 @@ class critical_temperature_impl
      * @param lyt_with_input_pattern The SiDB layout with a given input combination applied.
      * @return Simulation results.
      */
-    [[nodiscard]] sidb_simulation_result<Lyt> physical_simulation_of_layout(const Lyt& lyt_with_input_pattern) noexcept
+    [[nodiscard]] sidb_simulation_result<Lyt>
+    physical_simulation_of_layout(const Lyt& lyt_with_input_pattern) const noexcept
     {
         if (params.operational_params.sim_engine == sidb_simulation_engine::EXGS)
         {
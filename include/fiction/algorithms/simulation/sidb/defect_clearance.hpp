@@ -49,7 +49,7 @@ calculate_defect_clearance(const Lyt& lyt, const defect_influence_domain<Lyt>& d
     double    max_distance          = 0;
     cell<Lyt> max_distance_position = {};
 
-    defect_inf_domain.for_each(
+    defect_inf_domain.for_each_in_place(
         [&lyt, &max_distance, &max_distance_position](const auto& defect_pos, const auto& val)
         {
             if (std::get<0>(val) == defect_influence_status::NON_INFLUENTIAL)
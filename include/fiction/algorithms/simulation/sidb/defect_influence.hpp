@@ -6,15 +6,19 @@
 #define FICTION_DEFECT_INFLUENCE_HPP
 
 #include "fiction/algorithms/iter/bdl_input_iterator.hpp"
+#include "fiction/algorithms/simulation/sidb/charge_distribution_selection.hpp"
 #include "fiction/algorithms/simulation/sidb/is_operational.hpp"
 #include "fiction/algorithms/simulation/sidb/quickexact.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_domain.hpp"
 #include "fiction/layouts/bounding_box.hpp"
+#include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/sidb_charge_state.hpp"
 #include "fiction/technology/sidb_defect_surface.hpp"
 #include "fiction/technology/sidb_defects.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/types.hpp"
 #include "fiction/utils/layout_utils.hpp"
+#include "fiction/utils/work_stealing_thread_pool.hpp"
 
 #include <kitty/traits.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
@@ -22,12 +26,14 @@
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <optional>
 #include <random>
 #include <thread>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -135,6 +141,11 @@ struct defect_influence_stats
      * Number of parameter combinations, for which the layout is not influenced.
      */
     std::size_t num_non_influencing_defect_positions{0};
+    /**
+     * Number of defect positions whose influence on the ground state was determined without simulating the layout in
+     * presence of the defect.
+     */
+    std::size_t num_screened_defect_positions{0};
 };
 
 namespace detail
@@ -165,52 +176,25 @@ class defect_influence_impl
     grid_search(const std::size_t step_size, const std::optional<std::vector<TT>>& spec = std::nullopt) noexcept
     {
         mockturtle::stopwatch stop{stats.time_total};
-        const auto            all_possible_defect_positions = all_coordinates_in_spanned_area(nw_cell, se_cell);
-        const std::size_t     num_positions                 = all_possible_defect_positions.size();
 
-        // floored at `1` so that the slice arithmetic below stays well-defined when there is nothing to distribute;
-        // the `start >= end` guard in the loop then keeps the worker from being launched
-        const auto number_of_threads = std::max(std::min(num_threads, num_positions), std::size_t{1});
+        simulate_ground_state_references(spec);
 
-        // calculate the size of each slice
-        const auto slice_size = (num_positions + number_of_threads - 1) / number_of_threads;
+        const auto        all_possible_defect_positions = all_coordinates_in_spanned_area(nw_cell, se_cell);
+        const std::size_t num_positions                 = all_possible_defect_positions.size();
 
-        std::vector<std::thread> threads{};
-        threads.reserve(number_of_threads);
+        shared_work_stealing_thread_pool(num_threads)
+            .for_each_index(num_positions,
+                            [this, &all_possible_defect_positions, &step_size, &spec](const std::size_t i)
+                            {
+                                const auto& pos = all_possible_defect_positions[i];
 
-        // launch threads, each with its own slice of random step points
-        for (auto t = 0ul; t < number_of_threads; ++t)
-        {
-            const auto start = t * slice_size;
-            const auto end   = std::min(start + slice_size, num_positions);
-
-            if (start >= end)
-            {
-                break;  // no more work to distribute
-            }
-
-            threads.emplace_back(
-                [this, start, end, &all_possible_defect_positions, &step_size, &spec]
-                {
-                    for (auto i = start; i < end; ++i)
-                    {
-                        // this ensures that the defects are evenly distributed in a grid-like pattern
-                        if (static_cast<std::size_t>(std::abs(all_possible_defect_positions[i].x)) % step_size == 0 &&
-                            static_cast<std::size_t>(std::abs(all_possible_defect_positions[i].y)) % step_size == 0)
-                        {
-                            is_defect_influential(spec, all_possible_defect_positions[i]);
-                        }
-                    }
-                });
-        }
-
-        for (auto& thread : threads)
-        {
-            if (thread.joinable())
-            {
-                thread.join();
-            }
-        }
+                                // this ensures that the defects are evenly distributed in a grid-like pattern
+                                if (static_cast<std::size_t>(std::abs(pos.x)) % step_size == 0 &&
+                                    static_cast<std::size_t>(std::abs(pos.y)) % step_size == 0)
+                                {
+                                    is_defect_influential(spec, pos);
+                                }
+                            });
 
         log_stats();
 
@@ -232,6 +216,8 @@ class defect_influence_impl
     {
         mockturtle::stopwatch stop{stats.time_total};
 
+        simulate_ground_state_references(spec);
+
         // Get all possible defect positions within the grid spanned by nw_cell and se_cell
         auto all_possible_defect_positions = all_coordinates_in_spanned_area(nw_cell, se_cell);
 
@@ -241,44 +227,9 @@ class defect_influence_impl
         // Determine how many positions to sample (use the smaller of samples or the total number of positions)
         const auto min_iterations = std::min(all_possible_defect_positions.size(), samples);
 
-        // floored at `1` so that the slice arithmetic below stays well-defined when there is nothing to distribute;
-        // the `start >= end` guard in the loop then keeps the worker from being launched
-        const auto number_of_threads = std::max(std::min(num_threads, min_iterations), std::size_t{1});
-
-        // calculate the size of each slice
-        const auto slice_size = (min_iterations + number_of_threads - 1) / number_of_threads;
-
-        std::vector<std::thread> threads{};
-        threads.reserve(number_of_threads);
-
-        // launch threads, each with its own slice of random step points
-        for (auto t = 0ul; t < number_of_threads; ++t)
-        {
-            const auto start = t * slice_size;
-            const auto end   = std::min(start + slice_size, min_iterations);
-
-            if (start >= end)
-            {
-                break;  // no more work to distribute
-            }
-
-            threads.emplace_back(
-                [this, start, end, &all_possible_defect_positions, &spec]
-                {
-                    for (auto i = start; i < end; ++i)
-                    {
-                        is_defect_influential(spec, all_possible_defect_positions[i]);
-                    }
-                });
-        }
-
-        for (auto& thread : threads)
-        {
-            if (thread.joinable())
-            {
-                thread.join();
-            }
-        }
+        shared_work_stealing_thread_pool(num_threads)
+            .for_each_index(min_iterations, [this, &all_possible_defect_positions, &spec](const std::size_t i)
+                            { is_defect_influential(spec, all_possible_defect_positions[i]); });
 
         log_stats();  // Log the statistics after processing
 
@@ -332,6 +283,8 @@ class defect_influence_impl
             return neighborhood.front();
         };
 
+        simulate_ground_state_references(spec);
+
         std::unordered_set<cell<Lyt>> starting_points{};
 
         std::size_t sample_counter = 0;
@@ -479,6 +432,33 @@ class defect_influence_impl
      * Number of worker threads to distribute the defect positions over, taken from the parameters and floored at `1`.
      */
     const std::size_t num_threads{std::max(params.number_of_threads, std::size_t{1})};
+    /**
+     * Number of defect positions whose influence on the ground state was determined without simulation.
+     */
+    std::atomic<std::size_t> num_screened_defect_positions{0};
+    /**
+     * The defect-free ground states of an input pattern, which are simulated once instead of once per defect position.
+     */
+    struct ground_state_reference
+    {
+        /**
+         * Layout of the input pattern without the defect.
+         */
+        Lyt layout;
+        /**
+         * Ground states of the layout without the defect.
+         */
+        std::vector<charge_distribution_surface<Lyt>> ground_states;
+        /**
+         * The layout with all SiDBs negatively charged, i.e., with maximal local electrostatic potentials.
+         */
+        charge_distribution_surface<Lyt> all_negative;
+    };
+    /**
+     * Defect-free references of all input patterns. It is only filled if the influence is defined as a change of the
+     * ground state.
+     */
+    std::vector<ground_state_reference> ground_state_references{};
     /**
      * This function determines the northwest and southeast cells based on the layout and the additional scan
      * area specified.
@@ -575,6 +555,13 @@ class defect_influence_impl
             return non_influential();
         }
 
+        if (!ground_state_references.empty())
+        {
+            return does_defect_influence_reference_groundstates(defect_cell) == defect_influence_status::INFLUENTIAL ?
+                       influential() :
+                       non_influential();
+        }
+
         lyt_copy.assign_sidb_defect(defect_cell, params.defect);
 
         if (spec.has_value())
@@ -643,16 +630,25 @@ class defect_influence_impl
             return defect_influence_status::INFLUENTIAL;
         }
 
-        const quickexact_params<cell<Lyt>> qe_params{
-            params.operational_params.simulation_parameters,
-            quickexact_params<cell<Lyt>>::automatic_base_number_detection::OFF};
-
         mockturtle::stopwatch stop{stats.time_total};
 
-        const auto simulation_results = quickexact(lyt_without_defect, qe_params);
-
-        const auto ground_states = simulation_results.groundstates();
+        const auto simulation_results = quickexact(lyt_without_defect, ground_state_simulation_params());
 
+        return does_defect_influence_groundstate(lyt_without_defect, simulation_results.groundstates(), defect_pos);
+    };
+    /**
+     * This function checks if the defect at position `defect_pos` changes the given ground states of the layout.
+     *
+     * @param lyt_without_defect Layout without the defect.
+     * @param ground_states Ground states of the layout without the defect.
+     * @param defect_pos Position of the defect.
+     * @return The influence status of the defect.
+     */
+    [[nodiscard]] defect_influence_status
+    does_defect_influence_groundstate(const Lyt&                                           lyt_without_defect,
+                                      const std::vector<charge_distribution_surface<Lyt>>& ground_states,
+                                      const typename Lyt::cell&                            defect_pos) const noexcept
+    {
         if (lyt_without_defect.get_cell_type(defect_pos) == Lyt::technology::cell_type::EMPTY)
         {
             sidb_defect_surface<Lyt> lyt_defect{lyt_without_defect};
@@ -665,7 +661,7 @@ class defect_influence_impl
             }
 
             // conduct simulation with defect
-            auto simulation_result_defect = quickexact(lyt_defect, qe_params);
+            auto simulation_result_defect = quickexact(lyt_defect, ground_state_simulation_params());
 
             const auto ground_states_defect = simulation_result_defect.groundstates();
 
@@ -692,6 +688,155 @@ class defect_influence_impl
         // defect is placed on a non-empty cell
         return defect_influence_status::NON_INFLUENTIAL;
     };
+    /**
+     * Parameters of the *QuickExact* simulations that determine the ground states.
+     *
+     * @return *QuickExact* parameters that only return the ground states.
+     */
+    [[nodiscard]] quickexact_params<cell<Lyt>> ground_state_simulation_params() const noexcept
+    {
+        // only the ground states are compared
+        quickexact_params<cell<Lyt>> qe_params{params.operational_params.simulation_parameters,
+                                               quickexact_params<cell<Lyt>>::automatic_base_number_detection::OFF};
+        qe_params.result_mode = simulation_result_mode::GROUND_STATE_ONLY;
+
+        return qe_params;
+    }
+    /**
+     * Simulates the defect-free ground states of all input patterns if the influence is defined as a change of the
+     * ground state. Otherwise, no reference is stored.
+     *
+     * @param spec The optional truth table to be used for the simulation.
+     */
+    template <typename TT>
+    void simulate_ground_state_references(const std::optional<std::vector<TT>>& spec) noexcept
+    {
+        ground_state_references.clear();
+
+        if (params.influence_def != defect_influence_params<cell<Lyt>>::influence_definition::GROUND_STATE_CHANGE ||
+            layout.is_empty())
+        {
+            return;
+        }
+
+        const Lyt& lyt_without_defect = layout;
+
+        const auto& sim_params = params.operational_params.simulation_parameters;
+
+        const auto add_reference = [this, &sim_params](const Lyt& lyt)
+        {
+            ++num_simulator_invocations;
+
+            // all SiDBs are negatively charged, cf. can_positive_charges_occur
+            auto all_negative = [&lyt, &sim_params]
+            {
+                if constexpr (is_charge_distribution_surface_v<Lyt>)
+                {
+                    charge_distribution_surface<Lyt> cds{lyt};
+                    cds.assign_physical_parameters(sim_params);
+                    cds.assign_all_charge_states(sidb_charge_state::NEGATIVE);
+
+                    return cds;
+                }
+                else
+                {
+                    return charge_distribution_surface<Lyt>{lyt, sim_params, sidb_charge_state::NEGATIVE};
+                }
+            }();
+
+            ground_state_references.push_back(
+                {lyt, quickexact(lyt, ground_state_simulation_params()).groundstates(), std::move(all_negative)});
+        };
+
+        if (spec.has_value())
+        {
+            const auto& bdl_params = params.operational_params.input_bdl_iterator_params;
+
+            for (const auto& lyt : generate_bdl_input_pattern_layouts(lyt_without_defect, bdl_params))
+            {
+                add_reference(lyt);
+            }
+        }
+        else
+        {
+            add_reference(lyt_without_defect);
+        }
+    }
+    /**
+     * This function checks if the defect at position `defect_cell` changes the ground state of any input pattern.
+     * Since the electrostatic potential of the defect superposes with the local potentials of the defect-free
+     * layout, the defect is influential without any simulation if it makes positive charges possible or renders a
+     * defect-free ground state physically invalid. Otherwise, the layout is simulated with the defect and compared to
+     * the stored defect-free ground states.
+     *
+     * @param defect_cell Position of the defect.
+     * @return The influence status of the defect.
+     */
+    [[nodiscard]] defect_influence_status
+    does_defect_influence_reference_groundstates(const typename Lyt::cell& defect_cell) noexcept
+    {
+        std::vector<const ground_state_reference*> unresolved_references{};
+
+        for (const auto& reference : ground_state_references)
+        {
+            if (reference.layout.get_cell_type(defect_cell) != Lyt::technology::cell_type::EMPTY)
+            {
+                // defect is placed on a non-empty cell
+                continue;
+            }
+
+            // the local potentials are maximal if all SiDBs are negatively charged, cf. can_positive_charges_occur
+            auto all_negative_with_defect = reference.all_negative;
+            all_negative_with_defect.add_sidb_defect_to_potential_landscape(defect_cell, params.defect);
+
+            for (uint64_t i = 0; i < all_negative_with_defect.num_cells(); ++i)
+            {
+                if (-*all_negative_with_defect.get_local_internal_potential_by_index(i) >
+                    all_negative_with_defect.get_effective_charge_transition_thresholds(
+                        i)[static_cast<std::size_t>(charge_transition_threshold_bounds::POSITIVE_LOWER_BOUND)])
+                {
+                    ++num_screened_defect_positions;
+
+                    return defect_influence_status::INFLUENTIAL;
+                }
+            }
+
+            // a ground state that becomes physically invalid cannot be a ground state in presence of the defect
+            for (const auto& ground_state : reference.ground_states)
+            {
+                auto ground_state_with_defect = ground_state;
+                ground_state_with_defect.add_sidb_defect_to_potential_landscape(defect_cell, params.defect);
+                ground_state_with_defect.validity_check();
+
+                if (!ground_state_with_defect.is_physically_valid())
+                {
+                    ++num_screened_defect_positions;
+
+                    return defect_influence_status::INFLUENTIAL;
+                }
+            }
+
+            unresolved_references.push_back(&reference);
+        }
+
+        for (const auto* reference : unresolved_references)
+        {
+            ++num_simulator_invocations;
+
+            if (does_defect_influence_groundstate(reference->layout, reference->ground_states, defect_cell) ==
+                defect_influence_status::INFLUENTIAL)
+            {
+                return defect_influence_status::INFLUENTIAL;
+            }
+        }
+
+        if (unresolved_references.empty())
+        {
+            ++num_screened_defect_positions;
+        }
+
+        return defect_influence_status::NON_INFLUENTIAL;
+    }
     /**
      * This function identifies the most recent non-influential defect position while traversing from left to right
      * towards the SiDB layout.
@@ -748,8 +893,9 @@ class defect_influence_impl
     {
         stats.num_simulator_invocations      = num_simulator_invocations.load();
         stats.num_evaluated_defect_positions = num_evaluated_defect_positions.load();
+        stats.num_screened_defect_positions  = num_screened_defect_positions.load();
 
-        influence_domain.for_each(
+        influence_domain.for_each_in_place(
             [this](const auto& defect_pos [[maybe_unused]], const auto& status)
             {
                 if (std::get<0>(status) == defect_influence_status::INFLUENTIAL)
@@ -11,15 +11,18 @@
 #include "fiction/utils/combination_utils.hpp"
 #include "fiction/utils/layout_utils.hpp"
 #include "fiction/utils/math_utils.hpp"
+#include "fiction/utils/work_stealing_thread_pool.hpp"
 
 #include <mockturtle/utils/stopwatch.hpp>
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <limits>
 #include <mutex>
+#include <optional>
 #include <random>
 #include <set>
 #include <thread>
@@ -194,15 +197,25 @@ class displacement_robustness_domain_impl
 
         all_possible_sidb_displacements = calculate_all_possible_displacements_for_each_sidb();
 
-        auto layouts = generate_valid_displaced_sidb_layouts();
+        // the displaced layouts are not generated upfront; instead, each thread unranks the ones it analyzes
+        const auto num_displacements = number_of_cartesian_combinations(all_possible_sidb_displacements);
 
-        if (layouts.empty())
+        auto num_analyzed_displacements = num_displacements;
+
+        std::vector<uint64_t> sampled_ranks{};
+
+        if (params.analysis_mode ==
+            displacement_robustness_domain_params<cell<Lyt>>::displacement_analysis_mode::RANDOM)
         {
-            return displacement_robustness_domain<Lyt>{};
-        }
+            // the "1" is used so that at least one displaced layout is analyzed.
+            num_analyzed_displacements = std::min(
+                num_displacements,
+                std::max(uint64_t{1}, static_cast<uint64_t>(static_cast<double>(num_displacements) *
+                                                            std::min(params.percentage_of_analyzed_displaced_layouts,
+                                                                     1.0))));
 
-        // Shuffle the layouts vector to have random displaced layouts
-        std::ranges::shuffle(layouts, generator);
+            sampled_ranks = sample_distinct_ranks(num_displacements, num_analyzed_displacements, generator);
+        }
 
         displacement_robustness_domain<Lyt> domain{};
 
@@ -218,48 +231,17 @@ class displacement_robustness_domain_impl
             }
         };
 
-        const std::size_t requested_threads = std::max(params.number_of_threads, std::size_t{1});
-
-        // floored at `1` so that the slice arithmetic below stays well-defined when there is nothing to distribute;
-        // the `start >= end` guard in the loop then keeps the worker from being launched
-        const std::size_t num_threads = std::max(std::min(requested_threads, layouts.size()), std::size_t{1});
-
-        // calculate the size of each slice
-        const auto slice_size = (layouts.size() + num_threads - 1) / num_threads;
-
-        std::vector<std::thread> threads{};
-        threads.reserve(num_threads);
-
-        // launch threads, each with its own slice of random step points
-        for (auto i = 0ul; i < num_threads; ++i)
-        {
-            const auto start = i * slice_size;
-            const auto end   = std::min(start + slice_size, layouts.size());
-
-            if (start >= end)
-            {
-                break;  // no more work to distribute
-            }
-
-            threads.emplace_back(
-                [start, end, &layouts, &check_operational_status]
-                {
-                    for (auto it = layouts.cbegin() + static_cast<int64_t>(start);
-                         it != layouts.cbegin() + static_cast<int64_t>(end); ++it)
-                    {
-                        check_operational_status(*it);
-                    }
-                });
-        }
+        shared_work_stealing_thread_pool(params.number_of_threads)
+            .for_each_index(static_cast<std::size_t>(num_analyzed_displacements),
+                            [this, &sampled_ranks, &check_operational_status](const std::size_t i)
+                            {
+                                const auto rank = sampled_ranks.empty() ? uint64_t{i} : sampled_ranks[i];
 
-        // wait for all threads to complete
-        for (auto& thread : threads)
-        {
-            if (thread.joinable())
-            {
-                thread.join();
-            }
-        }
+                                if (const auto displaced_lyt = displaced_sidb_layout(rank); displaced_lyt.has_value())
+                                {
+                                    check_operational_status(*displaced_lyt);
+                                }
+                            });
 
         return domain;
     }
@@ -295,23 +277,31 @@ class displacement_robustness_domain_impl
             return 1.0;
         }
 
-        const auto all_combinations_of_fabricating_misplaced_sidbs =
-            determine_all_combinations_of_distributing_k_entities_on_n_positions(number_of_displaced_sidbs,
-                                                                                 sidbs_of_the_original_layout.size());
+        const auto num_combinations_of_fabricating_misplaced_sidbs =
+            binomial_coefficient(sidbs_of_the_original_layout.size(), number_of_displaced_sidbs);
 
-        const auto number_of_maximal_tested_misplaced_cell_combinations =
+        const auto number_of_maximal_tested_misplaced_cell_combinations = std::min(
+            num_combinations_of_fabricating_misplaced_sidbs,
             std::max(uint64_t{1},
-                     static_cast<uint64_t>(static_cast<double>(all_combinations_of_fabricating_misplaced_sidbs.size()) *
-                                           std::min(params.percentage_of_analyzed_displaced_layouts, 1.0)));
+                     static_cast<uint64_t>(static_cast<double>(num_combinations_of_fabricating_misplaced_sidbs) *
+                                           std::min(params.percentage_of_analyzed_displaced_layouts, 1.0))));
 
-        uint64_t number_of_tested_misplaced_cell_combinations = 0;
+        // in random mode, the tested combinations of misplaced SiDBs are sampled instead of taken in order
+        std::vector<uint64_t> sampled_ranks{};
 
-        for (const auto& fixed_c_indices : all_combinations_of_fabricating_misplaced_sidbs)
+        if (params.analysis_mode ==
+            displacement_robustness_domain_params<cell<Lyt>>::displacement_analysis_mode::RANDOM)
         {
-            if (number_of_tested_misplaced_cell_combinations >= number_of_maximal_tested_misplaced_cell_combinations)
-            {
-                break;
-            }
+            sampled_ranks = sample_distinct_ranks(num_combinations_of_fabricating_misplaced_sidbs,
+                                                  number_of_maximal_tested_misplaced_cell_combinations, generator);
+        }
+
+        for (uint64_t i = 0; i < number_of_maximal_tested_misplaced_cell_combinations; ++i)
+        {
+            const auto fixed_c_indices = unrank_combination_of_distributing_k_entities_on_n_positions(
+                sampled_ranks.empty() ? i : sampled_ranks[i], number_of_displaced_sidbs,
+                sidbs_of_the_original_layout.size());
+
             // all cells are fixed initially.
             for (const auto& c : sidbs_of_the_original_layout)
             {
@@ -324,8 +314,6 @@ class displacement_robustness_domain_impl
             }
 
             determine_robustness_domain();
-
-            number_of_tested_misplaced_cell_combinations++;
         }
 
         return static_cast<double>(stats.num_operational_sidb_displacements) /
@@ -503,58 +491,31 @@ class displacement_robustness_domain_impl
     }
 #pragma GCC diagnostic pop
     /**
-     * This function generates all SiDB layouts with displacements based on the original layout.
-     * It filters out layouts where two or more SiDBs would be on the same spot due to displacement.
+     * This function generates the SiDB layout with displacements that has the given rank among all combinations of the
+     * possible displacements of each SiDB. Layouts in which two or more SiDBs would be on the same spot due to
+     * displacement are discarded.
      *
-     * @return A vector containing all valid SiDB layouts with displacements.
+     * @param rank The rank of the displacement combination in the order of `cartesian_combinations`.
+     * @return The SiDB layout with displacements if it is valid, `std::nullopt` otherwise.
      */
-    [[nodiscard]] std::vector<Lyt> generate_valid_displaced_sidb_layouts() noexcept
+    [[nodiscard]] std::optional<Lyt> displaced_sidb_layout(const uint64_t rank) const noexcept
     {
-        auto all_possible_sidb_displacement = cartesian_combinations(all_possible_sidb_displacements);
-
-        std::ranges::shuffle(all_possible_sidb_displacement, generator);
-
-        std::vector<Lyt> layouts{};
-        layouts.reserve(all_possible_sidb_displacement.size());
-
-        std::size_t number_of_layouts_with_displaced_sidbs = 0;
+        const auto cell_displacements = unrank_cartesian_combination(all_possible_sidb_displacements, rank);
 
-        auto max_number_of_layouts_with_displaced_sidbs = all_possible_sidb_displacement.size();
+        Lyt displaced_lyt{};
 
-        if (params.analysis_mode ==
-            displacement_robustness_domain_params<cell<Lyt>>::displacement_analysis_mode::RANDOM)
+        for (std::size_t i = 0; i < cell_displacements.size(); ++i)
         {
-            // the "1" is used so that at least one displaced layout is analyzed.
-            max_number_of_layouts_with_displaced_sidbs =
-                std::max(std::size_t{1},
-                         static_cast<std::size_t>(static_cast<double>(all_possible_sidb_displacement.size()) *
-                                                  std::min(params.percentage_of_analyzed_displaced_layouts, 1.0)));
+            displaced_lyt.assign_cell_type(cell_displacements[i],
+                                           layout.get_cell_type(sidbs_of_the_original_layout[i]));
         }
 
-        for (const auto& cell_displacements : all_possible_sidb_displacement)
+        if (displaced_lyt.num_cells() != layout.num_cells())
         {
-            if (number_of_layouts_with_displaced_sidbs >= max_number_of_layouts_with_displaced_sidbs ||
-                ((number_of_layouts_with_displaced_sidbs == 1) && (max_number_of_layouts_with_displaced_sidbs == 1)))
-            {
-                break;
-            }
-
-            Lyt displaced_lyt{};
-
-            for (std::size_t i = 0; i < cell_displacements.size(); ++i)
-            {
-                displaced_lyt.assign_cell_type(cell_displacements[i],
-                                               layout.get_cell_type(sidbs_of_the_original_layout[i]));
-            }
-
-            if (displaced_lyt.num_cells() == layout.num_cells())
-            {
-                layouts.push_back(displaced_lyt);
-            }
-            number_of_layouts_with_displaced_sidbs++;
+            return std::nullopt;
         }
 
-        return layouts;
+        return displaced_lyt;
     }
     /**
      * This function adds the provided layout and its corresponding operational status to the list of
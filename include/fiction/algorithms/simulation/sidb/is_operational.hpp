@@ -7,6 +7,7 @@
 
 #include "fiction/algorithms/iter/bdl_input_iterator.hpp"
 #include "fiction/algorithms/simulation/sidb/can_positive_charges_occur.hpp"
+#include "fiction/algorithms/simulation/sidb/charge_distribution_selection.hpp"
 #include "fiction/algorithms/simulation/sidb/clustercomplete.hpp"
 #include "fiction/algorithms/simulation/sidb/detect_bdl_pairs.hpp"
 #include "fiction/algorithms/simulation/sidb/detect_bdl_wires.hpp"
@@ -21,6 +22,7 @@
 #include "fiction/technology/charge_distribution_surface.hpp"
 #include "fiction/technology/constants.hpp"
 #include "fiction/technology/sidb_charge_state.hpp"
+#include "fiction/technology/sidb_geometry_cache.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/truth_table_utils.hpp"
 
@@ -34,10 +36,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <ranges>
 #include <set>
 #include <stdexcept>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -138,6 +142,29 @@ struct is_operational_params
      */
     operational_analysis_strategy strategy_to_analyze_operational_status =
         operational_analysis_strategy::SIMULATION_ONLY;
+    /**
+     * Floating-point precision of the local potential updates in the filtering steps and in *QuickSim*. With
+     * `potential_precision::MIXED`, a single-precision copy of the potential matrix is read during the enumeration, and
+     * each charge distribution that appears physically valid is confirmed in double precision before its energy is
+     * used. The exact simulation engines are not affected.
+     */
+    potential_precision precision{potential_precision::DOUBLE};
+    /**
+     * If `true` and *QuickExact* is used, the charge distributions are enumerated by branch and bound, and the
+     * simulation of an input pattern is aborted as soon as a charge distribution that is proven to be a ground state
+     * does not encode the expected output (or shows kinks if they are rejected). Since most candidates are
+     * non-operational during design space exploration, this avoids paying for a full simulation per rejection. The
+     * operational status is not affected, but for layouts whose degenerate ground states fail for different reasons,
+     * the reported reason of non-operationality might differ.
+     */
+    bool early_termination{false};
+    /**
+     * Number of *QuickSim* iterations that are conducted if the simulation is warm-started from a seed that is still
+     * physically valid (see `detail::is_operational_impl::enable_warm_start`). Since such a seed is a good candidate
+     * for the ground state, fewer iterations than the 500 of a simulation from scratch suffice to confirm or improve
+     * it.
+     */
+    uint64_t warm_start_iteration_steps{100};
 };
 
 namespace detail
@@ -303,7 +330,7 @@ class is_operational_impl
      * Constructor to initialize the algorithm with pre-generated input pattern layouts.
      *
      * The layouts are not copied and must outlive this object. They are only read, so the same layouts may be shared
-     * by concurrently running instances.
+     * by concurrently running instances. The same holds for the optional geometry caches.
      *
      * @param input_pattern_lyts One layout per input pattern, indexed by input pattern, as generated by
      * `generate_bdl_input_pattern_layouts`.
@@ -312,10 +339,15 @@ class is_operational_impl
      * @param input_wires BDL input wires of the layout.
      * @param output_wires BDL output wires of the layout.
      * @param c_lyt Canvas layout.
+     * @param input_pattern_geometries Optional geometry caches of the input pattern layouts, indexed by input pattern.
+     * If provided, the charge distribution surfaces of the input pattern layouts are set up from them instead of
+     * computing their potential matrices from scratch.
      */
-    is_operational_impl(const std::vector<Lyt>& input_pattern_lyts, const std::vector<TT>& spec,
-                        const is_operational_params& params, const std::vector<bdl_wire<Lyt>>& input_wires,
-                        const std::vector<bdl_wire<Lyt>>& output_wires, const Lyt& c_lyt) :
+    is_operational_impl(
+        const std::vector<Lyt>& input_pattern_lyts, const std::vector<TT>& spec, const is_operational_params& params,
+        const std::vector<bdl_wire<Lyt>>& input_wires, const std::vector<bdl_wire<Lyt>>& output_wires,
+        const Lyt& c_lyt,
+        const std::vector<std::shared_ptr<const sidb_geometry_cache<cell<Lyt>>>>* input_pattern_geometries = nullptr) :
             truth_table{spec},
             parameters{params},
             output_bdl_pairs(detect_bdl_pairs(input_pattern_lyts.front(), sidb_technology::cell_type::OUTPUT,
@@ -328,8 +360,12 @@ class is_operational_impl
             number_of_output_wires{output_bdl_wires.size()},
             number_of_input_wires{input_bdl_wires.size()},
             canvas_lyt{c_lyt},
-            input_pattern_layouts{&input_pattern_lyts}
+            input_pattern_layouts{&input_pattern_lyts},
+            input_pattern_geometries{input_pattern_geometries}
     {
+        assert((input_pattern_geometries == nullptr || input_pattern_geometries->size() == input_pattern_lyts.size()) &&
+               "expected one geometry cache per input pattern layout");
+
         static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
         static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
     }
@@ -348,13 +384,28 @@ class is_operational_impl
     [[nodiscard]] std::optional<layout_invalidity_reason> is_layout_invalid(const uint64_t input_pattern) noexcept
     {
         const auto& lyt_with_input_pattern = layout_with_input_pattern(input_pattern);
+        const auto  geometry               = geometry_of_input_pattern(input_pattern);
+
+        auto cds_layout = [this, &lyt_with_input_pattern, &geometry]
+        {
+            if constexpr (is_charge_distribution_surface_v<Lyt>)
+            {
+                charge_distribution_surface<Lyt> cds{lyt_with_input_pattern};
+                cds.assign_all_charge_states(sidb_charge_state::NEGATIVE);
+                cds.assign_physical_parameters(parameters.simulation_parameters);
 
-        charge_distribution_surface<Lyt> cds_layout{lyt_with_input_pattern};
-        cds_layout.assign_all_charge_states(sidb_charge_state::NEGATIVE);
-        cds_layout.assign_physical_parameters(parameters.simulation_parameters);
+                return cds;
+            }
+            else
+            {
+                return charge_distribution_surface<Lyt>{lyt_with_input_pattern, parameters.simulation_parameters,
+                                                        geometry};
+            }
+        }();
+        cds_layout.assign_potential_precision(parameters.precision);
 
         if ((parameters.simulation_parameters.base == 2) &&
-            (can_positive_charges_occur(lyt_with_input_pattern, parameters.simulation_parameters)))
+            (can_positive_charges_occur(lyt_with_input_pattern, parameters.simulation_parameters, geometry)))
         {
             return layout_invalidity_reason::POTENTIAL_POSITIVE_CHARGES;
         }
@@ -422,36 +473,64 @@ class is_operational_impl
 
                 // if positively charged SiDBs can occur, the SiDB layout is considered non-operational
                 if ((parameters.simulation_parameters.base == 2) &&
-                    (can_positive_charges_occur(lyt_with_input_pattern, parameters.simulation_parameters)))
+                    (can_positive_charges_occur(lyt_with_input_pattern, parameters.simulation_parameters,
+                                                geometry_of_input_pattern(i))))
                 {
                     return {operational_status::NON_OPERATIONAL, non_operationality_reason::POTENTIAL_POSITIVE_CHARGES};
                 }
 
                 ++simulator_invocations;
+
+                if (parameters.early_termination && parameters.sim_engine == sidb_simulation_engine::QUICKEXACT)
+                {
+                    std::optional<non_operationality_reason> contradiction{};
+
+                    // the simulation reports each ground state as soon as it is proven and stops at the first one
+                    // that contradicts the expected logic
+                    const auto simulation_results = physical_simulation_of_layout(
+                        lyt_with_input_pattern, geometry_of_input_pattern(i),
+                        [this, &contradiction, i](const charge_distribution_surface<Lyt>& gs)
+                        {
+                            record_ground_state(gs, i);
+
+                            contradiction = contradicting_reason(gs, i);
+                            return !contradiction.has_value();
+                        },
+                        warm_start_seed_of_input_pattern(i));
+
+                    if (contradiction.has_value())
+                    {
+                        return {operational_status::NON_OPERATIONAL, contradiction.value()};
+                    }
+
+                    // if no physically valid charge distributions were found, the layout is non-operational
+                    if (simulation_results.num_charge_distributions() == 0)
+                    {
+                        return {operational_status::NON_OPERATIONAL, non_operationality_reason::LOGIC_MISMATCH};
+                    }
+
+                    continue;
+                }
+
                 // performs physical simulation of a given SiDB layout at a given input combination
-                const auto simulation_results = physical_simulation_of_layout(lyt_with_input_pattern);
+                const auto simulation_results = physical_simulation_of_layout(
+                    lyt_with_input_pattern, geometry_of_input_pattern(i), {}, warm_start_seed_of_input_pattern(i));
 
                 // if no physically valid charge distributions were found, the layout is non-operational
-                if (simulation_results.charge_distributions.empty())
+                if (simulation_results.num_charge_distributions() == 0)
                 {
                     return {operational_status::NON_OPERATIONAL, non_operationality_reason::LOGIC_MISMATCH};
                 }
 
                 const auto ground_states = simulation_results.groundstates();
 
+                record_ground_state(ground_states.front(), i);
+
                 for (const auto& gs : ground_states)
                 {
-                    const auto [op_status, non_op_reason] = verify_logic_match_of_cds(gs, i);
-                    if (op_status == operational_status::NON_OPERATIONAL &&
-                        non_op_reason == non_operationality_reason::LOGIC_MISMATCH)
+                    if (const auto contradiction = contradicting_reason(gs, i); contradiction.has_value())
                     {
-                        return {operational_status::NON_OPERATIONAL, non_operationality_reason::LOGIC_MISMATCH};
-                    }
-                    if (op_status == operational_status::NON_OPERATIONAL &&
-                        non_op_reason == non_operationality_reason::KINKS &&
-                        parameters.op_condition == is_operational_params::operational_condition::REJECT_KINKS)
-                    {
-                        return {operational_status::NON_OPERATIONAL, non_operationality_reason::KINKS};
+                        return {operational_status::NON_OPERATIONAL, contradiction.value()};
                     }
                 }
             }
@@ -460,6 +539,32 @@ class is_operational_impl
         // if we made it here, the layout is operational
         return {operational_status::OPERATIONAL, non_operationality_reason::NONE};
     }
+    /**
+     * Determines whether the given ground state renders the layout non-operational, i.e., whether it does not encode
+     * the expected output or shows kinks while they are rejected.
+     *
+     * @param gs Ground state charge distribution of the layout with the given input pattern applied.
+     * @param input_pattern Input pattern represented by the position of perturbers.
+     * @return Reason why `gs` renders the layout non-operational, or `std::nullopt` if it does not.
+     */
+    [[nodiscard]] std::optional<non_operationality_reason>
+    contradicting_reason(const charge_distribution_surface<Lyt>& gs, const uint64_t input_pattern) noexcept
+    {
+        const auto [op_status, non_op_reason] = verify_logic_match_of_cds(gs, input_pattern);
+
+        if (op_status == operational_status::NON_OPERATIONAL &&
+            non_op_reason == non_operationality_reason::LOGIC_MISMATCH)
+        {
+            return non_operationality_reason::LOGIC_MISMATCH;
+        }
+        if (op_status == operational_status::NON_OPERATIONAL && non_op_reason == non_operationality_reason::KINKS &&
+            parameters.op_condition == is_operational_params::operational_condition::REJECT_KINKS)
+        {
+            return non_operationality_reason::KINKS;
+        }
+
+        return std::nullopt;
+    }
     /**
      * Checks if the given charge distribution correctly encodes the expected logic for the given input pattern,
      * based on a provided truth table.
@@ -570,7 +675,8 @@ class is_operational_impl
 
             // if positively charged SiDBs can occur, the SiDB layout is considered non-operational
             if ((parameters.simulation_parameters.base == 2) &&
-                (can_positive_charges_occur(lyt_with_input_pattern, parameters.simulation_parameters)))
+                (can_positive_charges_occur(lyt_with_input_pattern, parameters.simulation_parameters,
+                                            geometry_of_input_pattern(i))))
             {
                 non_operational_input_pattern_and_non_operationality_reason.emplace_back(
                     i, non_operationality_reason::POTENTIAL_POSITIVE_CHARGES);
@@ -578,10 +684,11 @@ class is_operational_impl
             }
 
             // performs physical simulation of a given SiDB layout at a given input combination
-            const auto simulation_results = physical_simulation_of_layout(lyt_with_input_pattern);
+            const auto simulation_results =
+                physical_simulation_of_layout(lyt_with_input_pattern, geometry_of_input_pattern(i));
 
             // if no physically valid charge distributions were found, the layout is non-operational
-            if (simulation_results.charge_distributions.empty())
+            if (simulation_results.num_charge_distributions() == 0)
             {
                 continue;
             }
@@ -610,6 +717,38 @@ class is_operational_impl
     {
         return simulator_invocations;
     }
+    /**
+     * Enables warm-starting the simulations of `run()` from the ground states of a closely related run, e.g., the one
+     * of a neighboring parameter point in an operational domain sweep. Furthermore, the charge states of one ground
+     * state of each simulated input pattern are recorded, such that they can seed the next run.
+     *
+     * *QuickSim* adds the seed to its result if it is still physically valid and conducts fewer iterations in that
+     * case. If `is_operational_params::early_termination` is set, *QuickExact* tries the seeded charge states first in
+     * its branch-and-bound enumeration, such that a seed that is still physically valid bounds the search from the
+     * start; the ground states are the same as without a seed. The Gray code enumeration of *QuickExact* and the other
+     * simulation engines cannot exploit a seed.
+     *
+     * @param seed Charge states of a ground state per input pattern, indexed by input pattern and ordered like the
+     * SiDBs of a charge distribution surface of the layout. Input patterns with an empty entry are simulated from
+     * scratch.
+     */
+    void enable_warm_start(std::vector<std::vector<sidb_charge_state>> seed = {}) noexcept
+    {
+        warm_start      = true;
+        warm_start_seed = std::move(seed);
+
+        ground_state_charges.assign(truth_table.front().num_bits(), {});
+    }
+    /**
+     * Returns the charge states of the ground states that were recorded by `run()` if warm-starting is enabled.
+     *
+     * @return Charge states of a ground state per input pattern, indexed by input pattern. Input patterns that were not
+     * simulated have an empty entry.
+     */
+    [[nodiscard]] const std::vector<std::vector<sidb_charge_state>>& get_ground_state_charges() const noexcept
+    {
+        return ground_state_charges;
+    }
 
     /**
      * This function determines if there is a charge distribution of the canvas SiDBs for which the charge distribution
@@ -648,6 +787,13 @@ class is_operational_impl
             cds_layout.update_after_charge_change(dependent_cell_mode::VARIABLE,
                                                   energy_calculation::KEEP_OLD_ENERGY_VALUE);
 
+            // in mixed precision, the validity is confirmed in double precision
+            if (cds_layout.is_physically_valid() &&
+                cds_layout.get_potential_precision() == potential_precision::MIXED)
+            {
+                cds_layout.recompute_in_double_precision(energy_calculation::KEEP_OLD_ENERGY_VALUE);
+            }
+
             if (cds_layout.is_physically_valid())
             {
                 cds_layout.recompute_electrostatic_potential_energy();
@@ -958,12 +1104,144 @@ class is_operational_impl
      * by this object and only ever read.
      */
     const std::vector<Lyt>* input_pattern_layouts{nullptr};
+    /**
+     * Geometry caches of the pre-generated input pattern layouts, or `nullptr` if none were supplied. Not owned by this
+     * object.
+     */
+    const std::vector<std::shared_ptr<const sidb_geometry_cache<cell<Lyt>>>>* input_pattern_geometries{nullptr};
     /**
      * The charge distribution surface of the canvas layout, enumerated by `is_physical_validity_feasible`. It is built
      * on first use and reused afterwards, since the canvas does not change over this object's lifetime. Empty until
      * then, so that the strategies that never inspect the canvas do not pay for it.
      */
     std::optional<charge_distribution_surface<Lyt>> canvas_cds{};
+    /**
+     * `true` if warm-starting is enabled via `enable_warm_start`.
+     */
+    bool warm_start{false};
+    /**
+     * Charge states of a ground state per input pattern that seed the simulations if warm-starting is enabled.
+     */
+    std::vector<std::vector<sidb_charge_state>> warm_start_seed{};
+    /**
+     * Charge states of a ground state per simulated input pattern, recorded if warm-starting is enabled.
+     */
+    std::vector<std::vector<sidb_charge_state>> ground_state_charges{};
+    /**
+     * Records the charge states of the given ground state unless one was already recorded for the input pattern.
+     *
+     * @param gs Ground state of the layout with the given input pattern applied.
+     * @param input_pattern The input pattern.
+     */
+    void record_ground_state(const charge_distribution_surface<Lyt>& gs, const uint64_t input_pattern) noexcept
+    {
+        if (warm_start && ground_state_charges[input_pattern].empty())
+        {
+            ground_state_charges[input_pattern] = gs.get_all_sidb_charges();
+        }
+    }
+    /**
+     * Returns the seed of the simulation of the given input pattern.
+     *
+     * @param input_pattern The input pattern.
+     * @return Charge states of the seed, or an empty vector if the input pattern is not seeded.
+     */
+    [[nodiscard]] const std::vector<sidb_charge_state>&
+    warm_start_seed_of_input_pattern(const uint64_t input_pattern) const noexcept
+    {
+        static const std::vector<sidb_charge_state> no_seed{};
+
+        if (!warm_start || input_pattern >= warm_start_seed.size())
+        {
+            return no_seed;
+        }
+
+        return warm_start_seed[input_pattern];
+    }
+    /**
+     * Maps the charge states of a seed to the SiDBs of the given layout.
+     *
+     * @param lyt_with_input_pattern The SiDB layout with a given input combination applied.
+     * @param seed Charge states ordered like the SiDBs of a charge distribution surface of `lyt_with_input_pattern`.
+     * @return Charge state of each SiDB, or an empty map if the seed does not match the layout.
+     */
+    [[nodiscard]] static std::unordered_map<cell<Lyt>, sidb_charge_state>
+    seed_charge_states(const Lyt& lyt_with_input_pattern, const std::vector<sidb_charge_state>& seed) noexcept
+    {
+        std::vector<cell<Lyt>> sidbs{};
+        sidbs.reserve(lyt_with_input_pattern.num_cells());
+
+        lyt_with_input_pattern.foreach_cell([&sidbs](const auto& c) { sidbs.push_back(c); });
+
+        if (sidbs.size() != seed.size())
+        {
+            return {};
+        }
+
+        // charge distribution surfaces order their SiDBs by coordinate
+        std::ranges::sort(sidbs);
+
+        std::unordered_map<cell<Lyt>, sidb_charge_state> charge_states{};
+        charge_states.reserve(sidbs.size());
+
+        for (std::size_t i = 0; i < sidbs.size(); ++i)
+        {
+            charge_states.emplace(sidbs[i], seed[i]);
+        }
+
+        return charge_states;
+    }
+    /**
+     * Checks whether the given seed is a physically valid charge distribution of the given layout under the current
+     * simulation parameters.
+     *
+     * @param lyt_with_input_pattern The SiDB layout with a given input combination applied.
+     * @param geometry Optional geometry cache of `lyt_with_input_pattern`.
+     * @param seed Charge states ordered like the SiDBs of a charge distribution surface of `lyt_with_input_pattern`.
+     * @return The seed as a charge distribution surface if it is physically valid, `std::nullopt` otherwise.
+     */
+    [[nodiscard]] std::optional<charge_distribution_surface<Lyt>>
+    validate_seed(const Lyt& lyt_with_input_pattern,
+                  const std::shared_ptr<const sidb_geometry_cache<cell<Lyt>>>& geometry,
+                  const std::vector<sidb_charge_state>& seed) const noexcept
+    {
+        if (lyt_with_input_pattern.num_cells() != seed.size())
+        {
+            return std::nullopt;
+        }
+
+        auto cds = [this, &lyt_with_input_pattern, &geometry]
+        {
+            if constexpr (is_charge_distribution_surface_v<Lyt>)
+            {
+                charge_distribution_surface<Lyt> seed_cds{lyt_with_input_pattern};
+                seed_cds.assign_physical_parameters(parameters.simulation_parameters);
+
+                return seed_cds;
+            }
+            else
+            {
+                return charge_distribution_surface<Lyt>{lyt_with_input_pattern, parameters.simulation_parameters,
+                                                        geometry};
+            }
+        }();
+
+        for (uint64_t i = 0; i < seed.size(); ++i)
+        {
+            cds.assign_charge_state_by_index(i, seed[i], charge_index_mode::KEEP_CHARGE_INDEX);
+        }
+
+        cds.update_after_charge_change();
+
+        if (!cds.is_physically_valid())
+        {
+            return std::nullopt;
+        }
+
+        cds.charge_distribution_to_index();
+
+        return cds;
+    }
 
     /**
      * Returns the charge distribution surface of the canvas layout, constructing it on first use.
@@ -1010,14 +1288,41 @@ class is_operational_impl
         return *bii;
     }
 
+    /**
+     * Returns the geometry cache of the layout with the given input pattern applied.
+     *
+     * @param input_pattern The input pattern.
+     * @return The geometry cache of the layout with `input_pattern` applied, or `nullptr` if none was supplied.
+     */
+    [[nodiscard]] std::shared_ptr<const sidb_geometry_cache<cell<Lyt>>>
+    geometry_of_input_pattern(const uint64_t input_pattern) const noexcept
+    {
+        if (input_pattern_geometries != nullptr)
+        {
+            assert(input_pattern < input_pattern_geometries->size() && "input pattern out of range");
+
+            return (*input_pattern_geometries)[input_pattern];
+        }
+
+        return nullptr;
+    }
     /**
      * This function conducts physical simulation of the given SiDB layout.
      * The simulation results are stored in the `sim_result` variable.
      *
      * @param lyt_with_input_pattern The SiDB layout with a given input combination applied.
+     * @param geometry Optional geometry cache of `lyt_with_input_pattern` that is used by *QuickExact*.
+     * @param on_ground_state Optional function that *QuickExact* reports each proven ground state to. If given, the
+     * charge distributions are enumerated by branch and bound, and the simulation is aborted once it returns `false`.
+     * @param seed Optional charge states of a ground state under similar simulation parameters that warm-start
+     * *QuickExact* and *QuickSim* (see `enable_warm_start`).
      * @return Simulation results.
      */
-    [[nodiscard]] sidb_simulation_result<Lyt> physical_simulation_of_layout(const Lyt& lyt_with_input_pattern) noexcept
+    [[nodiscard]] sidb_simulation_result<Lyt>
+    physical_simulation_of_layout(const Lyt&                                                   lyt_with_input_pattern,
+                                  const std::shared_ptr<const sidb_geometry_cache<cell<Lyt>>>& geometry,
+                                  const ground_state_callback<Lyt>&     on_ground_state = {},
+                                  const std::vector<sidb_charge_state>& seed            = {}) noexcept
     {
         if (parameters.sim_engine == sidb_simulation_engine::EXGS)
         {
@@ -1026,17 +1331,38 @@ class is_operational_impl
         }
         if (parameters.sim_engine == sidb_simulation_engine::QUICKEXACT)
         {
-            // perform QuickExact exact simulation
-            const quickexact_params<cell<Lyt>> quickexact_params{
+            // perform QuickExact exact simulation; only the ground states are evaluated, hence, no other charge
+            // distributions are kept and the ground states are stored compactly
+            quickexact_params<cell<Lyt>> quickexact_params{
                 parameters.simulation_parameters,
                 fiction::quickexact_params<cell<Lyt>>::automatic_base_number_detection::OFF};
+            quickexact_params.result_format  = charge_distribution_format::COMPACT;
+            quickexact_params.result_mode    = simulation_result_mode::GROUND_STATE_ONLY;
+            quickexact_params.geometry_cache = geometry;
+
+            if (on_ground_state)
+            {
+                // only branch and bound proves ground states before the enumeration is complete
+                quickexact_params.enumeration =
+                    fiction::quickexact_params<cell<Lyt>>::charge_enumeration::BRANCH_AND_BOUND;
+
+                // the seed is tried first, which bounds the search by its energy if it is still physically valid
+                if (!seed.empty())
+                {
+                    quickexact_params.charge_state_hint = seed_charge_states(lyt_with_input_pattern, seed);
+                }
+
+                return quickexact(lyt_with_input_pattern, quickexact_params, on_ground_state);
+            }
+
             return quickexact(lyt_with_input_pattern, quickexact_params);
         }
 #if (FICTION_ALGLIB_ENABLED)
         if (parameters.sim_engine == sidb_simulation_engine::CLUSTERCOMPLETE)
         {
-            // perform ClusterComplete exact simulation
-            const clustercomplete_params<cell<Lyt>> cc_params{parameters.simulation_parameters};
+            // perform ClusterComplete exact simulation; only the ground states are evaluated
+            clustercomplete_params<cell<Lyt>> cc_params{parameters.simulation_parameters};
+            cc_params.result_mode = simulation_result_mode::GROUND_STATE_ONLY;
             return clustercomplete(lyt_with_input_pattern, cc_params);
         }
 #endif  // FICTION_ALGLIB_ENABLED
@@ -1046,12 +1372,30 @@ class is_operational_impl
             {
                 assert(parameters.simulation_parameters.base == 2 && "QuickSim does not support base-3 simulation");
 
+                auto valid_seed = seed.empty() ? std::nullopt : validate_seed(lyt_with_input_pattern, geometry, seed);
+
+                const uint64_t iteration_steps =
+                    valid_seed.has_value() ? parameters.warm_start_iteration_steps : uint64_t{500};
+
                 // perform QuickSim heuristic simulation
                 const quicksim_params qs_params{.simulation_parameters = parameters.simulation_parameters,
-                                                .iteration_steps       = 500,
-                                                .alpha                 = 0.6};
+                                                .iteration_steps       = iteration_steps,
+                                                .alpha                 = 0.6,
+                                                .precision             = parameters.precision};
+
+                auto qs_result = quicksim(lyt_with_input_pattern, qs_params);
+
+                if (valid_seed.has_value())
+                {
+                    if (!qs_result.has_value())
+                    {
+                        qs_result = sidb_simulation_result<Lyt>{};
+                    }
+
+                    qs_result->charge_distributions.push_back(std::move(*valid_seed));
+                }
 
-                if (const auto qs_result = quicksim(lyt_with_input_pattern, qs_params); qs_result.has_value())
+                if (qs_result.has_value())
                 {
                     return qs_result.value();
                 }
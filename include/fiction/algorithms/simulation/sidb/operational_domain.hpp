@@ -5,6 +5,7 @@
 #ifndef FICTION_OPERATIONAL_DOMAIN_HPP
 #define FICTION_OPERATIONAL_DOMAIN_HPP
 
+#include "fiction/algorithms/simulation/sidb/compact_sidb_simulation_domain.hpp"
 #include "fiction/algorithms/simulation/sidb/critical_temperature.hpp"
 #include "fiction/algorithms/simulation/sidb/detect_bdl_pairs.hpp"
 #include "fiction/algorithms/simulation/sidb/detect_bdl_wires.hpp"
@@ -18,9 +19,13 @@
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
 #include "fiction/technology/cell_technologies.hpp"
 #include "fiction/technology/constants.hpp"
+#include "fiction/technology/sidb_charge_state.hpp"
+#include "fiction/technology/sidb_geometry_cache.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/hash.hpp"
 #include "fiction/utils/math_utils.hpp"
+#include "fiction/utils/phmap_utils.hpp"
+#include "fiction/utils/work_stealing_thread_pool.hpp"
 
 #include <btree.h>
 #include <fmt/format.h>
@@ -29,6 +34,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <bit>
 #include <cassert>
 #include <cmath>
 #include <condition_variable>
@@ -36,16 +42,22 @@
 #include <cstdint>
 #include <cstdlib>
 #include <deque>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <mutex>
 #include <numeric>
 #include <optional>
 #include <queue>
 #include <random>
 #include <ranges>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <system_error>
 #include <string_view>
 #include <thread>
 #include <tuple>
@@ -272,7 +284,7 @@ class critical_temperature_domain : public sidb_simulation_domain<parameter_poin
     {
         double min_ct = std::numeric_limits<double>::infinity();
 
-        this->for_each(
+        this->for_each_in_place(
             [&min_ct](const auto&, const auto& op_value)
             {
                 if (std::get<0>(op_value) == operational_status::OPERATIONAL)
@@ -292,7 +304,7 @@ class critical_temperature_domain : public sidb_simulation_domain<parameter_poin
     {
         double max_ct = 0.0;
 
-        this->for_each(
+        this->for_each_in_place(
             [&max_ct](const auto&, const auto& op_value)
             {
                 if (std::get<0>(op_value) == operational_status::OPERATIONAL)
@@ -360,6 +372,31 @@ struct operational_domain_params
      * computation to leave cores free for other work.
      */
     std::size_t number_of_threads{std::max(std::size_t{std::thread::hardware_concurrency()}, std::size_t{1})};
+    /**
+     * Path of a journal file that records the operational domain (or critical temperature domain) computation. If
+     * empty, no journal is kept.
+     *
+     * Each parameter point is appended to the journal as soon as its evaluation completes, in the CSV format of
+     * `write_operational_domain`. If the file already exists, the parameter points recorded in it are loaded first and
+     * not evaluated again, such that an interrupted sweep can be resumed by restarting it with the same journal. Only
+     * rows whose parameter values lie on the grid of the current sweep are loaded, and a row that was cut off by the
+     * interruption is discarded. The journal has to stem from the same layout, truth table, and operational parameters;
+     * this is not checked.
+     */
+    std::string journal_file{};
+    /**
+     * If `true`, the simulations of a parameter point are warm-started from the ground states of an already evaluated
+     * neighboring parameter point. Since the ground states rarely change between adjacent parameter points, they are
+     * usually still physically valid. *QuickSim* then adds them to its result and conducts fewer iterations. If
+     * `is_operational_params::early_termination` is set, *QuickExact* tries them first in its branch-and-bound
+     * enumeration, such that their energy bounds the search from the start; the operational status is the same as
+     * without warm-starting. The other simulation engines are not affected.
+     *
+     * Warm-starting pays off for the algorithms that evaluate neighboring parameter points one after another, i.e.,
+     * flood fill, contour tracing, adaptive refinement, and grid search on few threads. The ground states of the
+     * evaluated parameter points are kept in memory for the duration of the computation.
+     */
+    bool warm_start{false};
 };
 /**
  * Statistics for the operational domain computation. The statistics are used across the different operational domain
@@ -391,11 +428,52 @@ struct operational_domain_stats
      * Total number of parameter points in the parameter space.
      */
     std::size_t num_total_parameter_points{0};
+    /**
+     * Number of parameter combinations that were loaded from the journal of a previous run instead of being evaluated.
+     */
+    std::size_t num_resumed_parameter_combinations{0};
+    /**
+     * Number of parameter combinations whose operational status was inferred by adaptive refinement from the corners of
+     * the enclosing cell instead of being evaluated.
+     */
+    std::size_t num_inferred_parameter_combinations{0};
+    /**
+     * Number of evaluated parameter combinations whose simulations were warm-started from the ground states of a
+     * neighboring parameter point.
+     */
+    std::size_t num_warm_started_parameter_combinations{0};
 };
 
 namespace detail
 {
 
+/**
+ * Converts a sweep parameter to a string representation. This is used to write the parameter name to CSV files, i.e.,
+ * to written operational domains and to operational domain journals.
+ *
+ * @param param The sweep parameter to be converted.
+ * @return The string representation of the sweep parameter.
+ */
+[[nodiscard]] static inline std::string sweep_parameter_to_string(const sweep_parameter& param) noexcept
+{
+    switch (param)
+    {
+        case sweep_parameter::EPSILON_R:
+        {
+            return "epsilon_r";
+        }
+        case sweep_parameter::LAMBDA_TF:
+        {
+            return "lambda_tf";
+        }
+        case sweep_parameter::MU_MINUS:
+        {
+            return "mu_minus";
+        }
+    }
+
+    return "";
+}
 /**
  * This function validates the given parameters for the operational domain computation. It checks if the minimum
  * value of any sweep dimension is larger than the corresponding maximum value, and if the step size of any sweep
@@ -456,6 +534,27 @@ void validate_operational_domain_params(const Lyt& lyt, const operational_domain
                 fmt::format("Invalid sweep dimension: 'step' size is negative or 0 for dimension {}", d));
         }
     }
+
+    // the step indices of a grid point are packed into a single 64-bit key
+    std::size_t key_width = 0;
+
+    for (const auto& dimension : params.sweep_dimensions)
+    {
+        const auto max_step = std::round((dimension.max - dimension.min) / dimension.step);
+
+        if (max_step >= static_cast<double>(std::numeric_limits<uint64_t>::max()))
+        {
+            throw std::invalid_argument("Invalid sweep dimensions: the grid has too many points");
+        }
+
+        key_width += static_cast<std::size_t>(std::bit_width(static_cast<uint64_t>(max_step)));
+    }
+
+    if (key_width > std::numeric_limits<uint64_t>::digits)
+    {
+        throw std::invalid_argument(
+            "Invalid sweep dimensions: the step indices of a grid point do not fit into 64 bits");
+    }
 }
 
 template <typename Lyt, typename TT, typename OpDomain = operational_domain>
@@ -487,7 +586,8 @@ class operational_domain_impl
             output_bdl_wires{detect_bdl_wires(lyt, params.operational_params.input_bdl_iterator_params.bdl_wire_params,
                                               bdl_wire_selection::OUTPUT)},
             input_pattern_layouts{generate_bdl_input_pattern_layouts(
-                lyt, params.operational_params.input_bdl_iterator_params, input_bdl_wires)}
+                lyt, params.operational_params.input_bdl_iterator_params, input_bdl_wires)},
+            input_pattern_geometries{generate_geometry_caches(input_pattern_layouts)}
     {
         // the public entry points reject a `FILTER_ONLY` request on a layout without `LOGIC` cells, so this may only
         // be empty for the strategies that do not need a canvas
@@ -536,6 +636,8 @@ class operational_domain_impl
                                        (static_cast<double>(i) * params.sweep_dimensions.at(d).step));
             }
         }
+
+        evaluated = compact_domain{number_of_grid_steps()};
     }
     /**
      * Additional Constructor. Initializes the layout, the parameters and the statistics.
@@ -584,6 +686,103 @@ class operational_domain_impl
                                        (static_cast<double>(i) * params.sweep_dimensions.at(d).step));
             }
         }
+
+        evaluated = compact_domain{number_of_grid_steps()};
+    }
+    /**
+     * Loads the parameter points that were evaluated in a previous run from the journal file given in the parameters
+     * and opens the journal to append all parameter points that are evaluated from now on. Does nothing if no journal
+     * file is given.
+     *
+     * The journal is read in the CSV format of `write_operational_domain` with the default tags. Only rows that are
+     * terminated by a newline are loaded; a trailing row without one was cut off while being written and is removed
+     * from the file. Rows that cannot be parsed or whose parameter values do not lie on the grid of the current sweep
+     * are skipped.
+     *
+     * @throws std::invalid_argument if the header of the journal does not match the sweep dimensions and the domain
+     * type of this computation.
+     * @throws std::ofstream::failure if the journal file could not be opened for writing or its cut-off row could not be
+     * removed.
+     */
+    void open_journal()
+    {
+        if (params.journal_file.empty())
+        {
+            return;
+        }
+
+        std::string content{};
+
+        if (std::ifstream is{params.journal_file}; is.is_open())
+        {
+            std::ostringstream buffer{};
+            buffer << is.rdbuf();
+            content = buffer.str();
+        }
+
+        // drop a row that was cut off by an interruption, such that appended rows start on a line of their own
+        const auto last_newline  = content.rfind('\n');
+        const auto complete_size = last_newline == std::string::npos ? std::size_t{0} : last_newline + 1;
+
+        if (complete_size != content.size())
+        {
+            content.resize(complete_size);
+
+            std::error_code ec{};
+            std::filesystem::resize_file(params.journal_file, complete_size, ec);
+
+            // appending to the cut-off row would corrupt the first appended one, so the journal cannot be used
+            if (ec)
+            {
+                throw std::ofstream::failure("could not remove the cut-off row from the journal file", ec);
+            }
+        }
+
+        std::vector<std::string> columns{};
+        columns.reserve(num_dimensions + 2);
+
+        for (auto d = 0u; d < num_dimensions; ++d)
+        {
+            columns.push_back(sweep_parameter_to_string(params.sweep_dimensions.at(d).dimension));
+        }
+
+        columns.emplace_back("operational status");
+
+        if constexpr (std::is_same_v<OpDomain, critical_temperature_domain>)
+        {
+            columns.emplace_back("critical temperature");
+        }
+
+        const auto header = join_journal_row(columns);
+
+        std::istringstream rows{content};
+        std::string        row{};
+
+        const auto is_new_journal = !std::getline(rows, row);
+
+        if (!is_new_journal && row != header)
+        {
+            throw std::invalid_argument(
+                fmt::format("the journal '{}' does not match the sweep: expected the header '{}', found '{}'",
+                            params.journal_file, header, row));
+        }
+
+        while (std::getline(rows, row))
+        {
+            resume_journal_row(split_journal_row(row), columns.size());
+        }
+
+        journal.open(params.journal_file, std::ofstream::out | std::ofstream::app);
+
+        if (!journal.is_open())
+        {
+            throw std::ofstream::failure("could not open journal file");
+        }
+
+        if (is_new_journal)
+        {
+            journal << header << '\n' << std::flush;
+        }
     }
     /**
      * Performs a grid search over the specified parameter ranges with the specified step sizes. The grid search
@@ -596,6 +795,9 @@ class operational_domain_impl
     {
         const mockturtle::stopwatch stop{stats.time_total};
 
+        // every grid point is evaluated, so a slot per grid point does not waste memory
+        use_dense_storage();
+
         const auto all_index_combinations = cartesian_combinations(indices);
 
         std::vector<step_point> all_step_points{};
@@ -604,18 +806,11 @@ class operational_domain_impl
         std::ranges::transform(all_index_combinations, std::back_inserter(all_step_points),
                                [](const auto& comb) noexcept { return step_point{comb}; });
 
-        // shuffle the step points to simulate in random order. This helps with load-balancing since
-        // operational/non-operational points are usually clustered. However, non-operational points can be simulated
-        // faster on average because of the early termination condition. Thus, threads that mainly simulate
-        // non-operational points will finish earlier and will be idle while other threads are still simulating the more
-        // expensive operational points
-        std::ranges::shuffle(all_step_points, std::mt19937_64{std::random_device{}()});
-
         simulate_operational_status_in_parallel(all_step_points);
 
         log_stats();
 
-        return op_domain;
+        return materialize_op_domain();
     }
     /**
      * Performs a random sampling of the specified number of samples within the specified parameter range. The
@@ -634,7 +829,7 @@ class operational_domain_impl
 
         log_stats();
 
-        return op_domain;
+        return materialize_op_domain();
     }
     /**
      * Performs flood fill to determine the operational domain. The algorithm first performs a random sampling of the
@@ -669,10 +864,6 @@ class operational_domain_impl
             step_point_samples.push_back(to_step_point(given_parameter_point.value()));
         }
 
-        // the samples are generated in lexicographic order, which distributes poorly over the slice-based thread
-        // assignment; shuffle them for better load balancing. The order is irrelevant for the flood fill itself
-        std::ranges::shuffle(step_point_samples, std::mt19937_64{std::random_device{}()});
-
         simulate_operational_status_in_parallel(step_point_samples);
 
         // a queue of (x, y[, z]) dimension step points to be evaluated, and the set of step points that have already
@@ -706,7 +897,7 @@ class operational_domain_impl
             const auto neighborhood = moore_neighborhood(sp);
 
             std::ranges::copy_if(neighborhood, std::back_inserter(unknown),
-                                 [this](const auto& m) noexcept { return !op_domain.contains(to_parameter_point(m)); });
+                                 [this](const auto& m) noexcept { return !evaluated_value(m).has_value(); });
 
             return unknown;
         };
@@ -724,16 +915,24 @@ class operational_domain_impl
             }
         };
 
-        // seed the queue with the neighbors of each operational sample
-        op_domain.for_each(
-            [this, &schedule_points, &unknown_neighborhood](const auto& param_point, const auto& status) noexcept
+        // seed the queue with the neighbors of each operational sample. The samples are collected first, since the
+        // neighborhood lookups must not happen while the domain is being iterated
+        std::vector<step_point> operational_samples{};
+
+        evaluated.for_each(
+            [this, &operational_samples](const auto key, const auto& status) noexcept
             {
                 if (std::get<0>(status) == operational_status::OPERATIONAL)
                 {
-                    schedule_points(unknown_neighborhood(to_step_point(param_point)));
+                    operational_samples.emplace_back(evaluated.unpack(key));
                 }
             });
 
+        for (const auto& sp : operational_samples)
+        {
+            schedule_points(unknown_neighborhood(sp));
+        }
+
         // if random sampling did not find a single operational point, there is nothing to flood fill
         if (!queue.empty())
         {
@@ -800,7 +999,7 @@ class operational_domain_impl
 
         log_stats();
 
-        return op_domain;
+        return materialize_op_domain();
     }
     // NOLINTEND(bugprone-exception-escape)
     /**
@@ -859,7 +1058,7 @@ class operational_domain_impl
         for (const auto& starting_point : step_point_samples)
         {
             // if the current starting point is non-operational, skip to the next one
-            const auto domain_value = op_domain.contains(to_parameter_point(starting_point));
+            const auto domain_value = evaluated_value(starting_point);
             if (domain_value.has_value())
             {
                 if (std::get<0>(domain_value.value()) == operational_status::NON_OPERATIONAL)
@@ -924,7 +1123,7 @@ class operational_domain_impl
 
         log_stats();
 
-        return op_domain;
+        return materialize_op_domain();
     }
     /**
      * Traces the boundary surface of the operational domain in three or more dimensions.
@@ -974,7 +1173,7 @@ class operational_domain_impl
         for (const auto& starting_point : step_point_samples)
         {
             // if the current starting point is non-operational, skip to the next one
-            const auto domain_value = op_domain.contains(to_parameter_point(starting_point));
+            const auto domain_value = evaluated_value(starting_point);
             if (domain_value.has_value())
             {
                 if (std::get<0>(domain_value.value()) == operational_status::NON_OPERATIONAL)
@@ -1034,71 +1233,141 @@ class operational_domain_impl
 
         log_stats();
 
-        return op_domain;
+        return materialize_op_domain();
     }
     /**
-     * Performs a grid search over the specified parameter ranges. For each physical parameter combination found for
-     * which the given CDS is physically valid, it is determined whether the CDS is the ground state or the n-th excited
-     * state.
+     * Performs adaptive refinement to determine the operational domain. The algorithm starts from a coarse grid that
+     * samples every `initial_spacing`-th step in each dimension, which partitions the parameter space into cells whose
+     * corners are the coarse grid points. Each cell whose corners disagree in their operational status is halved in
+     * every dimension that spans more than one step, and the corners of the resulting subcells are evaluated. This is
+     * repeated until each cell either has corners of a single operational status or spans at most one step in each
+     * dimension. A cell of agreeing corners is subdivided nonetheless if a subdivided neighbor cell has evaluated a
+     * point of the other status on their common face. The grid points inside the remaining cells of agreeing corners
+     * are not simulated, but inferred to share the status of the corners.
      *
-     * @param lyt SiDB cell-level layout that is simulated and compared to the given CDS.
-     * @return All physically valid physical parameters and the excited state number.
+     * The corners of all cells of one refinement level are evaluated in parallel.
+     *
+     * @param initial_spacing Number of steps between two neighboring points of the coarse grid. Values below `1` are
+     * treated as `1`, which degenerates to a grid search.
+     * @return The operational domain of the layout, which holds an evaluated or inferred status for each grid point.
      */
-    [[nodiscard]] sidb_simulation_domain<parameter_point, uint64_t>
-    grid_search_for_physically_valid_parameters(Lyt& lyt) noexcept
+    // NOLINTNEXTLINE(bugprone-exception-escape): only allocation can throw, which is fatal to the algorithm anyway
+    [[nodiscard]] OpDomain adaptive_refinement(const std::size_t initial_spacing) noexcept
     {
-        sidb_simulation_domain<parameter_point, uint64_t> suitable_params_domain{};
+        static_assert(std::is_same_v<OpDomain, operational_domain>,
+                      "Adaptive refinement infers operational statuses, but not critical temperatures");
 
         const mockturtle::stopwatch stop{stats.time_total};
 
-        // Cartesian product of all step point indices
-        const auto all_index_combinations = cartesian_combinations(indices);
-
-        // number of threads. Floored at `1` so that the slice arithmetic below stays well-defined when there is
-        // nothing to distribute; the `start >= end` guard in the loop then keeps the worker from being launched
-        const auto num_threads = std::max(std::min(number_of_threads, all_index_combinations.size()), std::size_t{1});
+        // the refinement ends up with a value for every grid point, so a slot per grid point does not waste memory
+        use_dense_storage();
 
-        // calculate the size of each slice
-        const auto slice_size = (all_index_combinations.size() + num_threads - 1) / num_threads;
+        const auto spacing = std::max(initial_spacing, std::size_t{1});
 
-        std::vector<std::thread> threads{};
-        threads.reserve(num_threads);
+        // the intervals between neighboring coarse grid points, which include the last step of each dimension
+        std::vector<std::vector<std::pair<std::size_t, std::size_t>>> coarse_intervals(num_dimensions);
 
-        // launch threads, each with its own slice of random step points
-        for (auto i = 0ul; i < num_threads; ++i)
+        for (auto d = 0u; d < num_dimensions; ++d)
         {
-            const auto start = i * slice_size;
-            const auto end   = std::min(start + slice_size, all_index_combinations.size());
+            const auto last = indices.at(d).size() - 1;
+
+            for (std::size_t lower = 0; lower < last; lower += spacing)
+            {
+                coarse_intervals.at(d).emplace_back(lower, std::min(lower + spacing, last));
+            }
 
-            if (start >= end)
+            // a dimension of a single step is covered by a degenerate interval
+            if (coarse_intervals.at(d).empty())
             {
-                break;  // no more work to distribute
+                coarse_intervals.at(d).emplace_back(0, 0);
             }
+        }
+
+        auto cells = cells_of_intervals(coarse_intervals);
 
-            threads.emplace_back(
-                [this, &lyt, start, end, &all_index_combinations]
+        // the cells whose corners agree, together with the operational status of their corners
+        std::vector<std::pair<refinement_cell, operational_status>> uniform_cells{};
+
+        while (!cells.empty())
+        {
+            refine_cells(cells, uniform_cells);
+
+            // a cell whose corners agree can still contain evaluated points of the other status on its boundary, which
+            // a subdivided neighbor cell has evaluated. Such a cell is not uniform after all and is subdivided as well
+            std::vector<std::pair<refinement_cell, operational_status>> consistent_cells{};
+
+            for (auto& [cell, status] : uniform_cells)
+            {
+                const auto points = cell_points(cell);
+
+                if (std::ranges::all_of(points,
+                                        [this, status](const auto& sp)
+                                        {
+                                            const auto value = evaluated_value(sp);
+
+                                            return !value.has_value() || std::get<0>(value.value()) == status;
+                                        }))
                 {
-                    for (auto it = all_index_combinations.cbegin() + static_cast<int64_t>(start);
-                         it != all_index_combinations.cbegin() + static_cast<int64_t>(end); ++it)
-                    {
-                        is_step_point_suitable(lyt, step_point{*it});  // construct a step_point
-                    }
-                });
+                    consistent_cells.emplace_back(std::move(cell), status);
+                }
+                else
+                {
+                    std::ranges::move(subdivide_cell(cell), std::back_inserter(cells));
+                }
+            }
+
+            uniform_cells = std::move(consistent_cells);
         }
 
-        // wait for all threads to complete
-        for (auto& thread : threads)
+        // the grid points of cells with agreeing corners take over the status of the corners. Points that have been
+        // evaluated, e.g., because they are shared with a subdivided neighbor cell, keep their evaluated status
+        for (const auto& [cell, status] : uniform_cells)
         {
-            if (thread.joinable())
+            for (const auto& sp : cell_points(cell))
             {
-                thread.join();
+                const auto key = evaluated.pack(sp.step_values);
+
+                if (!evaluated.contains(key).has_value())
+                {
+                    evaluated.add_value(key, std::make_tuple(status));
+
+                    ++num_inferred_parameter_combinations;
+                }
             }
         }
 
+        log_stats();
+
+        return materialize_op_domain();
+    }
+    /**
+     * Performs a grid search over the specified parameter ranges. For each physical parameter combination found for
+     * which the given CDS is physically valid, it is determined whether the CDS is the ground state or the n-th excited
+     * state.
+     *
+     * @param lyt SiDB cell-level layout that is simulated and compared to the given CDS.
+     * @return All physically valid physical parameters and the excited state number.
+     */
+    [[nodiscard]] sidb_simulation_domain<parameter_point, uint64_t>
+    grid_search_for_physically_valid_parameters(Lyt& lyt) noexcept
+    {
+        sidb_simulation_domain<parameter_point, uint64_t> suitable_params_domain{};
+
+        const mockturtle::stopwatch stop{stats.time_total};
+
+        use_dense_storage();
+
+        // Cartesian product of all step point indices
+        const auto all_index_combinations = cartesian_combinations(indices);
+
+        shared_work_stealing_thread_pool(number_of_threads)
+            .for_each_index(all_index_combinations.size(), [this, &lyt, &all_index_combinations](const std::size_t i)
+                            { is_step_point_suitable(lyt, step_point{all_index_combinations[i]}); });
+
         sidb_simulation_parameters simulation_parameters = params.operational_params.simulation_parameters;
 
-        op_domain.for_each(
-            [&simulation_parameters, &lyt, this, &suitable_params_domain](const auto& param_point, const auto& status)
+        evaluated.for_each(
+            [&simulation_parameters, &lyt, this, &suitable_params_domain](const auto key, const auto& status)
             {
                 if constexpr (std::is_same_v<OpDomain, operational_domain>)
                 {
@@ -1107,6 +1376,8 @@ class operational_domain_impl
                         return;
                     }
 
+                    const auto param_point = to_parameter_point(step_point{evaluated.unpack(key)});
+
                     for (auto d = 0u; d < num_dimensions; ++d)
                     {
                         set_dimension_value(simulation_parameters, param_point.get_parameters().at(d), d);
@@ -1222,9 +1493,21 @@ class operational_domain_impl
      */
     Lyt canvas_lyt{};
     /**
-     * The operational domain of the layout.
+     * The operational domain of the layout. It only holds the sweep dimensions during the computation; the evaluated
+     * parameter points are stored in `evaluated` and added by `materialize_op_domain`.
      */
     OpDomain op_domain{};
+    /**
+     * Compact domain with the value types of `OpDomain`.
+     */
+    using compact_domain = std::conditional_t<std::is_same_v<OpDomain, critical_temperature_domain>,
+                                              compact_sidb_simulation_domain<operational_status, double>,
+                                              compact_sidb_simulation_domain<operational_status>>;
+    /**
+     * The evaluated step points and their values. Keying them by their packed step indices avoids allocating and
+     * quantizing a parameter point on every lookup.
+     */
+    compact_domain evaluated{};
     /**
      * Forward-declare step_point.
      */
@@ -1241,6 +1524,46 @@ class operational_domain_impl
      * Number of evaluated parameter combinations.
      */
     std::atomic<std::size_t> num_evaluated_parameter_combinations{0};
+    /**
+     * Number of parameter combinations that were loaded from the journal.
+     */
+    std::size_t num_resumed_parameter_combinations{0};
+    /**
+     * Number of parameter combinations whose operational status was inferred by `adaptive_refinement`.
+     */
+    std::size_t num_inferred_parameter_combinations{0};
+    /**
+     * Number of evaluated parameter combinations that were warm-started.
+     */
+    std::atomic<std::size_t> num_warm_started_parameter_combinations{0};
+    /**
+     * `true` if warm-starting is enabled and the simulation engine can exploit it.
+     */
+    const bool warm_start_applicable{
+        params.warm_start && (params.operational_params.sim_engine == sidb_simulation_engine::QUICKSIM ||
+                              (params.operational_params.sim_engine == sidb_simulation_engine::QUICKEXACT &&
+                               params.operational_params.early_termination))};
+    /**
+     * Charge states of a ground state per input pattern of each evaluated step point, keyed like `evaluated`. Only
+     * recorded if warm-starting is applicable.
+     */
+    locked_parallel_flat_hash_map<uint64_t, std::vector<std::vector<sidb_charge_state>>> ground_state_charges{};
+    /**
+     * Tag of operational parameter points in the journal, which matches the default of `write_operational_domain`.
+     */
+    static constexpr const char* JOURNAL_OPERATIONAL_TAG = "1";
+    /**
+     * Tag of non-operational parameter points in the journal, which matches the default of `write_operational_domain`.
+     */
+    static constexpr const char* JOURNAL_NON_OPERATIONAL_TAG = "0";
+    /**
+     * Journal that every evaluated parameter point is appended to. Only open if a journal file is given.
+     */
+    std::ofstream journal{};
+    /**
+     * Mutex that serializes the appends to the journal.
+     */
+    std::mutex journal_mutex{};
     /**
      * Number of worker threads to distribute the parameter points over, taken from the parameters and floored at `1`.
      */
@@ -1259,6 +1582,12 @@ class operational_domain_impl
      * the layout-only constructor was used, which never evaluates operational status.
      */
     const std::vector<Lyt> input_pattern_layouts;
+    /**
+     * The geometry cache of each input pattern layout, indexed by input pattern. The SiDB distances do not depend on
+     * the swept parameters, so they are computed once and shared by all sample point evaluations, which only have to
+     * recompute the screening of the potentials.
+     */
+    const std::vector<std::shared_ptr<const sidb_geometry_cache<cell<Lyt>>>> input_pattern_geometries;
     /**
      * A step point holds one step value per sweep dimension, each from 0 to the maximum number of steps in that
      * dimension. A step point does not hold the actual parameter values, but the step values.
@@ -1290,6 +1619,20 @@ class operational_domain_impl
          */
         [[nodiscard]] auto operator<=>(const step_point& other) const = default;
     };
+    /**
+     * An axis-aligned box of step points that is subdivided by `adaptive_refinement`. The box includes its bounds.
+     */
+    struct refinement_cell
+    {
+        /**
+         * Lowest step value of the cell in each dimension.
+         */
+        std::vector<std::size_t> lower;
+        /**
+         * Highest step value of the cell in each dimension.
+         */
+        std::vector<std::size_t> upper;
+    };
     /**
      * Converts a step point to a parameter point.
      *
@@ -1350,6 +1693,65 @@ class operational_domain_impl
             std::round((params.sweep_dimensions.at(dimension).max - params.sweep_dimensions.at(dimension).min) /
                        params.sweep_dimensions.at(dimension).step));
     }
+    /**
+     * Returns the number of grid values in each sweep dimension.
+     *
+     * @return The number of grid values in each sweep dimension.
+     */
+    [[nodiscard]] std::vector<std::size_t> number_of_grid_steps() const noexcept
+    {
+        std::vector<std::size_t> grid_steps{};
+        grid_steps.reserve(num_dimensions);
+
+        for (const auto& dimension_values : values)
+        {
+            grid_steps.push_back(dimension_values.size());
+        }
+
+        return grid_steps;
+    }
+    /**
+     * Retrieves the stored value of the given step point if it has been evaluated.
+     *
+     * @param sp Step point to look up.
+     * @return The stored value of `sp` if it has been evaluated, `std::nullopt` otherwise.
+     */
+    [[nodiscard]] std::optional<typename compact_domain::value_type> evaluated_value(const step_point& sp) const
+    {
+        return evaluated.contains(evaluated.pack(sp.step_values));
+    }
+    /**
+     * Switches `evaluated` to the dense storage backend, which is preferable for techniques that evaluate every grid
+     * point. Values that are already stored, e.g., resumed from a journal, are kept.
+     */
+    void use_dense_storage()
+    {
+        if (evaluated.get_storage() == simulation_domain_storage::DENSE)
+        {
+            return;
+        }
+
+        compact_domain dense_domain{evaluated.get_number_of_steps(), simulation_domain_storage::DENSE};
+
+        evaluated.for_each([&dense_domain](const auto key, const auto& value) { dense_domain.add_value(key, value); });
+
+        evaluated = std::move(dense_domain);
+    }
+    /**
+     * Converts the evaluated step points to the parameter points of the returned operational domain. This happens once
+     * at the end of the computation, such that the sampling itself only works with packed keys.
+     *
+     * @return The operational domain that holds all evaluated parameter points.
+     */
+    [[nodiscard]] OpDomain materialize_op_domain() const
+    {
+        auto result = op_domain;
+
+        evaluated.for_each([this, &result](const auto key, const auto& value)
+                           { result.add_value(to_parameter_point(step_point{evaluated.unpack(key)}), value); });
+
+        return result;
+    }
     /**
      * Helper function that sets the value of a sweep dimension in the simulation parameters.
      *
@@ -1383,6 +1785,198 @@ class operational_domain_impl
             }
         }
     }
+    /**
+     * Creates a geometry cache for each of the given layouts.
+     *
+     * @param lyts Layouts to create the geometry caches of.
+     * @return One geometry cache per layout.
+     */
+    [[nodiscard]] static std::vector<std::shared_ptr<const sidb_geometry_cache<cell<Lyt>>>>
+    generate_geometry_caches(const std::vector<Lyt>& lyts) noexcept
+    {
+        std::vector<std::shared_ptr<const sidb_geometry_cache<cell<Lyt>>>> caches{};
+        caches.reserve(lyts.size());
+
+        for (const auto& lyt : lyts)
+        {
+            caches.push_back(std::make_shared<const sidb_geometry_cache<cell<Lyt>>>(lyt));
+        }
+
+        return caches;
+    }
+    /**
+     * Joins the given columns to a row of the journal.
+     *
+     * @param columns Columns of the row.
+     * @return The columns separated by commas.
+     */
+    [[nodiscard]] static std::string join_journal_row(const std::vector<std::string>& columns) noexcept
+    {
+        std::string row{};
+
+        for (const auto& column : columns)
+        {
+            if (!row.empty())
+            {
+                row += ',';
+            }
+
+            row += column;
+        }
+
+        return row;
+    }
+    /**
+     * Splits a row of the journal into its columns.
+     *
+     * @param row Row of the journal without the terminating newline.
+     * @return The comma-separated columns of the row.
+     */
+    [[nodiscard]] static std::vector<std::string> split_journal_row(const std::string& row) noexcept
+    {
+        std::vector<std::string> columns{};
+        std::istringstream       stream{row};
+        std::string              column{};
+
+        while (std::getline(stream, column, ','))
+        {
+            columns.push_back(column);
+        }
+
+        return columns;
+    }
+    /**
+     * Parses a floating-point column of the journal.
+     *
+     * @param column Column to parse.
+     * @return The value of the column, or `std::nullopt` if it is not a complete floating-point number.
+     */
+    [[nodiscard]] static std::optional<double> parse_journal_value(const std::string& column) noexcept
+    {
+        if (column.empty())
+        {
+            return std::nullopt;
+        }
+
+        char*      end   = nullptr;
+        const auto value = std::strtod(column.c_str(), &end);
+
+        if (end != column.c_str() + column.size())
+        {
+            return std::nullopt;
+        }
+
+        return value;
+    }
+    /**
+     * Adds the parameter point of a journal row to `evaluated` without evaluating it. Rows that cannot be
+     * parsed or whose parameter values do not lie on the grid of the current sweep are skipped.
+     *
+     * @param columns Columns of the journal row.
+     * @param num_columns Expected number of columns.
+     */
+    void resume_journal_row(const std::vector<std::string>& columns, const std::size_t num_columns) noexcept
+    {
+        if (columns.size() != num_columns)
+        {
+            return;
+        }
+
+        std::vector<std::size_t> steps{};
+        steps.reserve(num_dimensions);
+
+        for (auto d = 0u; d < num_dimensions; ++d)
+        {
+            const auto value = parse_journal_value(columns[d]);
+
+            if (!value.has_value())
+            {
+                return;
+            }
+
+            const auto& range = params.sweep_dimensions.at(d);
+            const auto  step  = std::llround((value.value() - range.min) / range.step);
+
+            // the value has to coincide with a grid value of the current sweep
+            if (step < 0 || static_cast<std::size_t>(step) >= values.at(d).size() ||
+                parameter_point::quantize(values.at(d).at(static_cast<std::size_t>(step))) !=
+                    parameter_point::quantize(value.value()))
+            {
+                return;
+            }
+
+            steps.push_back(static_cast<std::size_t>(step));
+        }
+
+        const auto& status_column = columns[num_dimensions];
+
+        if (status_column != JOURNAL_OPERATIONAL_TAG && status_column != JOURNAL_NON_OPERATIONAL_TAG)
+        {
+            return;
+        }
+
+        const auto status = status_column == JOURNAL_OPERATIONAL_TAG ? operational_status::OPERATIONAL :
+                                                                       operational_status::NON_OPERATIONAL;
+
+        const auto key = evaluated.pack(steps);
+
+        if constexpr (std::is_same_v<OpDomain, critical_temperature_domain>)
+        {
+            const auto ct = parse_journal_value(columns[num_dimensions + 1]);
+
+            if (!ct.has_value())
+            {
+                return;
+            }
+
+            evaluated.add_value(key, std::tuple{status, ct.value()});
+        }
+        else
+        {
+            evaluated.add_value(key, std::make_tuple(status));
+        }
+
+        ++num_resumed_parameter_combinations;
+    }
+    /**
+     * Appends an evaluated parameter point to the journal if one is open. The row is flushed immediately, such that it
+     * survives an interruption of the computation.
+     *
+     * @param param_point Evaluated parameter point.
+     * @param status Operational status of the parameter point.
+     * @param ct Critical temperature of the parameter point. Only written for critical temperature domains.
+     */
+    void append_to_journal(const parameter_point& param_point, const operational_status status,
+                           [[maybe_unused]] const double ct = 0.0) noexcept
+    {
+        if (!journal.is_open())
+        {
+            return;
+        }
+
+        std::vector<std::string> columns{};
+        columns.reserve(num_dimensions + 2);
+
+        // the shortest representation that parses back to the same value
+        for (const auto value : param_point.get_parameters())
+        {
+            columns.push_back(fmt::format("{}", value));
+        }
+
+        columns.emplace_back(status == operational_status::OPERATIONAL ? JOURNAL_OPERATIONAL_TAG :
+                                                                         JOURNAL_NON_OPERATIONAL_TAG);
+
+        if constexpr (std::is_same_v<OpDomain, critical_temperature_domain>)
+        {
+            columns.push_back(fmt::format("{}", ct));
+        }
+
+        const auto row = join_journal_row(columns);
+
+        const std::scoped_lock lock{journal_mutex};
+
+        journal << row << '\n' << std::flush;
+    }
     /**
      * Logs and returns the operational status at the given point `sp = (d1, ..., dn)`. If the point has already been
      * sampled, it returns the cached value. Otherwise, a ground state simulation is performed for all input
@@ -1390,14 +1984,16 @@ class operational_domain_impl
      * non-operational state is found. In the worst case, the function performs \f$2^i\f$ simulations, where \f$i\f$ is
      * the number of inputs of the layout. This function is used by all operational domain computation techniques.
      *
-     * Any investigated point is added to the stored `op_domain`, regardless of its operational status.
+     * Any investigated point is added to `evaluated`, regardless of its operational status.
      *
      * @param sp Step point to be investigated.
      * @return The operational status of the layout under the given simulation parameters.
      */
     operational_status is_step_point_operational(const step_point& sp) noexcept
     {
-        if (const auto op_value = op_domain.contains(to_parameter_point(sp)); op_value.has_value())
+        const auto key = evaluated.pack(sp.step_values);
+
+        if (const auto op_value = evaluated.contains(key); op_value.has_value())
         {
             return std::get<0>(*op_value);
         }
@@ -1405,34 +2001,38 @@ class operational_domain_impl
         const auto param_point = to_parameter_point(sp);
 
         // NOLINTNEXTLINE(bugprone-exception-escape): only allocation can throw, as in the enclosing algorithms
-        const auto operational = [this, &param_point](const std::optional<double>& ct_value = std::nullopt) noexcept
+        const auto operational = [this, key, &param_point](const std::optional<double>& ct_value = std::nullopt) noexcept
         {
             if constexpr (std::is_same_v<OpDomain, critical_temperature_domain>)
             {
                 if (ct_value.has_value())
                 {
-                    op_domain.add_value(param_point, std::tuple{operational_status::OPERATIONAL, ct_value.value()});
+                    evaluated.add_value(key, std::tuple{operational_status::OPERATIONAL, ct_value.value()});
+                    append_to_journal(param_point, operational_status::OPERATIONAL, ct_value.value());
                 }
             }
             else
             {
-                op_domain.add_value(param_point, std::make_tuple(operational_status::OPERATIONAL));
+                evaluated.add_value(key, std::make_tuple(operational_status::OPERATIONAL));
+                append_to_journal(param_point, operational_status::OPERATIONAL);
             }
 
             return operational_status::OPERATIONAL;
         };
 
-        const auto non_operational = [this, &param_point]() noexcept
+        const auto non_operational = [this, key, &param_point]() noexcept
         {
             if constexpr (std::is_same_v<OpDomain, critical_temperature_domain>)
             {
-                op_domain.add_value(param_point, std::tuple{operational_status::NON_OPERATIONAL, 0.0});
+                evaluated.add_value(key, std::tuple{operational_status::NON_OPERATIONAL, 0.0});
             }
             else
             {
-                op_domain.add_value(param_point, std::make_tuple(operational_status::NON_OPERATIONAL));
+                evaluated.add_value(key, std::make_tuple(operational_status::NON_OPERATIONAL));
             }
 
+            append_to_journal(param_point, operational_status::NON_OPERATIONAL);
+
             return operational_status::NON_OPERATIONAL;
         };
 
@@ -1448,11 +2048,33 @@ class operational_domain_impl
         auto op_params_set_dimension_values                  = params.operational_params;
         op_params_set_dimension_values.simulation_parameters = sim_params;
 
-        const auto& [status, sim_calls] =
-            is_operational(input_pattern_layouts, truth_table, op_params_set_dimension_values, input_bdl_wires,
-                           output_bdl_wires, std::optional{canvas_lyt});
+        // the implementation is instantiated directly to hand the geometry caches of the input pattern layouts over
+        detail::is_operational_impl<Lyt, TT> is_operational_p{
+            input_pattern_layouts, truth_table, op_params_set_dimension_values, input_bdl_wires, output_bdl_wires,
+            canvas_lyt, &input_pattern_geometries};
+
+        if (warm_start_applicable)
+        {
+            auto seed = ground_state_charges_of_neighbor(sp);
+
+            if (!seed.empty())
+            {
+                ++num_warm_started_parameter_combinations;
+            }
+
+            is_operational_p.enable_warm_start(std::move(seed));
+        }
+
+        const auto [status, _] = is_operational_p.run();
 
-        num_simulator_invocations += sim_calls;
+        num_simulator_invocations += is_operational_p.get_number_of_simulator_invocations();
+
+        // only step points at which at least one input pattern was simulated can seed their neighbors
+        if (const auto& charges = is_operational_p.get_ground_state_charges();
+            std::ranges::any_of(charges, [](const auto& gs) { return !gs.empty(); }))
+        {
+            ground_state_charges.try_emplace(key, charges);
+        }
 
         if (status == operational_status::NON_OPERATIONAL)
         {
@@ -1462,17 +2084,61 @@ class operational_domain_impl
         if constexpr (std::is_same_v<OpDomain, critical_temperature_domain>)
         {
             // the input pattern layouts and the BDL detection results do not depend on the swept parameters, so the
-            // ones generated once in the constructor are handed to every sample point instead of being re-derived here
+            // ones generated once in the constructor are handed to every sample point instead of being re-derived here.
+            // The sample points are already distributed over the threads, so the input patterns are simulated
+            // sequentially
             const auto ct = critical_temperature_gate_based(
                 input_pattern_layouts, truth_table,
-                critical_temperature_params{.operational_params = op_params_set_dimension_values}, output_bdl_pairs,
-                input_bdl_wires, output_bdl_wires);
+                critical_temperature_params{.operational_params = op_params_set_dimension_values,
+                                            .number_of_threads  = 1},
+                output_bdl_pairs, input_bdl_wires, output_bdl_wires);
 
             return operational(ct);
         }
 
         return operational();
     }
+    /**
+     * Returns the ground states that were recorded for an evaluated neighbor of the given step point, i.e., a step
+     * point that differs by one step in a single dimension.
+     *
+     * @param sp Step point whose neighbors are looked up.
+     * @return Charge states of a ground state per input pattern of the first evaluated neighbor, or an empty vector if
+     * no neighbor has been evaluated yet.
+     */
+    [[nodiscard]] std::vector<std::vector<sidb_charge_state>>
+    ground_state_charges_of_neighbor(const step_point& sp) const noexcept
+    {
+        std::vector<std::vector<sidb_charge_state>> charges{};
+
+        auto neighbor = sp.step_values;
+
+        for (auto d = 0u; d < num_dimensions && charges.empty(); ++d)
+        {
+            for (const auto step : {sp.step_values[d] + 1, sp.step_values[d] - 1})
+            {
+                // the decrement of step 0 wraps around and is caught by this check as well
+                if (step >= values[d].size())
+                {
+                    continue;
+                }
+
+                neighbor[d] = step;
+
+                ground_state_charges.if_contains(evaluated.pack(neighbor),
+                                                 [&charges](const auto& entry) { charges = entry.second; });
+
+                if (!charges.empty())
+                {
+                    break;
+                }
+            }
+
+            neighbor[d] = sp.step_values[d];
+        }
+
+        return charges;
+    }
     /**
      * This function checks if the given charge distribution surface (CDS) is physically valid for the parameter point
      * represented by the step point `sp`.
@@ -1484,7 +2150,9 @@ class operational_domain_impl
     operational_status is_step_point_suitable(Lyt lyt, const step_point& sp) noexcept
     {
         // if the point has already been sampled, return the stored operational status
-        if (const auto op_value = op_domain.contains(to_parameter_point(sp)); op_value.has_value())
+        const auto key = evaluated.pack(sp.step_values);
+
+        if (const auto op_value = evaluated.contains(key); op_value.has_value())
         {
             return std::get<0>(*op_value);
         }
@@ -1492,16 +2160,16 @@ class operational_domain_impl
         // fetch the parameter values of all sweep dimensions
         const auto param_point = to_parameter_point(sp);
 
-        const auto operational = [this, &param_point]()
+        const auto operational = [this, key]()
         {
-            op_domain.add_value(param_point, std::make_tuple(operational_status::OPERATIONAL));
+            evaluated.add_value(key, std::make_tuple(operational_status::OPERATIONAL));
 
             return operational_status::OPERATIONAL;
         };
 
-        const auto non_operational = [this, &param_point]()
+        const auto non_operational = [this, key]()
         {
-            op_domain.add_value(param_point, std::make_tuple(operational_status::NON_OPERATIONAL));
+            evaluated.add_value(key, std::make_tuple(operational_status::NON_OPERATIONAL));
 
             return operational_status::NON_OPERATIONAL;
         };
@@ -1584,50 +2252,17 @@ class operational_domain_impl
      * Simulates the operational status of the given points in parallel. It divides the work among multiple threads to
      * speed up the computation.
      *
-     * @note The distribution of the work among threads is a simple slice-based approach. If your step points are
-     * ordered, consider shuffling the vector first for better load balancing. Otherwise, some threads might finish
-     * early if they got assigned a slice with mainly non-operational samples, which are faster to compute due to the
-     * early termination condition.
+     * @note The work is distributed with work stealing. Hence, the order of the step points does not affect the load
+     * balance, even though non-operational points are usually clustered and faster to compute due to the early
+     * termination condition.
      *
      * @param step_points A vector of step points for which the operational status is to be simulated.
      */
     void simulate_operational_status_in_parallel(const std::vector<step_point>& step_points) noexcept
     {
-        // number of threads. Floored at `1` so that the slice arithmetic below stays well-defined when there is
-        // nothing to distribute; the `start >= end` guard in the loop then keeps the worker from being launched
-        const std::size_t num_threads = std::max(std::min(number_of_threads, step_points.size()), std::size_t{1});
-
-        // calculate the size of each slice
-        const auto slice_size = (step_points.size() + num_threads - 1) / num_threads;
-
-        std::vector<std::thread> threads{};
-        threads.reserve(num_threads);
-
-        // launch threads, each with its own slice of random step points
-        for (auto i = 0ul; i < num_threads; ++i)
-        {
-            const auto start = i * slice_size;
-            const auto end   = std::min(start + slice_size, step_points.size());
-
-            if (start >= end)
-            {
-                break;  // no more work to distribute
-            }
-
-            threads.emplace_back(
-                [this, start, end, &step_points]
-                {
-                    std::ranges::for_each(std::ranges::subrange{step_points.cbegin() + static_cast<int64_t>(start),
-                                                                step_points.cbegin() + static_cast<int64_t>(end)},
-                                          [this](const auto& sp) { is_step_point_operational(sp); });
-                });
-        }
-
-        // wait for all threads to complete
-        for (auto& thread : threads)
-        {
-            thread.join();
-        }
+        shared_work_stealing_thread_pool(number_of_threads)
+            .for_each_index(step_points.size(),
+                            [this, &step_points](const std::size_t i) { is_step_point_operational(step_points[i]); });
     }
     /**
      * Performs random sampling to find any operational parameter combination. This function is useful if a single
@@ -1701,6 +2336,182 @@ class operational_domain_impl
         // return the latest operational point
         return latest_operational_point;
     }
+    /**
+     * Refines the given cells level by level until each of them either has corners of a single operational status or
+     * spans at most one step in each dimension. The corners of all cells of a level are evaluated in parallel.
+     *
+     * @param cells Cells to refine. Empty afterward.
+     * @param uniform_cells Cells whose corners agree, together with the operational status of their corners. The
+     * uniform cells found during the refinement are appended.
+     */
+    // NOLINTNEXTLINE(bugprone-exception-escape): only allocation can throw, as in the calling `adaptive_refinement`
+    void refine_cells(std::vector<refinement_cell>&                                cells,
+                      std::vector<std::pair<refinement_cell, operational_status>>& uniform_cells) noexcept
+    {
+        while (!cells.empty())
+        {
+            // the corners of all cells of a level are gathered first, such that they are simulated in parallel
+            phmap::btree_set<step_point> unknown_corners{};
+
+            for (const auto& cell : cells)
+            {
+                for (const auto& corner : cell_corners(cell))
+                {
+                    if (!evaluated_value(corner).has_value())
+                    {
+                        unknown_corners.insert(corner);
+                    }
+                }
+            }
+
+            simulate_operational_status_in_parallel(
+                std::vector<step_point>(unknown_corners.cbegin(), unknown_corners.cend()));
+
+            std::vector<refinement_cell> subcells{};
+
+            for (auto& cell : cells)
+            {
+                const auto corners = cell_corners(cell);
+                const auto status  = is_step_point_operational(corners.front());
+
+                if (std::ranges::all_of(corners, [this, status](const auto& corner) noexcept
+                                        { return is_step_point_operational(corner) == status; }))
+                {
+                    uniform_cells.emplace_back(std::move(cell), status);
+
+                    continue;
+                }
+
+                // a cell that spans at most one step in each dimension consists of its corners only and is not
+                // subdivided any further
+                std::ranges::move(subdivide_cell(cell), std::back_inserter(subcells));
+            }
+
+            cells = std::move(subcells);
+        }
+    }
+    /**
+     * Returns the cells that are spanned by all combinations of the given intervals, one per dimension.
+     *
+     * @param intervals The intervals of step values in each dimension. Both bounds are included.
+     * @return The cells spanned by the Cartesian product of `intervals`.
+     */
+    [[nodiscard]] std::vector<refinement_cell>
+    cells_of_intervals(const std::vector<std::vector<std::pair<std::size_t, std::size_t>>>& intervals) const noexcept
+    {
+        const auto combinations = cartesian_combinations(intervals);
+
+        std::vector<refinement_cell> cells{};
+        cells.reserve(combinations.size());
+
+        for (const auto& combination : combinations)
+        {
+            refinement_cell cell{};
+            cell.lower.reserve(num_dimensions);
+            cell.upper.reserve(num_dimensions);
+
+            for (const auto& [lower, upper] : combination)
+            {
+                cell.lower.push_back(lower);
+                cell.upper.push_back(upper);
+            }
+
+            cells.push_back(std::move(cell));
+        }
+
+        return cells;
+    }
+    /**
+     * Returns the corners of the given cell. A cell that spans no step in `k` of its `n` dimensions has `2^(n - k)`
+     * distinct corners.
+     *
+     * @param cell Cell to get the corners of.
+     * @return The corners of `cell`.
+     */
+    [[nodiscard]] std::vector<step_point> cell_corners(const refinement_cell& cell) const noexcept
+    {
+        std::vector<std::vector<std::size_t>> bounds(num_dimensions);
+
+        for (auto d = 0u; d < num_dimensions; ++d)
+        {
+            bounds.at(d).push_back(cell.lower.at(d));
+
+            if (cell.upper.at(d) != cell.lower.at(d))
+            {
+                bounds.at(d).push_back(cell.upper.at(d));
+            }
+        }
+
+        std::vector<step_point> corners{};
+
+        std::ranges::transform(cartesian_combinations(bounds), std::back_inserter(corners),
+                               [](const auto& steps) noexcept { return step_point{steps}; });
+
+        return corners;
+    }
+    /**
+     * Returns all step points of the given cell, including those on its boundary.
+     *
+     * @param cell Cell to get the step points of.
+     * @return The step points of `cell`.
+     */
+    [[nodiscard]] std::vector<step_point> cell_points(const refinement_cell& cell) const noexcept
+    {
+        std::vector<std::vector<std::size_t>> steps(num_dimensions);
+
+        for (auto d = 0u; d < num_dimensions; ++d)
+        {
+            steps.at(d).resize(cell.upper.at(d) - cell.lower.at(d) + 1);
+            std::iota(steps.at(d).begin(), steps.at(d).end(), cell.lower.at(d));
+        }
+
+        std::vector<step_point> points{};
+
+        std::ranges::transform(cartesian_combinations(steps), std::back_inserter(points),
+                               [](const auto& step_values) noexcept { return step_point{step_values}; });
+
+        return points;
+    }
+    /**
+     * Halves the given cell in each dimension in which it spans more than one step. Neighboring subcells share the
+     * step points of their common face.
+     *
+     * @param cell Cell to subdivide.
+     * @return The subcells of `cell`, or an empty vector if `cell` spans at most one step in each dimension.
+     */
+    [[nodiscard]] std::vector<refinement_cell> subdivide_cell(const refinement_cell& cell) const noexcept
+    {
+        std::vector<std::vector<std::pair<std::size_t, std::size_t>>> halves(num_dimensions);
+
+        bool divisible = false;
+
+        for (auto d = 0u; d < num_dimensions; ++d)
+        {
+            const auto lower = cell.lower.at(d);
+            const auto upper = cell.upper.at(d);
+
+            if (upper - lower > 1)
+            {
+                const auto mid = lower + ((upper - lower) / 2);
+
+                halves.at(d).emplace_back(lower, mid);
+                halves.at(d).emplace_back(mid, upper);
+
+                divisible = true;
+            }
+            else
+            {
+                halves.at(d).emplace_back(lower, upper);
+            }
+        }
+
+        if (!divisible)
+        {
+            return {};
+        }
+
+        return cells_of_intervals(halves);
+    }
     /**
      * Returns the 2D Moore neighborhood of the step point at `sp = (x, y)`. The 2D Moore neighborhood is the set of all
      * points that are adjacent to `(x, y)` in the plane including the diagonals. Thereby, the 2D Moore neighborhood
@@ -1937,8 +2748,7 @@ class operational_domain_impl
                 }
 
                 // if the point has already been sampled
-                if (const auto operational_status = op_domain.contains(to_parameter_point(m));
-                    operational_status.has_value())
+                if (const auto operational_status = evaluated_value(m); operational_status.has_value())
                 {
                     // and found to be non-operational, continue with the next
                     if (std::get<0>(operational_status.value()) == operational_status::NON_OPERATIONAL)
@@ -1960,11 +2770,14 @@ class operational_domain_impl
      */
     void log_stats() const noexcept
     {
-        stats.num_simulator_invocations            = num_simulator_invocations.load();
-        stats.num_evaluated_parameter_combinations = num_evaluated_parameter_combinations.load();
-
-        op_domain.for_each(
-            [this](const auto& param_point [[maybe_unused]], const auto& status)
+        stats.num_simulator_invocations               = num_simulator_invocations.load();
+        stats.num_evaluated_parameter_combinations    = num_evaluated_parameter_combinations.load();
+        stats.num_resumed_parameter_combinations      = num_resumed_parameter_combinations;
+        stats.num_inferred_parameter_combinations     = num_inferred_parameter_combinations;
+        stats.num_warm_started_parameter_combinations = num_warm_started_parameter_combinations.load();
+
+        evaluated.for_each(
+            [this](const auto key [[maybe_unused]], const auto& status)
             {
                 if (std::get<0>(status) == operational_status::OPERATIONAL)
                 {
@@ -2007,7 +2820,8 @@ class operational_domain_impl
  * @return The operational domain of the layout.
  * @throws std::invalid_argument if the given sweep parameters are invalid, or if the operational domain sketch
  * is requested without rejecting kinks or on a layout without `LOGIC` cells. Any number of sweep
- * dimensions is accepted.
+ * dimensions is accepted. Also thrown if the header of the journal file does not match the sweep.
+ * @throws std::ofstream::failure if the journal file could not be opened or its cut-off row could not be removed.
  */
 template <typename Lyt, typename TT>
     requires is_cell_level_layout_v<Lyt> && has_sidb_technology_v<Lyt> && kitty::is_truth_table<TT>::value
@@ -2021,6 +2835,8 @@ template <typename Lyt, typename TT>
     operational_domain_stats                                     st{};
     detail::operational_domain_impl<Lyt, TT, operational_domain> p{lyt, spec, params, st};
 
+    p.open_journal();
+
     const auto result = p.grid_search();
 
     if (stats)
@@ -2052,7 +2868,8 @@ template <typename Lyt, typename TT>
  * @return The operational domain of the layout.
  * @throws std::invalid_argument if the given sweep parameters are invalid, or if the operational domain sketch
  * is requested without rejecting kinks or on a layout without `LOGIC` cells. Any number of sweep
- * dimensions is accepted.
+ * dimensions is accepted. Also thrown if the header of the journal file does not match the sweep.
+ * @throws std::ofstream::failure if the journal file could not be opened or its cut-off row could not be removed.
  */
 template <typename Lyt, typename TT>
     requires is_cell_level_layout_v<Lyt> && has_sidb_technology_v<Lyt> && kitty::is_truth_table<TT>::value
@@ -2067,6 +2884,8 @@ template <typename Lyt, typename TT>
     operational_domain_stats                                     st{};
     detail::operational_domain_impl<Lyt, TT, operational_domain> p{lyt, spec, params, st};
 
+    p.open_journal();
+
     const auto result = p.random_sampling(samples);
 
     if (stats)
@@ -2109,7 +2928,8 @@ template <typename Lyt, typename TT>
  * @throws std::invalid_argument if the given sweep parameters are invalid, or if the operational domain sketch
  * is requested without rejecting kinks or on a layout without `LOGIC` cells. Flood fill and contour
  * tracing additionally require at least two sweep dimensions; grid search and random sampling accept
- * any number.
+ * any number. Also thrown if the header of the journal file does not match the sweep.
+ * @throws std::ofstream::failure if the journal file could not be opened or its cut-off row could not be removed.
  */
 template <typename Lyt, typename TT>
     requires is_cell_level_layout_v<Lyt> && has_sidb_technology_v<Lyt> && kitty::is_truth_table<TT>::value
@@ -2123,6 +2943,8 @@ operational_domain_flood_fill(const Lyt& lyt, const std::vector<TT>& spec, const
     operational_domain_stats                                     st{};
     detail::operational_domain_impl<Lyt, TT, operational_domain> p{lyt, spec, params, st};
 
+    p.open_journal();
+
     const auto result = p.flood_fill(samples);
 
     if (stats)
@@ -2164,7 +2986,8 @@ operational_domain_flood_fill(const Lyt& lyt, const std::vector<TT>& spec, const
  * @throws std::invalid_argument if the given sweep parameters are invalid, or if the operational domain sketch
  * is requested without rejecting kinks or on a layout without `LOGIC` cells. Flood fill and contour
  * tracing additionally require at least two sweep dimensions; grid search and random sampling accept
- * any number.
+ * any number. Also thrown if the header of the journal file does not match the sweep.
+ * @throws std::ofstream::failure if the journal file could not be opened or its cut-off row could not be removed.
  */
 template <typename Lyt, typename TT>
     requires is_cell_level_layout_v<Lyt> && has_sidb_technology_v<Lyt> && kitty::is_truth_table<TT>::value
@@ -2178,7 +3001,75 @@ template <typename Lyt, typename TT>
 
     operational_domain_stats                                     st{};
     detail::operational_domain_impl<Lyt, TT, operational_domain> p{lyt, spec, params, st};
-    const auto                                                   result = p.contour_tracing(samples);
+
+    p.open_journal();
+
+    const auto result = p.contour_tracing(samples);
+
+    if (stats)
+    {
+        *stats = st;
+    }
+
+    return result;
+}
+/**
+ * Computes the operational domain of the given SiDB cell-level layout. The operational domain is the set of all
+ * parameter combinations for which the layout is logically operational. Logical operation is defined as the layout
+ * implementing the given truth table. The input BDL pairs of the layout are assumed to be in the same order as the
+ * inputs of the truth table.
+ *
+ * This algorithm uses adaptive refinement to approximate the result of a grid search. It first evaluates a coarse grid
+ * that samples every `initial_spacing`-th step in each sweep dimension. The coarse grid partitions the parameter space
+ * into cells (quadtree cells in two dimensions, octree cells in three), and each cell whose corners disagree in their
+ * operational status is recursively subdivided down to the step size of the sweep, as is each cell that shares a face
+ * with a subdivided cell whose evaluated points on that face disagree with its corners. All grid points inside the
+ * remaining cells are assigned the status of their corners without being simulated. Therefore, the returned operational
+ * domain holds a status for every grid point, just like the one of a grid search, but for smooth operational domains,
+ * the number of operational checks scales with the size of the boundary of the operational domain rather than with the
+ * size of the parameter space. Unlike contour tracing, the algorithm finds disconnected operational "islands" without
+ * a random sampling phase, as long as each island contains or touches a coarse grid point. Islands or holes that fit
+ * entirely within a coarse cell may be missed, which `initial_spacing` trades off against the number of simulations.
+ *
+ * @note The result is an approximation of the grid search. Each simulated point has its simulated status, but an
+ * inferred point may not. For example, sweeping \f$\epsilon_r\f$ and \f$\lambda_{TF}\f$ of the SiQAD AND gate from 1 to
+ * 10 in steps of 0.1 with an initial spacing of 8 misclassifies 5 of the 8281 grid points, which form an operational
+ * island that lies between the points of the coarse grid.
+ *
+ * Each operational check consists of up to \f$2^n\f$ exact ground state simulations, where \f$n\f$ is the number of
+ * inputs of the layout. Each exact ground state simulation has exponential complexity in of itself. Therefore, the
+ * algorithm is only feasible for small layouts with few inputs.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @tparam TT Truth table type.
+ * @param lyt Layout to compute the operational domain for.
+ * @param spec Expected Boolean function of the layout given as a multi-output truth table.
+ * @param initial_spacing Number of steps between two neighboring points of the initial coarse grid in each sweep
+ * dimension. A spacing of `1` evaluates every grid point like a grid search.
+ * @param params Operational domain computation parameters.
+ * @param stats Operational domain computation statistics.
+ * @return The operational domain of the layout.
+ * @throws std::invalid_argument if the given sweep parameters are invalid, or if the operational domain sketch
+ * is requested without rejecting kinks or on a layout without `LOGIC` cells. Any number of sweep
+ * dimensions is accepted. Also thrown if the header of the journal file does not match the sweep.
+ * @throws std::ofstream::failure if the journal file could not be opened or its cut-off row could not be removed.
+ */
+template <typename Lyt, typename TT>
+    requires is_cell_level_layout_v<Lyt> && has_sidb_technology_v<Lyt> && kitty::is_truth_table<TT>::value
+[[nodiscard]] operational_domain
+operational_domain_adaptive_refinement(const Lyt& lyt, const std::vector<TT>& spec, const std::size_t initial_spacing,
+                                       const operational_domain_params& params = {},
+                                       operational_domain_stats*        stats  = nullptr)
+{
+    // this may throw an `std::invalid_argument` exception
+    detail::validate_operational_domain_params(lyt, params);
+
+    operational_domain_stats                                     st{};
+    detail::operational_domain_impl<Lyt, TT, operational_domain> p{lyt, spec, params, st};
+
+    p.open_journal();
+
+    const auto result = p.adaptive_refinement(initial_spacing);
 
     if (stats)
     {
@@ -2210,7 +3101,8 @@ template <typename Lyt, typename TT>
  * @return The critical temperature domain of the layout.
  * @throws std::invalid_argument if the given sweep parameters are invalid, or if the operational domain sketch
  * is requested without rejecting kinks or on a layout without `LOGIC` cells. Any number of sweep
- * dimensions is accepted.
+ * dimensions is accepted. Also thrown if the header of the journal file does not match the sweep.
+ * @throws std::ofstream::failure if the journal file could not be opened or its cut-off row could not be removed.
  */
 template <typename Lyt, typename TT>
     requires is_cell_level_layout_v<Lyt> && has_sidb_technology_v<Lyt> && kitty::is_truth_table<TT>::value
@@ -2225,6 +3117,8 @@ critical_temperature_domain_grid_search(const Lyt& lyt, const std::vector<TT>& s
     operational_domain_stats                                              st{};
     detail::operational_domain_impl<Lyt, TT, critical_temperature_domain> p{lyt, spec, params, st};
 
+    p.open_journal();
+
     const auto result = p.grid_search();
 
     if (stats)
@@ -2255,7 +3149,8 @@ critical_temperature_domain_grid_search(const Lyt& lyt, const std::vector<TT>& s
  * @return The critical temperature domain of the layout.
  * @throws std::invalid_argument if the given sweep parameters are invalid, or if the operational domain sketch
  * is requested without rejecting kinks or on a layout without `LOGIC` cells. Any number of sweep
- * dimensions is accepted.
+ * dimensions is accepted. Also thrown if the header of the journal file does not match the sweep.
+ * @throws std::ofstream::failure if the journal file could not be opened or its cut-off row could not be removed.
  */
 template <typename Lyt, typename TT>
     requires is_cell_level_layout_v<Lyt> && has_sidb_technology_v<Lyt> && kitty::is_truth_table<TT>::value
@@ -2270,6 +3165,8 @@ critical_temperature_domain_random_sampling(const Lyt& lyt, const std::vector<TT
     operational_domain_stats                                              st{};
     detail::operational_domain_impl<Lyt, TT, critical_temperature_domain> p{lyt, spec, params, st};
 
+    p.open_journal();
+
     const auto result = p.random_sampling(samples);
 
     if (stats)
@@ -2307,7 +3204,8 @@ critical_temperature_domain_random_sampling(const Lyt& lyt, const std::vector<TT
  * @throws std::invalid_argument if the given sweep parameters are invalid, or if the operational domain sketch
  * is requested without rejecting kinks or on a layout without `LOGIC` cells. Flood fill and contour
  * tracing additionally require at least two sweep dimensions; grid search and random sampling accept
- * any number.
+ * any number. Also thrown if the header of the journal file does not match the sweep.
+ * @throws std::ofstream::failure if the journal file could not be opened or its cut-off row could not be removed.
  */
 template <typename Lyt, typename TT>
     requires is_cell_level_layout_v<Lyt> && has_sidb_technology_v<Lyt> && kitty::is_truth_table<TT>::value
@@ -2322,6 +3220,8 @@ critical_temperature_domain_flood_fill(const Lyt& lyt, const std::vector<TT>& sp
     operational_domain_stats                                              st{};
     detail::operational_domain_impl<Lyt, TT, critical_temperature_domain> p{lyt, spec, params, st};
 
+    p.open_journal();
+
     const auto result = p.flood_fill(samples);
 
     if (stats)
@@ -2362,7 +3262,8 @@ critical_temperature_domain_flood_fill(const Lyt& lyt, const std::vector<TT>& sp
  * @throws std::invalid_argument if the given sweep parameters are invalid, or if the operational domain sketch
  * is requested without rejecting kinks or on a layout without `LOGIC` cells. Flood fill and contour
  * tracing additionally require at least two sweep dimensions; grid search and random sampling accept
- * any number.
+ * any number. Also thrown if the header of the journal file does not match the sweep.
+ * @throws std::ofstream::failure if the journal file could not be opened or its cut-off row could not be removed.
  */
 template <typename Lyt, typename TT>
     requires is_cell_level_layout_v<Lyt> && has_sidb_technology_v<Lyt> && kitty::is_truth_table<TT>::value
@@ -2376,7 +3277,10 @@ critical_temperature_domain_contour_tracing(const Lyt& lyt, const std::vector<TT
 
     operational_domain_stats                                              st{};
     detail::operational_domain_impl<Lyt, TT, critical_temperature_domain> p{lyt, spec, params, st};
-    const auto                                                            result = p.contour_tracing(samples);
+
+    p.open_journal();
+
+    const auto result = p.contour_tracing(samples);
 
     if (stats)
     {
@@ -12,13 +12,18 @@
 #include "fiction/technology/charge_distribution_surface.hpp"
 #include "fiction/technology/sidb_charge_state.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/simd_utils.hpp"
+#include "fiction/utils/work_stealing_thread_pool.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
-#include <iterator>
 #include <limits>
+#include <numeric>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -83,6 +88,55 @@ struct population_stability_information
     double system_energy{};
 };
 
+/**
+ * Compact counterpart of `population_stability_information`, which does not depend on the layout type. Instead of maps
+ * keyed by the transition type, it stores the minimum electrostatic potential and the critical SiDB of each transition
+ * type in arrays indexed by the underlying value of `transition_type`. The critical SiDBs are given as indices into the
+ * SiDB order of the charge distribution surface, i.e., into the ascending order of the SiDB cells. The distances
+ * corresponding to the potentials are not computed; they can be obtained via `potential_to_distance_conversion` if
+ * needed.
+ */
+struct compact_population_stability_information
+{
+    /**
+     * Minimum electrostatic potential (unit: V) required to conduct each transition type. It is infinite if no SiDB
+     * can undergo the transition.
+     */
+    std::array<double, 4> transition_potentials{
+        std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity(),
+        std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity()};
+    /**
+     * Index of the SiDB that is closest to each transition type. It is the maximum value of `uint64_t` if no SiDB can
+     * undergo the transition.
+     */
+    std::array<uint64_t, 4> critical_sidb_indices{
+        std::numeric_limits<uint64_t>::max(), std::numeric_limits<uint64_t>::max(),
+        std::numeric_limits<uint64_t>::max(), std::numeric_limits<uint64_t>::max()};
+    /**
+     * Total electrostatic energy (unit: eV) of the charge distribution.
+     */
+    double system_energy{};
+    /**
+     * Returns the minimum electrostatic potential required to conduct the given transition type.
+     *
+     * @param type Transition type.
+     * @return The minimum electrostatic potential (unit: V) required for the transition.
+     */
+    [[nodiscard]] double transition_potential(const transition_type type) const noexcept
+    {
+        return transition_potentials[static_cast<std::size_t>(type)];
+    }
+    /**
+     * Returns the minimum electrostatic potential required to conduct any charge transition.
+     *
+     * @return The minimum electrostatic potential (unit: V) over all transition types.
+     */
+    [[nodiscard]] double minimum_transition_potential() const noexcept
+    {
+        return std::ranges::min(transition_potentials);
+    }
+};
+
 /**
  * This struct stores the parameters required to simulate the population stability.
  */
@@ -99,6 +153,112 @@ struct physical_population_stability_params
     uint64_t precision_for_distance_corresponding_to_potential = 2;
 };
 
+/**
+ * This struct stores the parameters required to simulate the population stability of many layouts.
+ */
+struct physical_population_stability_batch_params
+{
+    /**
+     * Parameters of each population stability simulation. The precision of the distance conversion is ignored, since
+     * no distances are computed.
+     */
+    physical_population_stability_params stability_params{};
+    /**
+     * Number of threads to distribute the layouts over. Values below `1` are treated as `1`.
+     */
+    std::size_t number_of_threads{std::thread::hardware_concurrency()};
+};
+
+/**
+ * This function determines the population stability of a single charge distribution, i.e., the minimum electrostatic
+ * potential required to change the charge state of any of its SiDBs per transition type, and the SiDBs for which this
+ * is the case. The local potentials of the SiDBs that can undergo each transition are gathered in one contiguous array
+ * per transition type, and the minimum distance to the respective charge transition level is determined by a
+ * vectorized kernel.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @param cds Charge distribution whose local potentials are up to date.
+ * @param params Simulation parameters that define the charge transition levels.
+ * @return The compact population stability information of the charge distribution.
+ */
+template <typename Lyt>
+[[nodiscard]] compact_population_stability_information
+population_stability_of_charge_distribution(const charge_distribution_surface<Lyt>& cds,
+                                            const sidb_simulation_parameters&       params) noexcept
+{
+    const auto num_sidbs = cds.num_cells();
+
+    // structure of arrays: the local potentials of all SiDBs that can undergo a transition type and their indices
+    std::array<std::vector<double>, 4>   potentials{};
+    std::array<std::vector<uint64_t>, 4> indices{};
+
+    const auto add = [&potentials, &indices](const transition_type type, const double local_potential,
+                                             const uint64_t index)
+    {
+        potentials[static_cast<std::size_t>(type)].push_back(local_potential);
+        indices[static_cast<std::size_t>(type)].push_back(index);
+    };
+
+    for (uint64_t i = 0; i < num_sidbs; ++i)
+    {
+        const auto local_potential = *cds.get_local_potential_by_index(i);
+
+        switch (cds.get_charge_state_by_index(i))
+        {
+            case sidb_charge_state::NEGATIVE:
+            {
+                add(transition_type::NEGATIVE_TO_NEUTRAL, local_potential, i);
+                break;
+            }
+            case sidb_charge_state::NEUTRAL:
+            {
+                // a neutral SiDB is only considered to become negative if it is closer to µ- than to µ+
+                if (std::abs(-local_potential + params.mu_minus) < std::abs(-local_potential + params.mu_plus()))
+                {
+                    add(transition_type::NEUTRAL_TO_NEGATIVE, local_potential, i);
+                }
+                add(transition_type::NEUTRAL_TO_POSITIVE, local_potential, i);
+                break;
+            }
+            case sidb_charge_state::POSITIVE:
+            {
+                add(transition_type::POSITIVE_TO_NEUTRAL, local_potential, i);
+                break;
+            }
+            case sidb_charge_state::NONE:
+            {
+                break;
+            }
+        }
+    }
+
+    compact_population_stability_information info{};
+
+    for (const auto type : {transition_type::NEUTRAL_TO_NEGATIVE, transition_type::NEGATIVE_TO_NEUTRAL,
+                            transition_type::NEUTRAL_TO_POSITIVE, transition_type::POSITIVE_TO_NEUTRAL})
+    {
+        const auto t = static_cast<std::size_t>(type);
+
+        // transitions between neutral and negative are governed by µ-, those between neutral and positive by µ+
+        const auto transition_level =
+            type == transition_type::NEUTRAL_TO_NEGATIVE || type == transition_type::NEGATIVE_TO_NEUTRAL ?
+                params.mu_minus :
+                params.mu_plus();
+
+        if (const auto [potential, position] =
+                minimum_absolute_difference(potentials[t].data(), potentials[t].size(), transition_level);
+            position < potentials[t].size())
+        {
+            info.transition_potentials[t] = potential;
+            info.critical_sidb_indices[t] = indices[t][position];
+        }
+    }
+
+    info.system_energy = cds.get_electrostatic_potential_energy();
+
+    return info;
+}
+
 namespace detail
 {
 /**
@@ -136,85 +296,56 @@ class physical_population_stability_impl
     {
         const quickexact_params<cell<Lyt>> quickexact_parameters{params.simulation_parameters};
         const auto                         simulation_results = quickexact(layout, quickexact_parameters);
-        const auto energy_and_unique_charge_index             = collect_energy_and_charge_index(simulation_results);
+
+        const auto& charge_distributions = simulation_results.charge_distributions;
+
+        // order the charge distributions by ascending energy without copying them
+        std::vector<std::size_t> order(charge_distributions.size());
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::ranges::stable_sort(order,
+                                 [&charge_distributions](const auto lhs, const auto rhs)
+                                 {
+                                     return charge_distributions[lhs].get_electrostatic_potential_energy() <
+                                            charge_distributions[rhs].get_electrostatic_potential_energy();
+                                 });
 
         std::vector<population_stability_information<Lyt>> popstability_information{};
-        popstability_information.reserve(simulation_results.charge_distributions.size());
+        popstability_information.reserve(charge_distributions.size());
 
-        // Access the unique indices
-        for (const auto& energy_and_index : energy_and_unique_charge_index)
+        for (const auto i : order)
         {
-            const auto it = std::ranges::find_if(simulation_results.charge_distributions,
-                                                 [&](const charge_distribution_surface<Lyt>& charge_lyt)
-                                                 {
-                                                     // Compare with the first element of the pair returned by
-                                                     // get_charge_index_and_base()
-                                                     return charge_lyt.get_charge_index_and_base().first ==
-                                                            energy_and_index.charge_index;
-                                                 });
-
-            if (it == simulation_results.charge_distributions.end())
-            {
-                continue;
-            }
+            const auto& charge_lyt = charge_distributions[i];
+            const auto& sidb_order = charge_lyt.get_sidb_order();
 
-            const auto& charge_lyt = *it;
+            const auto compact_info =
+                population_stability_of_charge_distribution(charge_lyt, params.simulation_parameters);
 
             population_stability_information<Lyt> population_stability_info{};
-
-            population_stability_info.transition_potentials.insert(
-                {transition_type::NEUTRAL_TO_NEGATIVE, {cell<Lyt>{}, std::numeric_limits<double>::infinity()}});
-            population_stability_info.transition_potentials.insert(
-                {transition_type::NEGATIVE_TO_NEUTRAL, {cell<Lyt>{}, std::numeric_limits<double>::infinity()}});
-            population_stability_info.transition_potentials.insert(
-                {transition_type::NEUTRAL_TO_POSITIVE, {cell<Lyt>{}, std::numeric_limits<double>::infinity()}});
-            population_stability_info.transition_potentials.insert(
-                {transition_type::POSITIVE_TO_NEUTRAL, {cell<Lyt>{}, std::numeric_limits<double>::infinity()}});
-
-            charge_lyt.foreach_cell(
-                [this, &charge_lyt, &population_stability_info](const auto& c)
-                {
-                    switch (charge_lyt.get_charge_state(c))
-                    {
-                        case sidb_charge_state::NEGATIVE:
-                        {
-                            population_stability_info = handle_negative_charges(*charge_lyt.get_local_potential(c), c,
-                                                                                population_stability_info);
-                            break;
-                        }
-                        case sidb_charge_state::NEUTRAL:
-                        {
-                            population_stability_info = handle_neutral_charges(*charge_lyt.get_local_potential(c), c,
-                                                                               population_stability_info);
-                            break;
-                        }
-                        case sidb_charge_state::POSITIVE:
-                        {
-                            population_stability_info = handle_positive_charges(*charge_lyt.get_local_potential(c), c,
-                                                                                population_stability_info);
-                            break;
-                        }
-                        case sidb_charge_state::NONE:
-                        {
-                            break;
-                        }
-                    }
-                });
-            population_stability_info.system_energy = charge_lyt.get_electrostatic_potential_energy();
+            population_stability_info.system_energy = compact_info.system_energy;
 
             auto minimum_potential_difference = std::numeric_limits<double>::infinity();
 
-            for (const auto& transition : population_stability_info.transition_potentials)
+            for (const auto type : {transition_type::NEUTRAL_TO_NEGATIVE, transition_type::NEGATIVE_TO_NEUTRAL,
+                                    transition_type::NEUTRAL_TO_POSITIVE, transition_type::POSITIVE_TO_NEUTRAL})
             {
-                population_stability_info.distance_corresponding_to_potential[transition.first] =
-                    potential_to_distance_conversion(transition.second.second, params.simulation_parameters,
+                const auto t         = static_cast<std::size_t>(type);
+                const auto potential = compact_info.transition_potentials[t];
+                const auto critical  = compact_info.critical_sidb_indices[t] < sidb_order.size() ?
+                                           sidb_order[compact_info.critical_sidb_indices[t]] :
+                                           cell<Lyt>{};
+
+                population_stability_info.transition_potentials[type] = {critical, potential};
+                population_stability_info.distance_corresponding_to_potential[type] =
+                    potential_to_distance_conversion(potential, params.simulation_parameters,
                                                      params.precision_for_distance_corresponding_to_potential);
-                if (transition.second.second < minimum_potential_difference)
+
+                if (potential < minimum_potential_difference)
                 {
-                    population_stability_info.critical_cell = transition.second.first;
-                    minimum_potential_difference            = transition.second.second;
+                    population_stability_info.critical_cell = critical;
+                    minimum_potential_difference            = potential;
                 }
             }
+
             popstability_information.push_back(population_stability_info);
         }
 
@@ -222,20 +353,6 @@ class physical_population_stability_impl
     };
 
   private:
-    /**
-     * This struct represents the electrostatic energy and charge index of a charge distribution.
-     */
-    struct energy_and_charge_index
-    {
-        /**
-         * Electrostatic energy of the charge distribution (unit: eV).
-         */
-        double energy;
-        /**
-         * Charge index of the charge distribution.
-         */
-        uint64_t charge_index;
-    };
     /**
      * Layout to analyze.
      */
@@ -244,141 +361,6 @@ class physical_population_stability_impl
      * Parameters required to simulate the population stability.
      */
     const physical_population_stability_params& params;
-
-    /**
-     * This function checks if the absolute difference between the given local potential and
-     * µ- is smaller than the current minimum potential difference to transition for a negatively charged SiDB.
-     * If `true`, it updates the population stability information with the new minimum difference and critical cell.
-     *
-     * @param local_potential The local potential associated with the cell.
-     * @param c The cell for which the charge state is being considered (SiDB is negatively charged).
-     * @param pop_stability_information The current population stability information.
-     *
-     * @return An updated population stability information with potential transition details.
-     */
-    [[nodiscard]] population_stability_information<Lyt>
-    handle_negative_charges(const double local_potential, const typename Lyt::cell& c,
-                            const population_stability_information<Lyt>& pop_stability_information) noexcept
-    {
-        auto updated_pop_stability_information = pop_stability_information;
-
-        const auto required_potential_to_conduct_transition_negative_to_neutral =
-            std::abs(-local_potential + params.simulation_parameters.mu_minus);
-
-        if (required_potential_to_conduct_transition_negative_to_neutral <
-            updated_pop_stability_information.transition_potentials.at(transition_type::NEGATIVE_TO_NEUTRAL).second)
-        {
-            updated_pop_stability_information.transition_potentials[transition_type::NEGATIVE_TO_NEUTRAL] = {
-                c, required_potential_to_conduct_transition_negative_to_neutral};
-        }
-
-        return updated_pop_stability_information;
-    }
-
-    /**
-     * This function checks if the absolute difference between the given local potential and
-     * µ- or µ+ is smaller than the current minimum potential difference.
-     * If `true`, it updates the population stability information with the new minimum difference and critical cell.
-     *
-     * @param local_potential The local potential associated with the cell.
-     * @param c The cell for which the charge state is being considered (SiDB is neutrally charged).
-     * @param pop_stability_information The current population stability information.
-     *
-     * @return An updated population stability information with potential transition details.
-     */
-    [[nodiscard]] population_stability_information<Lyt>
-    handle_neutral_charges(const double local_potential, const typename Lyt::cell& c,
-                           const population_stability_information<Lyt>& pop_stability_information) noexcept
-    {
-        auto updated_pop_stability_information = pop_stability_information;
-
-        const auto required_potential_to_conduct_transition_neutral_to_negative =
-            std::abs(-local_potential + params.simulation_parameters.mu_minus);
-
-        if (required_potential_to_conduct_transition_neutral_to_negative <
-            std::abs(-local_potential + params.simulation_parameters.mu_plus()))
-        {
-            if (std::abs(-local_potential + params.simulation_parameters.mu_minus) <
-                updated_pop_stability_information.transition_potentials.at(transition_type::NEUTRAL_TO_NEGATIVE).second)
-            {
-                updated_pop_stability_information.transition_potentials.at(transition_type::NEUTRAL_TO_NEGATIVE) = {
-                    c, required_potential_to_conduct_transition_neutral_to_negative};
-            }
-        }
-        if (std::abs(-local_potential + params.simulation_parameters.mu_plus()) <
-            updated_pop_stability_information.transition_potentials.at(transition_type::NEUTRAL_TO_POSITIVE).second)
-        {
-            const auto required_potential_to_conduct_transition_neutral_to_positive =
-                std::abs(-local_potential + params.simulation_parameters.mu_plus());
-            if (required_potential_to_conduct_transition_neutral_to_positive <
-                updated_pop_stability_information.transition_potentials.at(transition_type::NEUTRAL_TO_POSITIVE).second)
-            {
-                updated_pop_stability_information.transition_potentials[transition_type::NEUTRAL_TO_POSITIVE] = {
-                    c, required_potential_to_conduct_transition_neutral_to_positive};
-            }
-        }
-
-        return updated_pop_stability_information;
-    }
-
-    /**
-     * This function checks if the absolute difference between the given local potential and µ+ is smaller than the
-     * current minimum potential difference. If true`, it updates the
-     * population stability information with the new minimum difference and critical cell.
-     *
-     * @param local_potential The local potential associated with the cell.
-     * @param c The cell for which the charge state is being considered (SiDB is positively charged).
-     * @param pop_stability_information The current population stability information.
-     *
-     * @return An updated population stability information with potential transition details.
-     */
-    [[nodiscard]] population_stability_information<Lyt>
-    handle_positive_charges(const double local_potential, const typename Lyt::cell& c,
-                            const population_stability_information<Lyt>& pop_stability_information) noexcept
-    {
-        auto updated_pop_stability_information = pop_stability_information;
-
-        const auto required_potential_to_conduct_transition_from_positive_to_neutral =
-            std::abs(-local_potential + params.simulation_parameters.mu_plus());
-
-        if (required_potential_to_conduct_transition_from_positive_to_neutral <
-            updated_pop_stability_information.transition_potentials.at(transition_type::POSITIVE_TO_NEUTRAL).second)
-        {
-            updated_pop_stability_information.transition_potentials[transition_type::POSITIVE_TO_NEUTRAL] = {
-                c, required_potential_to_conduct_transition_from_positive_to_neutral};
-        }
-
-        return updated_pop_stability_information;
-    }
-
-    /**
-     * Collects the system energy with the corresponding charge index information of all physically valid
-     * charge distributions of a given SiDB layout.
-     *
-     * @param sim_results The simulation results, including all physically valid charge distributions.
-     * @return A vector of energy_and_charge_index pairs, where each pair consists of a double value representing
-     * the system energy and a uint64_t representing the unique charge index. The vector is sorted in ascending order
-     * of the energy values.
-     */
-    [[nodiscard]] std::vector<energy_and_charge_index>
-    collect_energy_and_charge_index(const sidb_simulation_result<Lyt>& sim_results) const noexcept
-    {
-        std::vector<energy_and_charge_index> energy_charge_index{};
-        energy_charge_index.reserve(sim_results.charge_distributions.size());
-
-        std::ranges::transform(sim_results.charge_distributions, std::back_inserter(energy_charge_index),
-                               [](const auto& ch_lyt)
-                               {
-                                   return energy_and_charge_index{ch_lyt.get_electrostatic_potential_energy(),
-                                                                  ch_lyt.get_charge_index_and_base().first};
-                               });
-
-        // Sort the vector in ascending order of the energy value
-        std::ranges::sort(energy_charge_index,
-                          [](const auto& lhs, const auto& rhs) { return lhs.energy < rhs.energy; });
-
-        return energy_charge_index;
-    }
 };
 
 }  // namespace detail
@@ -405,6 +387,52 @@ physical_population_stability(const Lyt& lyt, const physical_population_stabilit
     return p.run();
 }
 
+/**
+ * This function simulates the population stability of many SiDB layouts at once, e.g., of all gates of a library or of
+ * all candidates of a design run. The layouts are distributed over `params.number_of_threads` threads. Contrary to
+ * `physical_population_stability`, the results are stored in the compact format, i.e., the critical SiDBs are given as
+ * indices and the distances corresponding to the potentials are not computed.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @param layouts The layouts for which the population stability is simulated.
+ * @param params Parameters used to simulate the population stability.
+ * @return For each layout, in the order of `layouts`, the compact population stability information of all its
+ * physically valid charge distributions in ascending energy order.
+ */
+template <typename Lyt>
+[[nodiscard]] std::vector<std::vector<compact_population_stability_information>>
+physical_population_stability_batch(const std::vector<Lyt>&                         layouts,
+                                    const physical_population_stability_batch_params& params = {})
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+
+    std::vector<std::vector<compact_population_stability_information>> results(layouts.size());
+
+    const auto& sim_params = params.stability_params.simulation_parameters;
+
+    shared_work_stealing_thread_pool(std::max(params.number_of_threads, std::size_t{1}))
+        .for_each_index(layouts.size(),
+                        [&layouts, &sim_params, &results](const std::size_t i)
+                        {
+                            const auto simulation_results =
+                                quickexact(layouts[i], quickexact_params<cell<Lyt>>{sim_params});
+
+                            auto& layout_results = results[i];
+                            layout_results.reserve(simulation_results.charge_distributions.size());
+
+                            for (const auto& cds : simulation_results.charge_distributions)
+                            {
+                                layout_results.push_back(population_stability_of_charge_distribution(cds, sim_params));
+                            }
+
+                            std::ranges::stable_sort(layout_results, [](const auto& lhs, const auto& rhs)
+                                                     { return lhs.system_energy < rhs.system_energy; });
+                        });
+
+    return results;
+}
+
 }  // namespace fiction
 
 #endif  // FICTION_PHYSICAL_POPULATION_STABILITY_HPP
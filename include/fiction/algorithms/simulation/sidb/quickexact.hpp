@@ -6,20 +6,33 @@
 #define FICTION_QUICKEXACT_HPP
 
 #include "fiction/algorithms/iter/gray_code_iterator.hpp"
+#include "fiction/algorithms/simulation/sidb/charge_distribution_selection.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
 #include "fiction/layouts/coordinates.hpp"
 #include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/compact_charge_distribution.hpp"
+#include "fiction/technology/constants.hpp"
 #include "fiction/technology/sidb_charge_state.hpp"
 #include "fiction/technology/sidb_defects.hpp"
+#include "fiction/technology/sidb_geometry_cache.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/work_stealing_thread_pool.hpp"
 
 #include <mockturtle/utils/stopwatch.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -65,7 +78,114 @@ struct quickexact_params
      * Global external electrostatic potential. Value is applied on each cell in the layout.
      */
     double global_potential = 0;
+    /**
+     * Number of threads to distribute the enumeration of charge distributions over. The charge index space is split
+     * into contiguous Gray code blocks, one per thread, each of which is simulated on its own clone of the charge
+     * distribution surface. Defaults to `1` since *QuickExact* is frequently invoked by algorithms that already
+     * parallelize over many simulations (e.g., the operational domain computation). Values below `1` are treated as
+     * `1`.
+     */
+    uint64_t number_of_threads{1};
+    /**
+     * Format in which the physically valid charge distributions are stored in the simulation result. The compact format
+     * drastically reduces the memory consumption of layouts with many metastable states.
+     */
+    charge_distribution_format result_format{charge_distribution_format::FULL};
+    /**
+     * Strategies to enumerate the charge distributions of the SiDBs that are not pre-assigned to be negatively charged.
+     */
+    enum class charge_enumeration : uint8_t
+    {
+        /**
+         * All charge distributions are traversed in Gray code order, and each of them is checked for physical validity.
+         */
+        GRAY_CODE,
+        /**
+         * The charge states are assigned to one SiDB at a time in a depth-first search. Since the charge states of the
+         * unassigned SiDBs can only shift the local electrostatic potentials within known bounds, a partial charge
+         * distribution is discarded as soon as one of the SiDBs cannot be population stable anymore, no matter which
+         * charge states the remaining SiDBs take. The search is conducted on a single thread.
+         */
+        BRANCH_AND_BOUND
+    };
+    /**
+     * Strategy to enumerate the charge distributions. `BRANCH_AND_BOUND` pays off for layouts with many SiDBs that are
+     * not pre-assigned to be negatively charged, where most of the Gray code sequence is not population stable.
+     */
+    charge_enumeration enumeration{charge_enumeration::GRAY_CODE};
+    /**
+     * Selects which of the physically valid charge distributions are returned. In `LOWEST_K` and `GROUND_STATE_ONLY`
+     * mode, only the currently best charge distributions are kept during the enumeration, which bounds the memory
+     * consumption. In `BRANCH_AND_BOUND` mode, partial charge distributions whose electrostatic potential energy is
+     * bound to exceed the energies kept so far are discarded as well.
+     */
+    simulation_result_mode result_mode{simulation_result_mode::ALL_VALID};
+    /**
+     * Number of charge distributions that are returned in `simulation_result_mode::LOWEST_K` mode. Values below `1` are
+     * treated as `1`.
+     */
+    uint64_t number_of_lowest_energy_states{1};
+    /**
+     * Optional geometry cache of the layout to simulate. If provided, the distance and potential matrices are copied
+     * from the cache instead of being computed from scratch, which speeds up repeated simulations of the same layout
+     * under different physical parameters.
+     */
+    std::shared_ptr<const sidb_geometry_cache<CellType>> geometry_cache{};
+    /**
+     * Charge states that the `BRANCH_AND_BOUND` enumeration tries first for the given SiDBs, e.g., those of a ground
+     * state of the same layout under slightly different physical parameters. If the hinted charge distribution is
+     * still physically valid, it is the first one to be found, and its energy bounds the search from the start. The
+     * hint only affects the order in which the charge distributions are enumerated, not the simulation result. It is
+     * ignored by the `GRAY_CODE` enumeration.
+     */
+    std::unordered_map<CellType, sidb_charge_state> charge_state_hint = {};
+};
+/**
+ * Describes a layout by the SiDBs in which it differs from a skeleton layout.
+ *
+ * @tparam CellType Cell type.
+ */
+template <typename CellType = offset::ucoord_t>
+struct sidb_layout_delta
+{
+    /**
+     * SiDBs that are added to the skeleton as `NORMAL` cells.
+     */
+    std::vector<CellType> added_sidbs{};
+    /**
+     * SiDBs of the skeleton that are removed.
+     */
+    std::vector<CellType> removed_sidbs{};
+};
+/**
+ * This struct stores the parameters for the batch simulation of many layouts with *QuickExact*.
+ *
+ * @tparam CellType Cell type.
+ */
+template <typename CellType = offset::ucoord_t>
+struct quickexact_batch_params
+{
+    /**
+     * Parameters of each *QuickExact* simulation. A `geometry_cache` given here is ignored, since the batch
+     * simulation builds a cache of the skeleton and all added SiDBs itself.
+     */
+    quickexact_params<CellType> simulation_params{};
+    /**
+     * Number of threads to distribute the layouts over. The layouts are distributed with work stealing, such that
+     * layouts of different simulation runtimes are balanced. Defaults to `1` like
+     * `quickexact_params::number_of_threads`, since the batch simulation is frequently invoked by algorithms that
+     * already parallelize. Values below `1` are treated as `1`.
+     */
+    uint64_t number_of_threads{1};
 };
+/**
+ * Function that is invoked with each charge distribution that *QuickExact* has proven to be a ground state. Returning
+ * `false` aborts the simulation.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ */
+template <typename Lyt>
+using ground_state_callback = std::function<bool(const charge_distribution_surface<Lyt>&)>;
 
 namespace detail
 {
@@ -74,10 +194,14 @@ template <typename Lyt>
 class quickexact_impl
 {
   public:
-    quickexact_impl(const Lyt& lyt, const quickexact_params<cell<Lyt>>& parameter) :
+    quickexact_impl(const Lyt& lyt, const quickexact_params<cell<Lyt>>& parameter,
+                    ground_state_callback<Lyt> callback = {}) :
             layout{lyt.clone()},
-            charge_lyt{lyt},
-            params{parameter}
+            charge_lyt{create_charge_layout(lyt, parameter)},
+            params{parameter},
+            selected_charge_distributions{parameter.result_mode, parameter.number_of_lowest_energy_states},
+            selected_compact_charge_distributions{parameter.result_mode, parameter.number_of_lowest_energy_states},
+            on_ground_state{std::move(callback)}
     {
         charge_lyt.assign_all_charge_states(sidb_charge_state::NEGATIVE);
         charge_lyt.assign_physical_parameters(parameter.simulation_parameters);
@@ -114,15 +238,23 @@ class quickexact_impl
                 // If the layout consists of SiDBs that do not need to be negatively charged.
                 if (!all_sidbs_in_lyt_without_negative_preassigned_ones.empty())
                 {
-                    charge_distribution_surface charge_layout{layout};
-                    conduct_simulation(charge_layout, base_number);
+                    if constexpr (is_charge_distribution_surface_v<Lyt>)
+                    {
+                        charge_distribution_surface charge_layout{layout};
+                        conduct_simulation(charge_layout, base_number);
+                    }
+                    else
+                    {
+                        auto charge_layout = create_charge_layout(layout, params);
+                        conduct_simulation(charge_layout, base_number);
+                    }
                 }
 
                 // If the layout consists of only pre-assigned negatively charged SiDBs
                 // (i.e., only SiDBs that are far away from each other).
                 else if (all_sidbs_in_lyt_without_negative_preassigned_ones.empty())
                 {
-                    result.charge_distributions.emplace_back(charge_lyt);
+                    add_charge_distribution_to_result(charge_lyt);
                 }
             }
             // If there is only one SiDB in the layout, this single SiDB can be neutrally or even positively charged due
@@ -144,7 +276,7 @@ class quickexact_impl
                 {
                     if (charge_lyt.is_physically_valid())
                     {
-                        result.charge_distributions.emplace_back(charge_lyt);
+                        add_charge_distribution_to_result(charge_lyt);
                     }
 
                     charge_lyt.increase_charge_index_by_one(
@@ -155,7 +287,7 @@ class quickexact_impl
 
                 if (charge_lyt.is_physically_valid())
                 {
-                    result.charge_distributions.emplace_back(charge_lyt);
+                    add_charge_distribution_to_result(charge_lyt);
                 }
             }
 
@@ -163,6 +295,28 @@ class quickexact_impl
             {
                 layout.assign_cell_type(cell, Lyt::cell_type::NORMAL);
             }
+
+            result.charge_distributions         = selected_charge_distributions.extract();
+            result.compact_charge_distributions = selected_compact_charge_distributions.extract();
+
+            // all compact charge distributions refer to the SiDB order and the electrostatic potentials of charge_lyt
+            if (params.result_format == charge_distribution_format::COMPACT)
+            {
+                result.compact_charge_distribution_context =
+                    std::make_shared<const charge_distribution_surface<Lyt>>(charge_lyt);
+            }
+
+            // all enumerations but branch-and-bound only prove the ground states once they are complete
+            if (on_ground_state && !ground_states_reported)
+            {
+                for (const auto& gs : result.groundstates())
+                {
+                    if (!on_ground_state(gs))
+                    {
+                        break;
+                    }
+                }
+            }
         }
 
         result.simulation_runtime = time_counter;
@@ -203,6 +357,74 @@ class quickexact_impl
      * Simulation results.
      */
     sidb_simulation_result<Lyt> result{};
+    /**
+     * Physically valid charge distributions in `charge_distribution_format::FULL` that are selected for the result.
+     */
+    charge_distribution_selection<charge_distribution_surface<Lyt>> selected_charge_distributions;
+    /**
+     * Physically valid charge distributions in `charge_distribution_format::COMPACT` that are selected for the result.
+     */
+    charge_distribution_selection<compact_charge_distribution> selected_compact_charge_distributions;
+    /**
+     * Optional function that is invoked with each charge distribution that is proven to be a ground state.
+     */
+    ground_state_callback<Lyt> on_ground_state;
+    /**
+     * `true` if the ground states have already been reported to `on_ground_state` during the enumeration.
+     */
+    bool ground_states_reported{false};
+    /**
+     * Physically valid charge distributions that are found in a block of the charge index space.
+     */
+    struct block_result
+    {
+        /**
+         * Charge distributions stored in `charge_distribution_format::FULL`.
+         */
+        charge_distribution_selection<charge_distribution_surface<Lyt>> charge_distributions{};
+        /**
+         * Charge distributions stored in `charge_distribution_format::COMPACT`.
+         */
+        charge_distribution_selection<compact_charge_distribution> compact_charge_distributions{};
+        /**
+         * Copy of the full charge layout that is used to determine the energy of the found charge distributions.
+         */
+        std::optional<charge_distribution_surface<Lyt>> working_layout{};
+    };
+    /**
+     * Creates an empty block result that selects charge distributions according to the simulation parameters.
+     *
+     * @return Empty block result.
+     */
+    [[nodiscard]] block_result create_block_result() const noexcept
+    {
+        return block_result{
+            charge_distribution_selection<charge_distribution_surface<Lyt>>{params.result_mode,
+                                                                            params.number_of_lowest_energy_states},
+            charge_distribution_selection<compact_charge_distribution>{params.result_mode,
+                                                                       params.number_of_lowest_energy_states},
+            std::nullopt};
+    }
+    /**
+     * Creates the charge distribution surface of the given layout. If a geometry cache is provided, the distance and
+     * potential matrices are copied from it.
+     *
+     * @param lyt Layout to create the charge distribution surface of.
+     * @param parameter Parameters used for the simulation.
+     * @return Charge distribution surface of `lyt`.
+     */
+    [[nodiscard]] static charge_distribution_surface<Lyt>
+    create_charge_layout(const Lyt& lyt, const quickexact_params<cell<Lyt>>& parameter) noexcept
+    {
+        if constexpr (is_charge_distribution_surface_v<Lyt>)
+        {
+            return charge_distribution_surface<Lyt>{lyt};
+        }
+        else
+        {
+            return charge_distribution_surface<Lyt>{lyt, parameter.simulation_parameters, parameter.geometry_cache};
+        }
+    }
     /**
      * Base number required for the correct physical simulation.
      */
@@ -277,7 +499,13 @@ class quickexact_impl
         // to fulfill the local population stability at its position.
         charge_layout.update_after_charge_change(dependent_cell_mode::VARIABLE);
 
-        if (base_number == required_simulation_base_number::TWO)
+        if (params.enumeration == quickexact_params<cell<Lyt>>::charge_enumeration::BRANCH_AND_BOUND)
+        {
+            result.additional_simulation_parameters.emplace(
+                "base_number", base_number == required_simulation_base_number::THREE ? uint64_t{3} : uint64_t{2});
+            branch_and_bound_simulation(charge_layout, base_number);
+        }
+        else if (base_number == required_simulation_base_number::TWO)
         {
             result.additional_simulation_parameters.emplace("base_number", uint64_t{2});
             two_state_simulation(charge_layout);
@@ -304,11 +532,44 @@ class quickexact_impl
         static_assert(is_charge_distribution_surface_v<ChargeLyt>, "ChargeLyt is not a charge distribution surface");
 
         charge_layout.assign_base_number(2);
-        uint64_t previous_charge_index = 0;
 
-        gray_code_iterator gci{0};
+        simulate_charge_index_blocks(charge_layout, charge_layout.get_max_charge_index(),
+                                     [this](ChargeLyt& block_layout, const uint64_t first, const uint64_t last,
+                                            block_result& block)
+                                     { two_state_simulation_of_block(block_layout, first, last, block); });
+
+        // The cells of the pre-assigned negatively charged SiDBs are added to the cell level layout.
+        for (const auto& cell : preassigned_negative_sidbs)
+        {
+            layout.assign_cell_type(cell, Lyt::cell_type::NORMAL);
+        }
+    }
+    /**
+     * This function conducts 2-state physical simulation (negative, neutral) for the given block of the Gray code
+     * iteration range.
+     *
+     * @tparam ChargeLyt Type of the charge distribution surface.
+     * @param charge_layout Initialized charge layout. If `first` is not `0`, its charge distribution is overwritten.
+     * @param first First iteration (i.e., position in the Gray code sequence) of the block.
+     * @param last Last iteration (i.e., position in the Gray code sequence) of the block.
+     * @param block Physically valid charge distributions found in the block are stored here.
+     */
+    template <typename ChargeLyt>
+    void two_state_simulation_of_block(ChargeLyt& charge_layout, const uint64_t first, const uint64_t last,
+                                       block_result& block) const noexcept
+    {
+        gray_code_iterator gci{first};
+
+        // blocks that do not start at the beginning of the Gray code sequence have to set up their initial charge
+        // distribution (and the corresponding local electrostatic potentials) from scratch
+        if (first != 0)
+        {
+            assign_charge_distribution_of_gray_code(charge_layout, *gci);
+        }
+
+        uint64_t previous_charge_index = *gci;
 
-        for (gci = 0; gci <= charge_layout.get_max_charge_index(); ++gci)
+        for (gci = first; gci <= last; ++gci)
         {
             charge_layout.assign_charge_index_by_gray_code(*gci, previous_charge_index, dependent_cell_mode::VARIABLE,
                                                            energy_calculation::KEEP_OLD_ENERGY_VALUE,
@@ -318,26 +579,9 @@ class quickexact_impl
 
             if (charge_layout.is_physically_valid())
             {
-                charge_distribution_surface<Lyt> charge_lyt_copy{charge_lyt};
-
-                charge_layout.foreach_cell(
-                    [&charge_lyt_copy, &charge_layout](const auto& c)
-                    {
-                        charge_lyt_copy.assign_charge_state(c, charge_layout.get_charge_state(c),
-                                                            charge_index_mode::KEEP_CHARGE_INDEX);
-                    });
-
-                charge_lyt_copy.update_after_charge_change();
-                charge_lyt_copy.charge_distribution_to_index_general();
-                result.charge_distributions.push_back(charge_lyt_copy);
+                add_charge_distribution(charge_layout, block);
             }
         }
-
-        // The cells of the pre-assigned negatively charged SiDBs are added to the cell level layout.
-        for (const auto& cell : preassigned_negative_sidbs)
-        {
-            layout.assign_cell_type(cell, Lyt::cell_type::NORMAL);
-        }
     }
     /**
      * This function conducts 3-state physical simulation (negative, neutral, positive).
@@ -359,24 +603,51 @@ class quickexact_impl
         charge_layout.is_three_state_simulation_required();
         charge_layout.update_after_charge_change(dependent_cell_mode::VARIABLE);
 
-        while (charge_layout.get_charge_index_and_base().first < charge_layout.get_max_charge_index())
+        simulate_charge_index_blocks(charge_layout, charge_layout.get_max_charge_index(),
+                                     [this](ChargeLyt& block_layout, const uint64_t first, const uint64_t last,
+                                            block_result& block)
+                                     { three_state_simulation_of_block(block_layout, first, last, block); });
+
+        for (const auto& cell : preassigned_negative_sidbs)
+        {
+            layout.assign_cell_type(cell, Lyt::cell_type::NORMAL);
+        }
+    }
+    /**
+     * This function conducts 3-state physical simulation (negative, neutral, positive) for the given block of charge
+     * indices. For each charge index of the block, all charge configurations of the sublayout (i.e., SiDBs that can be
+     * positively charged) are enumerated.
+     *
+     * @tparam ChargeLyt Type of the charge distribution surface.
+     * @param charge_layout Initialized charge layout with all SiDBs negatively charged. If `first` is not `0`, its
+     * charge distribution is overwritten.
+     * @param first First charge index of the block.
+     * @param last Last charge index of the block.
+     * @param block Physically valid charge distributions found in the block are stored here.
+     */
+    template <typename ChargeLyt>
+    void three_state_simulation_of_block(ChargeLyt& charge_layout, const uint64_t first, const uint64_t last,
+                                         block_result& block) const noexcept
+    {
+        // blocks that do not start at charge index 0 have to set up their initial charge distribution (and the
+        // corresponding local electrostatic potentials) from scratch
+        if (first != 0)
+        {
+            charge_layout.assign_charge_index(first, charge_distribution_mode::KEEP_CHARGE_DISTRIBUTION);
+            charge_layout.reset_charge_index_sub_layout();
+            charge_layout.update_after_charge_change(dependent_cell_mode::VARIABLE,
+                                                     energy_calculation::KEEP_OLD_ENERGY_VALUE,
+                                                     charge_distribution_history::NEGLECT);
+        }
+
+        while (true)
         {
+            // charge configurations of the sublayout are iterated
             while (charge_layout.get_charge_index_of_sub_layout() < charge_layout.get_max_charge_index_sub_layout())
             {
                 if (charge_layout.is_physically_valid())
                 {
-                    charge_distribution_surface<Lyt> charge_lyt_copy{charge_lyt};
-
-                    charge_layout.foreach_cell(
-                        [&charge_lyt_copy, &charge_layout](const auto& c)
-                        {
-                            charge_lyt_copy.assign_charge_state(c, charge_layout.get_charge_state(c),
-                                                                charge_index_mode::KEEP_CHARGE_INDEX);
-                        });
-
-                    charge_lyt_copy.update_after_charge_change();
-                    charge_lyt_copy.charge_distribution_to_index_general();
-                    result.charge_distributions.push_back(charge_lyt_copy);
+                    add_charge_distribution(charge_layout, block);
                 }
 
                 charge_layout.increase_charge_index_of_sub_layout_by_one(
@@ -388,18 +659,12 @@ class quickexact_impl
 
             if (charge_layout.is_physically_valid())
             {
-                charge_distribution_surface<Lyt> charge_lyt_copy{charge_lyt};
-
-                charge_layout.foreach_cell(
-                    [&charge_lyt_copy, &charge_layout](const auto& c)
-                    {
-                        charge_lyt_copy.assign_charge_state(c, charge_layout.get_charge_state(c),
-                                                            charge_index_mode::KEEP_CHARGE_INDEX);
-                    });
+                add_charge_distribution(charge_layout, block);
+            }
 
-                charge_lyt_copy.update_after_charge_change();
-                charge_lyt_copy.charge_distribution_to_index_general();
-                result.charge_distributions.push_back(charge_lyt_copy);
+            if (charge_layout.get_charge_index_and_base().first >= last)
+            {
+                break;
             }
 
             if (charge_layout.get_max_charge_index_sub_layout() != 0)
@@ -413,96 +678,868 @@ class quickexact_impl
                                                              // state of the dependent cell is automatically changed
                                                              // based on the new charge distribution.
         }
+    }
+    /**
+     * State of the branch-and-bound search. The SiDBs are assigned in a fixed order, i.e., at depth `d`, the first `d`
+     * SiDBs of the order have their final charge state while all others are neutrally charged placeholders.
+     */
+    struct branch_and_bound_state
+    {
+        /**
+         * `true` if positively charged SiDBs are considered.
+         */
+        bool three_state{false};
+        /**
+         * Indices of the SiDBs in the order in which they are assigned.
+         */
+        std::vector<uint64_t> order{};
+        /**
+         * Position of each SiDB in `order`.
+         */
+        std::vector<uint64_t> position{};
+        /**
+         * Charge state that is tried first for each SiDB, as given by `quickexact_params::charge_state_hint`.
+         */
+        std::vector<std::optional<sidb_charge_state>> hinted_charge_state{};
+        /**
+         * Entry `[d][i]` is the sum of the chargeless potentials between SiDB `i` and all SiDBs at positions `>= d` of
+         * the order other than `i` itself (unit: V). It bounds by how much the unassigned SiDBs can still shift the
+         * local electrostatic potential at SiDB `i` when the search is at depth `d`.
+         */
+        std::vector<std::vector<double>> unassigned_potential{};
+        /**
+         * Difference between the energy that is required to add an electron to a neutrally charged SiDB and the local
+         * internal electrostatic potential at it, which stems from the external potentials and the defects (unit: eV).
+         */
+        std::vector<double> energy_offset{};
+        /**
+         * Charge states in which each unassigned SiDB can still be population stable at the current depth, indexed by
+         * `charge_state_to_sign(cs) + 1`.
+         */
+        std::vector<std::array<bool, 3>> possible_charge_states{};
+        /**
+         * Unassigned SiDBs that cannot be negatively charged anymore.
+         */
+        std::vector<uint64_t> non_negative_sidbs{};
+        /**
+         * Unassigned SiDBs that can still be positively charged.
+         */
+        std::vector<uint64_t> positive_sidbs{};
+        /**
+         * Difference between the electrostatic potential energy of a full charge distribution (i.e., including the
+         * pre-assigned negatively charged SiDBs) and the one of the searched charge layout (unit: eV). It is the same
+         * for all charge distributions and determined once the first physically valid one is found.
+         */
+        std::optional<double> energy_shift{};
+        /**
+         * Entry `d` is the lowest energy lower bound among the children of the node at depth `d` that have not been
+         * explored yet (unit: eV). Only maintained if ground states are reported during the search.
+         */
+        std::vector<double> unexplored_energy_bound{};
+        /**
+         * Lowest electrostatic potential energy of all full charge distributions found so far (unit: eV).
+         */
+        double lowest_energy{std::numeric_limits<double>::infinity()};
+        /**
+         * Full charge distributions within `constants::ERROR_MARGIN` of `lowest_energy` that have not been proven to be
+         * ground states yet.
+         */
+        std::vector<charge_distribution_surface<Lyt>> ground_state_candidates{};
+        /**
+         * `true` if `on_ground_state` requested to abort the search.
+         */
+        bool aborted{false};
+    };
+    /**
+     * This function conducts the physical simulation as a depth-first branch-and-bound search over the charge states of
+     * the SiDBs. Local potential bounds cut off all subtrees in which an SiDB cannot be population stable. If not all
+     * physically valid charge distributions are requested, subtrees whose energy lower bound exceeds the energies
+     * selected so far are cut off as well. If a ground state callback is given, the energy lower bounds of the
+     * unexplored subtrees are tracked to report the ground states as soon as they are proven.
+     *
+     * @tparam ChargeLyt Type of the charge distribution surface.
+     * @param charge_layout Initialized charge layout.
+     * @param base_number `THREE` if positively charged SiDBs are considered, `TWO` otherwise.
+     */
+    template <typename ChargeLyt>
+    void branch_and_bound_simulation(ChargeLyt&                            charge_layout,
+                                     const required_simulation_base_number base_number) noexcept
+    {
+        static_assert(is_charge_distribution_surface_v<ChargeLyt>, "ChargeLyt is not a charge distribution surface");
+
+        const auto num_sidbs = charge_layout.num_cells();
+
+        branch_and_bound_state state{};
+        state.three_state = base_number == required_simulation_base_number::THREE;
+
+        charge_layout.assign_base_number(state.three_state ? 3 : 2);
+        charge_layout.assign_all_charge_states(sidb_charge_state::NEUTRAL, charge_index_mode::KEEP_CHARGE_INDEX);
+        charge_layout.update_after_charge_change(dependent_cell_mode::FIXED, energy_calculation::UPDATE_ENERGY);
 
-        // charge configurations of the sublayout are iterated
-        while (charge_layout.get_charge_index_of_sub_layout() < charge_layout.get_max_charge_index_sub_layout())
+        determine_assignment_order(charge_layout, state);
+
+        state.hinted_charge_state.assign(num_sidbs, std::nullopt);
+
+        if (!params.charge_state_hint.empty())
         {
-            if (charge_layout.is_physically_valid())
+            for (uint64_t i = 0; i < num_sidbs; ++i)
             {
-                charge_distribution_surface<Lyt> charge_lyt_copy{charge_lyt};
+                if (const auto hint = params.charge_state_hint.find(charge_layout.index_to_cell(i));
+                    hint != params.charge_state_hint.cend())
+                {
+                    state.hinted_charge_state[i] = hint->second;
+                }
+            }
+        }
 
-                charge_layout.foreach_cell(
-                    [&charge_lyt_copy, &charge_layout](const auto& c)
-                    {
-                        charge_lyt_copy.assign_charge_state(c, charge_layout.get_charge_state(c),
-                                                            charge_index_mode::KEEP_CHARGE_INDEX);
-                    });
+        state.unassigned_potential.assign(num_sidbs + 1, std::vector<double>(num_sidbs, 0.0));
 
-                charge_lyt_copy.update_after_charge_change();
-                charge_lyt_copy.charge_distribution_to_index_general();
-                result.charge_distributions.push_back(charge_lyt_copy);
-            }
+        for (uint64_t d = num_sidbs; d-- > 0;)
+        {
+            const auto sidb = state.order[d];
 
-            charge_layout.increase_charge_index_of_sub_layout_by_one(dependent_cell_mode::VARIABLE,
-                                                                     energy_calculation::KEEP_OLD_ENERGY_VALUE,
-                                                                     charge_distribution_history::CONSIDER);
+            for (uint64_t i = 0; i < num_sidbs; ++i)
+            {
+                state.unassigned_potential[d][i] =
+                    state.unassigned_potential[d + 1][i] +
+                    (i == sidb ? 0.0 : charge_layout.get_chargeless_potential_by_indices(i, sidb));
+            }
         }
 
-        if (charge_layout.is_physically_valid())
+        // the energy that a single electron adds to the otherwise neutral layout reveals the contribution of the
+        // external potentials and the defects
+        const auto neutral_energy = charge_layout.get_electrostatic_potential_energy();
+
+        state.energy_offset.resize(num_sidbs);
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
         {
-            charge_distribution_surface<Lyt> charge_lyt_copy{charge_lyt};
+            charge_layout.flip_charge(i, sidb_charge_state::NEGATIVE, validity_calculation::KEEP_OLD_VALIDITY);
+            state.energy_offset[i] = neutral_energy - charge_layout.get_electrostatic_potential_energy() -
+                                     charge_layout.get_local_internal_potential_by_index(i).value();
+            charge_layout.flip_charge(i, sidb_charge_state::NEUTRAL, validity_calculation::KEEP_OLD_VALIDITY);
+        }
 
-            charge_layout.foreach_cell(
-                [&charge_lyt_copy, &charge_layout](const auto& c)
-                {
-                    charge_lyt_copy.assign_charge_state(c, charge_layout.get_charge_state(c),
-                                                        charge_index_mode::KEEP_CHARGE_INDEX);
-                });
+        state.possible_charge_states.resize(num_sidbs);
+        state.unexplored_energy_bound.assign(num_sidbs + 1, std::numeric_limits<double>::infinity());
 
-            charge_lyt_copy.update_after_charge_change();
-            charge_lyt_copy.charge_distribution_to_index_general();
-            result.charge_distributions.push_back(charge_lyt_copy);
+        auto block = create_block_result();
+
+        if (propagate_potential_bounds(charge_layout, state, 0))
+        {
+            branch_and_bound(charge_layout, state, 0, block);
         }
 
+        add_block_result(block);
+
+        // once the root is left, all remaining candidates have been reported
+        ground_states_reported = true;
+
         for (const auto& cell : preassigned_negative_sidbs)
         {
             layout.assign_cell_type(cell, Lyt::cell_type::NORMAL);
         }
     }
     /**
-     * This function is responsible for preparing the charge layout and relevant data structures for the simulation.
-     *
-     * This function initializes the charge layout within the context of the current simulation. It performs the
-     * following tasks:
+     * Determines the order in which the SiDBs are assigned. Starting with the SiDB that interacts most strongly with
+     * all others, the next SiDB is always the one that interacts most strongly with the SiDBs assigned before it. This
+     * way, the potential bounds of the assigned SiDBs tighten as early as possible.
      *
-     * - If the provided layout type `Lyt` supports a `foreach_sidb_defect` method, it iterates through each
-     *   defect in the layout.
-     *   - If a defect is found, it adds the SiDB defect to the potential landscape.
-     * - It assigns the local external potential from the `params.local_external_potential` configuration to the charge
-     * layout.
-     * - It assigns the global external potential from `params.global_potential` to the charge layout.
+     * @tparam ChargeLyt Type of the charge distribution surface.
+     * @param charge_layout Charge layout.
+     * @param state State of the branch-and-bound search whose order is determined.
      */
-    void initialize_charge_layout() noexcept
+    template <typename ChargeLyt>
+    static void determine_assignment_order(const ChargeLyt& charge_layout, branch_and_bound_state& state) noexcept
     {
-        // If Lyt is already a charge distribution surface, the layout was copied directly to the charge layout,
-        // and initialization was skipped. Therefore, the electrostatic influence of the defects is needed.
-        if constexpr (is_sidb_defect_surface_v<Lyt> && is_charge_distribution_surface_v<Lyt>)
+        const auto num_sidbs = charge_layout.num_cells();
+
+        std::vector<double> interaction(num_sidbs, 0.0);
+        std::vector<bool>   is_ordered(num_sidbs, false);
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
         {
-            layout.foreach_sidb_defect(
-                [this](const auto& cd)
-                {
-                    if (const auto& [cell, defect] = cd;
-                        defect.type != sidb_defect_type::NONE && is_charged_defect_type(cd.second))
-                    {
-                        charge_lyt.add_sidb_defect_to_potential_landscape(cell, layout.get_sidb_defect(cell));
-                    }
-                });
+            for (uint64_t j = 0; j < num_sidbs; ++j)
+            {
+                interaction[i] += charge_layout.get_chargeless_potential_by_indices(i, j);
+            }
         }
 
-        charge_lyt.assign_local_external_potential(params.local_external_potential);
-        charge_lyt.assign_global_external_potential(params.global_potential);
+        state.order.clear();
+        state.position.assign(num_sidbs, 0);
 
-        preassigned_negative_sidb_indices = charge_lyt.negative_sidb_detection();
-        preassigned_negative_sidbs.reserve(preassigned_negative_sidb_indices.size());
+        for (uint64_t d = 0; d < num_sidbs; ++d)
+        {
+            uint64_t next = num_sidbs;
 
-        all_sidbs_in_lyt_without_negative_preassigned_ones = charge_lyt.get_sidb_order();
-        // store the number of SiDBs, since the number of active cells changes during simulation.
-        number_of_sidbs = charge_lyt.num_cells();
-    }
-    /**
-     *
-     * This function is used to generate a layout without the SiDBs that are pre-assigned to be negatively charged in a
-     * physically-valid layout.
+            for (uint64_t i = 0; i < num_sidbs; ++i)
+            {
+                if (!is_ordered[i] && (next == num_sidbs || interaction[i] > interaction[next]))
+                {
+                    next = i;
+                }
+            }
+
+            // after the first SiDB, only the interaction with the already ordered SiDBs counts
+            if (d == 0)
+            {
+                std::ranges::fill(interaction, 0.0);
+            }
+
+            for (uint64_t i = 0; i < num_sidbs; ++i)
+            {
+                interaction[i] += charge_layout.get_chargeless_potential_by_indices(i, next);
+            }
+
+            is_ordered[next]     = true;
+            state.position[next] = d;
+            state.order.push_back(next);
+        }
+    }
+    /**
+     * Assigns all feasible charge states to the SiDB at the given depth and recursively continues with the next SiDB.
+     * Complete charge distributions are checked for physical validity and stored in the given block result.
+     *
+     * @note The potential bounds have to be propagated for the given depth before.
+     *
+     * @tparam ChargeLyt Type of the charge distribution surface.
+     * @param charge_layout Charge layout in which the first `depth` SiDBs of the order are assigned.
+     * @param state State of the branch-and-bound search.
+     * @param depth Position of the SiDB to assign in the order.
+     * @param block Physically valid charge distributions are stored here.
+     */
+    template <typename ChargeLyt>
+    void branch_and_bound(ChargeLyt& charge_layout, branch_and_bound_state& state, const uint64_t depth,
+                          block_result& block) const noexcept
+    {
+        if (depth == charge_layout.num_cells())
+        {
+            // the flips of the descent do not update the validity, which is only needed for complete charge
+            // distributions
+            charge_layout.validity_check();
+
+            if (!charge_layout.is_physically_valid())
+            {
+                return;
+            }
+
+            const auto full_energy = add_charge_distribution(charge_layout, block);
+
+            if (!state.energy_shift.has_value())
+            {
+                state.energy_shift = full_energy - charge_layout.get_electrostatic_potential_energy();
+            }
+
+            if (on_ground_state)
+            {
+                add_ground_state_candidate(state, block.working_layout.value(), full_energy);
+                report_proven_ground_states(state, depth);
+            }
+
+            return;
+        }
+
+        const auto sidb = state.order[depth];
+
+        // the possible charge states are overwritten by the propagation in the subtrees
+        const auto possible_charge_states = state.possible_charge_states[sidb];
+
+        // states that lower the energy the most are tried first, such that low energies are found early
+        const auto energy_coefficient =
+            charge_layout.get_local_internal_potential_by_index(sidb).value() + state.energy_offset[sidb];
+
+        std::array<sidb_charge_state, 3> charge_states{sidb_charge_state::NEGATIVE, sidb_charge_state::NEUTRAL,
+                                                       sidb_charge_state::POSITIVE};
+
+        std::ranges::sort(charge_states, {},
+                          [energy_coefficient](const sidb_charge_state cs)
+                          { return static_cast<double>(charge_state_to_sign(cs)) * energy_coefficient; });
+
+        // a hinted charge state takes precedence, such that the hinted charge distribution is reached first
+        if (const auto hint = state.hinted_charge_state[sidb]; hint.has_value())
+        {
+            std::ranges::stable_partition(charge_states, [&hint](const sidb_charge_state cs) { return cs == *hint; });
+        }
+
+        const auto is_possible = [&possible_charge_states](const sidb_charge_state cs)
+        { return possible_charge_states[static_cast<std::size_t>(charge_state_to_sign(cs) + 1)]; };
+
+        // to prove ground states during the search, the energy lower bounds of all children are determined upfront
+        std::array<double, 3> child_energy_bounds{};
+        child_energy_bounds.fill(std::numeric_limits<double>::infinity());
+
+        if (on_ground_state)
+        {
+            for (std::size_t k = 0; k < charge_states.size(); ++k)
+            {
+                if (is_possible(charge_states[k]))
+                {
+                    charge_layout.flip_charge(sidb, charge_states[k], validity_calculation::KEEP_OLD_VALIDITY);
+
+                    if (propagate_potential_bounds(charge_layout, state, depth + 1))
+                    {
+                        child_energy_bounds[k] = energy_lower_bound(charge_layout, state, depth + 1);
+                    }
+
+                    charge_layout.flip_charge(sidb, sidb_charge_state::NEUTRAL,
+                                              validity_calculation::KEEP_OLD_VALIDITY);
+                }
+            }
+        }
+
+        for (std::size_t k = 0; k < charge_states.size(); ++k)
+        {
+            const auto cs = charge_states[k];
+
+            if (!is_possible(cs))
+            {
+                continue;
+            }
+
+            // only the children after the current one remain unexplored
+            state.unexplored_energy_bound[depth] = std::numeric_limits<double>::infinity();
+
+            for (auto j = k + 1; j < child_energy_bounds.size(); ++j)
+            {
+                state.unexplored_energy_bound[depth] =
+                    std::min(state.unexplored_energy_bound[depth], child_energy_bounds[j]);
+            }
+
+            charge_layout.flip_charge(sidb, cs, validity_calculation::KEEP_OLD_VALIDITY);
+
+            if (propagate_potential_bounds(charge_layout, state, depth + 1) &&
+                (params.result_mode == simulation_result_mode::ALL_VALID || !state.energy_shift.has_value() ||
+                 energy_lower_bound(charge_layout, state, depth + 1) + state.energy_shift.value() <
+                     selected_energy_bound(block) + constants::ERROR_MARGIN))
+            {
+                branch_and_bound(charge_layout, state, depth + 1, block);
+            }
+
+            charge_layout.flip_charge(sidb, sidb_charge_state::NEUTRAL, validity_calculation::KEEP_OLD_VALIDITY);
+
+            if (state.aborted)
+            {
+                return;
+            }
+        }
+
+        state.unexplored_energy_bound[depth] = std::numeric_limits<double>::infinity();
+
+        if (on_ground_state)
+        {
+            report_proven_ground_states(state, depth);
+        }
+    }
+    /**
+     * Stores the given full charge distribution as a ground state candidate if its energy is within
+     * `constants::ERROR_MARGIN` of the lowest energy found so far. Candidates that are outperformed are discarded.
+     *
+     * @param state State of the branch-and-bound search.
+     * @param cds Full charge layout with a physically valid charge distribution.
+     * @param energy Electrostatic potential energy of `cds` (unit: eV).
+     */
+    static void add_ground_state_candidate(branch_and_bound_state& state, const charge_distribution_surface<Lyt>& cds,
+                                           const double energy) noexcept
+    {
+        if (energy < state.lowest_energy)
+        {
+            state.lowest_energy = energy;
+
+            std::erase_if(state.ground_state_candidates,
+                          [&state](const auto& candidate)
+                          {
+                              return candidate.get_electrostatic_potential_energy() - state.lowest_energy >=
+                                     constants::ERROR_MARGIN;
+                          });
+        }
+
+        if (energy - state.lowest_energy < constants::ERROR_MARGIN)
+        {
+            charge_distribution_surface<Lyt> candidate{cds};
+            candidate.charge_distribution_to_index_general();
+            state.ground_state_candidates.push_back(std::move(candidate));
+        }
+    }
+    /**
+     * Reports all ground state candidates whose energy is within `constants::ERROR_MARGIN` of the energy lower bound of
+     * the unexplored part of the search tree to `on_ground_state`. Since no unexplored charge distribution can undercut
+     * them by more than the error margin, they are proven to be ground states.
+     *
+     * @param state State of the branch-and-bound search.
+     * @param depth Depth of the current node. The nodes at depths `< depth` are its ancestors.
+     */
+    void report_proven_ground_states(branch_and_bound_state& state, const uint64_t depth) const noexcept
+    {
+        if (state.ground_state_candidates.empty())
+        {
+            return;
+        }
+
+        auto unexplored_bound = std::numeric_limits<double>::infinity();
+
+        for (uint64_t d = 0; d < depth; ++d)
+        {
+            unexplored_bound = std::min(unexplored_bound, state.unexplored_energy_bound[d]);
+        }
+
+        unexplored_bound += state.energy_shift.value();
+
+        auto& candidates = state.ground_state_candidates;
+
+        for (auto it = candidates.begin(); it != candidates.end() && !state.aborted;)
+        {
+            if (it->get_electrostatic_potential_energy() < unexplored_bound + constants::ERROR_MARGIN)
+            {
+                state.aborted = !on_ground_state(*it);
+                it            = candidates.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+    /**
+     * Checks whether an SiDB can be population stable in the given charge state if its local electrostatic potential
+     * ends up anywhere in the given range.
+     *
+     * @param thresholds Effective charge transition thresholds of the SiDB.
+     * @param min_potential Lower bound on the negated local internal electrostatic potential at the SiDB (unit: V).
+     * @param max_potential Upper bound on the negated local internal electrostatic potential at the SiDB (unit: V).
+     * @param cs Charge state of the SiDB.
+     * @return `false` if the SiDB can certainly not be population stable in charge state `cs`, `true` otherwise.
+     */
+    [[nodiscard]] static bool can_be_population_stable(const std::array<double, 4>& thresholds,
+                                                       const double min_potential, const double max_potential,
+                                                       const sidb_charge_state cs) noexcept
+    {
+        switch (cs)
+        {
+            case sidb_charge_state::NEGATIVE:
+            {
+                return min_potential < thresholds[static_cast<std::size_t>(
+                                           charge_transition_threshold_bounds::NEGATIVE_UPPER_BOUND)];
+            }
+            case sidb_charge_state::POSITIVE:
+            {
+                return max_potential > thresholds[static_cast<std::size_t>(
+                                           charge_transition_threshold_bounds::POSITIVE_LOWER_BOUND)];
+            }
+            case sidb_charge_state::NEUTRAL:
+            {
+                return max_potential > thresholds[static_cast<std::size_t>(
+                                           charge_transition_threshold_bounds::NEUTRAL_LOWER_BOUND)] &&
+                       min_potential < thresholds[static_cast<std::size_t>(
+                                           charge_transition_threshold_bounds::NEUTRAL_UPPER_BOUND)];
+            }
+            default:
+            {
+                return false;
+            }
+        }
+    }
+    /**
+     * Determines the charge states in which the unassigned SiDBs can still be population stable and checks whether all
+     * assigned SiDBs can remain population stable. Each unassigned SiDB `j` can shift the local electrostatic potential
+     * at SiDB `i` by at most the chargeless potential between them, upward only if `j` can still be negatively charged
+     * and downward only if `j` can still be positively charged. Since excluding charge states of one SiDB tightens the
+     * bounds of all others, the bounds are propagated until a fixed point is reached.
+     *
+     * @tparam ChargeLyt Type of the charge distribution surface.
+     * @param charge_layout Charge layout in which the first `depth` SiDBs of the order are assigned.
+     * @param state State of the branch-and-bound search. The possible charge states of the unassigned SiDBs are
+     * updated.
+     * @param depth Number of assigned SiDBs.
+     * @return `false` if the partial charge distribution cannot be completed to a population-stable one.
+     */
+    template <typename ChargeLyt>
+    [[nodiscard]] static bool propagate_potential_bounds(const ChargeLyt& charge_layout, branch_and_bound_state& state,
+                                                         const uint64_t depth) noexcept
+    {
+        const auto num_sidbs = charge_layout.num_cells();
+
+        state.non_negative_sidbs.clear();
+        state.positive_sidbs.clear();
+
+        for (uint64_t d = depth; d < num_sidbs; ++d)
+        {
+            const auto j = state.order[d];
+
+            state.possible_charge_states[j] = {true, true, state.three_state};
+
+            if (state.three_state)
+            {
+                state.positive_sidbs.push_back(j);
+            }
+        }
+
+        for (auto changed = true; changed;)
+        {
+            changed = false;
+
+            for (uint64_t i = 0; i < num_sidbs; ++i)
+            {
+                // unassigned negatively charged SiDBs raise the negated potential, positively charged ones lower it
+                auto raise = state.unassigned_potential[depth][i];
+                auto lower = 0.0;
+
+                for (const auto j : state.non_negative_sidbs)
+                {
+                    raise -= j == i ? 0.0 : charge_layout.get_chargeless_potential_by_indices(i, j);
+                }
+
+                for (const auto j : state.positive_sidbs)
+                {
+                    lower += j == i ? 0.0 : charge_layout.get_chargeless_potential_by_indices(i, j);
+                }
+
+                const auto potential     = -charge_layout.get_local_internal_potential_by_index(i).value();
+                const auto min_potential = potential - lower - constants::ERROR_MARGIN;
+                const auto max_potential = potential + raise + constants::ERROR_MARGIN;
+                const auto thresholds    = charge_layout.get_effective_charge_transition_thresholds(i);
+
+                if (state.position[i] < depth)
+                {
+                    if (!can_be_population_stable(thresholds, min_potential, max_potential,
+                                                  charge_layout.get_charge_state_by_index(i)))
+                    {
+                        return false;
+                    }
+
+                    continue;
+                }
+
+                auto& possible = state.possible_charge_states[i];
+
+                const auto is_stable = [&](const sidb_charge_state cs)
+                { return can_be_population_stable(thresholds, min_potential, max_potential, cs); };
+
+                const std::array<bool, 3> still_possible{possible[0] && is_stable(sidb_charge_state::NEGATIVE),
+                                                         possible[1] && is_stable(sidb_charge_state::NEUTRAL),
+                                                         possible[2] && is_stable(sidb_charge_state::POSITIVE)};
+
+                if (!still_possible[0] && !still_possible[1] && !still_possible[2])
+                {
+                    return false;
+                }
+
+                if (possible[0] && !still_possible[0])
+                {
+                    state.non_negative_sidbs.push_back(i);
+                    changed = true;
+                }
+
+                if (possible[2] && !still_possible[2])
+                {
+                    std::erase(state.positive_sidbs, i);
+                    changed = true;
+                }
+
+                possible = still_possible;
+            }
+        }
+
+        return true;
+    }
+    /**
+     * Computes a lower bound on the electrostatic potential energy of all charge distributions that complete the given
+     * partial one. Each unassigned SiDB contributes its most favorable possible charge state with respect to the
+     * assigned SiDBs, the defects, and the external potentials. The interaction among the unassigned SiDBs is
+     * non-negative unless one of them is positively charged, which is bounded by its unassigned potential.
+     *
+     * @note The potential bounds have to be propagated for the given depth before.
+     *
+     * @tparam ChargeLyt Type of the charge distribution surface.
+     * @param charge_layout Charge layout in which the first `depth` SiDBs of the order are assigned.
+     * @param state State of the branch-and-bound search.
+     * @param depth Number of assigned SiDBs.
+     * @return Lower bound on the electrostatic potential energy (unit: eV).
+     */
+    template <typename ChargeLyt>
+    [[nodiscard]] static double energy_lower_bound(const ChargeLyt& charge_layout, const branch_and_bound_state& state,
+                                                   const uint64_t depth) noexcept
+    {
+        auto bound = charge_layout.get_electrostatic_potential_energy();
+
+        for (uint64_t d = depth; d < charge_layout.num_cells(); ++d)
+        {
+            const auto j = state.order[d];
+
+            const auto energy_coefficient =
+                charge_layout.get_local_internal_potential_by_index(j).value() + state.energy_offset[j];
+
+            const auto& possible = state.possible_charge_states[j];
+
+            // a negatively charged SiDB contributes -coefficient, a neutral one 0, and a positive one +coefficient
+            auto contribution = std::numeric_limits<double>::infinity();
+
+            if (possible[0])
+            {
+                contribution = -energy_coefficient;
+            }
+
+            if (possible[1])
+            {
+                contribution = std::min(contribution, 0.0);
+            }
+
+            if (possible[2])
+            {
+                contribution = std::min(contribution, energy_coefficient);
+                bound -= state.unassigned_potential[depth][j];
+            }
+
+            bound += contribution;
+        }
+
+        return bound;
+    }
+    /**
+     * Returns the electrostatic potential energy that a charge distribution has to fall below in order to be selected
+     * in the given block result.
+     *
+     * @param block Block result.
+     * @return Energy bound of the selection in the requested format (unit: eV).
+     */
+    [[nodiscard]] double selected_energy_bound(const block_result& block) const noexcept
+    {
+        return params.result_format == charge_distribution_format::COMPACT ?
+                   block.compact_charge_distributions.energy_bound() :
+                   block.charge_distributions.energy_bound();
+    }
+    /**
+     * This function splits the charge index range `[0, max_charge_index]` into contiguous blocks, one per thread, and
+     * simulates each block with the given function. The first block is simulated on the given charge layout by the
+     * calling thread, all other blocks are simulated on clones of it by supporting threads. The physically valid
+     * charge distributions of all blocks are collected in separate block results and merged into the simulation result
+     * in block order afterward. Therefore, the result is independent of the number of threads.
+     *
+     * @tparam ChargeLyt Type of the charge distribution surface.
+     * @tparam BlockSimulation Type of the function that simulates a block.
+     * @param charge_layout Initialized charge layout.
+     * @param max_charge_index Maximum charge index to enumerate.
+     * @param simulate_block Function that simulates all charge indices in `[first, last]` on the given charge layout
+     * and stores all physically valid charge distributions in the given block result.
+     */
+    template <typename ChargeLyt, typename BlockSimulation>
+    void simulate_charge_index_blocks(ChargeLyt& charge_layout, const uint64_t max_charge_index,
+                                      BlockSimulation&& simulate_block) noexcept
+    {
+        const auto num_blocks = std::min(std::max(params.number_of_threads, uint64_t{1}), max_charge_index + 1);
+
+        // single-threaded execution
+        if (num_blocks <= 1)
+        {
+            auto block = create_block_result();
+            simulate_block(charge_layout, 0, max_charge_index, block);
+            add_block_result(block);
+
+            return;
+        }
+
+        // multi-threaded execution
+        const auto block_size = (max_charge_index / num_blocks) + 1;
+
+        std::vector<std::pair<uint64_t, uint64_t>> blocks{};
+        blocks.reserve(num_blocks);
+
+        for (uint64_t first = 0; first <= max_charge_index; first += block_size)
+        {
+            blocks.emplace_back(first, std::min(first + block_size - 1, max_charge_index));
+
+            if (max_charge_index - first < block_size)
+            {
+                break;  // prevents an overflow of `first`
+            }
+        }
+
+        // each supporting thread works on its own clone of the initialized charge layout
+        std::vector<ChargeLyt> block_layouts{};
+        block_layouts.reserve(blocks.size() - 1);
+
+        for (uint64_t i = 1; i < blocks.size(); ++i)
+        {
+            block_layouts.emplace_back(charge_layout.clone());
+        }
+
+        std::vector<block_result> block_results(blocks.size(), create_block_result());
+
+        std::vector<std::thread> supporting_threads{};
+        supporting_threads.reserve(blocks.size() - 1);
+
+        for (uint64_t i = 1; i < blocks.size(); ++i)
+        {
+            supporting_threads.emplace_back(
+                [&simulate_block, &block_layouts, &blocks, &block_results, i]
+                { simulate_block(block_layouts[i - 1], blocks[i].first, blocks[i].second, block_results[i]); });
+        }
+
+        // the first block is simulated on the main thread
+        simulate_block(charge_layout, blocks.front().first, blocks.front().second, block_results.front());
+
+        // wait for all threads to complete
+        for (auto& thread : supporting_threads)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
+
+        for (auto& block : block_results)
+        {
+            add_block_result(block);
+        }
+    }
+    /**
+     * This function moves the charge distributions of the given block result to the ones selected for the simulation
+     * result.
+     *
+     * @param block Block result whose charge distributions are moved.
+     */
+    void add_block_result(block_result& block) noexcept
+    {
+        selected_charge_distributions.merge(std::move(block.charge_distributions));
+        selected_compact_charge_distributions.merge(std::move(block.compact_charge_distributions));
+    }
+    /**
+     * This function assigns the charge distribution that is represented by the given Gray code to the charge layout
+     * (2-state simulation). Contrary to `assign_charge_index_by_gray_code`, it does not require the previous Gray code
+     * and recomputes the local electrostatic potentials from scratch. The dependent SiDB is then updated accordingly.
+     *
+     * @tparam ChargeLyt Type of the charge distribution surface.
+     * @param charge_layout Initialized charge layout.
+     * @param gray_code Gray code representing the charge distribution of all SiDBs but the dependent one.
+     */
+    template <typename ChargeLyt>
+    void assign_charge_distribution_of_gray_code(ChargeLyt& charge_layout, const uint64_t gray_code) const noexcept
+    {
+        const auto dependent_cell_index =
+            static_cast<uint64_t>(charge_layout.cell_to_index(all_sidbs_in_lyt_without_negative_preassigned_ones[0]));
+
+        // the i-th bit of the Gray code corresponds to the i-th SiDB with the dependent SiDB being skipped
+        for (uint64_t i = 0; i < charge_layout.num_cells() - 1; ++i)
+        {
+            charge_layout.assign_charge_state_by_index(i < dependent_cell_index ? i : i + 1,
+                                                       ((gray_code >> i) & 1u) != 0 ? sidb_charge_state::NEGATIVE :
+                                                                                      sidb_charge_state::NEUTRAL,
+                                                       charge_index_mode::KEEP_CHARGE_INDEX);
+        }
+
+        charge_layout.update_after_charge_change(dependent_cell_mode::VARIABLE,
+                                                 energy_calculation::KEEP_OLD_ENERGY_VALUE,
+                                                 charge_distribution_history::NEGLECT);
+    }
+    /**
+     * This function transfers the charge distribution of the given (reduced) charge layout to the full charge layout
+     * (i.e., including the pre-assigned negatively charged SiDBs) and stores it in the given block result in the
+     * requested format, unless its energy rules it out according to the requested result mode.
+     *
+     * @tparam ChargeLyt Type of the charge distribution surface.
+     * @param charge_layout Charge layout with a physically valid charge distribution.
+     * @param block Block result in which the charge distribution is stored.
+     * @return Electrostatic potential energy of the full charge distribution (unit: eV).
+     */
+    template <typename ChargeLyt>
+    double add_charge_distribution(const ChargeLyt& charge_layout, block_result& block) const noexcept
+    {
+        // a single copy of the full charge layout is reused to determine the energy of all charge distributions of the
+        // block; it is only copied if the charge distribution is selected
+        if (!block.working_layout.has_value())
+        {
+            block.working_layout.emplace(charge_lyt);
+        }
+
+        auto& working_layout = block.working_layout.value();
+
+        charge_layout.foreach_cell(
+            [&working_layout, &charge_layout](const auto& c)
+            {
+                working_layout.assign_charge_state(c, charge_layout.get_charge_state(c),
+                                                   charge_index_mode::KEEP_CHARGE_INDEX);
+            });
+
+        working_layout.update_after_charge_change();
+
+        const auto energy = working_layout.get_electrostatic_potential_energy();
+
+        if (params.result_format == charge_distribution_format::COMPACT)
+        {
+            if (block.compact_charge_distributions.admits(energy))
+            {
+                block.compact_charge_distributions.add(compact_charge_distribution{working_layout});
+            }
+        }
+        else if (block.charge_distributions.admits(energy))
+        {
+            charge_distribution_surface<Lyt> charge_lyt_copy{working_layout};
+            charge_lyt_copy.charge_distribution_to_index_general();
+            block.charge_distributions.add(std::move(charge_lyt_copy));
+        }
+
+        return energy;
+    }
+    /**
+     * This function selects the charge distribution of the given charge layout for the simulation result in the
+     * requested format.
+     *
+     * @param cds Charge layout with a physically valid charge distribution.
+     */
+    void add_charge_distribution_to_result(const charge_distribution_surface<Lyt>& cds) noexcept
+    {
+        if (params.result_format == charge_distribution_format::COMPACT)
+        {
+            selected_compact_charge_distributions.add(compact_charge_distribution{cds});
+        }
+        else
+        {
+            selected_charge_distributions.add(charge_distribution_surface<Lyt>{cds});
+        }
+    }
+    /**
+     * This function is responsible for preparing the charge layout and relevant data structures for the simulation.
+     *
+     * This function initializes the charge layout within the context of the current simulation. It performs the
+     * following tasks:
+     *
+     * - If the provided layout type `Lyt` supports a `foreach_sidb_defect` method, it iterates through each
+     *   defect in the layout.
+     *   - If a defect is found, it adds the SiDB defect to the potential landscape.
+     * - It assigns the local external potential from the `params.local_external_potential` configuration to the charge
+     * layout.
+     * - It assigns the global external potential from `params.global_potential` to the charge layout.
+     */
+    void initialize_charge_layout() noexcept
+    {
+        // If Lyt is already a charge distribution surface, the layout was copied directly to the charge layout,
+        // and initialization was skipped. Therefore, the electrostatic influence of the defects is needed.
+        if constexpr (is_sidb_defect_surface_v<Lyt> && is_charge_distribution_surface_v<Lyt>)
+        {
+            layout.foreach_sidb_defect(
+                [this](const auto& cd)
+                {
+                    if (const auto& [cell, defect] = cd;
+                        defect.type != sidb_defect_type::NONE && is_charged_defect_type(cd.second))
+                    {
+                        charge_lyt.add_sidb_defect_to_potential_landscape(cell, layout.get_sidb_defect(cell));
+                    }
+                });
+        }
+
+        charge_lyt.assign_local_external_potential(params.local_external_potential);
+        charge_lyt.assign_global_external_potential(params.global_potential);
+
+        preassigned_negative_sidb_indices = charge_lyt.negative_sidb_detection();
+        preassigned_negative_sidbs.reserve(preassigned_negative_sidb_indices.size());
+
+        all_sidbs_in_lyt_without_negative_preassigned_ones = charge_lyt.get_sidb_order();
+        // store the number of SiDBs, since the number of active cells changes during simulation.
+        number_of_sidbs = charge_lyt.num_cells();
+    }
+    /**
+     *
+     * This function is used to generate a layout without the SiDBs that are pre-assigned to be negatively charged in a
+     * physically-valid layout.
      */
     void generate_layout_without_negative_sidbs() noexcept
     {
@@ -568,6 +1605,100 @@ template <typename Lyt>
 
     return p.run();
 }
+/**
+ * Runs *QuickExact* and reports each ground state to the given callback as soon as it is proven to be one. If the
+ * callback returns `false`, the simulation is aborted and the returned result only contains the charge distributions
+ * found so far. This allows callers that check a property of the ground states (e.g., `is_operational`) to stop the
+ * simulation on the first ground state that violates it.
+ *
+ * With `quickexact_params::charge_enumeration::BRANCH_AND_BOUND`, a charge distribution is proven to be a ground state
+ * during the search as soon as the energy lower bound of the unexplored part of the search tree does not fall below its
+ * energy by more than `constants::ERROR_MARGIN`. All other enumerations can only prove the ground states once they are
+ * complete, i.e., the ground states are reported after the simulation.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @tparam Fn Functor type that is convertible to `ground_state_callback<Lyt>`.
+ * @param lyt Layout to simulate.
+ * @param params Parameter required for the simulation.
+ * @param fn Function that is invoked once with each ground state. Returning `false` aborts the simulation.
+ * @return Simulation Results.
+ */
+template <typename Lyt, typename Fn>
+[[nodiscard]] sidb_simulation_result<Lyt> quickexact(const Lyt& lyt, const quickexact_params<cell<Lyt>>& params,
+                                                     Fn&& fn) noexcept
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+
+    detail::quickexact_impl<Lyt> p{lyt, params, ground_state_callback<Lyt>{std::forward<Fn>(fn)}};
+
+    return p.run();
+}
+/**
+ * Simulates many layouts that share a common skeleton with *QuickExact*. Each layout is given by the SiDBs in which it
+ * differs from the skeleton, e.g., the canvas SiDBs of a gate design candidate or the perturbers of an input pattern.
+ *
+ * The distances and chargeless potentials between all SiDBs of the skeleton and all added SiDBs are computed once and
+ * stored in a shared `sidb_geometry_cache`. The charge distribution surface of each layout then copies its matrices
+ * from this cache instead of computing them from scratch. The layouts are simulated in parallel and the results are
+ * returned in the order of `deltas`.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @param skeleton Layout that all simulated layouts are derived from.
+ * @param deltas Modifications of the skeleton, one per layout to simulate.
+ * @param params Parameters of the batch simulation.
+ * @return Simulation results, one per entry of `deltas` in the same order.
+ */
+template <typename Lyt>
+[[nodiscard]] std::vector<sidb_simulation_result<Lyt>>
+quickexact_batch(const Lyt& skeleton, const std::vector<sidb_layout_delta<cell<Lyt>>>& deltas,
+                 const quickexact_batch_params<cell<Lyt>>& params = {}) noexcept
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+
+    std::vector<sidb_simulation_result<Lyt>> results(deltas.size());
+
+    if (deltas.empty())
+    {
+        return results;
+    }
+
+    // the geometry of the skeleton and all added SiDBs is computed once; each layout is a subset of it
+    auto union_lyt = skeleton.clone();
+
+    for (const auto& delta : deltas)
+    {
+        for (const auto& c : delta.added_sidbs)
+        {
+            union_lyt.assign_cell_type(c, Lyt::cell_type::NORMAL);
+        }
+    }
+
+    auto simulation_params           = params.simulation_params;
+    simulation_params.geometry_cache = std::make_shared<const sidb_geometry_cache<cell<Lyt>>>(union_lyt);
+
+    shared_work_stealing_thread_pool(static_cast<std::size_t>(std::max(params.number_of_threads, uint64_t{1})))
+        .for_each_index(deltas.size(),
+                        [&skeleton, &deltas, &simulation_params, &results](const std::size_t i)
+                        {
+                            auto lyt = skeleton.clone();
+
+                            for (const auto& c : deltas[i].removed_sidbs)
+                            {
+                                lyt.assign_cell_type(c, Lyt::cell_type::EMPTY);
+                            }
+
+                            for (const auto& c : deltas[i].added_sidbs)
+                            {
+                                lyt.assign_cell_type(c, Lyt::cell_type::NORMAL);
+                            }
+
+                            results[i] = quickexact(lyt, simulation_params);
+                        });
+
+    return results;
+}
 
 }  // namespace fiction
 
@@ -52,6 +52,14 @@ struct quicksim_params
      * Timeout limit (in ms).
      */
     uint64_t timeout = std::numeric_limits<uint64_t>::max();
+    /**
+     * Floating-point precision of the local potential updates during the search. With `potential_precision::MIXED`,
+     * the search reads a single-precision copy of the potential matrix, and every charge distribution it accepts is
+     * re-evaluated in double precision before it is added to the result. Charge distributions whose validity is
+     * decided within the single-precision rounding error may thus be missed, which is in line with the heuristic
+     * nature of *QuickSim*.
+     */
+    potential_precision precision{potential_precision::DOUBLE};
 };
 
 /**
@@ -107,12 +115,40 @@ quicksim(const Lyt& lyt, const quicksim_params& ps = quicksim_params{}) noexcept
     {
         const mockturtle::stopwatch stop{time_counter};
 
+        std::mutex mutex{};  // used to control access to shared resources
+
+        // adds a charge distribution that is physically valid in the precision of the search to the result; in mixed
+        // precision, it is confirmed in double precision first
+        const auto add_charge_distribution = [&ps, &st, &mutex](const charge_distribution_surface<Lyt>& cds)
+        {
+            if (ps.precision == potential_precision::MIXED)
+            {
+                auto confirmed_cds = cds;
+                confirmed_cds.assign_potential_precision(potential_precision::DOUBLE);
+                confirmed_cds.recompute_in_double_precision();
+
+                if (!confirmed_cds.is_physically_valid())
+                {
+                    return;
+                }
+
+                const std::scoped_lock lock{mutex};
+                st.charge_distributions.emplace_back(std::move(confirmed_cds));
+
+                return;
+            }
+
+            const std::scoped_lock lock{mutex};
+            st.charge_distributions.emplace_back(cds);
+        };
+
         charge_distribution_surface<Lyt> charge_lyt{lyt};
         charge_lyt.set_sidb_simulation_engine(sidb_simulation_engine::QUICKSIM);
 
         // set the given physical parameters
         charge_lyt.assign_physical_parameters(ps.simulation_parameters);
         charge_lyt.assign_base_number(2);
+        charge_lyt.assign_potential_precision(ps.precision);
         charge_lyt.assign_all_charge_states(sidb_charge_state::NEGATIVE);
         charge_lyt.update_after_charge_change();
         const auto predefined_negative_sidb_indices = charge_lyt.negative_sidb_detection();
@@ -120,7 +156,7 @@ quicksim(const Lyt& lyt, const quicksim_params& ps = quicksim_params{}) noexcept
         // Check that the layout with all SiDBs negatively charged is physically valid.
         if (charge_lyt.is_physically_valid())
         {
-            st.charge_distributions.emplace_back(charge_lyt);
+            add_charge_distribution(charge_lyt);
         }
 
         // Check that the layout with all SiDBs neutrally charged is physically valid.
@@ -131,7 +167,7 @@ quicksim(const Lyt& lyt, const quicksim_params& ps = quicksim_params{}) noexcept
         {
             if (charge_lyt.is_physically_valid())
             {
-                st.charge_distributions.emplace_back(charge_lyt);
+                add_charge_distribution(charge_lyt);
             }
         }
 
@@ -160,7 +196,7 @@ quicksim(const Lyt& lyt, const quicksim_params& ps = quicksim_params{}) noexcept
         charge_lyt.update_after_charge_change();
         if (charge_lyt.is_physically_valid())
         {
-            st.charge_distributions.emplace_back(charge_lyt);
+            add_charge_distribution(charge_lyt);
         }
 
         // If the number of threads is initially set to zero, the simulation is run with one thread.
@@ -174,7 +210,6 @@ quicksim(const Lyt& lyt, const quicksim_params& ps = quicksim_params{}) noexcept
 
         std::vector<std::thread> threads{};
         threads.reserve(num_threads);
-        std::mutex mutex{};  // used to control access to shared resources
 
         for (uint64_t z = 0ul; z < num_threads; z++)
         {
@@ -225,24 +260,20 @@ quicksim(const Lyt& lyt, const quicksim_params& ps = quicksim_params{}) noexcept
                             if (charge_lyt_copy.is_physically_valid())
                             {
                                 charge_lyt_copy.charge_distribution_to_index();
-
-                                const std::scoped_lock lock{mutex};
-                                st.charge_distributions.emplace_back(charge_lyt_copy);
+                                add_charge_distribution(charge_lyt_copy);
                             }
 
                             const auto upper_limit = all_sidb_indices_with_unknown_charge_state.size() - 1;
 
                             for (uint64_t num = 0ul; num < upper_limit; num++)
                             {
+                                // updates the potentials, the energy, and the validity incrementally
                                 charge_lyt_copy.adjacent_search(ps.alpha, negative_sidbs_indices);
-                                charge_lyt_copy.validity_check();
 
                                 if (charge_lyt_copy.is_physically_valid())
                                 {
                                     charge_lyt_copy.charge_distribution_to_index();
-
-                                    const std::scoped_lock lock{mutex};
-                                    st.charge_distributions.emplace_back(charge_lyt_copy);
+                                    add_charge_distribution(charge_lyt_copy);
                                 }
                             }
                         }
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <functional>
 #include <optional>
 #include <tuple>
 
@@ -78,6 +79,20 @@ class sidb_simulation_domain
         std::ranges::for_each(domain_values_copy,
                               [&fn](const auto& pair) { std::invoke(std::forward<Fn>(fn), pair.first, pair.second); });
     }
+    /**
+     * Applies a callable to all key-value pairs in the container without copying it, which makes it the better choice
+     * for large domains once they are no longer modified, e.g., to write or evaluate a computed operational domain.
+     * Each internal submap is locked while it is visited. Concurrent calls of `add_value` are therefore safe, but the
+     * added pairs may or may not be visited, and `fn` must not access this domain.
+     *
+     * @tparam Fn Functor type.
+     * @param fn Functor to apply to each key-value pair.
+     */
+    template <typename Fn>
+    void for_each_in_place(Fn&& fn) const
+    {
+        domain_values.for_each([&fn](const auto& pair) { std::invoke(fn, pair.first, pair.second); });
+    }
     /**
      * Checks whether a specified key exists in the given map and retrieves its associated value if present.
      * This function utilizes the `if_contains` method of the map to ensure thread-safe access.
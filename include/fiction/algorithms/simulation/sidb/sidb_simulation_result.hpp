@@ -8,13 +8,17 @@
 #include "fiction/algorithms/simulation/sidb/minimum_energy.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
 #include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/compact_charge_distribution.hpp"
 #include "fiction/technology/constants.hpp"
 
 #include <algorithm>
 #include <any>
+#include <cassert>
 #include <chrono>
+#include <cmath>
 #include <cstdint>
 #include <limits>
+#include <memory>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -23,6 +27,24 @@
 namespace fiction
 {
 
+/**
+ * Format in which SiDB simulation algorithms store the determined charge distributions.
+ */
+enum class charge_distribution_format : uint8_t
+{
+    /**
+     * Each charge distribution is stored as a full `charge_distribution_surface` in
+     * `sidb_simulation_result::charge_distributions`.
+     */
+    FULL,
+    /**
+     * Each charge distribution is stored as a `compact_charge_distribution` in
+     * `sidb_simulation_result::compact_charge_distributions`. All of them share a single charge distribution surface
+     * that holds the geometry and the electrostatic potentials of the layout. Full charge distribution surfaces are
+     * only created on request. This considerably reduces the memory footprint of large simulation results.
+     */
+    COMPACT
+};
 /**
  * This struct defines a unified return type for all SiDB simulation algorithms. It contains the name of the algorithm,
  * the total simulation runtime, the charge distributions determined by the algorithm, the physical parameters used in
@@ -54,6 +76,17 @@ struct sidb_simulation_result
      * Charge distributions determined by the algorithm.
      */
     std::vector<charge_distribution_surface<Lyt>> charge_distributions{};
+    /**
+     * Charge distributions determined by the algorithm if it was instructed to use
+     * `charge_distribution_format::COMPACT`. The SiDB indices refer to the SiDB order of
+     * `compact_charge_distribution_context`.
+     */
+    std::vector<compact_charge_distribution> compact_charge_distributions{};
+    /**
+     * Charge distribution surface shared by all compact charge distributions. It holds the geometry and the
+     * electrostatic potentials of the simulated layout, its charge distribution is meaningless.
+     */
+    std::shared_ptr<const charge_distribution_surface<Lyt>> compact_charge_distribution_context{};
     /**
      * Physical parameters used in the simulation.
      */
@@ -66,7 +99,51 @@ struct sidb_simulation_result
      */
     std::unordered_map<std::string, std::any> additional_simulation_parameters{};
     /**
-     * This function computes the ground state of the charge distributions.
+     * Returns the number of determined charge distributions regardless of the format they are stored in.
+     *
+     * @return Number of full and compact charge distributions.
+     */
+    [[nodiscard]] std::size_t num_charge_distributions() const noexcept
+    {
+        return charge_distributions.size() + compact_charge_distributions.size();
+    }
+    /**
+     * Restores the full charge distribution surface of the given compact charge distribution.
+     *
+     * @param compact_cds Compact charge distribution of this simulation result.
+     * @return Charge distribution surface with the charge distribution of `compact_cds` assigned.
+     */
+    [[nodiscard]] charge_distribution_surface<Lyt>
+    materialize(const compact_charge_distribution& compact_cds) const noexcept
+    {
+        assert(compact_charge_distribution_context != nullptr && "no compact charge distribution context available");
+
+        charge_distribution_surface<Lyt> cds{*compact_charge_distribution_context};
+        compact_cds.apply_to(cds);
+
+        return cds;
+    }
+    /**
+     * Returns all determined charge distributions as full charge distribution surfaces. Compact charge distributions
+     * are materialized and appended after the full ones.
+     *
+     * @return A vector of all charge distributions.
+     */
+    [[nodiscard]] std::vector<charge_distribution_surface<Lyt>> materialize_charge_distributions() const noexcept
+    {
+        std::vector<charge_distribution_surface<Lyt>> all_charge_distributions{charge_distributions};
+        all_charge_distributions.reserve(num_charge_distributions());
+
+        for (const auto& compact_cds : compact_charge_distributions)
+        {
+            all_charge_distributions.push_back(materialize(compact_cds));
+        }
+
+        return all_charge_distributions;
+    }
+    /**
+     * This function computes the ground state of the charge distributions. Compact charge distributions are considered
+     * as well, where only the ground states among them are materialized.
      *
      * @note If degenerate states exist in the simulation result, this function will return multiple ground states that
      * all possess the same system energy.
@@ -75,6 +152,11 @@ struct sidb_simulation_result
      */
     [[nodiscard]] std::vector<charge_distribution_surface<Lyt>> groundstates() const noexcept
     {
+        if (!compact_charge_distributions.empty())
+        {
+            return compact_groundstates();
+        }
+
         std::vector<charge_distribution_surface<Lyt>> groundstate_charge_distributions{};
         std::set<uint64_t>                            charge_indices{};
 
@@ -111,6 +193,58 @@ struct sidb_simulation_result
 
         return groundstate_charge_distributions;
     }
+
+  private:
+    /**
+     * This function computes the ground state of a simulation result that (also) contains compact charge
+     * distributions. Full charge distributions are taken into account as well.
+     *
+     * @return A vector of charge distributions with the minimal energy.
+     */
+    [[nodiscard]] std::vector<charge_distribution_surface<Lyt>> compact_groundstates() const noexcept
+    {
+        double min_energy = std::numeric_limits<double>::infinity();
+
+        for (const auto& compact_cds : compact_charge_distributions)
+        {
+            min_energy = std::min(min_energy, compact_cds.get_electrostatic_potential_energy());
+        }
+
+        if (!charge_distributions.empty())
+        {
+            min_energy = std::min(min_energy, minimum_energy(charge_distributions.cbegin(), charge_distributions.cend()));
+        }
+
+        std::vector<charge_distribution_surface<Lyt>> groundstate_charge_distributions{};
+        std::set<uint64_t>                            charge_indices{};
+
+        // simulation results can have multiple identical charge distributions, which are only returned once
+        for (const auto& cds : charge_distributions)
+        {
+            cds.charge_distribution_to_index_general();
+
+            if (std::abs(cds.get_electrostatic_potential_energy() - min_energy) < constants::ERROR_MARGIN &&
+                charge_indices.insert(cds.get_charge_index_and_base().first).second)
+            {
+                groundstate_charge_distributions.push_back(cds);
+            }
+        }
+
+        for (const auto& compact_cds : compact_charge_distributions)
+        {
+            if (std::abs(compact_cds.get_electrostatic_potential_energy() - min_energy) < constants::ERROR_MARGIN &&
+                charge_indices.insert(compact_cds.get_charge_index_and_base().first).second)
+            {
+                groundstate_charge_distributions.push_back(materialize(compact_cds));
+            }
+        }
+
+        // same order as for full charge distributions, i.e., ascending charge index
+        std::ranges::sort(groundstate_charge_distributions, {},
+                          [](const auto& cds) { return cds.get_charge_index_and_base().first; });
+
+        return groundstate_charge_distributions;
+    }
 };
 
 }  // namespace fiction
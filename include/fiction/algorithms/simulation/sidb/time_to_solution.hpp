@@ -13,14 +13,19 @@
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/work_stealing_thread_pool.hpp"
 
 #include <fmt/format.h>
+#include <mockturtle/utils/stopwatch.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <iostream>
 #include <limits>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -45,6 +50,14 @@ struct time_to_solution_params
      * value.
      */
     double confidence_level = 0.997;
+    /**
+     * Number of threads over which the *QuickSim* repetitions of `time_to_solution` and the layouts of
+     * `time_to_solution_batch` are distributed. Concurrent simulations compete for the same cores and memory bandwidth,
+     * which inflates the measured runtimes. Therefore, it defaults to `1`, and *QuickSim*'s own
+     * `quicksim_params::number_threads` should be reduced accordingly if it is increased. Values below `1` are treated
+     * as `1`.
+     */
+    std::size_t number_of_threads = 1;
 };
 
 /**
@@ -70,6 +83,11 @@ struct time_to_solution_stats
      * Single simulation runtime of the exact ground state simulation algorithm.
      */
     double single_runtime_exact{};
+    /**
+     * Runtime of each *QuickSim* repetition in seconds, in order of the repetitions. It makes the runtime distribution
+     * available beyond its mean, e.g., its median or tail.
+     */
+    std::vector<double> single_runtimes{};
     /**
      * Exact simulation algorithm used to simulate the ground state as reference.
      */
@@ -140,21 +158,32 @@ void time_to_solution(const Lyt& lyt, const quicksim_params& quicksim_params,
         simulation_result = exhaustive_ground_state_simulation(lyt, quicksim_params.simulation_parameters);
     }
 
+    std::vector<std::optional<sidb_simulation_result<Lyt>>> repetition_results(tts_params.repetitions);
+
+    const auto simulate_repetition = [&lyt, &quicksim_params, &repetition_results](const std::size_t i)
+    { repetition_results[i] = quicksim<Lyt>(lyt, quicksim_params); };
+
+    if (const auto num_threads = std::max(tts_params.number_of_threads, std::size_t{1}); num_threads > 1)
+    {
+        shared_work_stealing_thread_pool(num_threads).for_each_index(repetition_results.size(), simulate_repetition);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < repetition_results.size(); ++i)
+        {
+            simulate_repetition(i);
+        }
+    }
+
+    // repetitions that did not return a result are not taken into account
     std::vector<sidb_simulation_result<Lyt>> simulation_results_quicksim{};
     simulation_results_quicksim.reserve(tts_params.repetitions);
 
-    for (auto i = 0u; i < tts_params.repetitions; ++i)
+    for (auto& result : repetition_results)
     {
-        if (const auto result = quicksim<Lyt>(lyt, quicksim_params))
+        if (result.has_value())
         {
-            if (!result.has_value())
-            {
-                simulation_results_quicksim.push_back(sidb_simulation_result<Lyt>{});
-            }
-            else
-            {
-                simulation_results_quicksim.push_back(*result);
-            }
+            simulation_results_quicksim.push_back(std::move(*result));
         }
     }
 
@@ -196,13 +225,16 @@ void time_to_solution_for_given_simulation_results(const sidb_simulation_result<
     auto        total_runtime_heuristic = 0.0;
     std::size_t gs_count                = 0;
 
+    st.single_runtimes.reserve(results_heuristic.size());
+
     for (const auto& heuristic : results_heuristic)
     {
         if (is_ground_state(heuristic, results_exact))
         {
             ++gs_count;
         }
-        total_runtime_heuristic += mockturtle::to_seconds(heuristic.simulation_runtime);
+        st.single_runtimes.push_back(mockturtle::to_seconds(heuristic.simulation_runtime));
+        total_runtime_heuristic += st.single_runtimes.back();
     }
 
     const auto single_runtime_heuristic_average =
@@ -237,6 +269,37 @@ void time_to_solution_for_given_simulation_results(const sidb_simulation_result<
     }
 }
 
+/**
+ * This function determines the time-to-solution (TTS) and the accuracy (acc) of the *QuickSim* algorithm for each of
+ * the given layouts, e.g., for a benchmark suite of layouts read via `read_sqd_layout`. The layouts are distributed
+ * over `tts_params.number_of_threads` threads, while the repetitions of each layout are run sequentially.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @param layouts Layouts that are used for the simulation.
+ * @param quicksim_params Parameters required for the *QuickSim* algorithm.
+ * @param tts_params Parameters used for the time-to-solution calculation.
+ * @return The time-to-solution statistics of each layout, in the order of `layouts`.
+ */
+template <typename Lyt>
+[[nodiscard]] std::vector<time_to_solution_stats> time_to_solution_batch(const std::vector<Lyt>&        layouts,
+                                                                         const quicksim_params&         quicksim_params,
+                                                                         const time_to_solution_params& tts_params = {})
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+
+    std::vector<time_to_solution_stats> stats(layouts.size());
+
+    auto layout_params              = tts_params;
+    layout_params.number_of_threads = 1;
+
+    shared_work_stealing_thread_pool(std::max(tts_params.number_of_threads, std::size_t{1}))
+        .for_each_index(layouts.size(), [&layouts, &quicksim_params, &layout_params, &stats](const std::size_t i)
+                        { time_to_solution(layouts[i], quicksim_params, layout_params, &stats[i]); });
+
+    return stats;
+}
+
 }  // namespace fiction
 
 #endif  // FICTION_TIME_TO_SOLUTION_HPP
@@ -52,7 +52,7 @@ void write_defect_influence_domain(const defect_influence_domain<Lyt>& defect_in
 
     writer.write_line("x", "y", "operational status");
 
-    defect_infdom.for_each(
+    defect_infdom.for_each_in_place(
         [&params, &writer](const auto& sim_param, const auto& op_val)
         {
             writer.write_line(sim_param.x, sim_param.y,
@@ -10,9 +10,12 @@
 #include "fiction/technology/constants.hpp"
 #include "fiction/technology/sidb_charge_state.hpp"
 #include "fiction/technology/sidb_defects.hpp"
+#include "fiction/technology/sidb_geometry_cache.hpp"
 #include "fiction/technology/sidb_nm_distance.hpp"
 #include "fiction/technology/sidb_nm_position.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/aligned_matrix.hpp"
+#include "fiction/utils/simd_utils.hpp"
 
 #include <algorithm>
 #include <array>
@@ -65,6 +68,21 @@ enum class energy_calculation : uint8_t
     UPDATE_ENERGY
 };
 
+/**
+ * An enumeration of modes for the evaluation of the physical validity of a given charge distribution.
+ */
+enum class validity_calculation : uint8_t
+{
+    /**
+     * The physical validity of a given charge distribution is not updated after it is changed.
+     */
+    KEEP_OLD_VALIDITY,
+    /**
+     * The physical validity of a given charge distribution is updated after it is changed.
+     */
+    UPDATE_VALIDITY
+};
+
 /**
  * An enumeration of modes for the charge distribution surface.
  */
@@ -97,6 +115,24 @@ enum class charge_distribution_history : uint8_t
     NEGLECT
 };
 
+/**
+ * An enumeration of floating-point precisions for the electrostatic potential computations.
+ */
+enum class potential_precision : uint8_t
+{
+    /**
+     * The chargeless potentials between SiDBs are stored and processed in double precision.
+     */
+    DOUBLE,
+    /**
+     * The chargeless potentials between SiDBs are additionally stored in single precision, which is read by the updates
+     * of the local electrostatic potentials. The local potentials, the energy, and all accumulations remain in double
+     * precision. This halves the memory traffic of the potential updates at the cost of a relative error of about
+     * \f$10^{-7}\f$ per potential.
+     */
+    MIXED
+};
+
 /**
  * An enumeration of modes to specifying if the charge index should be recomputed fully.
  */
@@ -198,13 +234,18 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
       private:
         /**
-         * The distance matrix is a vector of vectors storing the Euclidean distance in nm.
+         * The distance matrix is a contiguous square matrix storing the Euclidean distance in nm.
          */
-        using distance_matrix = std::vector<std::vector<double>>;
+        using distance_matrix = aligned_square_matrix<double>;
         /**
-         * The potential matrix is a vector of vectors storing the charge-less electrostatic potentials in Volt (V).
+         * The potential matrix is a contiguous square matrix storing the charge-less electrostatic potentials in Volt
+         * (V). Its rows are aligned to cache lines such that they can be streamed by vectorized kernels.
          */
-        using potential_matrix = std::vector<std::vector<double>>;
+        using potential_matrix = aligned_square_matrix<double>;
+        /**
+         * Single-precision copy of the potential matrix that is used in `potential_precision::MIXED` mode.
+         */
+        using single_precision_potential_matrix = aligned_square_matrix<float>;
         /**
          * It is a vector that stores the local electrostatic potential in Volt (V).
          */
@@ -257,6 +298,20 @@ class charge_distribution_surface<Lyt, false> : public Lyt
          * Electrostatic potential between SiDBs are stored as matrix (here, still charge-independent, unit: V).
          */
         potential_matrix pot_mat;
+        /**
+         * Floating-point precision of the local potential updates.
+         */
+        potential_precision precision{potential_precision::DOUBLE};
+        /**
+         * Electrostatic potential between SiDBs in single precision (unit: V). It is only populated in
+         * `potential_precision::MIXED` mode.
+         */
+        single_precision_potential_matrix pot_mat_single{};
+        /**
+         * Optional cache of the layout geometry from which the distance and potential matrices are copied instead of
+         * being computed from scratch.
+         */
+        std::shared_ptr<const sidb_geometry_cache<typename Lyt::cell>> geometry{};
         /**
          * External electrostatic potential in V at each SiDB position (can be used when different potentials are
          * applied to different SiDBs).
@@ -274,6 +329,11 @@ class charge_distribution_surface<Lyt, false> : public Lyt
          * Local electrostatic potential generated by charged SiDBs and defects.
          */
         local_potential local_int_pot;
+        /**
+         * Charge states of the SiDBs as floating-point numbers (`-1.0`, `0.0`, `1.0`). It serves as a scratch buffer
+         * for the vectorized potential and energy kernels and is only valid during their execution.
+         */
+        std::vector<double> charge_signs{};
         /**
          * Electrostatic potential generated by charged SiDBs and defects that is local to defects.
          */
@@ -384,7 +444,30 @@ class charge_distribution_surface<Lyt, false> : public Lyt
 
         initialize(cs, configuration);
     };
+    /**
+     * Constructor for existing layouts whose geometry is cached. The distance and potential matrices are copied from
+     * the given cache instead of being computed from scratch, which makes the construction cheap if the same layout is
+     * simulated under many physical parameters. The cache is kept and also used by `assign_physical_parameters`.
+     *
+     * @param lyt SiDB cell-level layout.
+     * @param params Physical parameters used for the simulation (µ_minus, base number, ...).
+     * @param geometry Geometry cache that was constructed from `lyt` or from a layout that contains all of its SiDBs.
+     * If it is `nullptr` or does not contain all SiDBs of `lyt`, the matrices are computed from scratch.
+     * @param cs The charge state used for the initialization of all SiDBs, default is a negative charge.
+     */
+    charge_distribution_surface(const Lyt& lyt, const sidb_simulation_parameters& params,
+                                std::shared_ptr<const sidb_geometry_cache<typename Lyt::cell>> geometry,
+                                const sidb_charge_state cs = sidb_charge_state::NEGATIVE) :
+            Lyt(lyt),
+            strg{std::make_shared<charge_distribution_storage>(params)}
+    {
+        static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+        static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+
+        strg->geometry = std::move(geometry);
 
+        initialize(cs);
+    }
     /**
      * Copy constructor.
      *
@@ -528,6 +611,38 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         this->determine_effective_charge_transition_thresholds();
         this->validity_check();
     }
+    /**
+     * Sets the floating-point precision of the local electrostatic potential updates. In `potential_precision::MIXED`
+     * mode, a single-precision copy of the potential matrix is created and used by the local potential updates. Charge
+     * distributions that are accepted in this mode should be confirmed via `recompute_in_double_precision`. Switching
+     * back to `potential_precision::DOUBLE` releases the single-precision copy.
+     *
+     * @note The local potentials are not recomputed by this function.
+     *
+     * @param precision Floating-point precision of the local potential updates.
+     */
+    void assign_potential_precision(const potential_precision precision) noexcept
+    {
+        strg->precision = precision;
+
+        if (precision == potential_precision::MIXED)
+        {
+            initialize_single_precision_potential_matrix();
+        }
+        else
+        {
+            strg->pot_mat_single = {};
+        }
+    }
+    /**
+     * Returns the floating-point precision of the local electrostatic potential updates.
+     *
+     * @return Floating-point precision of the local potential updates.
+     */
+    [[nodiscard]] potential_precision get_potential_precision() const noexcept
+    {
+        return strg->precision;
+    }
     /**
      * This function retrieves the physical parameters of the simulation.
      *
@@ -807,7 +922,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (const auto index1 = cell_to_index(c1), index2 = cell_to_index(c2); (index1 != -1) && (index2 != -1))
         {
-            return strg->nm_dist_mat[static_cast<uint64_t>(index1)][static_cast<uint64_t>(index2)];
+            return strg->nm_dist_mat(static_cast<uint64_t>(index1), static_cast<uint64_t>(index2));
         }
 
         return 0.0;
@@ -822,7 +937,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      */
     [[nodiscard]] double get_nm_distance_by_indices(const uint64_t index1, const uint64_t index2) const noexcept
     {
-        return strg->nm_dist_mat[index1][index2];
+        return strg->nm_dist_mat(index1, index2);
     }
     /**
      * This function calculates and returns the chargeless electrostatic potential between two cells (SiDBs) in Volt
@@ -837,13 +952,15 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         assert(strg->simulation_parameters.lambda_tf > 0.0 && "lambda_tf has to be > 0.0");
 
-        if (strg->nm_dist_mat[index1][index2] == 0.0)
+        const auto nm_distance = strg->nm_dist_mat(index1, index2);
+
+        if (nm_distance == 0.0)
         {
             return 0.0;
         }
 
-        return (strg->simulation_parameters.k() / (strg->nm_dist_mat[index1][index2] * 1E-9) *
-                std::exp(-strg->nm_dist_mat[index1][index2] / strg->simulation_parameters.lambda_tf) *
+        return (strg->simulation_parameters.k() / (nm_distance * 1E-9) *
+                std::exp(-nm_distance / strg->simulation_parameters.lambda_tf) *
                 constants::physical::ELEMENTARY_CHARGE);
     }
     /**
@@ -877,7 +994,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (const auto index1 = cell_to_index(c1), index2 = cell_to_index(c2); (index1 != -1) && (index2 != -1))
         {
-            return strg->pot_mat[static_cast<uint64_t>(index1)][static_cast<uint64_t>(index2)];
+            return strg->pot_mat(static_cast<uint64_t>(index1), static_cast<uint64_t>(index2));
         }
 
         return 0.0;
@@ -892,7 +1009,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     [[nodiscard]] double get_chargeless_potential_by_indices(const uint64_t index1,
                                                              const uint64_t index2) const noexcept
     {
-        return strg->pot_mat[index1][index2];
+        return strg->pot_mat(index1, index2);
     }
     /**
      * This function calculates and returns the electrostatic potential at one cell (`c1`) generated by another cell
@@ -910,7 +1027,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (const auto index1 = cell_to_index(c1), index2 = cell_to_index(c2); (index1 != -1) && (index2 != -1))
         {
-            return strg->pot_mat[static_cast<uint64_t>(index1)][static_cast<uint64_t>(index2)] *
+            return strg->pot_mat(static_cast<uint64_t>(index1), static_cast<uint64_t>(index2)) *
                    charge_state_to_sign(get_charge_state(c2));
         }
 
@@ -927,49 +1044,41 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     void update_local_internal_potential(
         const charge_distribution_history history_mode = charge_distribution_history::NEGLECT) noexcept
     {
+        const auto num_sidbs = strg->sidb_order.size();
+
         if (history_mode == charge_distribution_history::NEGLECT)
         {
             strg->local_int_pot = strg->local_pot_caused_by_defects;
 
-            for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
-            {
-                double collect = 0.0;
-                for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
-                {
-                    collect += strg->pot_mat[i][j] * static_cast<double>(charge_state_to_sign(strg->cell_charge[j]));
-                }
+            update_charge_signs();
 
-                strg->local_int_pot[i] += collect;
+            for (uint64_t i = 0u; i < num_sidbs; ++i)
+            {
+                strg->local_int_pot[i] += potential_generated_by_all_sidbs(i);
             }
         }
         else
         {
+            // since the potential matrix is symmetric, the potentials caused by a changed SiDB are given by its row
             if (strg->simulation_parameters.base == 2)
             {
                 if (strg->cell_history_gray_code.first != -1)
                 {
-                    const auto cell_charge = charge_state_to_sign(
-                        strg->cell_charge[static_cast<uint64_t>(strg->cell_history_gray_code.first)]);
-                    const auto charge_diff = static_cast<double>(cell_charge - strg->cell_history_gray_code.second);
-                    for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
-                    {
-                        const double pot_diff =
-                            strg->pot_mat[static_cast<uint64_t>(strg->cell_history_gray_code.first)][j] * charge_diff;
-                        strg->local_int_pot[j] += pot_diff;
-                    }
+                    const auto changed_cell = static_cast<uint64_t>(strg->cell_history_gray_code.first);
+                    const auto cell_charge  = charge_state_to_sign(strg->cell_charge[changed_cell]);
+                    const auto charge_diff  = static_cast<double>(cell_charge - strg->cell_history_gray_code.second);
+
+                    add_potential_generated_by_sidb(changed_cell, charge_diff);
                 }
             }
             else
             {
                 for (const auto& [changed_cell, charge] : strg->cell_history)
                 {
-                    for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
-                    {
-                        const double pot_diff =
-                            strg->pot_mat[changed_cell][j] *
-                            (static_cast<double>(charge_state_to_sign(strg->cell_charge[changed_cell])) - charge);
-                        strg->local_int_pot[j] += pot_diff;
-                    }
+                    const auto charge_diff =
+                        static_cast<double>(charge_state_to_sign(strg->cell_charge[changed_cell])) - charge;
+
+                    add_potential_generated_by_sidb(changed_cell, charge_diff);
                 }
             }
         }
@@ -1017,13 +1126,8 @@ class charge_distribution_surface<Lyt, false> : public Lyt
 
             for (uint64_t i = 0; i < strg->sidb_order.size(); ++i)
             {
-                const auto dist = sidb_nm_distance<Lyt>(*this, c1, strg->sidb_order[i]);
-                const auto pot  = chargeless_potential_generated_by_defect_at_given_distance(
-                    dist, sidb_defect{sidb_defect_type::DB, 0, strg->simulation_parameters.epsilon_r,
-                                      strg->simulation_parameters.lambda_tf});
-
-                strg->local_int_pot_at_defect[c1] +=
-                    pot * static_cast<double>(charge_state_to_sign(strg->cell_charge[i]));
+                strg->local_int_pot_at_defect[c1] += potential_at_defect_generated_by_sidb(c1, i) *
+                                                     static_cast<double>(charge_state_to_sign(strg->cell_charge[i]));
             }
         }
     }
@@ -1190,15 +1294,14 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      */
     void recompute_electrostatic_potential_energy() noexcept
     {
-        double collect = 0.0;
+        const auto num_sidbs = strg->sidb_order.size();
+
+        update_charge_signs();
+
+        double collect = dot_product(strg->local_int_pot.data(), strg->charge_signs.data(), num_sidbs);
 
         if (strg->engine == sidb_simulation_engine::QUICKSIM)
         {
-            for (uint64_t i = 0; i < strg->sidb_order.size(); ++i)
-            {
-                collect += strg->local_int_pot[i] * static_cast<double>(charge_state_to_sign(strg->cell_charge[i]));
-            }
-
             strg->system_energy = 0.5 * collect;
 
             return;
@@ -1207,14 +1310,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         update_local_external_potential();
         update_local_defect_potential();
 
-        double collect_ext = 0.0;
-
-        for (uint64_t i = 0; i < strg->sidb_order.size(); ++i)
-        {
-            collect_ext += strg->local_ext_pot[i] * static_cast<double>(charge_state_to_sign(strg->cell_charge[i]));
-
-            collect += strg->local_int_pot[i] * static_cast<double>(charge_state_to_sign(strg->cell_charge[i]));
-        }
+        double collect_ext = dot_product(strg->local_ext_pot.data(), strg->charge_signs.data(), num_sidbs);
 
         for (const auto& [c, defect] : strg->defects)
         {
@@ -1261,6 +1357,93 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         }
         this->validity_check();
     }
+    /**
+     * Recomputes the local electrostatic potentials from scratch with the double-precision potential matrix and
+     * re-evaluates the physical validity. It is used to confirm charge distributions that were accepted in
+     * `potential_precision::MIXED` mode. The precision mode itself is not changed, but the local potentials are exact
+     * afterward, i.e., subsequent incremental updates start from double-precision values.
+     *
+     * @param energy_calculation_mode `energy_calculation::UPDATE_ENERGY` if the electrostatic potential energy should
+     * be updated, `energy_calculation::KEEP_OLD_ENERGY_VALUE` otherwise.
+     */
+    void recompute_in_double_precision(
+        const energy_calculation energy_calculation_mode = energy_calculation::UPDATE_ENERGY) noexcept
+    {
+        const auto precision = strg->precision;
+        strg->precision      = potential_precision::DOUBLE;
+
+        this->update_local_internal_potential(charge_distribution_history::NEGLECT);
+
+        strg->precision = precision;
+
+        if (energy_calculation_mode == energy_calculation::UPDATE_ENERGY)
+        {
+            this->recompute_electrostatic_potential_energy();
+        }
+
+        this->validity_check();
+    }
+    /**
+     * Changes the charge state of a single SiDB and updates the local electrostatic potentials, the local potentials at
+     * the defects, the electrostatic potential energy, and the physical validity incrementally. Since only one charge
+     * changes, the local potentials are shifted by the corresponding row of the potential matrix and the energy by the
+     * resulting difference, which takes \f$\mathcal{O}(n)\f$ time instead of the \f$\mathcal{O}(n^2)\f$ of a full
+     * `update_after_charge_change`. The subsequent validity check is not incremental. It stops at the first SiDB that
+     * violates the population stability, but evaluates the \f$\mathcal{O}(n^2)\f$ configuration stability for each
+     * population-stable charge distribution, which then dominates the cost of the flip. Algorithms that flip many
+     * charges before they evaluate the result, e.g., to explore partial charge distributions, can therefore skip it.
+     *
+     * @note The local potentials and the energy have to be up to date before the flip (e.g., after
+     * `update_after_charge_change`). The charge index is not updated.
+     *
+     * @param index Index of the SiDB whose charge state is changed.
+     * @param new_state Charge state that is assigned to the SiDB.
+     * @param validity_calculation_mode `validity_calculation::UPDATE_VALIDITY` if the physical validity should be
+     * updated, `validity_calculation::KEEP_OLD_VALIDITY` otherwise.
+     */
+    void
+    flip_charge(const uint64_t index, const sidb_charge_state new_state,
+                const validity_calculation validity_calculation_mode = validity_calculation::UPDATE_VALIDITY) noexcept
+    {
+        assert(index < strg->cell_charge.size() && "SiDB index out of range");
+
+        const auto charge_diff = static_cast<double>(charge_state_to_sign(new_state) -
+                                                     charge_state_to_sign(strg->cell_charge[index]));
+
+        if (charge_diff == 0.0)
+        {
+            return;
+        }
+
+        // the diagonal of the potential matrix is zero, i.e., the energy changes by the interaction of the flipped
+        // charge with all other charges, with the defects, and with the external potential
+        double energy_diff =
+            charge_diff * (strg->local_int_pot[index] - 0.5 * strg->local_pot_caused_by_defects[index]);
+
+        if (strg->engine != sidb_simulation_engine::QUICKSIM)
+        {
+            energy_diff += charge_diff * strg->local_ext_pot[index];
+
+            for (const auto& [c, defect] : strg->defects)
+            {
+                const auto pot_at_defect = potential_at_defect_generated_by_sidb(c, index);
+
+                energy_diff += 0.5 * charge_diff * pot_at_defect * static_cast<double>(defect.charge);
+
+                strg->local_int_pot_at_defect[c] += charge_diff * pot_at_defect;
+            }
+        }
+
+        strg->cell_charge[index] = new_state;
+        strg->system_energy += energy_diff;
+
+        add_potential_generated_by_sidb(index, charge_diff);
+
+        if (validity_calculation_mode == validity_calculation::UPDATE_VALIDITY)
+        {
+            this->validity_check();
+        }
+    }
     /**
      * The configuration stability of the current charge distribution is evaluated. It is performed as the last check
      * towards a judgement of physical validity of the present charge distribution layout.
@@ -1273,7 +1456,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
             [this](const uint64_t c1, const uint64_t c2)  // energy change when charge hops between two SiDBs.
         {
             return strg->local_ext_pot[c1] - strg->local_ext_pot[c2] +
-                   (0.5 * (strg->local_int_pot[c1] - strg->local_int_pot[c2] - strg->pot_mat[c1][c2]));
+                   (0.5 * (strg->local_int_pot[c1] - strg->local_int_pot[c2] - strg->pot_mat(c1, c2)));
         };
 
         for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
@@ -1311,20 +1494,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         // this for-loop checks if the "population stability" is fulfilled.
         for (uint64_t i = 0; i < strg->sidb_order.size(); ++i)
         {
-            const bool valid =
-                (((strg->cell_charge[i] == sidb_charge_state::NEGATIVE) &&
-                  (-strg->local_int_pot[i] < strg->charge_transition_threshold_bounds[i][static_cast<std::size_t>(
-                                                 charge_transition_threshold_bounds::NEGATIVE_UPPER_BOUND)])) ||
-                 ((strg->cell_charge[i] == sidb_charge_state::POSITIVE) &&
-                  (-strg->local_int_pot[i] > strg->charge_transition_threshold_bounds[i][static_cast<std::size_t>(
-                                                 charge_transition_threshold_bounds::POSITIVE_LOWER_BOUND)])) ||
-                 ((strg->cell_charge[i] == sidb_charge_state::NEUTRAL) &&
-                  (-strg->local_int_pot[i] > strg->charge_transition_threshold_bounds[i][static_cast<std::size_t>(
-                                                 charge_transition_threshold_bounds::NEUTRAL_LOWER_BOUND)]) &&
-                  (-strg->local_int_pot[i] < strg->charge_transition_threshold_bounds[i][static_cast<std::size_t>(
-                                                 charge_transition_threshold_bounds::NEUTRAL_UPPER_BOUND)])));
-
-            if (!valid)
+            if (!is_population_stable_by_index(i))
             {
                 strg->validity = false;  // if at least one SiDB does not fulfill the population stability, the validity
                                          // of the given charge distribution is set to "false".
@@ -1545,7 +1715,8 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      * This function is used for the *QuickSim* algorithm (see quicksim.hpp). It gets a vector with indices representing
      * negatively charged SiDBs as input. Afterward, a distant and a neutrally charged SiDB is localized using a min-max
      * diversity algorithm. This selected SiDB is set to "negative" and the index is added to the input vector such that
-     * the next iteration works correctly.
+     * the next iteration works correctly. The charge change is applied via `flip_charge`, i.e., the local potentials,
+     * the electrostatic potential energy, and the physical validity are up to date afterward.
      *
      * @param alpha A parameter for the algorithm (default: 0.7).
      * @param negative_indices Vector of SiDBs indices that are already negatively charged (double occupied).
@@ -1600,15 +1771,9 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         static std::mt19937_64                  generator(std::random_device{}());
         std::uniform_int_distribution<uint64_t> dist(0, candidates.size() - 1);
         const auto                              random_element = index_vector[candidates[dist(generator)]];
-        strg->cell_charge[random_element]                      = sidb_charge_state::NEGATIVE;
         negative_indices.push_back(random_element);
 
-        strg->system_energy += -strg->local_int_pot[random_element];
-
-        for (uint64_t i = 0u; i < strg->pot_mat.size(); ++i)
-        {
-            strg->local_int_pot[i] += -this->get_chargeless_potential_by_indices(i, random_element);
-        }
+        this->flip_charge(random_element, sidb_charge_state::NEGATIVE);
     }
     /**
      * This function determines if given layout has to be simulated with three states since positively charged SiDBs
@@ -2210,8 +2375,10 @@ class charge_distribution_surface<Lyt, false> : public Lyt
                const cds_configuration configuration = cds_configuration::CHARGE_LOCATION_AND_ELECTROSTATIC) noexcept
     {
         const auto param_copy       = strg->simulation_parameters;
+        auto       geometry_copy    = strg->geometry;
         strg                        = std::make_shared<charge_distribution_storage>();
         strg->simulation_parameters = param_copy;
+        strg->geometry              = std::move(geometry_copy);
         strg->sidb_order.reserve(this->num_cells());
         strg->cell_charge.reserve(this->num_cells());
         this->foreach_cell([this](const auto& c1) { strg->sidb_order.push_back(c1); });
@@ -2276,36 +2443,219 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     }
 
     /**
-     * Initializes the distance matrix between all the cells of the layout.
+     * Initializes the distance matrix between all the cells of the layout. Since distances are symmetric, only the
+     * upper triangle is computed and mirrored.
      */
     void initialize_nm_distance_matrix() noexcept
     {
-        strg->nm_dist_mat =
-            std::vector<std::vector<double>>(this->num_cells(), std::vector<double>(this->num_cells(), 0.0));
+        if (const auto cache_indices = geometry_cache_indices(); cache_indices.has_value())
+        {
+            copy_from_geometry_cache(strg->nm_dist_mat, strg->geometry->get_nm_distance_matrix(), *cache_indices);
+
+            return;
+        }
+
+        strg->nm_dist_mat = aligned_square_matrix<double>(this->num_cells(), 0.0);
 
         for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
         {
-            for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
+            for (uint64_t j = i + 1; j < strg->sidb_order.size(); j++)
             {
-                strg->nm_dist_mat[i][j] = sidb_nm_distance<Lyt>(*this, strg->sidb_order[i], strg->sidb_order[j]);
+                const auto distance = sidb_nm_distance<Lyt>(*this, strg->sidb_order[i], strg->sidb_order[j]);
+
+                strg->nm_dist_mat(i, j) = distance;
+                strg->nm_dist_mat(j, i) = distance;
             }
         }
     }
     /**
-     * Initializes the potential matrix between all the cells of the layout.
+     * Initializes the potential matrix between all the cells of the layout. Since the chargeless potentials only
+     * depend on the distance, only the upper triangle is computed and mirrored.
      */
     void initialize_potential_matrix() noexcept
     {
-        strg->pot_mat =
-            std::vector<std::vector<double>>(this->num_cells(), std::vector<double>(this->num_cells(), 0.0));
+        if (const auto cache_indices = geometry_cache_indices(); cache_indices.has_value())
+        {
+            copy_from_geometry_cache(strg->pot_mat, *strg->geometry->get_potential_matrix(strg->simulation_parameters),
+                                     *cache_indices);
+        }
+        else
+        {
+            strg->pot_mat = aligned_square_matrix<double>(this->num_cells(), 0.0);
 
-        for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
+            for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
+            {
+                for (uint64_t j = i + 1; j < strg->sidb_order.size(); j++)
+                {
+                    const auto potential = calculate_chargeless_potential_between_sidbs_by_index(i, j);
+
+                    strg->pot_mat(i, j) = potential;
+                    strg->pot_mat(j, i) = potential;
+                }
+            }
+        }
+
+        if (strg->precision == potential_precision::MIXED)
         {
-            for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
+            initialize_single_precision_potential_matrix();
+        }
+    }
+    /**
+     * Determines the indices of all SiDBs in the matrices of the geometry cache.
+     *
+     * @return The index in the geometry cache of each SiDB in `sidb_order`, or `std::nullopt` if no geometry cache is
+     * assigned or it does not contain all SiDBs.
+     */
+    [[nodiscard]] std::optional<std::vector<uint64_t>> geometry_cache_indices() const noexcept
+    {
+        if (strg->geometry == nullptr)
+        {
+            return std::nullopt;
+        }
+
+        std::vector<uint64_t> cache_indices{};
+        cache_indices.reserve(strg->sidb_order.size());
+
+        for (const auto& c : strg->sidb_order)
+        {
+            const auto index = strg->geometry->index_of(c);
+
+            if (!index.has_value())
             {
-                strg->pot_mat[i][j] = calculate_chargeless_potential_between_sidbs_by_index(i, j);
+                return std::nullopt;
             }
+
+            cache_indices.push_back(*index);
         }
+
+        return cache_indices;
+    }
+    /**
+     * Copies the entries of a matrix of the geometry cache that belong to the SiDBs of this layout.
+     *
+     * @param target Matrix to assign.
+     * @param source Matrix of the geometry cache.
+     * @param cache_indices The index in the geometry cache of each SiDB in `sidb_order`.
+     */
+    static void copy_from_geometry_cache(aligned_square_matrix<double>&       target,
+                                         const aligned_square_matrix<double>& source,
+                                         const std::vector<uint64_t>&         cache_indices) noexcept
+    {
+        // since the SiDBs in the cache are unique, strictly increasing indices of all cached SiDBs map one-to-one
+        if (cache_indices.size() == source.size() && std::ranges::is_sorted(cache_indices))
+        {
+            target = source;
+
+            return;
+        }
+
+        target = aligned_square_matrix<double>(cache_indices.size(), 0.0);
+
+        for (uint64_t i = 0u; i < cache_indices.size(); ++i)
+        {
+            for (uint64_t j = 0u; j < cache_indices.size(); ++j)
+            {
+                target(i, j) = source(cache_indices[i], cache_indices[j]);
+            }
+        }
+    }
+    /**
+     * Checks whether the SiDB at the given index fulfills the population stability, i.e., whether its charge state is
+     * compatible with its local electrostatic potential and the effective charge transition thresholds.
+     *
+     * @param i Index of the SiDB.
+     * @return `true` iff the SiDB fulfills the population stability.
+     */
+    [[nodiscard]] bool is_population_stable_by_index(const uint64_t i) const noexcept
+    {
+        return ((strg->cell_charge[i] == sidb_charge_state::NEGATIVE) &&
+                (-strg->local_int_pot[i] < strg->charge_transition_threshold_bounds[i][static_cast<std::size_t>(
+                                               charge_transition_threshold_bounds::NEGATIVE_UPPER_BOUND)])) ||
+               ((strg->cell_charge[i] == sidb_charge_state::POSITIVE) &&
+                (-strg->local_int_pot[i] > strg->charge_transition_threshold_bounds[i][static_cast<std::size_t>(
+                                               charge_transition_threshold_bounds::POSITIVE_LOWER_BOUND)])) ||
+               ((strg->cell_charge[i] == sidb_charge_state::NEUTRAL) &&
+                (-strg->local_int_pot[i] > strg->charge_transition_threshold_bounds[i][static_cast<std::size_t>(
+                                               charge_transition_threshold_bounds::NEUTRAL_LOWER_BOUND)]) &&
+                (-strg->local_int_pot[i] < strg->charge_transition_threshold_bounds[i][static_cast<std::size_t>(
+                                               charge_transition_threshold_bounds::NEUTRAL_UPPER_BOUND)]));
+    }
+    /**
+     * Calculates the chargeless electrostatic potential that the SiDB at the given index generates at the position of
+     * a defect (unit: V).
+     *
+     * @param defect_cell Position of the defect.
+     * @param index Index of the SiDB.
+     * @return Chargeless potential at `defect_cell` caused by the SiDB at `index` (unit: V).
+     */
+    [[nodiscard]] double potential_at_defect_generated_by_sidb(const typename Lyt::cell& defect_cell,
+                                                               const uint64_t            index) const noexcept
+    {
+        return chargeless_potential_generated_by_defect_at_given_distance(
+            sidb_nm_distance<Lyt>(*this, defect_cell, strg->sidb_order[index]),
+            sidb_defect{sidb_defect_type::DB, 0, strg->simulation_parameters.epsilon_r,
+                        strg->simulation_parameters.lambda_tf});
+    }
+    /**
+     * Creates the single-precision copy of the potential matrix that is used in `potential_precision::MIXED` mode.
+     */
+    void initialize_single_precision_potential_matrix() noexcept
+    {
+        const auto num_sidbs = strg->pot_mat.size();
+
+        strg->pot_mat_single = aligned_square_matrix<float>{num_sidbs};
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            std::transform(strg->pot_mat.row(i), strg->pot_mat.row(i) + num_sidbs, strg->pot_mat_single.row(i),
+                           [](const double pot) { return static_cast<float>(pot); });
+        }
+    }
+    /**
+     * Computes the local electrostatic potential at the SiDB with the given index that is generated by all charged SiDBs
+     * (unit: V). The charge signs have to be up to date (see `update_charge_signs`).
+     *
+     * @param index Index of the SiDB.
+     * @return Local electrostatic potential at the SiDB caused by all SiDBs (unit: V).
+     */
+    [[nodiscard]] double potential_generated_by_all_sidbs(const uint64_t index) const noexcept
+    {
+        if (strg->precision == potential_precision::MIXED)
+        {
+            return dot_product(strg->pot_mat_single.row(index), strg->charge_signs.data(), strg->pot_mat_single.size());
+        }
+
+        return dot_product(strg->pot_mat.row(index), strg->charge_signs.data(), strg->pot_mat.size());
+    }
+    /**
+     * Adds the local electrostatic potentials that a change of the charge of the SiDB with the given index causes to the
+     * local potentials of all SiDBs. Since the potential matrix is symmetric, these are given by the SiDB's row.
+     *
+     * @param index Index of the SiDB whose charge changed.
+     * @param charge_diff Difference between the new and the old charge sign.
+     */
+    void add_potential_generated_by_sidb(const uint64_t index, const double charge_diff) noexcept
+    {
+        if (strg->precision == potential_precision::MIXED)
+        {
+            scaled_addition(strg->local_int_pot.data(), strg->pot_mat_single.row(index), charge_diff,
+                            strg->pot_mat_single.size());
+        }
+        else
+        {
+            scaled_addition(strg->local_int_pot.data(), strg->pot_mat.row(index), charge_diff, strg->pot_mat.size());
+        }
+    }
+    /**
+     * Writes the charge states of all SiDBs as floating-point numbers (`-1.0`, `0.0`, `1.0`) to the scratch buffer
+     * that is consumed by the vectorized potential and energy kernels.
+     */
+    void update_charge_signs() noexcept
+    {
+        strg->charge_signs.resize(strg->cell_charge.size());
+
+        std::transform(strg->cell_charge.cbegin(), strg->cell_charge.cend(), strg->charge_signs.begin(),
+                       [](const auto cs) { return static_cast<double>(charge_state_to_sign(cs)); });
     }
 
     /**
@@ -2476,6 +2826,16 @@ template <class T>
 charge_distribution_surface(const T&, const sidb_simulation_parameters&, sidb_charge_state cs,
                             cds_configuration cds_configuration) -> charge_distribution_surface<T>;
 
+template <class T>
+charge_distribution_surface(const T&, const sidb_simulation_parameters&,
+                            std::shared_ptr<const sidb_geometry_cache<typename T::cell>>)
+    -> charge_distribution_surface<T>;
+
+template <class T>
+charge_distribution_surface(const T&, const sidb_simulation_parameters&,
+                            std::shared_ptr<const sidb_geometry_cache<typename T::cell>>, sidb_charge_state cs)
+    -> charge_distribution_surface<T>;
+
 }  // namespace fiction
 
 #endif  // FICTION_CHARGE_DISTRIBUTION_SURFACE_HPP
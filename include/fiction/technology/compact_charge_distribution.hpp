@@ -0,0 +1,217 @@
+//
+// Created by Jan Drewniok on 17.10.26.
+//
+
+#ifndef FICTION_COMPACT_CHARGE_DISTRIBUTION_HPP
+#define FICTION_COMPACT_CHARGE_DISTRIBUTION_HPP
+
+#include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/sidb_charge_state.hpp"
+#include "fiction/traits.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * A memory-efficient representation of a charge distribution. Contrary to a `charge_distribution_surface`, it does not
+ * carry the layout, the distance and potential matrices, or any other geometry-dependent data. Instead, only the charge
+ * states (packed into 2 bits per SiDB), the electrostatic potential energy, and the charge index are stored. The SiDB
+ * indices refer to the order of SiDBs in the charge distribution surface the compact charge distribution was created
+ * from. Hence, a full charge distribution surface can be restored via `apply_to` on a charge distribution surface of
+ * the same layout.
+ */
+class compact_charge_distribution
+{
+  public:
+    /**
+     * Default constructor. Creates an empty charge distribution.
+     */
+    compact_charge_distribution() noexcept = default;
+    /**
+     * Standard constructor. Packs the charge states of the given charge distribution surface and stores its
+     * electrostatic potential energy and charge index.
+     *
+     * @tparam ChargeLyt Type of the charge distribution surface.
+     * @param cds Charge distribution surface whose charge distribution is stored.
+     */
+    template <typename ChargeLyt>
+    explicit compact_charge_distribution(const ChargeLyt& cds) noexcept :
+            num_sidbs{cds.num_cells()},
+            electrostatic_potential_energy{cds.get_electrostatic_potential_energy()}
+    {
+        static_assert(is_charge_distribution_surface_v<ChargeLyt>, "ChargeLyt is not a charge distribution surface");
+
+        cds.charge_distribution_to_index_general();
+        charge_index_and_base = cds.get_charge_index_and_base();
+
+        packed_charge_states.resize((num_sidbs + CHARGE_STATES_PER_WORD - 1) / CHARGE_STATES_PER_WORD, 0);
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            const auto shift = BITS_PER_CHARGE_STATE * (i % CHARGE_STATES_PER_WORD);
+
+            packed_charge_states[i / CHARGE_STATES_PER_WORD] |= charge_state_to_bits(cds.get_charge_state_by_index(i))
+                                                                << shift;
+        }
+    }
+    /**
+     * Returns the number of SiDBs whose charge states are stored.
+     *
+     * @return Number of SiDBs.
+     */
+    [[nodiscard]] uint64_t num_cells() const noexcept
+    {
+        return num_sidbs;
+    }
+    /**
+     * Returns the charge state of the SiDB at the given index.
+     *
+     * @param index Index of the SiDB.
+     * @return The charge state of the SiDB at the given index.
+     */
+    [[nodiscard]] sidb_charge_state get_charge_state_by_index(const uint64_t index) const noexcept
+    {
+        assert(index < num_sidbs && "SiDB index out of range");
+
+        return bits_to_charge_state((packed_charge_states[index / CHARGE_STATES_PER_WORD] >>
+                                     (BITS_PER_CHARGE_STATE * (index % CHARGE_STATES_PER_WORD))) &
+                                    CHARGE_STATE_MASK);
+    }
+    /**
+     * Returns the charge states of all SiDBs.
+     *
+     * @return Vector of the charge states of all SiDBs.
+     */
+    [[nodiscard]] std::vector<sidb_charge_state> get_all_sidb_charges() const noexcept
+    {
+        std::vector<sidb_charge_state> charges{};
+        charges.reserve(num_sidbs);
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            charges.push_back(get_charge_state_by_index(i));
+        }
+
+        return charges;
+    }
+    /**
+     * Returns the electrostatic potential energy of the charge distribution.
+     *
+     * @return Electrostatic potential energy in eV.
+     */
+    [[nodiscard]] double get_electrostatic_potential_energy() const noexcept
+    {
+        return electrostatic_potential_energy;
+    }
+    /**
+     * Returns the charge index of the charge distribution and the base it refers to.
+     *
+     * @return Pair of the charge index and the base number.
+     */
+    [[nodiscard]] std::pair<uint64_t, uint8_t> get_charge_index_and_base() const noexcept
+    {
+        return charge_index_and_base;
+    }
+    /**
+     * Assigns the stored charge distribution to the given charge distribution surface and updates its local
+     * electrostatic potentials, system energy, and physical validity.
+     *
+     * @tparam ChargeLyt Type of the charge distribution surface.
+     * @param cds Charge distribution surface of the layout this compact charge distribution was created from.
+     */
+    template <typename ChargeLyt>
+    void apply_to(ChargeLyt& cds) const noexcept
+    {
+        static_assert(is_charge_distribution_surface_v<ChargeLyt>, "ChargeLyt is not a charge distribution surface");
+
+        assert(cds.num_cells() == num_sidbs && "the charge distribution surface does not match the stored charges");
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            cds.assign_charge_state_by_index(i, get_charge_state_by_index(i), charge_index_mode::KEEP_CHARGE_INDEX);
+        }
+
+        cds.update_after_charge_change();
+        cds.charge_distribution_to_index_general();
+    }
+    /**
+     * Equality operator. Two compact charge distributions are equal if they store the same charge states.
+     *
+     * @param other Other compact charge distribution.
+     * @return `true` iff both store the same charge states.
+     */
+    [[nodiscard]] bool operator==(const compact_charge_distribution& other) const noexcept
+    {
+        return num_sidbs == other.num_sidbs && packed_charge_states == other.packed_charge_states;
+    }
+
+  private:
+    /**
+     * Number of bits used to store the charge state of a single SiDB.
+     */
+    static constexpr uint64_t BITS_PER_CHARGE_STATE = 2;
+    /**
+     * Number of charge states stored in a single 64-bit word.
+     */
+    static constexpr uint64_t CHARGE_STATES_PER_WORD = 64 / BITS_PER_CHARGE_STATE;
+    /**
+     * Bit mask to extract a single charge state.
+     */
+    static constexpr uint64_t CHARGE_STATE_MASK = (uint64_t{1} << BITS_PER_CHARGE_STATE) - 1;
+    /**
+     * Packed charge states, 2 bits per SiDB.
+     */
+    std::vector<uint64_t> packed_charge_states{};
+    /**
+     * Number of SiDBs.
+     */
+    uint64_t num_sidbs{0};
+    /**
+     * Electrostatic potential energy of the charge distribution in eV.
+     */
+    double electrostatic_potential_energy{0.0};
+    /**
+     * Charge index of the charge distribution and the base it refers to.
+     */
+    std::pair<uint64_t, uint8_t> charge_index_and_base{0, 0};
+    /**
+     * Converts a charge state into its 2-bit representation (`NEGATIVE` = `0`, `NEUTRAL` = `1`, `POSITIVE` = `2`,
+     * `NONE` = `3`).
+     *
+     * @param cs SiDB charge state.
+     * @return 2-bit representation of `cs`.
+     */
+    [[nodiscard]] static constexpr uint64_t charge_state_to_bits(const sidb_charge_state cs) noexcept
+    {
+        if (cs == sidb_charge_state::NONE)
+        {
+            return 3;
+        }
+
+        return static_cast<uint64_t>(charge_state_to_sign(cs) + 1);
+    }
+    /**
+     * Converts a 2-bit representation back into a charge state.
+     *
+     * @param bits 2-bit representation of a charge state.
+     * @return SiDB charge state represented by `bits`.
+     */
+    [[nodiscard]] static constexpr sidb_charge_state bits_to_charge_state(const uint64_t bits) noexcept
+    {
+        if (bits == 3)
+        {
+            return sidb_charge_state::NONE;
+        }
+
+        return sign_to_charge_state(static_cast<int8_t>(static_cast<int8_t>(bits) - 1));
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_COMPACT_CHARGE_DISTRIBUTION_HPP
@@ -0,0 +1,392 @@
+//
+// Created by Jan Drewniok on 17.10.26.
+//
+
+#ifndef FICTION_SIDB_GATE_DESIGN_CACHE_HPP
+#define FICTION_SIDB_GATE_DESIGN_CACHE_HPP
+
+#include "fiction/algorithms/physical_design/design_sidb_gates.hpp"
+#include "fiction/technology/cell_technologies.hpp"
+#include "fiction/technology/sidb_defect_surface.hpp"
+#include "fiction/traits.hpp"
+
+#include <fmt/format.h>
+#include <kitty/print.hpp>
+#include <phmap.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Computes the key under which the design of an SiDB gate is stored in an `sidb_gate_design_cache`. The key is a
+ * canonical textual description of everything the outcome of `design_sidb_gates` depends on: the skeleton including its
+ * cell types and, if it is an `sidb_defect_surface`, the atomic defects clipped into it, the truth tables of the
+ * specification, and the physical and operational parameters of the design process. Two design problems thus share a
+ * key if and only if they are identical, independent of the order in which the cells and defects were added.
+ *
+ * @tparam Lyt SiDB cell-level layout type of the skeleton.
+ * @tparam TT Truth table type.
+ * @param skeleton Skeleton of the gate, i.e., its input and output wires and, if any, nearby atomic defects.
+ * @param spec Expected Boolean function of the gate given as a multi-output truth table.
+ * @param params Parameters of the gate design process.
+ * @return Key of the gate design, which contains no whitespace.
+ */
+template <typename Lyt, typename TT>
+[[nodiscard]] std::string sidb_gate_design_cache_key(const Lyt& skeleton, const std::vector<TT>& spec,
+                                                     const design_sidb_gates_params<cell<Lyt>>& params)
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+
+    const auto position = [](const cell<Lyt>& c)
+    {
+        return fmt::format("{},{},{}", static_cast<int64_t>(c.x), static_cast<int64_t>(c.y),
+                           static_cast<int64_t>(c.z));
+    };
+
+    // cells and defects live in hash maps, so their descriptions are sorted to be independent of the visiting order
+    std::vector<std::string> elements{};
+
+    skeleton.foreach_cell(
+        [&skeleton, &position, &elements](const auto& c)
+        { elements.push_back(fmt::format("{}{}", position(c), static_cast<char>(skeleton.get_cell_type(c)))); });
+
+    if constexpr (is_sidb_defect_surface_v<Lyt>)
+    {
+        skeleton.foreach_sidb_defect(
+            [&position, &elements](const auto& cd)
+            {
+                const auto& [c, defect] = cd;
+
+                elements.push_back(fmt::format("{}d{},{},{},{}", position(c), static_cast<int>(defect.type),
+                                               defect.charge, defect.epsilon_r, defect.lambda_tf));
+            });
+    }
+
+    std::sort(elements.begin(), elements.end());
+
+    std::string key{};
+
+    for (const auto& e : elements)
+    {
+        key += e;
+        key += ';';
+    }
+
+    for (const auto& output : spec)
+    {
+        key += fmt::format("|{}:{}", output.num_vars(), kitty::to_hex(output));
+    }
+
+    const auto& op_params  = params.operational_params;
+    const auto& sim_params = op_params.simulation_parameters;
+    const auto& bdl_params = op_params.input_bdl_iterator_params;
+
+    // floating-point values are written in their shortest representation that reads back to the same value
+    key += fmt::format("|{},{},{},{}", sim_params.base, sim_params.epsilon_r, sim_params.lambda_tf,
+                       sim_params.mu_minus);
+    key += fmt::format("|{},{},{},{},{}", static_cast<int>(op_params.sim_engine),
+                       static_cast<int>(op_params.op_condition),
+                       static_cast<int>(op_params.strategy_to_analyze_operational_status),
+                       static_cast<int>(op_params.precision), op_params.early_termination);
+    key += fmt::format("|{},{},{},{}", static_cast<int>(bdl_params.input_bdl_config),
+                       bdl_params.bdl_wire_params.threshold_bdl_interdistance,
+                       bdl_params.bdl_wire_params.bdl_pairs_params.minimum_distance,
+                       bdl_params.bdl_wire_params.bdl_pairs_params.maximum_distance);
+    key += fmt::format("|{},{},{},{},{},{}", static_cast<int>(params.design_mode), position(params.canvas.first),
+                       position(params.canvas.second), params.number_of_canvas_sidbs,
+                       static_cast<int>(params.termination_cond), static_cast<int>(params.symmetry));
+
+    return key;
+}
+
+/**
+ * A content-addressed cache of SiDB gate designs. Designing a gate with `design_sidb_gates` is expensive, yet the
+ * tiles of a layout frequently share their port configuration, their Boolean function, and the atomic defects in their
+ * vicinity. Keyed by `sidb_gate_design_cache_key`, this cache stores the gate found for each such combination, or the
+ * fact that none exists, so that every distinct design problem is solved only once.
+ *
+ * By default, the cache lives in memory only. If constructed with a file path, all entries of that file are loaded, and
+ * every new entry is appended to it. This way, re-running the on-the-fly circuit design on the same or a slightly
+ * modified wafer reuses all designs of previous runs.
+ *
+ * The file stores one entry per line: the key, followed by a space and either `-` if no gate exists or the gate's rows
+ * with each cell written as the character of its type and empty cells written as `.`. Lines that do not follow this
+ * format, e.g., a line that was cut short by an interrupted run, are skipped on loading. Since the keys describe their
+ * design problems exactly, a file can be shared between builds and platforms, and a cached gate is only ever returned
+ * for the very design problem it was designed for.
+ *
+ * The cache is safe to be shared by concurrently designed gates. Identical design problems that are requested at the
+ * same time via `find_or_design` are solved only once.
+ *
+ * @tparam GateSizeX Width of the cached gates.
+ * @tparam GateSizeY Height of the cached gates.
+ */
+template <uint16_t GateSizeX, uint16_t GateSizeY>
+class sidb_gate_design_cache
+{
+  public:
+    /**
+     * Gate type stored in the cache.
+     */
+    using gate = std::array<std::array<sidb_technology::cell_type, GateSizeX>, GateSizeY>;
+    /**
+     * Standard constructor. Creates an in-memory cache.
+     */
+    sidb_gate_design_cache() = default;
+    /**
+     * Constructor. Loads all entries stored in the given file, if it exists, and appends every new entry to it.
+     *
+     * @param path File that persists the cache.
+     * @throws std::ofstream::failure If the file cannot be opened for writing.
+     */
+    explicit sidb_gate_design_cache(const std::filesystem::path& path)
+    {
+        if (std::ifstream is{path, std::ifstream::in}; is.is_open())
+        {
+            std::string line{};
+
+            while (std::getline(is, line))
+            {
+                parse_entry(line);
+            }
+        }
+
+        store.emplace(path, std::ofstream::out | std::ofstream::app);
+
+        if (!store->is_open())
+        {
+            throw std::ofstream::failure("could not open file");
+        }
+    }
+    /**
+     * Looks up the design stored under the given key.
+     *
+     * @param key Key of the design problem as computed by `sidb_gate_design_cache_key`. It must not contain line
+     * breaks.
+     * @return `std::nullopt` if the cache holds no entry for `key`. Otherwise, the stored entry, which is itself
+     * `std::nullopt` if no gate exists for `key`.
+     */
+    [[nodiscard]] std::optional<std::optional<gate>> find(const std::string& key) const
+    {
+        const std::lock_guard lock{mutex};
+
+        if (const auto it = entries.find(key); it != entries.cend())
+        {
+            return it->second;
+        }
+
+        return std::nullopt;
+    }
+    /**
+     * Stores the outcome of a design problem. If the cache is backed by a file, the entry is appended to it. An
+     * existing entry for the same key is left untouched.
+     *
+     * @param key Key of the design problem as computed by `sidb_gate_design_cache_key`. It must not contain line
+     * breaks.
+     * @param design The designed gate, or `std::nullopt` if no gate exists.
+     */
+    void insert(const std::string& key, const std::optional<gate>& design)
+    {
+        const std::lock_guard lock{mutex};
+
+        insert_entry(key, design);
+    }
+    /**
+     * Returns the design stored under the given key. If there is none, `design` is invoked to solve the design problem,
+     * and its outcome is stored. Concurrent requests of the same key are de-duplicated: while one thread designs the
+     * gate, all other threads that request the same key wait for its outcome instead of designing the gate as well.
+     *
+     * If `design` throws, the exception is passed on to all threads that requested the key, and nothing is stored.
+     *
+     * @tparam Fn Functor type with signature `std::optional<gate>()`.
+     * @param key Key of the design problem as computed by `sidb_gate_design_cache_key`. It must not contain line
+     * breaks.
+     * @param design Function that designs the gate, returning `std::nullopt` if no gate exists.
+     * @return The designed gate, or `std::nullopt` if no gate exists.
+     */
+    template <typename Fn>
+    [[nodiscard]] std::optional<gate> find_or_design(const std::string& key, Fn&& design)
+    {
+        std::unique_lock lock{mutex};
+
+        if (const auto it = entries.find(key); it != entries.cend())
+        {
+            return it->second;
+        }
+
+        if (const auto it = pending.find(key); it != pending.cend())
+        {
+            const auto outcome = it->second;
+
+            lock.unlock();
+
+            return outcome.get();
+        }
+
+        std::promise<std::optional<gate>> promise{};
+        pending.emplace(key, promise.get_future().share());
+
+        lock.unlock();
+
+        try
+        {
+            auto result = std::invoke(std::forward<Fn>(design));
+
+            lock.lock();
+            pending.erase(key);
+            insert_entry(key, result);
+            lock.unlock();
+
+            promise.set_value(result);
+
+            return result;
+        }
+        catch (...)
+        {
+            lock.lock();
+            pending.erase(key);
+            lock.unlock();
+
+            promise.set_exception(std::current_exception());
+
+            throw;
+        }
+    }
+    /**
+     * Returns the number of cached design problems.
+     *
+     * @return Number of entries in the cache.
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        const std::lock_guard lock{mutex};
+
+        return entries.size();
+    }
+
+  private:
+    /**
+     * Cached designs by their key.
+     */
+    phmap::flat_hash_map<std::string, std::optional<gate>> entries{};
+    /**
+     * Outcomes of the design problems that are currently being solved by their key.
+     */
+    phmap::flat_hash_map<std::string, std::shared_future<std::optional<gate>>> pending{};
+    /**
+     * File the new entries are appended to, if any.
+     */
+    std::optional<std::ofstream> store{};
+    /**
+     * Mutex that guards the entries, the pending designs, and the file.
+     */
+    mutable std::mutex mutex{};
+    /**
+     * Adds an entry and, if the cache is backed by a file, appends it to the file. An existing entry for the same key
+     * is left untouched. The mutex must be held by the caller.
+     *
+     * @param key Key of the design problem.
+     * @param design The designed gate, or `std::nullopt` if no gate exists.
+     */
+    void insert_entry(const std::string& key, const std::optional<gate>& design)
+    {
+        if (!entries.try_emplace(key, design).second || !store.has_value())
+        {
+            return;
+        }
+
+        *store << key << ' ';
+
+        if (design.has_value())
+        {
+            for (const auto& row : *design)
+            {
+                for (const auto c : row)
+                {
+                    *store << (c == sidb_technology::cell_type::EMPTY ? '.' : static_cast<char>(c));
+                }
+            }
+        }
+        else
+        {
+            *store << '-';
+        }
+
+        *store << '\n' << std::flush;
+    }
+    /**
+     * Parses a line of the cache file and adds its entry. Malformed lines are ignored.
+     *
+     * @param line Line to parse.
+     */
+    void parse_entry(const std::string_view line)
+    {
+        // the payload never contains a space
+        const auto separator = line.rfind(' ');
+
+        if (separator == 0 || separator == std::string_view::npos)
+        {
+            return;
+        }
+
+        const auto key = std::string{line.substr(0, separator)};
+
+        const auto payload = line.substr(separator + 1);
+
+        if (payload == "-")
+        {
+            entries.try_emplace(key, std::nullopt);
+            return;
+        }
+
+        if (payload.size() != static_cast<std::size_t>(GateSizeX) * GateSizeY)
+        {
+            return;
+        }
+
+        gate design{};
+
+        for (std::size_t y = 0; y < GateSizeY; ++y)
+        {
+            for (std::size_t x = 0; x < GateSizeX; ++x)
+            {
+                const auto c = payload[y * GateSizeX + x];
+
+                if (c == '.')
+                {
+                    design[y][x] = sidb_technology::cell_type::EMPTY;
+                }
+                else if (std::string_view{"xiol"}.find(c) != std::string_view::npos)
+                {
+                    design[y][x] = static_cast<sidb_technology::cell_type>(c);
+                }
+                else
+                {
+                    return;
+                }
+            }
+        }
+
+        entries.try_emplace(key, design);
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_SIDB_GATE_DESIGN_CACHE_HPP
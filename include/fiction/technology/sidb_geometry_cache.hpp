@@ -0,0 +1,292 @@
+//
+// Created by Jan Drewniok on 17.10.26.
+//
+
+#ifndef FICTION_SIDB_GEOMETRY_CACHE_HPP
+#define FICTION_SIDB_GEOMETRY_CACHE_HPP
+
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
+#include "fiction/technology/constants.hpp"
+#include "fiction/technology/sidb_nm_distance.hpp"
+#include "fiction/traits.hpp"
+#include "fiction/utils/aligned_matrix.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Caches the geometry-dependent part of the electrostatic interaction between the SiDBs of a layout. The chargeless
+ * potential between two SiDBs at distance \f$d\f$ is given by \f$\frac{k}{d} \cdot e^{-d / \lambda_{TF}} \cdot e\f$,
+ * where \f$k\f$ is the Coulomb constant divided by \f$\epsilon_r\f$. The distances never change for a given layout and
+ * the unscreened term \f$\frac{k}{d}\f$ only depends on \f$\epsilon_r\f$. This cache computes the distance matrix once
+ * on construction and memoizes the unscreened and the screened potential matrices of the most recently requested
+ * physical parameters, so that a change of \f$\lambda_{TF}\f$ only requires to recompute the exponential screening
+ * factor.
+ *
+ * A `charge_distribution_surface` that is constructed with a geometry cache copies its distance and potential matrices
+ * from the cache instead of computing them from scratch. This pays off whenever the same layout is simulated under many
+ * physical parameters, e.g., in the operational domain computation.
+ *
+ * The cache is safe to be shared by concurrently running simulations.
+ *
+ * @note The cache has to be constructed from a layout of the same lattice type as the charge distribution surfaces that
+ * use it. They may, however, contain only a subset of the cached SiDBs.
+ *
+ * @tparam CellType Cell type.
+ */
+template <typename CellType>
+class sidb_geometry_cache
+{
+  public:
+    /**
+     * Matrix type of the cached distances and potentials.
+     */
+    using matrix = aligned_square_matrix<double>;
+    /**
+     * Standard constructor. Determines the SiDB order and computes the distance matrix of the given layout.
+     *
+     * @tparam Lyt SiDB cell-level layout type.
+     * @param lyt Layout whose geometry is cached.
+     */
+    template <typename Lyt>
+    explicit sidb_geometry_cache(const Lyt& lyt)
+    {
+        static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+        static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+        static_assert(std::is_same_v<cell<Lyt>, CellType>, "Lyt has a different cell type");
+
+        sidb_order.reserve(lyt.num_cells());
+        lyt.foreach_cell([this](const auto& c) { sidb_order.push_back(c); });
+        std::ranges::sort(sidb_order);
+
+        nm_dist_mat = matrix(sidb_order.size(), 0.0);
+
+        for (uint64_t i = 0u; i < sidb_order.size(); ++i)
+        {
+            for (uint64_t j = i + 1; j < sidb_order.size(); ++j)
+            {
+                const auto distance = sidb_nm_distance<Lyt>(lyt, sidb_order[i], sidb_order[j]);
+
+                nm_dist_mat(i, j) = distance;
+                nm_dist_mat(j, i) = distance;
+            }
+        }
+    }
+    /**
+     * Returns the number of cached SiDBs.
+     *
+     * @return Number of SiDBs.
+     */
+    [[nodiscard]] std::size_t num_sidbs() const noexcept
+    {
+        return sidb_order.size();
+    }
+    /**
+     * Returns the cached SiDBs in the order that is used for the matrix indices.
+     *
+     * @return Sorted vector of all cached SiDBs.
+     */
+    [[nodiscard]] const std::vector<CellType>& get_sidb_order() const noexcept
+    {
+        return sidb_order;
+    }
+    /**
+     * Returns the matrix index of the given SiDB.
+     *
+     * @param c SiDB cell.
+     * @return Index of `c` in the cached matrices, or `std::nullopt` if `c` is not cached.
+     */
+    [[nodiscard]] std::optional<uint64_t> index_of(const CellType& c) const noexcept
+    {
+        if (const auto it = std::ranges::lower_bound(sidb_order, c); it != sidb_order.cend() && *it == c)
+        {
+            return static_cast<uint64_t>(std::distance(sidb_order.cbegin(), it));
+        }
+
+        return std::nullopt;
+    }
+    /**
+     * Returns the distance matrix (unit: nm).
+     *
+     * @return Matrix of the distances between all cached SiDBs.
+     */
+    [[nodiscard]] const matrix& get_nm_distance_matrix() const noexcept
+    {
+        return nm_dist_mat;
+    }
+    /**
+     * Returns the chargeless potential matrix for the given physical parameters (unit: V). If the parameters match one
+     * of the recently requested ones, the memoized matrix is returned. Otherwise, the unscreened potentials are reused
+     * if \f$\epsilon_r\f$ is unchanged and only the screening is recomputed. The entries are bit-identical to the ones
+     * computed by `charge_distribution_surface`.
+     *
+     * @param params Physical parameters that determine \f$\epsilon_r\f$ and \f$\lambda_{TF}\f$.
+     * @return Shared pointer to the chargeless potential matrix.
+     */
+    [[nodiscard]] std::shared_ptr<const matrix>
+    get_potential_matrix(const sidb_simulation_parameters& params) const noexcept
+    {
+        std::shared_ptr<const matrix> unscreened{};
+
+        {
+            const std::lock_guard lock{memo_mutex};
+
+            for (const auto& entry : memo)
+            {
+                if (entry.epsilon_r == params.epsilon_r)
+                {
+                    if (entry.lambda_tf == params.lambda_tf)
+                    {
+                        return entry.potentials;
+                    }
+
+                    unscreened = entry.unscreened;
+                }
+            }
+        }
+
+        // the potentials are computed outside the lock such that concurrent requests for different parameters do not
+        // serialize
+        if (unscreened == nullptr)
+        {
+            unscreened = compute_unscreened_potential_matrix(params);
+        }
+
+        auto potentials = compute_screened_potential_matrix(*unscreened, params);
+
+        {
+            const std::lock_guard lock{memo_mutex};
+
+            if (memo.size() < MEMO_CAPACITY)
+            {
+                memo.push_back({params.epsilon_r, params.lambda_tf, unscreened, potentials});
+            }
+            else
+            {
+                memo[next_memo_slot] = {params.epsilon_r, params.lambda_tf, unscreened, potentials};
+                next_memo_slot       = (next_memo_slot + 1) % MEMO_CAPACITY;
+            }
+        }
+
+        return potentials;
+    }
+
+  private:
+    /**
+     * Number of parameter combinations whose potential matrices are memoized. A few slots are kept such that
+     * concurrently evaluated parameter points do not evict each other's matrices right away.
+     */
+    static constexpr std::size_t MEMO_CAPACITY = 8;
+    /**
+     * Memoized potential matrices of a combination of physical parameters.
+     */
+    struct memo_entry
+    {
+        /**
+         * Relative permittivity the matrices refer to.
+         */
+        double epsilon_r;
+        /**
+         * Thomas-Fermi screening distance the screened matrix refers to (unit: nm).
+         */
+        double lambda_tf;
+        /**
+         * Unscreened chargeless potentials, i.e., \f$\frac{k}{d}\f$ (unit: V/C).
+         */
+        std::shared_ptr<const matrix> unscreened;
+        /**
+         * Screened chargeless potentials (unit: V).
+         */
+        std::shared_ptr<const matrix> potentials;
+    };
+    /**
+     * All cached SiDBs in sorted order.
+     */
+    std::vector<CellType> sidb_order{};
+    /**
+     * Distances between all cached SiDBs (unit: nm).
+     */
+    matrix nm_dist_mat{};
+    /**
+     * Guards the memoized potential matrices.
+     */
+    mutable std::mutex memo_mutex{};
+    /**
+     * Memoized potential matrices.
+     */
+    mutable std::vector<memo_entry> memo{};
+    /**
+     * Slot that is overwritten next once the memo is full.
+     */
+    mutable std::size_t next_memo_slot{0};
+    /**
+     * Computes the unscreened potentials \f$\frac{k}{d}\f$ between all cached SiDBs.
+     *
+     * @param params Physical parameters that determine \f$\epsilon_r\f$.
+     * @return Unscreened potential matrix.
+     */
+    [[nodiscard]] std::shared_ptr<const matrix>
+    compute_unscreened_potential_matrix(const sidb_simulation_parameters& params) const noexcept
+    {
+        auto unscreened = std::make_shared<matrix>(sidb_order.size(), 0.0);
+
+        for (uint64_t i = 0u; i < sidb_order.size(); ++i)
+        {
+            for (uint64_t j = i + 1; j < sidb_order.size(); ++j)
+            {
+                const auto nm_distance = nm_dist_mat(i, j);
+
+                const auto potential = nm_distance == 0.0 ? 0.0 : params.k() / (nm_distance * 1E-9);
+
+                (*unscreened)(i, j) = potential;
+                (*unscreened)(j, i) = potential;
+            }
+        }
+
+        return unscreened;
+    }
+    /**
+     * Applies the Thomas-Fermi screening to the given unscreened potentials.
+     *
+     * @param unscreened Unscreened potential matrix.
+     * @param params Physical parameters that determine \f$\lambda_{TF}\f$.
+     * @return Screened chargeless potential matrix.
+     */
+    [[nodiscard]] std::shared_ptr<const matrix>
+    compute_screened_potential_matrix(const matrix& unscreened, const sidb_simulation_parameters& params) const noexcept
+    {
+        assert(params.lambda_tf > 0.0 && "lambda_tf has to be > 0.0");
+
+        auto potentials = std::make_shared<matrix>(sidb_order.size(), 0.0);
+
+        for (uint64_t i = 0u; i < sidb_order.size(); ++i)
+        {
+            for (uint64_t j = i + 1; j < sidb_order.size(); ++j)
+            {
+                const auto potential = unscreened(i, j) * std::exp(-nm_dist_mat(i, j) / params.lambda_tf) *
+                                       constants::physical::ELEMENTARY_CHARGE;
+
+                (*potentials)(i, j) = potential;
+                (*potentials)(j, i) = potential;
+            }
+        }
+
+        return potentials;
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_SIDB_GEOMETRY_CACHE_HPP
@@ -12,6 +12,7 @@
 #include "fiction/technology/cell_technologies.hpp"
 #include "fiction/technology/fcn_gate_library.hpp"
 #include "fiction/technology/is_sidb_gate_design_impossible.hpp"
+#include "fiction/technology/sidb_gate_design_cache.hpp"
 #include "fiction/technology/sidb_nm_distance.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/types.hpp"
@@ -23,9 +24,11 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <exception>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <utility>
@@ -137,6 +140,19 @@ struct sidb_on_the_fly_gate_library_params
      * incorporated into the gate design.
      */
     double influence_radius_charged_defects = 15;  // (unit: nm)
+    /**
+     * Optional cache of gate designs. If set, each design problem is looked up in the cache before `design_sidb_gates`
+     * is invoked, and its outcome is stored afterward. Sharing a cache across tiles, layouts, or runs avoids designing
+     * the same gate repeatedly.
+     */
+    std::shared_ptr<sidb_gate_design_cache<60, 46>> design_cache{};  // width and height of a hexagon
+    /**
+     * Number of tiles that are designed concurrently when the library is applied to a gate-level layout. With more
+     * than one thread, identical design problems of different tiles are only solved once, and the first tile that
+     * cannot be designed cancels all tiles that have not been started yet. Defaults to `1`, i.e., the tiles are
+     * designed one after another.
+     */
+    std::size_t number_of_threads{1};
 };
 
 /**
@@ -677,7 +693,8 @@ class sidb_on_the_fly_gate_library : public fcn_gate_library<sidb_technology, 60
      * This function designs an SiDB gate for a given Boolean function at a given tile and a given rotation. If atomic
      * defects exist, they are incorporated into the design process.
      *
-     * An exception is thrown in case there is no possible gate design.
+     * An exception is thrown in case there is no possible gate design. If a design cache is given in `parameters`, it
+     * is consulted first, and the outcome of a new design process, including its failure, is stored in it.
      *
      * @tparam LytSkeleton The cell-level layout of the skeleton.
      * @tparam TT Truth table type.
@@ -702,13 +719,17 @@ class sidb_on_the_fly_gate_library : public fcn_gate_library<sidb_technology, 60
         const auto params = is_sidb_gate_design_impossible_params{
             parameters.design_gate_params.operational_params.simulation_parameters};
 
-        if (spec == create_crossing_wire_tt() || spec == create_double_wire_tt())
+        // the exception of complex gates reports the identity since their specification has multiple outputs
+        const auto error_spec =
+            (spec == create_crossing_wire_tt() || spec == create_double_wire_tt()) ? create_id_tt() : spec.front();
+
+        const auto design_new_gate = [&]() -> std::optional<fcn_gate>
         {
             if constexpr (is_sidb_defect_surface_v<LytSkeleton>)
             {
                 if (is_sidb_gate_design_impossible(skeleton, spec, params))
                 {
-                    throw gate_design_exception<tt, GateLyt>(tile, create_id_tt(), p);
+                    return std::nullopt;
                 }
             }
 
@@ -716,28 +737,24 @@ class sidb_on_the_fly_gate_library : public fcn_gate_library<sidb_technology, 60
 
             if (found_gate_layouts.empty())
             {
-                throw gate_design_exception<tt, GateLyt>(tile, create_id_tt(), p);
+                return std::nullopt;
             }
 
             return cell_list_to_gate<char>(cell_level_layout_to_list(found_gate_layouts.front()));
-        }
-
-        if constexpr (is_sidb_defect_surface_v<LytSkeleton>)
-        {
-            if (is_sidb_gate_design_impossible(skeleton, spec, params))
-            {
-                throw gate_design_exception<tt, GateLyt>(tile, spec.front(), p);
-            }
-        }
+        };
 
-        const auto found_gate_layouts = design_sidb_gates(skeleton, spec, parameters.design_gate_params);
+        const auto design =
+            parameters.design_cache != nullptr ?
+                parameters.design_cache->find_or_design(
+                    sidb_gate_design_cache_key(skeleton, spec, parameters.design_gate_params), design_new_gate) :
+                design_new_gate();
 
-        if (found_gate_layouts.empty())
+        if (!design.has_value())
         {
-            throw gate_design_exception<tt, GateLyt>(tile, spec.front(), p);
+            throw gate_design_exception<tt, GateLyt>(tile, error_spec, p);
         }
 
-        return cell_list_to_gate<char>(cell_level_layout_to_list(found_gate_layouts.front()));
+        return design.value();
     }
     /**
      * The function generates a layout where each cell is assigned a specific
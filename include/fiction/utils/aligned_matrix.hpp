@@ -0,0 +1,191 @@
+//
+// Created by Jan Drewniok on 17.10.26.
+//
+
+#ifndef FICTION_ALIGNED_MATRIX_HPP
+#define FICTION_ALIGNED_MATRIX_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * A minimal allocator that returns memory aligned to `Alignment` bytes. It is used to let rows of matrices start at
+ * cache line boundaries.
+ *
+ * @tparam T Value type.
+ * @tparam Alignment Alignment in bytes. Must be a power of two.
+ */
+template <typename T, std::size_t Alignment>
+class aligned_allocator
+{
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+    static_assert(Alignment >= alignof(T), "Alignment must not be smaller than the natural alignment of T");
+
+  public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = aligned_allocator<U, Alignment>;
+    };
+
+    aligned_allocator() noexcept = default;
+
+    template <typename U>
+    aligned_allocator(const aligned_allocator<U, Alignment>& /*other*/) noexcept  // NOLINT(*-explicit-constructor)
+    {}
+
+    [[nodiscard]] T* allocate(const std::size_t n)
+    {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    void deallocate(T* p, const std::size_t /*n*/) noexcept
+    {
+        ::operator delete(p, std::align_val_t{Alignment});
+    }
+
+    template <typename U>
+    [[nodiscard]] bool operator==(const aligned_allocator<U, Alignment>& /*other*/) const noexcept
+    {
+        return true;
+    }
+};
+/**
+ * A dense square matrix stored in a single contiguous buffer in row-major order. Each row is padded such that all rows
+ * start at a cache line boundary, which allows streaming over rows without chasing a separate heap allocation per row
+ * and lets vectorized kernels operate on whole rows.
+ *
+ * @tparam T Value type.
+ */
+template <typename T>
+class aligned_square_matrix
+{
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+  public:
+    /**
+     * Alignment of each row in bytes (i.e., the size of a cache line on common architectures).
+     */
+    static constexpr std::size_t ALIGNMENT = 64;
+    /**
+     * Default constructor. Creates an empty matrix.
+     */
+    aligned_square_matrix() noexcept = default;
+    /**
+     * Standard constructor. Creates an `n x n` matrix with all entries set to `value`.
+     *
+     * @param n Number of rows and columns.
+     * @param value Initial value of all entries.
+     */
+    explicit aligned_square_matrix(const std::size_t n, const T value = T{}) :
+            dimension{n},
+            row_stride{padded_row_length(n)},
+            entries(n * padded_row_length(n), value)
+    {}
+    /**
+     * Returns the number of rows (and columns) of the matrix.
+     *
+     * @return Dimension of the matrix.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return dimension;
+    }
+    /**
+     * Checks whether the matrix is empty.
+     *
+     * @return `true` iff the matrix has no entries.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return dimension == 0;
+    }
+    /**
+     * Returns the entry in row `i` and column `j`.
+     *
+     * @param i Row index.
+     * @param j Column index.
+     * @return Reference to the entry.
+     */
+    [[nodiscard]] T& operator()(const std::size_t i, const std::size_t j) noexcept
+    {
+        assert(i < dimension && j < dimension && "matrix index out of range");
+
+        return entries[i * row_stride + j];
+    }
+    /**
+     * Returns the entry in row `i` and column `j`.
+     *
+     * @param i Row index.
+     * @param j Column index.
+     * @return Const reference to the entry.
+     */
+    [[nodiscard]] const T& operator()(const std::size_t i, const std::size_t j) const noexcept
+    {
+        assert(i < dimension && j < dimension && "matrix index out of range");
+
+        return entries[i * row_stride + j];
+    }
+    /**
+     * Returns a pointer to the first entry of row `i`. The following `size()` entries are the row's entries.
+     *
+     * @param i Row index.
+     * @return Pointer to the first entry of row `i`.
+     */
+    [[nodiscard]] T* row(const std::size_t i) noexcept
+    {
+        assert(i < dimension && "matrix index out of range");
+
+        return entries.data() + i * row_stride;
+    }
+    /**
+     * Returns a pointer to the first entry of row `i`. The following `size()` entries are the row's entries.
+     *
+     * @param i Row index.
+     * @return Const pointer to the first entry of row `i`.
+     */
+    [[nodiscard]] const T* row(const std::size_t i) const noexcept
+    {
+        assert(i < dimension && "matrix index out of range");
+
+        return entries.data() + i * row_stride;
+    }
+
+  private:
+    /**
+     * Number of rows and columns.
+     */
+    std::size_t dimension{0};
+    /**
+     * Number of entries between the beginnings of two consecutive rows.
+     */
+    std::size_t row_stride{0};
+    /**
+     * All entries in row-major order including the padding at the end of each row.
+     */
+    std::vector<T, aligned_allocator<T, ALIGNMENT>> entries{};
+    /**
+     * Rounds the given row length up to the next multiple of entries that fills a whole number of cache lines.
+     *
+     * @param n Row length.
+     * @return Padded row length.
+     */
+    [[nodiscard]] static constexpr std::size_t padded_row_length(const std::size_t n) noexcept
+    {
+        constexpr std::size_t entries_per_line = ALIGNMENT / sizeof(T) > 0 ? ALIGNMENT / sizeof(T) : 1;
+
+        return ((n + entries_per_line - 1) / entries_per_line) * entries_per_line;
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_ALIGNED_MATRIX_HPP
@@ -7,8 +7,12 @@
 
 #include "fiction/utils/math_utils.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <numeric>
+#include <random>
+#include <unordered_set>
 #include <vector>
 
 #include <combinations.h>
@@ -66,6 +70,110 @@ determine_all_combinations_of_distributing_k_entities_on_n_positions(const std::
 
     return all_combinations;
 }
+/**
+ * This function determines the combination of distributing k entities onto n positions that has the given rank in the
+ * lexicographic order of `determine_all_combinations_of_distributing_k_entities_on_n_positions`, without generating
+ * any of the other combinations. Since there are `binomial_coefficient(n, k)` combinations, this allows enumerating or
+ * sampling them in memory that does not depend on their number, e.g., by distributing their ranks over threads.
+ *
+ * @param rank The rank of the combination. Must be smaller than `binomial_coefficient(n, k)`.
+ * @param k The number of entities to distribute.
+ * @param n The number of positions available for distribution.
+ * @return The ascending positions of the k entities in the combination with the given rank.
+ */
+[[nodiscard]] inline std::vector<std::size_t>
+unrank_combination_of_distributing_k_entities_on_n_positions(uint64_t rank, const std::size_t k,
+                                                             const std::size_t n) noexcept
+{
+    std::vector<std::size_t> combination{};
+    combination.reserve(k);
+
+    std::size_t position = 0;
+
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        // skip the combinations whose i-th entity is on the current position as long as the rank lies beyond them
+        while (rank >= binomial_coefficient(n - position - 1, k - i - 1))
+        {
+            rank -= binomial_coefficient(n - position - 1, k - i - 1);
+            ++position;
+        }
+
+        combination.push_back(position++);
+    }
+
+    return combination;
+}
+/**
+ * This function advances a combination of distributing k entities onto n positions to its successor in the
+ * lexicographic order of `determine_all_combinations_of_distributing_k_entities_on_n_positions`. Together with
+ * `unrank_combination_of_distributing_k_entities_on_n_positions`, it allows a contiguous range of ranks to be
+ * enumerated in a single buffer.
+ *
+ * @param combination The ascending positions of the k entities, which are replaced by those of the successor.
+ * @param n The number of positions available for distribution.
+ * @return `true` if `combination` had a successor, `false` if it was the last combination. In the latter case,
+ * `combination` is left unchanged.
+ */
+inline bool next_combination_of_distributing_k_entities_on_n_positions(std::vector<std::size_t>& combination,
+                                                                       const std::size_t         n) noexcept
+{
+    const auto k = combination.size();
+
+    // find the rightmost entity that can still be moved one position further
+    for (auto i = k; i > 0; --i)
+    {
+        if (combination[i - 1] < n - k + i - 1)
+        {
+            ++combination[i - 1];
+
+            // the subsequent entities follow directly after it
+            for (auto j = i; j < k; ++j)
+            {
+                combination[j] = combination[j - 1] + 1;
+            }
+
+            return true;
+        }
+    }
+
+    return false;
+}
+/**
+ * This function draws distinct ranks uniformly at random from the interval [0, `num_ranks`) via Robert Floyd's
+ * sampling algorithm. Its memory scales with the number of drawn ranks instead of `num_ranks`, which makes it suitable
+ * to sample from combinations that are too many to be generated, in conjunction with an unranking function such as
+ * `unrank_combination_of_distributing_k_entities_on_n_positions` or `unrank_cartesian_combination`.
+ *
+ * @tparam Generator Uniform random bit generator type.
+ * @param num_ranks The number of ranks to draw from.
+ * @param num_samples The number of ranks to draw. At most `num_ranks` ranks are drawn.
+ * @param generator The random number generator.
+ * @return The drawn ranks in ascending order.
+ */
+template <typename Generator>
+[[nodiscard]] std::vector<uint64_t> sample_distinct_ranks(const uint64_t num_ranks, uint64_t num_samples,
+                                                          Generator& generator) noexcept
+{
+    num_samples = std::min(num_samples, num_ranks);
+
+    std::unordered_set<uint64_t> drawn_ranks{};
+    drawn_ranks.reserve(num_samples);
+
+    for (auto j = num_ranks - num_samples; j < num_ranks; ++j)
+    {
+        // if rank t was drawn before, j is drawn instead, which has not been a candidate so far
+        if (const auto t = std::uniform_int_distribution<uint64_t>{0, j}(generator); !drawn_ranks.insert(t).second)
+        {
+            drawn_ranks.insert(j);
+        }
+    }
+
+    std::vector<uint64_t> ranks(drawn_ranks.cbegin(), drawn_ranks.cend());
+    std::ranges::sort(ranks);
+
+    return ranks;
+}
 
 }  // namespace fiction
 
@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <limits>
 #include <stdexcept>
 #include <type_traits>
 #include <vector>
@@ -116,6 +117,58 @@ cartesian_combinations(const std::vector<std::vector<VectorDataType>>& sets) noe
     return all_combinations;  // Return the final list of combinations
 }
 
+/**
+ * This function counts the combinations that `cartesian_combinations` generates for the given sets, without generating
+ * them.
+ *
+ * @tparam VectorDataType The type of elements in the vectors.
+ * @param sets The sets whose Cartesian product is counted.
+ * @return The product of the sizes of the sets. Saturates at the maximum value of `uint64_t`.
+ */
+template <typename VectorDataType>
+[[nodiscard]] inline uint64_t
+number_of_cartesian_combinations(const std::vector<std::vector<VectorDataType>>& sets) noexcept
+{
+    uint64_t num_combinations = 1;
+
+    for (const auto& dimension : sets)
+    {
+        if (dimension.empty())
+        {
+            return 0;
+        }
+
+        num_combinations = num_combinations > std::numeric_limits<uint64_t>::max() / dimension.size() ?
+                               std::numeric_limits<uint64_t>::max() :
+                               num_combinations * dimension.size();
+    }
+
+    return num_combinations;
+}
+/**
+ * This function determines the combination with the given rank in the order of `cartesian_combinations`, in which the
+ * last dimension varies fastest, without generating any of the other combinations. Thereby, the combinations can be
+ * enumerated or sampled in memory that does not depend on their number.
+ *
+ * @tparam VectorDataType The type of elements in the vectors.
+ * @param sets The sets of the Cartesian product. None of them may be empty.
+ * @param rank The rank of the combination. Must be smaller than `number_of_cartesian_combinations(sets)`.
+ * @return The combination with the given rank, consisting of one element from each dimension.
+ */
+template <typename VectorDataType>
+[[nodiscard]] inline std::vector<VectorDataType>
+unrank_cartesian_combination(const std::vector<std::vector<VectorDataType>>& sets, uint64_t rank) noexcept
+{
+    std::vector<VectorDataType> combination(sets.size());
+
+    for (auto d = sets.size(); d-- > 0;)
+    {
+        combination[d] = sets[d][rank % sets[d].size()];
+        rank /= sets[d].size();
+    }
+
+    return combination;
+}
 /**
  * Calculates the cost function \f$ \chi = \sum_{i=1} w_{i} \cdot \chi_{i} \f$ by summing the product of normalized chi
  * values \f$ \chi_{i} \f$ and weights \f$ w_{i} \f$.
@@ -0,0 +1,308 @@
+//
+// Created by Jan Drewniok on 17.10.26.
+//
+
+#ifndef FICTION_SIMD_UTILS_HPP
+#define FICTION_SIMD_UTILS_HPP
+
+// select the widest vector instruction set that the compiler is allowed to emit for the target (e.g., via
+// `-march=native`); no runtime dispatch is performed, i.e., the default build uses the scalar kernels
+#if defined(__AVX512F__)
+
+#include <immintrin.h>
+
+/**
+ * Defined if the vectorized kernels use AVX-512 instructions.
+ */
+#define FICTION_SIMD_AVX512
+
+#elif defined(__AVX2__) && defined(__FMA__)
+
+#include <immintrin.h>
+
+/**
+ * Defined if the vectorized kernels use AVX2 instructions.
+ */
+#define FICTION_SIMD_AVX2
+
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+namespace fiction
+{
+
+/**
+ * Computes the dot product \f$\sum_{i=0}^{n-1} x_i \cdot y_i\f$ of two arrays of doubles.
+ *
+ * @note If the target supports AVX2 or AVX-512, the sum is accumulated in several lanes, which changes the rounding
+ * compared to the sequential scalar fallback within the limits of floating-point associativity.
+ *
+ * @param x Pointer to the first array.
+ * @param y Pointer to the second array.
+ * @param n Number of elements.
+ * @return The dot product of `x` and `y`.
+ */
+[[nodiscard]] inline double dot_product(const double* x, const double* y, const std::size_t n) noexcept
+{
+    std::size_t i   = 0;
+    double      sum = 0.0;
+
+#if defined(FICTION_SIMD_AVX512)
+    __m512d acc = _mm512_setzero_pd();
+
+    for (; i + 8 <= n; i += 8)
+    {
+        acc = _mm512_fmadd_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i), acc);
+    }
+
+    sum = _mm512_reduce_add_pd(acc);
+#elif defined(FICTION_SIMD_AVX2)
+    __m256d acc = _mm256_setzero_pd();
+
+    for (; i + 4 <= n; i += 4)
+    {
+        acc = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i), acc);
+    }
+
+    const __m128d low  = _mm256_castpd256_pd128(acc);
+    const __m128d high = _mm256_extractf128_pd(acc, 1);
+    const __m128d pair = _mm_add_pd(low, high);
+
+    sum = _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+#endif
+
+    // scalar fallback and remainder
+    for (; i < n; ++i)
+    {
+        sum += x[i] * y[i];
+    }
+
+    return sum;
+}
+/**
+ * Computes the dot product \f$\sum_{i=0}^{n-1} x_i \cdot y_i\f$ of an array of floats and an array of doubles. The
+ * entries of `x` are widened to double precision before they are multiplied, i.e., only the storage of `x` is in single
+ * precision while the accumulation is carried out in double precision.
+ *
+ * @param x Pointer to the single-precision array.
+ * @param y Pointer to the double-precision array.
+ * @param n Number of elements.
+ * @return The dot product of `x` and `y`.
+ */
+[[nodiscard]] inline double dot_product(const float* x, const double* y, const std::size_t n) noexcept
+{
+    std::size_t i   = 0;
+    double      sum = 0.0;
+
+#if defined(FICTION_SIMD_AVX512)
+    __m512d acc = _mm512_setzero_pd();
+
+    for (; i + 8 <= n; i += 8)
+    {
+        acc = _mm512_fmadd_pd(_mm512_cvtps_pd(_mm256_loadu_ps(x + i)), _mm512_loadu_pd(y + i), acc);
+    }
+
+    sum = _mm512_reduce_add_pd(acc);
+#elif defined(FICTION_SIMD_AVX2)
+    __m256d acc = _mm256_setzero_pd();
+
+    for (; i + 4 <= n; i += 4)
+    {
+        acc = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(x + i)), _mm256_loadu_pd(y + i), acc);
+    }
+
+    const __m128d low  = _mm256_castpd256_pd128(acc);
+    const __m128d high = _mm256_extractf128_pd(acc, 1);
+    const __m128d pair = _mm_add_pd(low, high);
+
+    sum = _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+#endif
+
+    // scalar fallback and remainder
+    for (; i < n; ++i)
+    {
+        sum += static_cast<double>(x[i]) * y[i];
+    }
+
+    return sum;
+}
+/**
+ * Adds a scaled array to another one, i.e., \f$y_i \leftarrow y_i + a \cdot x_i\f$ for all \f$0 \leq i < n\f$.
+ *
+ * @param y Pointer to the array that is updated.
+ * @param x Pointer to the array that is scaled and added.
+ * @param a Scaling factor.
+ * @param n Number of elements.
+ */
+inline void scaled_addition(double* y, const double* x, const double a, const std::size_t n) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(FICTION_SIMD_AVX512)
+    const __m512d factor = _mm512_set1_pd(a);
+
+    for (; i + 8 <= n; i += 8)
+    {
+        _mm512_storeu_pd(y + i, _mm512_fmadd_pd(_mm512_loadu_pd(x + i), factor, _mm512_loadu_pd(y + i)));
+    }
+#elif defined(FICTION_SIMD_AVX2)
+    const __m256d factor = _mm256_set1_pd(a);
+
+    for (; i + 4 <= n; i += 4)
+    {
+        _mm256_storeu_pd(y + i, _mm256_fmadd_pd(_mm256_loadu_pd(x + i), factor, _mm256_loadu_pd(y + i)));
+    }
+#endif
+
+    // scalar fallback and remainder
+    for (; i < n; ++i)
+    {
+        y[i] += x[i] * a;
+    }
+}
+
+/**
+ * Adds a scaled single-precision array to a double-precision one, i.e., \f$y_i \leftarrow y_i + a \cdot x_i\f$ for all
+ * \f$0 \leq i < n\f$. The entries of `x` are widened to double precision before they are scaled.
+ *
+ * @param y Pointer to the double-precision array that is updated.
+ * @param x Pointer to the single-precision array that is scaled and added.
+ * @param a Scaling factor.
+ * @param n Number of elements.
+ */
+inline void scaled_addition(double* y, const float* x, const double a, const std::size_t n) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(FICTION_SIMD_AVX512)
+    const __m512d factor = _mm512_set1_pd(a);
+
+    for (; i + 8 <= n; i += 8)
+    {
+        _mm512_storeu_pd(y + i,
+                         _mm512_fmadd_pd(_mm512_cvtps_pd(_mm256_loadu_ps(x + i)), factor, _mm512_loadu_pd(y + i)));
+    }
+#elif defined(FICTION_SIMD_AVX2)
+    const __m256d factor = _mm256_set1_pd(a);
+
+    for (; i + 4 <= n; i += 4)
+    {
+        _mm256_storeu_pd(y + i, _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(x + i)), factor, _mm256_loadu_pd(y + i)));
+    }
+#endif
+
+    // scalar fallback and remainder
+    for (; i < n; ++i)
+    {
+        y[i] += static_cast<double>(x[i]) * a;
+    }
+}
+
+/**
+ * Determines the minimum absolute difference \f$\min_{0 \leq i < n} |x_i - r|\f$ between the elements of an array
+ * and a reference value \f$r\f$, as well as the first index at which it is attained.
+ *
+ * @note If the target supports AVX2 or AVX-512, each lane keeps the first index at which its own minimum is attained,
+ * and ties between lanes are resolved in favor of the smaller index. Therefore, the result is identical to the scalar
+ * fallback.
+ *
+ * @param x Pointer to the array.
+ * @param n Number of elements. Must be smaller than \f$2^{53}\f$, such that each index is exactly representable as a
+ * double.
+ * @param reference Reference value.
+ * @return The minimum absolute difference and its first index, or infinity and `n` if the array is empty.
+ */
+[[nodiscard]] inline std::pair<double, std::size_t> minimum_absolute_difference(const double* x, const std::size_t n,
+                                                                                const double reference) noexcept
+{
+    std::size_t i = 0;
+
+    auto minimum       = std::numeric_limits<double>::infinity();
+    auto minimum_index = n;
+
+#if defined(FICTION_SIMD_AVX512) || defined(FICTION_SIMD_AVX2)
+#if defined(FICTION_SIMD_AVX512)
+    constexpr std::size_t width = 8;
+
+    const __m512d ref   = _mm512_set1_pd(reference);
+    const __m512d step  = _mm512_set1_pd(static_cast<double>(width));
+    __m512d       index = _mm512_setr_pd(0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0);
+    __m512d       best  = _mm512_set1_pd(std::numeric_limits<double>::infinity());
+    __m512d       arg   = _mm512_setzero_pd();
+
+    for (; i + width <= n; i += width)
+    {
+        const __m512d  difference = _mm512_abs_pd(_mm512_sub_pd(_mm512_loadu_pd(x + i), ref));
+        const __mmask8 smaller    = _mm512_cmp_pd_mask(difference, best, _CMP_LT_OQ);
+
+        best  = _mm512_mask_blend_pd(smaller, best, difference);
+        arg   = _mm512_mask_blend_pd(smaller, arg, index);
+        index = _mm512_add_pd(index, step);
+    }
+
+    alignas(64) double lane_minima[width];
+    alignas(64) double lane_indices[width];
+
+    _mm512_store_pd(lane_minima, best);
+    _mm512_store_pd(lane_indices, arg);
+#else
+    constexpr std::size_t width = 4;
+
+    const __m256d ref       = _mm256_set1_pd(reference);
+    const __m256d sign_mask = _mm256_set1_pd(-0.0);
+    const __m256d step      = _mm256_set1_pd(static_cast<double>(width));
+    __m256d       index     = _mm256_setr_pd(0.0, 1.0, 2.0, 3.0);
+    __m256d       best      = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+    __m256d       arg       = _mm256_setzero_pd();
+
+    for (; i + width <= n; i += width)
+    {
+        const __m256d difference = _mm256_andnot_pd(sign_mask, _mm256_sub_pd(_mm256_loadu_pd(x + i), ref));
+        const __m256d smaller    = _mm256_cmp_pd(difference, best, _CMP_LT_OQ);
+
+        best  = _mm256_blendv_pd(best, difference, smaller);
+        arg   = _mm256_blendv_pd(arg, index, smaller);
+        index = _mm256_add_pd(index, step);
+    }
+
+    alignas(32) double lane_minima[width];
+    alignas(32) double lane_indices[width];
+
+    _mm256_store_pd(lane_minima, best);
+    _mm256_store_pd(lane_indices, arg);
+#endif
+
+    // lanes that never found a finite difference do not hold a valid index
+    for (std::size_t lane = 0; lane < width; ++lane)
+    {
+        const auto lane_index = static_cast<std::size_t>(lane_indices[lane]);
+
+        if (lane_minima[lane] < minimum ||
+            (lane_minima[lane] == minimum && std::isfinite(minimum) && lane_index < minimum_index))
+        {
+            minimum       = lane_minima[lane];
+            minimum_index = lane_index;
+        }
+    }
+#endif
+
+    // scalar fallback and remainder
+    for (; i < n; ++i)
+    {
+        if (const auto difference = std::abs(x[i] - reference); difference < minimum)
+        {
+            minimum       = difference;
+            minimum_index = i;
+        }
+    }
+
+    return {minimum, minimum_index};
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_SIMD_UTILS_HPP
@@ -0,0 +1,442 @@
+//
+// Created by Jan Drewniok on 17.10.26.
+//
+
+#ifndef FICTION_WORK_STEALING_THREAD_POOL_HPP
+#define FICTION_WORK_STEALING_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * A thread pool that executes a batch of independent, index-addressed tasks with work stealing. Each participating
+ * thread owns a contiguous range of task indices, which it processes from the front. Once its range is exhausted, it
+ * steals the back half of the range of another thread. Hence, tasks of vastly different runtimes, e.g., the
+ * simulations of parameter points near and far from the border of an operational domain, are balanced across all
+ * threads, and the wall-clock time scales with the total work rather than with the slowest contiguous slice.
+ *
+ * The worker threads are created once and wait for the next batch in between, such that the pool can be reused across
+ * many calls without paying for thread creation each time. The thread that submits a batch participates in its
+ * execution, i.e., a pool of `n` threads spawns `n - 1` workers.
+ */
+class work_stealing_thread_pool
+{
+  public:
+    /**
+     * Standard constructor. Spawns `num_threads - 1` worker threads.
+     *
+     * @param num_threads Number of threads that execute a batch, including the submitting one. Values below `1` are
+     * treated as `1`.
+     */
+    explicit work_stealing_thread_pool(const std::size_t num_threads = std::thread::hardware_concurrency()) :
+            ranges(std::max(num_threads, std::size_t{1}))
+    {
+        workers.reserve(ranges.size() - 1);
+
+        for (std::size_t i = 1; i < ranges.size(); ++i)
+        {
+            workers.emplace_back([this, i] { worker_loop(i); });
+        }
+    }
+    /**
+     * Destructor. Stops and joins all worker threads.
+     */
+    ~work_stealing_thread_pool() noexcept
+    {
+        {
+            const std::scoped_lock lock{batch_mutex};
+            stop = true;
+        }
+
+        batch_cv.notify_all();
+
+        for (auto& worker : workers)
+        {
+            if (worker.joinable())
+            {
+                worker.join();
+            }
+        }
+    }
+
+    work_stealing_thread_pool(const work_stealing_thread_pool&)            = delete;
+    work_stealing_thread_pool(work_stealing_thread_pool&&)                 = delete;
+    work_stealing_thread_pool& operator=(const work_stealing_thread_pool&) = delete;
+    work_stealing_thread_pool& operator=(work_stealing_thread_pool&&)      = delete;
+    /**
+     * Returns the number of threads that execute a batch, including the submitting one.
+     *
+     * @return Number of threads.
+     */
+    [[nodiscard]] std::size_t num_threads() const noexcept
+    {
+        return ranges.size();
+    }
+    /**
+     * Invokes `fn(i)` for each `i` in `[0, num_tasks)` and blocks until all invocations have returned. The invocations
+     * are distributed over all threads of the pool with work stealing, so `fn` has to be safe to call concurrently.
+     *
+     * A batch that is submitted from within a task of the same pool, i.e., if `fn` itself submits a batch, is executed
+     * inline by the calling thread, since all threads of the pool are already busy. The same holds for a batch that is
+     * submitted from within a task of another pool while this pool is busy, which avoids waiting for a pool that might
+     * itself wait for the calling thread. Any other submission to a busy pool, e.g., by an independent thread that
+     * shares the pool, blocks until the current batch is finished.
+     *
+     * @tparam Fn Functor type with signature `void(std::size_t)`.
+     * @param num_tasks Number of tasks.
+     * @param fn Function that executes the task of the given index. It must not throw.
+     */
+    template <typename Fn>
+    void for_each_index(const std::size_t num_tasks, Fn&& fn)
+    {
+        if (num_tasks == 0)
+        {
+            return;
+        }
+
+        // a nested batch would otherwise wait for the threads that are executing the enclosing one
+        if (takes_part_in_batch())
+        {
+            execute_inline(num_tasks, fn);
+
+            return;
+        }
+
+        std::unique_lock submit_lock{submit_mutex, std::defer_lock};
+
+        if (innermost_batch() == nullptr)
+        {
+            submit_lock.lock();
+        }
+        else if (!submit_lock.try_lock())
+        {
+            execute_inline(num_tasks, fn);
+
+            return;
+        }
+
+        // a single task or a single thread does not benefit from the workers
+        if (num_tasks == 1 || workers.empty())
+        {
+            execute_inline(num_tasks, fn);
+
+            return;
+        }
+
+        // each thread starts with a contiguous range of the same size
+        for (std::size_t t = 0; t < ranges.size(); ++t)
+        {
+            const std::scoped_lock lock{ranges[t].mutex};
+
+            ranges[t].begin = t * num_tasks / ranges.size();
+            ranges[t].end   = (t + 1) * num_tasks / ranges.size();
+        }
+
+        {
+            const std::scoped_lock lock{batch_mutex};
+
+            task            = [&fn](const std::size_t i) { fn(i); };
+            running_workers = workers.size();
+            ++batch;
+        }
+
+        batch_cv.notify_all();
+
+        // the submitting thread participates as thread 0
+        execute_tasks(0);
+
+        std::unique_lock lock{batch_mutex};
+        done_cv.wait(lock, [this] { return running_workers == 0; });
+
+        task = nullptr;
+    }
+
+  private:
+    /**
+     * Range of task indices owned by a thread.
+     */
+    struct alignas(64) task_range
+    {
+        /**
+         * Mutex that guards the range.
+         */
+        std::mutex mutex{};
+        /**
+         * First task index that has not been started yet.
+         */
+        std::size_t begin{0};
+        /**
+         * Task index past the last one of the range.
+         */
+        std::size_t end{0};
+    };
+    /**
+     * Task ranges, one per thread. Thread `0` is the submitting thread.
+     */
+    std::vector<task_range> ranges;
+    /**
+     * Worker threads `1` to `num_threads() - 1`.
+     */
+    std::vector<std::thread> workers{};
+    /**
+     * Function that executes the task of the given index in the current batch.
+     */
+    std::function<void(std::size_t)> task{};
+    /**
+     * Number of the current batch. Workers compare it to the last batch they took part in to detect a new one.
+     */
+    uint64_t batch{0};
+    /**
+     * Number of workers that have not finished the current batch yet.
+     */
+    std::size_t running_workers{0};
+    /**
+     * `true` once the pool is destroyed.
+     */
+    bool stop{false};
+    /**
+     * Mutex that guards `task`, `batch`, `running_workers`, and `stop`.
+     */
+    std::mutex batch_mutex{};
+    /**
+     * Notifies the workers of a new batch or of the destruction of the pool.
+     */
+    std::condition_variable batch_cv{};
+    /**
+     * Notifies the submitting thread once all workers have finished the current batch.
+     */
+    std::condition_variable done_cv{};
+    /**
+     * Ensures that only one batch is executed at a time. Threads that take part in a batch of this pool never try
+     * to lock it, such that it is never locked twice by the same thread.
+     */
+    std::mutex submit_mutex{};
+    /**
+     * Batch that a thread takes part in. Nested batches of different pools form a chain on the stack of the thread.
+     */
+    struct batch_participation
+    {
+        /**
+         * Pool that executes the batch.
+         */
+        const work_stealing_thread_pool* pool;
+        /**
+         * Batch within whose task the batch was submitted, or `nullptr` if there is none.
+         */
+        const batch_participation* enclosing;
+    };
+    /**
+     * Returns the innermost batch that the calling thread takes part in.
+     *
+     * @return Reference to the innermost batch of the calling thread, or to `nullptr` if the calling thread does not
+     * take part in any batch.
+     */
+    [[nodiscard]] static const batch_participation*& innermost_batch() noexcept
+    {
+        thread_local const batch_participation* batch = nullptr;
+
+        return batch;
+    }
+    /**
+     * Checks whether the calling thread takes part in a batch of this pool, including enclosing batches.
+     *
+     * @return `true` iff the calling thread executes a task of this pool.
+     */
+    [[nodiscard]] bool takes_part_in_batch() const noexcept
+    {
+        for (const auto* b = innermost_batch(); b != nullptr; b = b->enclosing)
+        {
+            if (b->pool == this)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+    /**
+     * Executes all tasks of a batch on the calling thread.
+     *
+     * @tparam Fn Functor type with signature `void(std::size_t)`.
+     * @param num_tasks Number of tasks.
+     * @param fn Function that executes the task of the given index.
+     */
+    template <typename Fn>
+    void execute_inline(const std::size_t num_tasks, Fn& fn) noexcept
+    {
+        const batch_participation participation{this, innermost_batch()};
+        innermost_batch() = &participation;
+
+        for (std::size_t i = 0; i < num_tasks; ++i)
+        {
+            fn(i);
+        }
+
+        innermost_batch() = participation.enclosing;
+    }
+    /**
+     * Main loop of a worker thread, which takes part in each batch until the pool is destroyed.
+     *
+     * @param self Index of the worker thread.
+     */
+    void worker_loop(const std::size_t self) noexcept
+    {
+        uint64_t last_batch = 0;
+
+        while (true)
+        {
+            std::unique_lock lock{batch_mutex};
+
+            batch_cv.wait(lock, [this, last_batch] { return stop || batch != last_batch; });
+
+            if (stop)
+            {
+                return;
+            }
+
+            last_batch = batch;
+
+            lock.unlock();
+
+            execute_tasks(self);
+
+            lock.lock();
+
+            if (--running_workers == 0)
+            {
+                done_cv.notify_one();
+            }
+        }
+    }
+    /**
+     * Executes tasks of the current batch until no range has any tasks left.
+     *
+     * @param self Index of the executing thread.
+     */
+    void execute_tasks(const std::size_t self) noexcept
+    {
+        const batch_participation participation{this, innermost_batch()};
+        innermost_batch() = &participation;
+
+        for (auto next = take_own_task(self); next.has_value() || steal_tasks(self); next = take_own_task(self))
+        {
+            if (next.has_value())
+            {
+                task(next.value());
+            }
+        }
+
+        innermost_batch() = participation.enclosing;
+    }
+    /**
+     * Takes the next task from the range of the given thread.
+     *
+     * @param self Index of the thread.
+     * @return Index of the next task, or `std::nullopt` if the range is exhausted.
+     */
+    [[nodiscard]] std::optional<std::size_t> take_own_task(const std::size_t self) noexcept
+    {
+        auto& own = ranges[self];
+
+        const std::scoped_lock lock{own.mutex};
+
+        if (own.begin < own.end)
+        {
+            return own.begin++;
+        }
+
+        return std::nullopt;
+    }
+    /**
+     * Moves the back half of the remaining range of another thread to the range of the given thread.
+     *
+     * @param self Index of the stealing thread.
+     * @return `true` if tasks were stolen, `false` if all other ranges are exhausted.
+     */
+    [[nodiscard]] bool steal_tasks(const std::size_t self) noexcept
+    {
+        for (std::size_t offset = 1; offset < ranges.size(); ++offset)
+        {
+            auto& victim = ranges[(self + offset) % ranges.size()];
+
+            std::size_t first = 0;
+            std::size_t last  = 0;
+
+            {
+                const std::scoped_lock lock{victim.mutex};
+
+                if (victim.begin >= victim.end)
+                {
+                    continue;
+                }
+
+                // the victim keeps the front half, which it continues to work on
+                const auto stolen = (victim.end - victim.begin + 1) / 2;
+
+                first = victim.end - stolen;
+                last  = victim.end;
+
+                victim.end = first;
+            }
+
+            auto& own = ranges[self];
+
+            const std::scoped_lock lock{own.mutex};
+
+            own.begin = first;
+            own.end   = last;
+
+            return true;
+        }
+
+        return false;
+    }
+};
+/**
+ * Returns a process-wide work-stealing thread pool of the given size. The pool is created on first request and reused
+ * by all subsequent requests of the same size, such that sweep algorithms that are invoked many times do not spawn new
+ * threads on each invocation. Since more threads than hardware threads do not speed up the computation-bound tasks of
+ * the pools, the size is capped at the hardware concurrency. This bounds the number of pools that are kept alive, even
+ * if the requested sizes vary.
+ *
+ * @param num_threads Number of threads of the pool, including the submitting one. Values below `1` are treated as `1`,
+ * values above the hardware concurrency are treated as the hardware concurrency.
+ * @return Shared thread pool with `min(num_threads, std::thread::hardware_concurrency())` threads.
+ */
+[[nodiscard]] inline work_stealing_thread_pool& shared_work_stealing_thread_pool(const std::size_t num_threads)
+{
+    static std::mutex                                                         pools_mutex{};
+    static std::map<std::size_t, std::unique_ptr<work_stealing_thread_pool>> pools{};
+
+    static const auto hardware_threads = std::max(std::size_t{std::thread::hardware_concurrency()}, std::size_t{1});
+
+    const auto size = std::clamp(num_threads, std::size_t{1}, hardware_threads);
+
+    const std::scoped_lock lock{pools_mutex};
+
+    auto& pool = pools[size];
+
+    if (pool == nullptr)
+    {
+        pool = std::make_unique<work_stealing_thread_pool>(size);
+    }
+
+    return *pool;
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_WORK_STEALING_THREAD_POOL_HPP
@@ -20,12 +20,15 @@
 #include <fiction/technology/sidb_bestagon_library.hpp>
 #include <fiction/technology/sidb_defect_surface.hpp>
 #include <fiction/technology/sidb_defects.hpp>
+#include <fiction/technology/sidb_gate_design_cache.hpp>
 #include <fiction/technology/sidb_on_the_fly_gate_library.hpp>
 #include <fiction/technology/sim7_mol_library.hpp>
 #include <fiction/traits.hpp>
 #include <fiction/types.hpp>
+#include <fiction/utils/layout_utils.hpp>
 #include <fiction/utils/truth_table_utils.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -127,6 +130,23 @@ TEST_CASE("Gate-level layout with AND gate", "[apply-gate-library]")
 
                 CHECK(bestagon_and_with_defects.num_cells() == 19);
             }
+            SECTION("with gate design cache")
+            {
+                params.design_cache = std::make_shared<sidb_gate_design_cache<60, 46>>();
+
+                const auto bestagon_and_designed =
+                    apply_parameterized_gate_library<cell_lyt, sidb_on_the_fly_gate_library,
+                                                     hex_even_row_gate_clk_lyt>(layout, params);
+
+                CHECK(params.design_cache->size() == 1);
+
+                const auto bestagon_and_cached =
+                    apply_parameterized_gate_library<cell_lyt, sidb_on_the_fly_gate_library,
+                                                     hex_even_row_gate_clk_lyt>(layout, params);
+
+                CHECK(params.design_cache->size() == 1);
+                CHECK(are_cell_layouts_identical(bestagon_and_designed, bestagon_and_cached));
+            }
         }
         SECTION("AND gate cannot be designed with one SiDB, exception handling on invalid parameters")
         {
@@ -137,6 +157,33 @@ TEST_CASE("Gate-level layout with AND gate", "[apply-gate-library]")
             CHECK_THROWS(
                 apply_parameterized_gate_library<cell_lyt, sidb_on_the_fly_gate_library, hex_even_row_gate_clk_lyt>(
                     layout, params));
+
+            SECTION("with gate design cache")
+            {
+                params.design_cache = std::make_shared<sidb_gate_design_cache<60, 46>>();
+
+                CHECK_THROWS(
+                    apply_parameterized_gate_library<cell_lyt, sidb_on_the_fly_gate_library,
+                                                     hex_even_row_gate_clk_lyt>(layout, params));
+
+                // the failed design is cached and reported again without redesigning the gate
+                CHECK(params.design_cache->size() == 1);
+
+                CHECK_THROWS(
+                    apply_parameterized_gate_library<cell_lyt, sidb_on_the_fly_gate_library,
+                                                     hex_even_row_gate_clk_lyt>(layout, params));
+
+                CHECK(params.design_cache->size() == 1);
+            }
+            SECTION("design tiles concurrently")
+            {
+                params.number_of_threads = 4;
+
+                CHECK_THROWS_AS(
+                    (apply_parameterized_gate_library<cell_lyt, sidb_on_the_fly_gate_library,
+                                                      hex_even_row_gate_clk_lyt>(layout, params)),
+                    gate_design_exception<tt, hex_even_row_gate_clk_lyt>);
+            }
         }
     }
 }
@@ -208,6 +255,19 @@ TEST_CASE("Gate-level layout with two input wires, one double wire, and two outp
                 bestagon_double_wire,
                 fmt::format("{}/resources/sidb_on_the_fly_gate_library/multi_tile_layout/double_wire.sqd", TEST_PATH));
 
+            SECTION("design tiles concurrently")
+            {
+                params.number_of_threads = 4;
+
+                const auto bestagon_double_wire_concurrent =
+                    apply_parameterized_gate_library<cell_lyt, sidb_on_the_fly_gate_library,
+                                                     hex_even_row_gate_clk_lyt>(layout, params);
+
+                check_equivalence(
+                    bestagon_double_wire_concurrent,
+                    fmt::format("{}/resources/sidb_on_the_fly_gate_library/multi_tile_layout/double_wire.sqd",
+                                TEST_PATH));
+            }
             SECTION("with defects")
             {
                 sidb_defect_surface<cell_lyt> defect_surface{};
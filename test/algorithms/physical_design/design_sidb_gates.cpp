@@ -24,6 +24,8 @@
 
 #include <mockturtle/utils/stopwatch.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <thread>
 #include <vector>
 
@@ -631,6 +633,215 @@ TEST_CASE("Design hexagonal CX gate with pruning only", "[design-sidb-gates]")
     CHECK(found_gate_layouts.front().num_cells() == lyt.num_cells() + 3);
 }
 
+TEST_CASE("Design gates with mirror symmetry reduction", "[design-sidb-gates]")
+{
+    using params_type = design_sidb_gates_params<cell<sidb_100_cell_clk_lyt_siqad>>;
+
+    sidb_100_cell_clk_lyt_siqad lyt{};
+
+    lyt.assign_cell_type({0, 0, 1}, sidb_technology::cell_type::INPUT);
+    lyt.assign_cell_type({2, 1, 1}, sidb_technology::cell_type::INPUT);
+
+    lyt.assign_cell_type({20, 0, 1}, sidb_technology::cell_type::INPUT);
+    lyt.assign_cell_type({18, 1, 1}, sidb_technology::cell_type::INPUT);
+
+    lyt.assign_cell_type({4, 2, 1}, sidb_technology::cell_type::NORMAL);
+    lyt.assign_cell_type({6, 3, 1}, sidb_technology::cell_type::NORMAL);
+
+    lyt.assign_cell_type({14, 3, 1}, sidb_technology::cell_type::NORMAL);
+    lyt.assign_cell_type({16, 2, 1}, sidb_technology::cell_type::NORMAL);
+
+    lyt.assign_cell_type({10, 6, 0}, sidb_technology::cell_type::OUTPUT);
+    lyt.assign_cell_type({10, 7, 0}, sidb_technology::cell_type::OUTPUT);
+
+    lyt.assign_cell_type({10, 9, 1}, sidb_technology::cell_type::NORMAL);
+
+    params_type params{
+        .operational_params =
+            is_operational_params{
+                .simulation_parameters     = sidb_simulation_parameters{2, -0.28},
+                .sim_engine                = sidb_simulation_engine::QUICKEXACT,
+                .input_bdl_iterator_params = {.bdl_wire_params =
+                                                  detect_bdl_wires_params{.threshold_bdl_interdistance = 2.0}}},
+        .design_mode            = params_type::design_sidb_gates_mode::AUTOMATIC_EXHAUSTIVE_GATE_DESIGNER,
+        .canvas                 = {{5, 4, 0}, {15, 5, 1}},
+        .number_of_canvas_sidbs = 2,
+        .termination_cond       = params_type::termination_condition::ALL_COMBINATIONS_ENUMERATED};
+
+    const auto digests = [](const std::vector<sidb_100_cell_clk_lyt_siqad>& layouts)
+    {
+        std::vector<std::size_t> d{};
+        d.reserve(layouts.size());
+
+        for (const auto& l : layouts)
+        {
+            d.push_back(cell_layout_digest(l));
+        }
+
+        std::ranges::sort(d);
+
+        return d;
+    };
+
+    const auto design = [&lyt, &params](const tt& spec, const params_type::symmetry_reduction symmetry,
+                                        design_sidb_gates_stats& stats)
+    {
+        auto ps     = params;
+        ps.symmetry = symmetry;
+
+        return design_sidb_gates(lyt, std::vector<tt>{spec}, ps, &stats);
+    };
+
+    SECTION("symmetric AND gate")
+    {
+        for (const auto mode : {params_type::design_sidb_gates_mode::AUTOMATIC_EXHAUSTIVE_GATE_DESIGNER,
+                                params_type::design_sidb_gates_mode::QUICKCELL})
+        {
+            params.design_mode = mode;
+
+            design_sidb_gates_stats stats_all{};
+            design_sidb_gates_stats stats_canonical{};
+            design_sidb_gates_stats stats_mirrored{};
+
+            const auto all_gates = design(create_and_tt(), params_type::symmetry_reduction::NONE, stats_all);
+            const auto canonical_gates =
+                design(create_and_tt(), params_type::symmetry_reduction::CANONICAL_ONLY, stats_canonical);
+            const auto mirrored_gates =
+                design(create_and_tt(), params_type::symmetry_reduction::CANONICAL_AND_MIRRORED, stats_mirrored);
+
+            REQUIRE(!all_gates.empty());
+
+            CHECK(!stats_all.mirror_symmetric);
+            CHECK(stats_all.number_of_skipped_mirror_images == 0);
+
+            // 26 of the 946 canvas layouts are mirror-symmetric themselves
+            CHECK(stats_canonical.mirror_symmetric);
+            CHECK(stats_canonical.number_of_layouts == 946);
+            CHECK(stats_canonical.number_of_skipped_mirror_images == 460);
+
+            CHECK(canonical_gates.size() < all_gates.size());
+            CHECK(digests(mirrored_gates) == digests(all_gates));
+        }
+    }
+    SECTION("asymmetric specification")
+    {
+        design_sidb_gates_stats stats{};
+
+        static_cast<void>(design(create_lt_tt(), params_type::symmetry_reduction::CANONICAL_ONLY, stats));
+
+        CHECK(!stats.mirror_symmetric);
+        CHECK(stats.number_of_skipped_mirror_images == 0);
+    }
+    SECTION("asymmetric canvas")
+    {
+        params.canvas = {{4, 4, 0}, {14, 5, 1}};
+
+        design_sidb_gates_stats stats{};
+
+        static_cast<void>(design(create_and_tt(), params_type::symmetry_reduction::CANONICAL_ONLY, stats));
+
+        CHECK(!stats.mirror_symmetric);
+    }
+    SECTION("asymmetric atomic defect")
+    {
+        sidb_defect_surface<sidb_100_cell_clk_lyt_siqad> defect_layout{lyt};
+        defect_layout.assign_sidb_defect({3, 8, 0}, sidb_defect{sidb_defect_type::DB, -1, 5.6, 5.0});
+
+        auto ps     = params;
+        ps.symmetry = params_type::symmetry_reduction::CANONICAL_ONLY;
+
+        design_sidb_gates_stats stats{};
+
+        static_cast<void>(design_sidb_gates(defect_layout, std::vector<tt>{create_and_tt()}, ps, &stats));
+
+        CHECK(!stats.mirror_symmetric);
+
+        defect_layout.assign_sidb_defect({17, 8, 0}, sidb_defect{sidb_defect_type::DB, -1, 5.6, 5.0});
+
+        static_cast<void>(design_sidb_gates(defect_layout, std::vector<tt>{create_and_tt()}, ps, &stats));
+
+        CHECK(stats.mirror_symmetric);
+    }
+}
+
+TEST_CASE("Design gates with QuickCell with and without cached input pattern geometries", "[design-sidb-gates]")
+{
+    using params_type = design_sidb_gates_params<cell<sidb_100_cell_clk_lyt_siqad>>;
+
+    sidb_100_cell_clk_lyt_siqad lyt{};
+
+    lyt.assign_cell_type({0, 0, 1}, sidb_technology::cell_type::INPUT);
+    lyt.assign_cell_type({2, 1, 1}, sidb_technology::cell_type::INPUT);
+
+    lyt.assign_cell_type({20, 0, 1}, sidb_technology::cell_type::INPUT);
+    lyt.assign_cell_type({18, 1, 1}, sidb_technology::cell_type::INPUT);
+
+    lyt.assign_cell_type({4, 2, 1}, sidb_technology::cell_type::NORMAL);
+    lyt.assign_cell_type({6, 3, 1}, sidb_technology::cell_type::NORMAL);
+
+    lyt.assign_cell_type({14, 3, 1}, sidb_technology::cell_type::NORMAL);
+    lyt.assign_cell_type({16, 2, 1}, sidb_technology::cell_type::NORMAL);
+
+    lyt.assign_cell_type({10, 6, 0}, sidb_technology::cell_type::OUTPUT);
+    lyt.assign_cell_type({10, 7, 0}, sidb_technology::cell_type::OUTPUT);
+
+    lyt.assign_cell_type({10, 9, 1}, sidb_technology::cell_type::NORMAL);
+
+    params_type params{
+        .operational_params =
+            is_operational_params{
+                .simulation_parameters     = sidb_simulation_parameters{2, -0.28},
+                .sim_engine                = sidb_simulation_engine::QUICKEXACT,
+                .input_bdl_iterator_params = {.bdl_wire_params =
+                                                  detect_bdl_wires_params{.threshold_bdl_interdistance = 2.0}}},
+        .design_mode            = params_type::design_sidb_gates_mode::QUICKCELL,
+        .canvas                 = {{4, 4, 0}, {14, 5, 1}},
+        .number_of_canvas_sidbs = 2,
+        .termination_cond       = params_type::termination_condition::ALL_COMBINATIONS_ENUMERATED};
+
+    const auto digests = [](const std::vector<sidb_100_cell_clk_lyt_siqad>& layouts)
+    {
+        std::vector<std::size_t> d{};
+        d.reserve(layouts.size());
+
+        for (const auto& l : layouts)
+        {
+            d.push_back(cell_layout_digest(l));
+        }
+
+        std::ranges::sort(d);
+
+        return d;
+    };
+
+    for (const auto mode :
+         {params_type::design_sidb_gates_mode::QUICKCELL, params_type::design_sidb_gates_mode::PRUNING_ONLY})
+    {
+        params.design_mode = mode;
+
+        design_sidb_gates_stats stats_cached{};
+        design_sidb_gates_stats stats_uncached{};
+
+        params.cache_input_pattern_geometries = true;
+        const auto cached_gates = design_sidb_gates(lyt, std::vector<tt>{create_and_tt()}, params, &stats_cached);
+
+        params.cache_input_pattern_geometries = false;
+        const auto uncached_gates = design_sidb_gates(lyt, std::vector<tt>{create_and_tt()}, params, &stats_uncached);
+
+        REQUIRE(!cached_gates.empty());
+
+        CHECK(digests(cached_gates) == digests(uncached_gates));
+
+        CHECK(stats_cached.number_of_layouts == stats_uncached.number_of_layouts);
+        CHECK(stats_cached.number_of_layouts_after_first_pruning ==
+              stats_uncached.number_of_layouts_after_first_pruning);
+        CHECK(stats_cached.number_of_layouts_after_second_pruning ==
+              stats_uncached.number_of_layouts_after_second_pruning);
+        CHECK(stats_cached.number_of_layouts_after_third_pruning ==
+              stats_uncached.number_of_layouts_after_third_pruning);
+    }
+}
+
 // to save runtime in the CI, this test is only run in RELEASE mode
 #ifdef NDEBUG
 TEST_CASE("Design Bestagon shaped CX gate with QuickCell", "[design-sidb-gates]")
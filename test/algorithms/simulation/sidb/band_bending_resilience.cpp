@@ -15,6 +15,8 @@
 #include <fiction/types.hpp>
 #include <fiction/utils/truth_table_utils.hpp>
 
+#include <cstddef>
+#include <optional>
 #include <vector>
 
 using namespace fiction;
@@ -60,3 +62,38 @@ TEST_CASE("Single SiDB", "[band-bending-resilience]")
         CHECK_THAT(min_potential, Catch::Matchers::WithinAbs(0.020652, constants::ERROR_MARGIN));
     }
 }
+
+TEST_CASE("Band bending resilience of many layouts", "[band-bending-resilience]")
+{
+    const auto and_gate = blueprints::bestagon_and_gate<test_layout>();
+
+    // an AND gate with an additional SiDB close to the output
+    auto perturbed_and_gate = and_gate;
+    perturbed_and_gate.assign_cell_type({34, 20, 0}, sidb_technology::cell_type::NORMAL);
+
+    const std::vector<test_layout> layouts{and_gate, perturbed_and_gate, and_gate};
+
+    band_bending_resilience_batch_params params{
+        band_bending_resilience_params{physical_population_stability_params{sidb_simulation_parameters{2, -0.32}, 2}}};
+
+    for (const auto num_threads : {std::size_t{1}, std::size_t{2}})
+    {
+        params.number_of_threads = num_threads;
+
+        for (const auto& type : {std::optional<transition_type>{}, std::optional{transition_type::NEGATIVE_TO_NEUTRAL}})
+        {
+            const auto resilience =
+                band_bending_resilience_batch(layouts, std::vector{create_and_tt()}, params, type);
+
+            REQUIRE(resilience.size() == layouts.size());
+
+            for (std::size_t i = 0; i < layouts.size(); ++i)
+            {
+                CHECK_THAT(resilience[i], Catch::Matchers::WithinAbs(band_bending_resilience(
+                                                                         layouts[i], std::vector{create_and_tt()},
+                                                                         params.resilience_params, type),
+                                                                     constants::ERROR_MARGIN));
+            }
+        }
+    }
+}
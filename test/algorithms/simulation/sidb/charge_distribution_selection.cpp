@@ -0,0 +1,145 @@
+//
+// Created by Jan Drewniok on 17.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/simulation/sidb/charge_distribution_selection.hpp>
+#include <fiction/technology/constants.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace fiction;
+
+namespace
+{
+
+/**
+ * Minimal charge distribution that is identified by an ID and only provides its energy.
+ */
+struct energy_only_charge_distribution
+{
+    uint64_t id;
+    double   energy;
+
+    [[nodiscard]] double get_electrostatic_potential_energy() const noexcept
+    {
+        return energy;
+    }
+};
+
+[[nodiscard]] std::vector<uint64_t>
+extract_ids(charge_distribution_selection<energy_only_charge_distribution>& selection) noexcept
+{
+    std::vector<uint64_t> ids{};
+
+    for (const auto& cd : selection.extract())
+    {
+        ids.push_back(cd.id);
+    }
+
+    return ids;
+}
+
+}  // namespace
+
+TEST_CASE("Selection of all valid charge distributions", "[charge-distribution-selection]")
+{
+    charge_distribution_selection<energy_only_charge_distribution> selection{};
+
+    CHECK(selection.get_mode() == simulation_result_mode::ALL_VALID);
+    CHECK(selection.empty());
+    CHECK(std::isinf(selection.energy_bound()));
+
+    selection.add({0, 0.5});
+    selection.add({1, 0.2});
+    selection.add({2, 0.9});
+
+    CHECK(selection.admits(100.0));
+    CHECK(selection.size() == 3);
+
+    // the insertion order is kept
+    CHECK(extract_ids(selection) == std::vector<uint64_t>{0, 1, 2});
+    CHECK(selection.empty());
+}
+
+TEST_CASE("Selection of the charge distributions with the lowest energies", "[charge-distribution-selection]")
+{
+    charge_distribution_selection<energy_only_charge_distribution> selection{simulation_result_mode::LOWEST_K, 3};
+
+    SECTION("fewer charge distributions than requested")
+    {
+        selection.add({0, 0.5});
+        selection.add({1, 0.2});
+
+        CHECK(std::isinf(selection.energy_bound()));
+        CHECK(extract_ids(selection) == std::vector<uint64_t>{1, 0});
+    }
+
+    SECTION("more charge distributions than requested")
+    {
+        selection.add({0, 0.5});
+        selection.add({1, 0.2});
+        selection.add({2, 0.9});
+
+        CHECK(selection.energy_bound() == 0.9);
+        CHECK(selection.admits(0.6));
+        CHECK(!selection.admits(0.9));
+
+        selection.add({3, 0.1});
+        selection.add({4, 1.5});
+        selection.add({5, 0.3});
+
+        CHECK(selection.size() == 3);
+        CHECK(selection.energy_bound() == 0.3);
+        CHECK(extract_ids(selection) == std::vector<uint64_t>{3, 1, 5});
+    }
+
+    SECTION("merging selections")
+    {
+        charge_distribution_selection<energy_only_charge_distribution> other{simulation_result_mode::LOWEST_K, 3};
+
+        selection.add({0, 0.5});
+        selection.add({1, 0.2});
+        other.add({2, 0.1});
+        other.add({3, 0.7});
+
+        selection.merge(std::move(other));
+
+        CHECK(extract_ids(selection) == std::vector<uint64_t>{2, 1, 0});
+    }
+
+    SECTION("at least one charge distribution is kept")
+    {
+        charge_distribution_selection<energy_only_charge_distribution> single{simulation_result_mode::LOWEST_K, 0};
+
+        single.add({0, 0.5});
+        single.add({1, 0.2});
+
+        CHECK(extract_ids(single) == std::vector<uint64_t>{1});
+    }
+}
+
+TEST_CASE("Selection of the ground states", "[charge-distribution-selection]")
+{
+    charge_distribution_selection<energy_only_charge_distribution> selection{
+        simulation_result_mode::GROUND_STATE_ONLY};
+
+    CHECK(std::isinf(selection.energy_bound()));
+
+    selection.add({0, 0.5});
+    selection.add({1, 0.5 + constants::ERROR_MARGIN / 2});
+    selection.add({2, 0.9});
+
+    CHECK(selection.size() == 2);
+    CHECK(selection.energy_bound() == 0.5 + constants::ERROR_MARGIN);
+
+    // a lower energy evicts all previous charge distributions
+    selection.add({3, 0.2});
+    selection.add({4, 0.2});
+
+    CHECK(!selection.admits(0.5));
+    CHECK(extract_ids(selection) == std::vector<uint64_t>{3, 4});
+}
@@ -11,6 +11,7 @@
 #include "utils/blueprints/layout_blueprints.hpp"
 
 #include <fiction/algorithms/physical_design/apply_gate_library.hpp>
+#include <fiction/algorithms/simulation/sidb/charge_distribution_selection.hpp>
 #include <fiction/algorithms/simulation/sidb/clustercomplete.hpp>
 #include <fiction/algorithms/simulation/sidb/minimum_energy.hpp>
 #include <fiction/algorithms/simulation/sidb/quickexact.hpp>
@@ -774,6 +775,74 @@ TEMPLATE_TEST_CASE("ClusterComplete simulation of a Y-shape SiDB arrangement", "
                Catch::Matchers::WithinAbs(0.3191788254, constants::ERROR_MARGIN));
 }
 
+TEMPLATE_TEST_CASE("ClusterComplete simulation with a selection of the charge distributions", "[clustercomplete]",
+                   (sidb_100_cell_clk_lyt_siqad), (cds_sidb_100_cell_clk_lyt_siqad))
+{
+    TestType lyt{};
+
+    // two rows of SiDBs with several degenerate ground states and metastable states
+    for (const auto x : {0, 4, 8, 12, 16})
+    {
+        lyt.assign_cell_type({x, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({x, 2, 0}, TestType::cell_type::NORMAL);
+    }
+
+    clustercomplete_params<cell<TestType>> sim_params{sidb_simulation_parameters{2, -0.25}};
+
+    const auto all_valid = clustercomplete<TestType>(lyt, sim_params);
+
+    REQUIRE(all_valid.charge_distributions.size() > 3);
+
+    std::vector<double> energies{};
+
+    for (const auto& cds : all_valid.charge_distributions)
+    {
+        energies.push_back(cds.get_electrostatic_potential_energy());
+    }
+
+    std::ranges::sort(energies);
+
+    for (const auto available_threads : {uint64_t{1}, uint64_t{4}})
+    {
+        sim_params.available_threads = available_threads;
+
+        sim_params.result_mode = simulation_result_mode::GROUND_STATE_ONLY;
+
+        const auto ground_state_result = clustercomplete<TestType>(lyt, sim_params);
+
+        std::set<std::vector<sidb_charge_state>> expected_charges{};
+        std::set<std::vector<sidb_charge_state>> selected_charges{};
+
+        for (const auto& gs : all_valid.groundstates())
+        {
+            expected_charges.insert(gs.get_all_sidb_charges());
+        }
+
+        for (const auto& gs : ground_state_result.charge_distributions)
+        {
+            selected_charges.insert(gs.get_all_sidb_charges());
+        }
+
+        CHECK(ground_state_result.charge_distributions.size() == expected_charges.size());
+        CHECK(selected_charges == expected_charges);
+
+        sim_params.result_mode                    = simulation_result_mode::LOWEST_K;
+        sim_params.number_of_lowest_energy_states = 3;
+
+        const auto lowest_result = clustercomplete<TestType>(lyt, sim_params);
+
+        REQUIRE(lowest_result.charge_distributions.size() == 3);
+
+        for (uint64_t i = 0; i < 3; ++i)
+        {
+            CHECK_THAT(lowest_result.charge_distributions[i].get_electrostatic_potential_energy(),
+                       Catch::Matchers::WithinAbs(energies[i], constants::ERROR_MARGIN));
+        }
+
+        sim_params.result_mode = simulation_result_mode::ALL_VALID;
+    }
+}
+
 TEMPLATE_TEST_CASE("ClusterComplete simulation of a Y-shape SiDB OR gate with input 01, check energy and charge "
                    "distribution, using siqad coordinates",
                    "[clustercomplete]", (sidb_100_cell_clk_lyt_siqad), (cds_sidb_100_cell_clk_lyt_siqad))
@@ -0,0 +1,128 @@
+//
+// Created by Jan Drewniok on 17.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/simulation/sidb/compact_sidb_simulation_domain.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Packing and unpacking step indices", "[compact-sidb-simulation-domain]")
+{
+    const compact_sidb_simulation_domain<uint64_t> domain{{5, 1, 300, 2}};
+
+    CHECK(domain.get_number_of_steps() == std::vector<std::size_t>{5, 1, 300, 2});
+
+    for (const auto& steps : {std::vector<std::size_t>{0, 0, 0, 0}, std::vector<std::size_t>{4, 0, 299, 1},
+                              std::vector<std::size_t>{2, 0, 128, 0}, std::vector<std::size_t>{3, 0, 17, 1}})
+    {
+        CHECK(domain.unpack(domain.pack(steps)) == steps);
+    }
+
+    // distinct grid points have distinct keys
+    CHECK(domain.pack({1, 0, 0, 0}) != domain.pack({0, 0, 1, 0}));
+    CHECK(domain.pack({0, 0, 0, 1}) != domain.pack({0, 0, 256, 0}));
+}
+
+TEST_CASE("Adding and retrieving values", "[compact-sidb-simulation-domain]")
+{
+    for (const auto backend : {simulation_domain_storage::SPARSE, simulation_domain_storage::DENSE})
+    {
+        compact_sidb_simulation_domain<uint64_t, double> domain{{3, 4}, backend};
+
+        CHECK(domain.get_storage() == backend);
+        CHECK(domain.empty());
+
+        const auto key = domain.pack({2, 3});
+
+        CHECK(!domain.contains(key).has_value());
+
+        domain.add_value(key, std::tuple{7, 0.5});
+        domain.add_value(domain.pack({0, 1}), std::tuple{1, 1.5});
+
+        // the first value of a grid point is kept
+        domain.add_value(key, std::tuple{8, 2.5});
+
+        CHECK(domain.size() == 2);
+        CHECK(domain.contains(key) == std::tuple<uint64_t, double>{7, 0.5});
+        CHECK(!domain.contains(domain.pack({1, 1})).has_value());
+
+        std::size_t visited = 0;
+        uint64_t    sum     = 0;
+
+        domain.for_each(
+            [&domain, &visited, &sum](const auto k, const auto& value)
+            {
+                CHECK((domain.unpack(k) == std::vector<std::size_t>{2, 3} ||
+                       domain.unpack(k) == std::vector<std::size_t>{0, 1}));
+
+                ++visited;
+                sum += std::get<0>(value);
+            });
+
+        CHECK(visited == 2);
+        CHECK(sum == 8);
+    }
+}
+
+TEST_CASE("Invalid compact simulation domains", "[compact-sidb-simulation-domain]")
+{
+    CHECK_THROWS_AS(compact_sidb_simulation_domain<uint64_t>({3, 0}), std::invalid_argument);
+    CHECK_THROWS_AS(compact_sidb_simulation_domain<uint64_t>({uint64_t{1} << 40, uint64_t{1} << 30}),
+                    std::invalid_argument);
+
+    // a domain without dimensions has a single grid point
+    compact_sidb_simulation_domain<uint64_t> domain{};
+
+    domain.add_value(domain.pack({}), std::tuple{3});
+
+    CHECK(domain.size() == 1);
+}
+
+TEST_CASE("Concurrent insertions into a dense compact simulation domain", "[compact-sidb-simulation-domain]")
+{
+    compact_sidb_simulation_domain<uint64_t> domain{{50, 40}, simulation_domain_storage::DENSE};
+
+    std::vector<std::thread> threads{};
+
+    // all threads insert all grid points, each with its own value
+    for (uint64_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&domain, t]
+            {
+                for (std::size_t x = 0; x < 50; ++x)
+                {
+                    for (std::size_t y = 0; y < 40; ++y)
+                    {
+                        domain.add_value(domain.pack({x, y}), std::tuple{t});
+                    }
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    CHECK(domain.size() == 2000);
+
+    std::size_t visited = 0;
+
+    domain.for_each([&visited](const auto, const auto& value)
+                    {
+                        CHECK(std::get<0>(value) < 4);
+                        ++visited;
+                    });
+
+    CHECK(visited == 2000);
+}
@@ -10,10 +10,12 @@
 #include "utils/blueprints/layout_blueprints.hpp"
 
 #include <fiction/algorithms/iter/bdl_input_iterator.hpp>
+#include <fiction/algorithms/simulation/sidb/calculate_energy_and_state_type.hpp>
 #include <fiction/algorithms/simulation/sidb/critical_temperature.hpp>
 #include <fiction/algorithms/simulation/sidb/detect_bdl_pairs.hpp>
 #include <fiction/algorithms/simulation/sidb/detect_bdl_wires.hpp>
 #include <fiction/algorithms/simulation/sidb/is_operational.hpp>
+#include <fiction/algorithms/simulation/sidb/occupation_probability_of_excited_states.hpp>
 #include <fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp>
 #include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
 #include <fiction/technology/cell_technologies.hpp>
@@ -21,6 +23,9 @@
 #include <fiction/utils/truth_table_utils.hpp>
 
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <stdexcept>
 #include <vector>
 
@@ -920,6 +925,116 @@ TEST_CASE("Pre-generated input pattern layouts reject mismatched BDL data", "[cr
     }
 }
 
+TEST_CASE("Critical temperature does not depend on the number of threads", "[critical-temperature]")
+{
+    const sidb_100_cell_clk_lyt_siqad lat{blueprints::bestagon_and_gate<sidb_cell_clk_lyt_siqad>()};
+
+    critical_temperature_params params{};
+    params.operational_params.simulation_parameters = sidb_simulation_parameters{2, -0.32, 5.6, 5.0};
+    params.operational_params.sim_engine            = sidb_simulation_engine::QUICKEXACT;
+    params.max_temperature                          = 350;
+    params.number_of_threads                        = 1;
+
+    critical_temperature_stats expected_stats{};
+
+    const auto expected_ct =
+        critical_temperature_gate_based(lat, std::vector<tt>{create_and_tt()}, params, &expected_stats);
+
+    CHECK_THAT(expected_ct, Catch::Matchers::WithinAbs(57.24, 0.01));
+
+    for (const auto num_threads : {std::size_t{2}, std::size_t{4}, std::size_t{7}})
+    {
+        params.number_of_threads = num_threads;
+
+        critical_temperature_stats stats{};
+
+        const auto ct = critical_temperature_gate_based(lat, std::vector<tt>{create_and_tt()}, params, &stats);
+
+        // the input patterns are combined in order, so the results must be bit-identical
+        CHECK_THAT(ct, Catch::Matchers::WithinULP(expected_ct, 0));
+        CHECK(stats.num_valid_lyt == expected_stats.num_valid_lyt);
+        CHECK(stats.energy_between_ground_state_and_first_erroneous ==
+              expected_stats.energy_between_ground_state_and_first_erroneous);
+    }
+}
+
+TEST_CASE("Critical temperature statistics of a layout that fails at a later input pattern",
+          "[critical-temperature]")
+{
+    sidb_100_cell_clk_lyt_siqad lat{blueprints::bestagon_and_gate<sidb_cell_clk_lyt_siqad>()};
+
+    // positive charges can only occur if the input SiDB next to this one is present, i.e., at input patterns 1 and 3
+    lat.assign_cell_type({35, 1, 0}, sidb_technology::cell_type::LOGIC);
+
+    critical_temperature_params params{};
+    params.operational_params.simulation_parameters = sidb_simulation_parameters{2, -0.32, 5.6, 5.0};
+    params.operational_params.sim_engine            = sidb_simulation_engine::QUICKEXACT;
+    params.max_temperature                          = 350;
+
+    // the statistics stem from input pattern 0, which all thread counts simulate before they stop at pattern 1
+    for (const auto num_threads : {std::size_t{1}, std::size_t{2}, std::size_t{4}, std::size_t{7}})
+    {
+        params.number_of_threads = num_threads;
+
+        critical_temperature_stats stats{};
+
+        CHECK(critical_temperature_gate_based(lat, std::vector<tt>{create_and_tt()}, params, &stats) == 0.0);
+        CHECK(stats.num_valid_lyt == 4);
+        CHECK_THAT(stats.energy_between_ground_state_and_first_erroneous,
+                   Catch::Matchers::WithinAbs(285.145, 0.001));
+    }
+}
+
+TEST_CASE("Bisection over the erroneous state spectrum matches a linear scan", "[critical-temperature]")
+{
+    const auto linear_scan = [](const sidb_energy_and_state_type& energy_and_state_type, const double threshold,
+                                const uint64_t num_steps) -> std::optional<uint64_t>
+    {
+        for (uint64_t step = 1; step <= num_steps; ++step)
+        {
+            if (occupation_probability_gate_based(energy_and_state_type, static_cast<double>(step) / 100.0) >
+                threshold)
+            {
+                return step;
+            }
+        }
+
+        return std::nullopt;
+    };
+
+    const std::vector<sidb_energy_and_state_type> spectra{
+        // erroneous states only above the correct ones, i.e., a single crossing
+        {{-1.0, state_type::ACCEPTED}, {-0.99, state_type::REJECTED}, {-0.98, state_type::REJECTED}},
+        // unsorted and degenerate
+        {{-0.95, state_type::REJECTED}, {-1.0, state_type::ACCEPTED}, {-0.95, state_type::ACCEPTED}},
+        // a large correct manifold above the erroneous state, i.e., the probability rises and falls again
+        {{-1.0, state_type::ACCEPTED},
+         {-0.995, state_type::REJECTED},
+         {-0.95, state_type::ACCEPTED},
+         {-0.95, state_type::ACCEPTED},
+         {-0.95, state_type::ACCEPTED},
+         {-0.95, state_type::ACCEPTED},
+         {-0.9, state_type::REJECTED}},
+        // an erroneous ground state
+        {{-1.0, state_type::ACCEPTED}, {-1.0, state_type::REJECTED}},
+        // no erroneous state
+        {{-1.0, state_type::ACCEPTED}, {-0.9, state_type::ACCEPTED}}};
+
+    for (const auto& spectrum : spectra)
+    {
+        const detail::erroneous_state_spectrum sorted_spectrum{spectrum};
+
+        for (const auto threshold : {0.01, 0.1, 0.3, 0.5})
+        {
+            for (const auto num_steps : {uint64_t{0}, uint64_t{1}, uint64_t{5000}, uint64_t{40000}})
+            {
+                CHECK(sorted_spectrum.first_temperature_step_exceeding(threshold, num_steps) ==
+                      linear_scan(spectrum, threshold, num_steps));
+            }
+        }
+    }
+}
+
 // to save runtime in the CI, this test is only run in RELEASE mode
 #ifdef NDEBUG
 TEMPLATE_TEST_CASE("Critical temperature of Bestagon CX, QuickExact", "[critical-temperature], [quality]",
@@ -7,18 +7,23 @@
 
 #include "utils/blueprints/layout_blueprints.hpp"
 
+#include <fiction/algorithms/simulation/sidb/can_positive_charges_occur.hpp>
 #include <fiction/algorithms/simulation/sidb/defect_clearance.hpp>
 #include <fiction/algorithms/simulation/sidb/defect_influence.hpp>
 #include <fiction/algorithms/simulation/sidb/is_operational.hpp>
+#include <fiction/algorithms/simulation/sidb/quickexact.hpp>
 #include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
 #include <fiction/layouts/coordinates.hpp>
 #include <fiction/technology/constants.hpp>
+#include <fiction/technology/sidb_defect_surface.hpp>
 #include <fiction/technology/sidb_defects.hpp>
 #include <fiction/traits.hpp>
 #include <fiction/types.hpp>
 #include <fiction/utils/layout_utils.hpp>
 #include <fiction/utils/truth_table_utils.hpp>
 
+#include <cstdint>
+#include <set>
 #include <vector>
 
 using namespace fiction;
@@ -357,3 +362,62 @@ TEMPLATE_TEST_CASE("Defect influence when considering the change of the ground s
                    Catch::Matchers::WithinAbs(2.8999201713, constants::ERROR_MARGIN));
     }
 }
+
+TEMPLATE_TEST_CASE("Defect influence on the ground state without re-simulating the defect-free layout",
+                   "[defect-influence]", sidb_cell_clk_lyt_cube)
+{
+    const auto lyt =
+        convert_layout_to_fiction_coordinates<TestType>(blueprints::siqad_and_gate<sidb_cell_clk_lyt_siqad>());
+
+    const quickexact_params<cell<TestType>> qe_params{
+        sidb_simulation_parameters{2, -0.32}, quickexact_params<cell<TestType>>::automatic_base_number_detection::OFF};
+
+    const auto ground_state_indices = [&qe_params](const auto& layout)
+    {
+        std::set<uint64_t> indices{};
+
+        for (const auto& gs : quickexact(layout, qe_params).groundstates())
+        {
+            indices.insert(gs.get_charge_index_and_base().first);
+        }
+
+        return indices;
+    };
+
+    const auto defect_free_ground_states = ground_state_indices(lyt);
+
+    for (const auto& defect : {sidb_defect{sidb_defect_type::SI_VACANCY, -1, 10.6, 5.9},
+                               sidb_defect{sidb_defect_type::UNKNOWN, 1, 9.7, 2.1}})
+    {
+        const auto params = defect_influence_params<cell<TestType>>{
+            defect, is_operational_params{qe_params.simulation_parameters}, {15, 5},
+            defect_influence_params<cell<TestType>>::influence_definition::GROUND_STATE_CHANGE};
+
+        defect_influence_stats stats{};
+
+        const auto defect_influence_domain = defect_influence_grid_search(lyt, params, 1, &stats);
+
+        CHECK(stats.num_evaluated_defect_positions == defect_influence_domain.size());
+        CHECK(stats.num_screened_defect_positions > 0);
+        CHECK(stats.num_screened_defect_positions <= stats.num_influencing_defect_positions);
+
+        // each defect position is classified like a simulation of the layout with and without the defect
+        defect_influence_domain.for_each(
+            [&lyt, &defect, &qe_params, &ground_state_indices, &defect_free_ground_states](const auto& defect_pos,
+                                                                                          const auto& status)
+            {
+                if (!lyt.is_empty_cell(defect_pos))
+                {
+                    return;
+                }
+
+                sidb_defect_surface<TestType> lyt_defect{lyt};
+                lyt_defect.assign_sidb_defect(defect_pos, defect);
+
+                const auto influential = can_positive_charges_occur(lyt_defect, qe_params.simulation_parameters) ||
+                                         ground_state_indices(lyt_defect) != defect_free_ground_states;
+
+                CHECK((std::get<0>(status) == defect_influence_status::INFLUENTIAL) == influential);
+            });
+    }
+}
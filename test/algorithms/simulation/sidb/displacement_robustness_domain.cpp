@@ -96,6 +96,44 @@ TEST_CASE("Determine the SiDB gate displacement robustness of the Y-shaped SiDB
     }
 }
 
+TEST_CASE("Determine the displacement robustness domain by sampling from a vast number of displacements",
+          "[displacement-robustness-domain]")
+{
+    const auto lyt = blueprints::bdl_wire<sidb_cell_clk_lyt_siqad>();
+
+    displacement_robustness_domain_params<cell<sidb_cell_clk_lyt_siqad>> params{};
+    params.displacement_variations                  = {1, 1};
+    params.operational_params.simulation_parameters = sidb_simulation_parameters{2, -0.32};
+    params.operational_params.input_bdl_iterator_params.bdl_wire_params.threshold_bdl_interdistance       = 3.0;
+    params.operational_params.input_bdl_iterator_params.bdl_wire_params.bdl_pairs_params.maximum_distance = 2.0;
+    params.operational_params.input_bdl_iterator_params.bdl_wire_params.bdl_pairs_params.minimum_distance = 0.2;
+    params.dimer_policy = displacement_robustness_domain_params<
+        cell<sidb_cell_clk_lyt_siqad>>::dimer_displacement_policy::ALLOW_OTHER_DIMER;
+    params.analysis_mode =
+        displacement_robustness_domain_params<cell<sidb_cell_clk_lyt_siqad>>::displacement_analysis_mode::RANDOM;
+
+    // all SiDBs can be displaced to 9 positions each, which yields far too many displaced layouts to be generated
+    const auto num_displacements = std::pow(9.0, static_cast<double>(lyt.num_cells()));
+    REQUIRE(num_displacements > 1e8);
+
+    params.percentage_of_analyzed_displaced_layouts = 50.0 / num_displacements;
+
+    displacement_robustness_domain_stats stats{};
+
+    const auto robustness_domain =
+        determine_displacement_robustness_domain(lyt, std::vector<tt>{create_id_tt()}, params, &stats);
+
+    // layouts in which displaced SiDBs coincide are discarded
+    CHECK(robustness_domain.operational_values.size() <= 50);
+    CHECK(robustness_domain.operational_values.size() > 25);
+    check_identical_information_of_stats_and_domain(robustness_domain, stats);
+
+    for (const auto& [displaced_lyt, status] : robustness_domain.operational_values)
+    {
+        CHECK(displaced_lyt.num_cells() == lyt.num_cells());
+    }
+}
+
 TEST_CASE("Determine the probability of fabricating an operational SiQAD Y-shaped AND gate with a fabrication error "
           "rate (p) of 0.3",
           "[displacement-robustness-domain]")
@@ -14,6 +14,7 @@
 #include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
 #include <fiction/layouts/cell_level_layout.hpp>
 #include <fiction/technology/cell_technologies.hpp>
+#include <fiction/technology/charge_distribution_surface.hpp>
 #include <fiction/technology/sidb_defects.hpp>
 #include <fiction/types.hpp>
 #include <fiction/utils/truth_table_utils.hpp>
@@ -142,6 +143,14 @@ TEST_CASE("SiQAD NAND gate", "[is-operational]")
         CHECK(is_operational(lat, std::vector<tt>{create_nand_tt()}, op_params).first ==
               operational_status::OPERATIONAL);
     }
+    SECTION("only pruning in mixed precision")
+    {
+        op_params.strategy_to_analyze_operational_status =
+            is_operational_params::operational_analysis_strategy::FILTER_ONLY;
+        op_params.precision = potential_precision::MIXED;
+        CHECK(is_operational(lat, std::vector<tt>{create_nand_tt()}, op_params).first ==
+              operational_status::OPERATIONAL);
+    }
 
     const auto input_wires =
         detect_bdl_wires(lat, detect_bdl_wires_params{.threshold_bdl_interdistance = 2.0}, bdl_wire_selection::INPUT);
@@ -317,6 +326,48 @@ TEST_CASE("Bestagon AND gate", "[is-operational]")
     }
 }
 
+TEST_CASE("Operational check with early termination", "[is-operational]")
+{
+    const auto lyt = blueprints::bestagon_and<sidb_100_cell_clk_lyt_siqad>();
+
+    is_operational_params op_params{.simulation_parameters = sidb_simulation_parameters{2, -0.32},
+                                    .sim_engine            = sidb_simulation_engine::QUICKEXACT,
+                                    .early_termination     = true};
+
+    SECTION("tolerate kinks")
+    {
+        for (const auto mu_minus : {-0.32, -0.30, -0.25})
+        {
+            op_params.simulation_parameters.mu_minus = mu_minus;
+
+            const auto early_status = is_operational(lyt, std::vector<tt>{create_and_tt()}, op_params).first;
+
+            op_params.early_termination = false;
+
+            CHECK(early_status == is_operational(lyt, std::vector<tt>{create_and_tt()}, op_params).first);
+
+            op_params.early_termination = true;
+        }
+    }
+    SECTION("reject kinks")
+    {
+        const auto or_gate = blueprints::siqad_or_gate<sidb_cell_clk_lyt_siqad>();
+
+        const sidb_100_cell_clk_lyt_siqad lat{or_gate};
+
+        op_params.input_bdl_iterator_params = bdl_input_iterator_params{
+            .bdl_wire_params  = detect_bdl_wires_params{.threshold_bdl_interdistance = 1.5},
+            .input_bdl_config = bdl_input_iterator_params::input_bdl_configuration::PERTURBER_ABSENCE_ENCODED};
+
+        CHECK(is_operational(lat, std::vector<tt>{create_or_tt()}, op_params).first == operational_status::OPERATIONAL);
+
+        op_params.op_condition = is_operational_params::operational_condition::REJECT_KINKS;
+
+        CHECK(is_operational(lat, std::vector<tt>{create_or_tt()}, op_params).first ==
+              operational_status::NON_OPERATIONAL);
+    }
+}
+
 TEST_CASE("SiQAD AND gate", "[is-operational]")
 {
     auto lyt = blueprints::siqad_and_gate<sidb_defect_cell_clk_lyt_siqad>();
@@ -24,9 +24,12 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <optional>
 #include <stdexcept>
+#include <string>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -631,6 +634,130 @@ TEST_CASE("Pinning the thread count does not change the operational domain", "[o
     CHECK(zero_stats.num_evaluated_parameter_combinations == default_stats.num_evaluated_parameter_combinations);
 }
 
+TEST_CASE("Resuming an operational domain computation from its journal", "[operational-domain]")
+{
+    const sidb_100_cell_clk_lyt_siqad lat{blueprints::siqad_and_gate<sidb_cell_clk_lyt_siqad>()};
+
+    const auto journal_file = std::filesystem::temp_directory_path() / "fiction_operational_domain_journal.csv";
+    std::filesystem::remove(journal_file);
+
+    operational_domain_params op_domain_params{};
+    op_domain_params.operational_params.simulation_parameters = sidb_simulation_parameters{2, -0.32};
+    op_domain_params.operational_params.sim_engine            = sidb_simulation_engine::QUICKEXACT;
+    op_domain_params.sweep_dimensions                         = {
+        {.dimension = sweep_parameter::EPSILON_R, .min = 5.5, .max = 5.7, .step = 0.1},
+        {.dimension = sweep_parameter::LAMBDA_TF, .min = 5.0, .max = 5.2, .step = 0.1}};
+    op_domain_params.journal_file = journal_file.string();
+
+    const auto read_rows = [&journal_file]
+    {
+        std::ifstream            is{journal_file};
+        std::vector<std::string> rows{};
+
+        for (std::string row{}; std::getline(is, row);)
+        {
+            rows.push_back(row);
+        }
+
+        return rows;
+    };
+
+    operational_domain_stats full_stats{};
+
+    const auto full_domain =
+        operational_domain_grid_search(lat, std::vector{create_and_tt()}, op_domain_params, &full_stats);
+
+    CHECK(full_stats.num_evaluated_parameter_combinations == 9);
+    CHECK(full_stats.num_resumed_parameter_combinations == 0);
+
+    const auto full_rows = read_rows();
+
+    REQUIRE(full_rows.size() == 10);
+    CHECK(full_rows.front() == "epsilon_r,lambda_tf,operational status");
+
+    const auto check_equal_to_full_domain = [&full_domain](const operational_domain& op_domain)
+    {
+        REQUIRE(op_domain.size() == full_domain.size());
+
+        full_domain.for_each(
+            [&op_domain](const auto& pp, const auto& op_value)
+            {
+                REQUIRE(op_domain.contains(pp).has_value());
+                CHECK(std::get<0>(op_domain.contains(pp).value()) == std::get<0>(op_value));
+            });
+    };
+
+    SECTION("interrupted sweep")
+    {
+        // keep four evaluated points and a row that was cut off while being written
+        {
+            std::ofstream os{journal_file, std::ofstream::out | std::ofstream::trunc};
+
+            for (auto i = 0u; i < 5; ++i)
+            {
+                os << full_rows[i] << '\n';
+            }
+
+            os << full_rows[5].substr(0, 5);
+        }
+
+        operational_domain_stats resumed_stats{};
+
+        const auto resumed_domain =
+            operational_domain_grid_search(lat, std::vector{create_and_tt()}, op_domain_params, &resumed_stats);
+
+        CHECK(resumed_stats.num_resumed_parameter_combinations == 4);
+        CHECK(resumed_stats.num_evaluated_parameter_combinations == 5);
+        CHECK(resumed_stats.num_operational_parameter_combinations == full_stats.num_operational_parameter_combinations);
+
+        check_equal_to_full_domain(resumed_domain);
+
+        // the cut-off row was removed, and the missing points were appended
+        CHECK(read_rows().size() == 10);
+    }
+    SECTION("completed sweep")
+    {
+        operational_domain_stats resumed_stats{};
+
+        const auto resumed_domain =
+            operational_domain_flood_fill(lat, std::vector{create_and_tt()}, 1, op_domain_params, &resumed_stats);
+
+        CHECK(resumed_stats.num_resumed_parameter_combinations == 9);
+        CHECK(resumed_stats.num_evaluated_parameter_combinations == 0);
+        CHECK(resumed_stats.num_simulator_invocations == 0);
+
+        check_equal_to_full_domain(resumed_domain);
+    }
+    SECTION("refined sweep")
+    {
+        // only the points that lie on the finer grid as well are resumed
+        op_domain_params.sweep_dimensions[0].step = 0.05;
+
+        operational_domain_stats resumed_stats{};
+
+        const auto resumed_domain =
+            operational_domain_grid_search(lat, std::vector{create_and_tt()}, op_domain_params, &resumed_stats);
+
+        CHECK(resumed_domain.size() == 15);
+        CHECK(resumed_stats.num_resumed_parameter_combinations == 9);
+        CHECK(resumed_stats.num_evaluated_parameter_combinations == 6);
+    }
+    SECTION("mismatching sweep")
+    {
+        std::swap(op_domain_params.sweep_dimensions[0], op_domain_params.sweep_dimensions[1]);
+
+        CHECK_THROWS_AS(operational_domain_grid_search(lat, std::vector{create_and_tt()}, op_domain_params),
+                        std::invalid_argument);
+    }
+    SECTION("mismatching domain type")
+    {
+        CHECK_THROWS_AS(critical_temperature_domain_grid_search(lat, std::vector{create_and_tt()}, op_domain_params),
+                        std::invalid_argument);
+    }
+
+    std::filesystem::remove(journal_file);
+}
+
 // NOLINTNEXTLINE(*-function-size)
 TEST_CASE("BDL wire operational domain computation", "[operational-domain]")
 {
@@ -1469,6 +1596,302 @@ TEST_CASE("Contour tracing does not retrace an already enclosed area", "[operati
     }
 }
 
+TEST_CASE("Adaptive refinement agrees with grid search", "[operational-domain]")
+{
+    using layout = sidb_cell_clk_lyt_siqad;
+
+    layout lyt{{24, 0}, "BDL wire"};
+
+    lyt.assign_cell_type({0, 0, 0}, sidb_technology::cell_type::INPUT);
+    lyt.assign_cell_type({3, 0, 0}, sidb_technology::cell_type::INPUT);
+
+    lyt.assign_cell_type({6, 0, 0}, sidb_technology::cell_type::NORMAL);
+    lyt.assign_cell_type({8, 0, 0}, sidb_technology::cell_type::NORMAL);
+
+    lyt.assign_cell_type({12, 0, 0}, sidb_technology::cell_type::NORMAL);
+    lyt.assign_cell_type({14, 0, 0}, sidb_technology::cell_type::NORMAL);
+
+    lyt.assign_cell_type({18, 0, 0}, sidb_technology::cell_type::OUTPUT);
+    lyt.assign_cell_type({20, 0, 0}, sidb_technology::cell_type::OUTPUT);
+
+    // output perturber
+    lyt.assign_cell_type({24, 0, 0}, sidb_technology::cell_type::NORMAL);
+
+    const sidb_100_cell_clk_lyt_siqad lat{lyt};
+
+    operational_domain_params op_domain_params{};
+    op_domain_params.operational_params.simulation_parameters = sidb_simulation_parameters{2};
+    // 16 x 16 steps; the operational area is a single connected island of 80 parameter points
+    op_domain_params.sweep_dimensions = {
+        {.dimension = sweep_parameter::EPSILON_R, .min = 0.5, .max = 4.25, .step = 0.25},
+        {.dimension = sweep_parameter::LAMBDA_TF, .min = 0.5, .max = 4.25, .step = 0.25}};
+
+    operational_domain_stats grid_search_stats{};
+
+    const auto grid_search_domain =
+        operational_domain_grid_search(lat, std::vector{create_id_tt()}, op_domain_params, &grid_search_stats);
+
+    const auto check_agreement = [&grid_search_domain](const operational_domain& op_domain)
+    {
+        CHECK(op_domain.size() == grid_search_domain.size());
+
+        op_domain.for_each(
+            [&grid_search_domain](const auto& coord, const auto& op_value)
+            {
+                const auto ground_truth = grid_search_domain.contains(coord);
+
+                REQUIRE(ground_truth.has_value());
+                CHECK(std::get<0>(op_value) == std::get<0>(ground_truth.value()));
+            });
+    };
+
+    SECTION("coarse initial grid")
+    {
+        operational_domain_stats op_domain_stats{};
+
+        const auto op_domain = operational_domain_adaptive_refinement(lat, std::vector{create_id_tt()}, 4,
+                                                                      op_domain_params, &op_domain_stats);
+
+        check_agreement(op_domain);
+
+        // only the cells along the boundary of the operational area are refined
+        CHECK(op_domain_stats.num_evaluated_parameter_combinations < 256);
+        CHECK(op_domain_stats.num_evaluated_parameter_combinations +
+                  op_domain_stats.num_inferred_parameter_combinations ==
+              256);
+        CHECK(op_domain_stats.num_operational_parameter_combinations == 80);
+        CHECK(op_domain_stats.num_non_operational_parameter_combinations == 176);
+        CHECK(op_domain_stats.num_total_parameter_points == 256);
+    }
+    SECTION("initial grid coarser than the sweep")
+    {
+        operational_domain_stats op_domain_stats{};
+
+        const auto op_domain = operational_domain_adaptive_refinement(lat, std::vector{create_id_tt()}, 100,
+                                                                      op_domain_params, &op_domain_stats);
+
+        CHECK(op_domain.size() == 256);
+        CHECK(op_domain_stats.num_evaluated_parameter_combinations +
+                  op_domain_stats.num_inferred_parameter_combinations ==
+              256);
+    }
+    SECTION("initial grid as fine as the sweep")
+    {
+        operational_domain_stats op_domain_stats{};
+
+        const auto op_domain = operational_domain_adaptive_refinement(lat, std::vector{create_id_tt()}, 1,
+                                                                      op_domain_params, &op_domain_stats);
+
+        check_agreement(op_domain);
+
+        CHECK(op_domain_stats.num_evaluated_parameter_combinations == 256);
+        CHECK(op_domain_stats.num_inferred_parameter_combinations == 0);
+    }
+    SECTION("one dimension")
+    {
+        op_domain_params.sweep_dimensions.pop_back();
+
+        const auto line_domain = operational_domain_grid_search(lat, std::vector{create_id_tt()}, op_domain_params);
+
+        const auto op_domain =
+            operational_domain_adaptive_refinement(lat, std::vector{create_id_tt()}, 4, op_domain_params);
+
+        CHECK(op_domain.size() == line_domain.size());
+
+        op_domain.for_each([&line_domain](const auto& coord, const auto& op_value)
+                           { CHECK(std::get<0>(op_value) == std::get<0>(line_domain.contains(coord).value())); });
+    }
+    SECTION("three dimensions")
+    {
+        op_domain_params.sweep_dimensions.push_back(
+            {.dimension = sweep_parameter::MU_MINUS, .min = -0.32, .max = -0.30, .step = 0.01});
+
+        const auto cube_domain = operational_domain_grid_search(lat, std::vector{create_id_tt()}, op_domain_params);
+
+        operational_domain_stats op_domain_stats{};
+
+        const auto op_domain = operational_domain_adaptive_refinement(lat, std::vector{create_id_tt()}, 4,
+                                                                      op_domain_params, &op_domain_stats);
+
+        CHECK(op_domain.size() == cube_domain.size());
+        CHECK(op_domain_stats.num_evaluated_parameter_combinations < cube_domain.size());
+
+        op_domain.for_each([&cube_domain](const auto& coord, const auto& op_value)
+                           { CHECK(std::get<0>(op_value) == std::get<0>(cube_domain.contains(coord).value())); });
+    }
+}
+
+TEST_CASE("Adaptive refinement approximates the grid search of the SiQAD AND gate", "[operational-domain]")
+{
+    const sidb_100_cell_clk_lyt_siqad lat{blueprints::siqad_and_gate<sidb_cell_clk_lyt_siqad>()};
+
+    operational_domain_params op_domain_params{};
+    op_domain_params.operational_params.simulation_parameters = sidb_simulation_parameters{2, -0.32};
+    // 91 x 91 steps; besides the main operational area, there is an operational island of 5 parameter points in a
+    // single row between the points of the coarse grid
+    op_domain_params.sweep_dimensions = {
+        {.dimension = sweep_parameter::EPSILON_R, .min = 1.0, .max = 10.0, .step = 0.1},
+        {.dimension = sweep_parameter::LAMBDA_TF, .min = 1.0, .max = 10.0, .step = 0.1}};
+
+    const auto grid_search_domain = operational_domain_grid_search(lat, std::vector{create_and_tt()}, op_domain_params);
+
+    operational_domain_stats op_domain_stats{};
+
+    const auto op_domain = operational_domain_adaptive_refinement(lat, std::vector{create_and_tt()}, 8,
+                                                                  op_domain_params, &op_domain_stats);
+
+    CHECK(op_domain.size() == grid_search_domain.size());
+
+    std::size_t num_mismatches = 0;
+
+    op_domain.for_each(
+        [&grid_search_domain, &num_mismatches](const auto& coord, const auto& op_value)
+        {
+            const auto ground_truth = grid_search_domain.contains(coord);
+
+            REQUIRE(ground_truth.has_value());
+
+            if (std::get<0>(op_value) != std::get<0>(ground_truth.value()))
+            {
+                ++num_mismatches;
+            }
+        });
+
+    // only the island is missed, whose points are inferred to be non-operational
+    CHECK(num_mismatches <= 5);
+    CHECK(op_domain_stats.num_evaluated_parameter_combinations < grid_search_domain.size() / 5);
+    CHECK(op_domain_stats.num_inferred_parameter_combinations >= num_mismatches);
+}
+
+TEST_CASE("Warm-started operational domain computation", "[operational-domain]")
+{
+    using layout = sidb_cell_clk_lyt_siqad;
+
+    layout lyt{{24, 0}, "BDL wire"};
+
+    lyt.assign_cell_type({0, 0, 0}, sidb_technology::cell_type::INPUT);
+    lyt.assign_cell_type({3, 0, 0}, sidb_technology::cell_type::INPUT);
+
+    lyt.assign_cell_type({6, 0, 0}, sidb_technology::cell_type::NORMAL);
+    lyt.assign_cell_type({8, 0, 0}, sidb_technology::cell_type::NORMAL);
+
+    lyt.assign_cell_type({12, 0, 0}, sidb_technology::cell_type::NORMAL);
+    lyt.assign_cell_type({14, 0, 0}, sidb_technology::cell_type::NORMAL);
+
+    lyt.assign_cell_type({18, 0, 0}, sidb_technology::cell_type::OUTPUT);
+    lyt.assign_cell_type({20, 0, 0}, sidb_technology::cell_type::OUTPUT);
+
+    // output perturber
+    lyt.assign_cell_type({24, 0, 0}, sidb_technology::cell_type::NORMAL);
+
+    const sidb_100_cell_clk_lyt_siqad lat{lyt};
+
+    operational_domain_params op_domain_params{};
+    op_domain_params.operational_params.simulation_parameters = sidb_simulation_parameters{2};
+    op_domain_params.sweep_dimensions = {
+        {.dimension = sweep_parameter::EPSILON_R, .min = 0.5, .max = 4.25, .step = 0.25},
+        {.dimension = sweep_parameter::LAMBDA_TF, .min = 0.5, .max = 4.25, .step = 0.25}};
+
+    const auto cold_domain = operational_domain_grid_search(lat, std::vector{create_id_tt()}, op_domain_params);
+
+    // warm-starting QuickExact requires its branch-and-bound enumeration
+    op_domain_params.warm_start                           = true;
+    op_domain_params.operational_params.early_termination = true;
+
+    const auto check_agreement = [&cold_domain](const operational_domain& op_domain)
+    {
+        op_domain.for_each(
+            [&cold_domain](const auto& coord, const auto& op_value)
+            {
+                const auto ground_truth = cold_domain.contains(coord);
+
+                REQUIRE(ground_truth.has_value());
+                CHECK(std::get<0>(op_value) == std::get<0>(ground_truth.value()));
+            });
+    };
+
+    SECTION("grid search")
+    {
+        // a single thread evaluates the parameter points in order, such that each has an evaluated neighbor
+        op_domain_params.number_of_threads = 1;
+
+        operational_domain_stats op_domain_stats{};
+
+        const auto op_domain =
+            operational_domain_grid_search(lat, std::vector{create_id_tt()}, op_domain_params, &op_domain_stats);
+
+        CHECK(op_domain.size() == cold_domain.size());
+        check_agreement(op_domain);
+
+        CHECK(op_domain_stats.num_warm_started_parameter_combinations > 0);
+        CHECK(op_domain_stats.num_warm_started_parameter_combinations <
+              op_domain_stats.num_evaluated_parameter_combinations);
+    }
+    SECTION("flood fill")
+    {
+        operational_domain_stats op_domain_stats{};
+
+        const auto op_domain =
+            operational_domain_flood_fill(lat, std::vector{create_id_tt()}, 50, op_domain_params, &op_domain_stats);
+
+        check_agreement(op_domain);
+
+        CHECK(op_domain_stats.num_operational_parameter_combinations == 80);
+        CHECK(op_domain_stats.num_warm_started_parameter_combinations > 0);
+    }
+    SECTION("adaptive refinement")
+    {
+        operational_domain_stats op_domain_stats{};
+
+        const auto op_domain = operational_domain_adaptive_refinement(lat, std::vector{create_id_tt()}, 4,
+                                                                      op_domain_params, &op_domain_stats);
+
+        CHECK(op_domain.size() == cold_domain.size());
+        check_agreement(op_domain);
+
+        CHECK(op_domain_stats.num_warm_started_parameter_combinations > 0);
+    }
+    SECTION("Gray code enumeration")
+    {
+        op_domain_params.operational_params.early_termination = false;
+        op_domain_params.number_of_threads                    = 1;
+
+        operational_domain_stats op_domain_stats{};
+
+        const auto op_domain =
+            operational_domain_grid_search(lat, std::vector{create_id_tt()}, op_domain_params, &op_domain_stats);
+
+        check_agreement(op_domain);
+
+        // the Gray code enumeration cannot exploit the ground states of the neighbors
+        CHECK(op_domain_stats.num_warm_started_parameter_combinations == 0);
+    }
+    SECTION("QuickSim")
+    {
+        op_domain_params.operational_params.sim_engine = sidb_simulation_engine::QUICKSIM;
+        op_domain_params.number_of_threads             = 1;
+
+        operational_domain_stats op_domain_stats{};
+
+        SECTION("default number of warm-started iterations")
+        {
+            CHECK(op_domain_params.operational_params.warm_start_iteration_steps == 100);
+        }
+        SECTION("as many warm-started iterations as cold ones")
+        {
+            op_domain_params.operational_params.warm_start_iteration_steps = 500;
+        }
+
+        const auto op_domain =
+            operational_domain_grid_search(lat, std::vector{create_id_tt()}, op_domain_params, &op_domain_stats);
+
+        CHECK(op_domain.size() == cold_domain.size());
+        check_agreement(op_domain);
+
+        CHECK(op_domain_stats.num_warm_started_parameter_combinations > 0);
+    }
+}
+
 TEST_CASE("Parallel flood fill yields deterministic results", "[operational-domain]")
 {
     using layout = sidb_cell_clk_lyt_siqad;
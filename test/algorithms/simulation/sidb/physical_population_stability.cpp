@@ -15,7 +15,12 @@
 #include <fiction/technology/sidb_lattice_orientations.hpp>
 #include <fiction/types.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
 
 using namespace fiction;
 
@@ -393,3 +398,64 @@ TEST_CASE("Bestagon CX gate input 11", "[assess-physical-population-stability],
             Catch::Matchers::WithinAbs(6.88, 1e-5));
     }
 }
+
+TEST_CASE("Population stability of many layouts", "[assess-physical-population-stability]")
+{
+    sidb_100_cell_clk_lyt_siqad single{};
+    single.assign_cell_type({1, 1, 0}, sidb_technology::cell_type::NORMAL);
+
+    sidb_100_cell_clk_lyt_siqad three{};
+    three.assign_cell_type({1, 1, 0}, sidb_technology::cell_type::NORMAL);
+    three.assign_cell_type({1, 1, 1}, sidb_technology::cell_type::NORMAL);
+    three.assign_cell_type({2, 1, 0}, sidb_technology::cell_type::NORMAL);
+
+    const std::vector<sidb_100_cell_clk_lyt_siqad> layouts{three, single, sidb_100_cell_clk_lyt_siqad{}, three};
+
+    for (const auto num_threads : {std::size_t{1}, std::size_t{3}})
+    {
+        physical_population_stability_batch_params params{};
+        params.number_of_threads = num_threads;
+
+        const auto batch_result = physical_population_stability_batch(layouts, params);
+        REQUIRE(batch_result.size() == layouts.size());
+
+        CHECK(batch_result[2].empty());
+
+        for (const auto i : {std::size_t{0}, std::size_t{1}, std::size_t{3}})
+        {
+            const auto result = physical_population_stability(layouts[i], params.stability_params);
+            REQUIRE(batch_result[i].size() == result.size());
+
+            // the critical SiDBs are given as indices into the ascending order of the cells
+            std::vector<siqad::coord_t> cells{};
+            layouts[i].foreach_cell([&cells](const auto& c) { cells.push_back(c); });
+            std::sort(cells.begin(), cells.end());
+
+            for (std::size_t j = 0; j < result.size(); ++j)
+            {
+                CHECK_THAT(batch_result[i][j].system_energy,
+                           Catch::Matchers::WithinAbs(result[j].system_energy, 1e-9));
+
+                for (const auto& [type, transition] : result[j].transition_potentials)
+                {
+                    const auto potential = batch_result[i][j].transition_potential(type);
+                    const auto index     = batch_result[i][j].critical_sidb_indices[static_cast<std::size_t>(type)];
+
+                    if (std::isinf(transition.second))
+                    {
+                        CHECK(std::isinf(potential));
+                        CHECK(index == std::numeric_limits<uint64_t>::max());
+                    }
+                    else
+                    {
+                        CHECK_THAT(potential, Catch::Matchers::WithinAbs(transition.second, 1e-9));
+                        REQUIRE(index < cells.size());
+                        CHECK(cells[index] == transition.first);
+                    }
+                }
+            }
+        }
+
+        CHECK_THAT(batch_result[1].front().minimum_transition_potential(), Catch::Matchers::WithinAbs(0.32, 1e-9));
+    }
+}
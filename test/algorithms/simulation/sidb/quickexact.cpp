@@ -22,8 +22,11 @@
 #include <fiction/types.hpp>
 #include <fiction/utils/math_utils.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <map>
 #include <set>
+#include <vector>
 
 using namespace fiction;
 
@@ -1408,6 +1411,689 @@ TEMPLATE_TEST_CASE("QuickExact simulation of a Y-shaped SiDB OR gate with input
     }
 }
 
+TEMPLATE_TEST_CASE("Multi-threaded QuickExact simulation", "[quickexact]", (sidb_100_cell_clk_lyt_siqad),
+                   (cds_sidb_100_cell_clk_lyt_siqad))
+{
+    const auto check_equivalence_to_single_threaded_simulation =
+        [](const TestType& lyt, const quickexact_params<cell<TestType>>& params)
+    {
+        const auto single_threaded_result = quickexact<TestType>(lyt, params);
+
+        for (const auto num_threads : {uint64_t{0}, uint64_t{2}, uint64_t{3}, uint64_t{8}, uint64_t{1000}})
+        {
+            auto multi_threaded_params              = params;
+            multi_threaded_params.number_of_threads = num_threads;
+
+            const auto multi_threaded_result = quickexact<TestType>(lyt, multi_threaded_params);
+
+            REQUIRE(multi_threaded_result.charge_distributions.size() ==
+                    single_threaded_result.charge_distributions.size());
+
+            // charge distributions are returned in the same order as in the single-threaded simulation
+            for (auto i = 0u; i < single_threaded_result.charge_distributions.size(); ++i)
+            {
+                const auto& expected = single_threaded_result.charge_distributions[i];
+                const auto& actual   = multi_threaded_result.charge_distributions[i];
+
+                CHECK(actual.get_charge_index_and_base() == expected.get_charge_index_and_base());
+                CHECK_THAT(actual.get_electrostatic_potential_energy(),
+                           Catch::Matchers::WithinAbs(expected.get_electrostatic_potential_energy(),
+                                                      constants::ERROR_MARGIN));
+            }
+        }
+    };
+
+    SECTION("2-state simulation of a Y-shaped SiDB OR gate")
+    {
+        TestType lyt{};
+
+        lyt.assign_cell_type({6, 2, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({8, 3, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({12, 3, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({14, 2, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({10, 5, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({10, 6, 1}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({10, 8, 1}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({16, 1, 0}, TestType::cell_type::NORMAL);
+
+        check_equivalence_to_single_threaded_simulation(
+            lyt, quickexact_params<cell<TestType>>{sidb_simulation_parameters{2, -0.28}});
+    }
+
+    SECTION("3-state simulation of closely spaced SiDBs")
+    {
+        TestType lyt{};
+
+        lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({4, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({6, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({11, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({12, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({11, 0, 1}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({12, 0, 1}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({18, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({20, 0, 0}, TestType::cell_type::NORMAL);
+
+        check_equivalence_to_single_threaded_simulation(
+            lyt, quickexact_params<cell<TestType>>{
+                     sidb_simulation_parameters{3, -0.32},
+                     quickexact_params<cell<TestType>>::automatic_base_number_detection::OFF});
+    }
+
+    SECTION("3-state simulation of a dense SiDB wire")
+    {
+        TestType lyt{};
+
+        for (auto x = 0; x < 7; ++x)
+        {
+            lyt.assign_cell_type({x, 0, 0}, TestType::cell_type::NORMAL);
+        }
+
+        check_equivalence_to_single_threaded_simulation(
+            lyt, quickexact_params<cell<TestType>>{sidb_simulation_parameters{3, -0.25}});
+    }
+}
+
+TEMPLATE_TEST_CASE("QuickExact simulation with compact charge distributions", "[quickexact]",
+                   (sidb_100_cell_clk_lyt_siqad), (cds_sidb_100_cell_clk_lyt_siqad))
+{
+    const auto check_equivalence_to_full_charge_distributions =
+        [](const TestType& lyt, const quickexact_params<cell<TestType>>& params)
+    {
+        const auto full_result = quickexact<TestType>(lyt, params);
+
+        for (const auto num_threads : {uint64_t{1}, uint64_t{4}})
+        {
+            auto compact_params              = params;
+            compact_params.result_format     = charge_distribution_format::COMPACT;
+            compact_params.number_of_threads = num_threads;
+
+            const auto compact_result = quickexact<TestType>(lyt, compact_params);
+
+            CHECK(compact_result.charge_distributions.empty());
+            REQUIRE(compact_result.compact_charge_distribution_context != nullptr);
+            REQUIRE(compact_result.num_charge_distributions() == full_result.num_charge_distributions());
+
+            const auto materialized_charge_distributions = compact_result.materialize_charge_distributions();
+
+            for (auto i = 0u; i < full_result.charge_distributions.size(); ++i)
+            {
+                const auto& expected = full_result.charge_distributions[i];
+
+                CHECK(compact_result.compact_charge_distributions[i].get_all_sidb_charges() ==
+                      expected.get_all_sidb_charges());
+                CHECK(compact_result.compact_charge_distributions[i].get_charge_index_and_base() ==
+                      expected.get_charge_index_and_base());
+                CHECK_THAT(compact_result.compact_charge_distributions[i].get_electrostatic_potential_energy(),
+                           Catch::Matchers::WithinAbs(expected.get_electrostatic_potential_energy(),
+                                                      constants::ERROR_MARGIN));
+
+                CHECK(materialized_charge_distributions[i].get_all_sidb_charges() == expected.get_all_sidb_charges());
+                CHECK_THAT(materialized_charge_distributions[i].get_electrostatic_potential_energy(),
+                           Catch::Matchers::WithinAbs(expected.get_electrostatic_potential_energy(),
+                                                      constants::ERROR_MARGIN));
+            }
+
+            const auto expected_ground_states = full_result.groundstates();
+            const auto ground_states          = compact_result.groundstates();
+
+            REQUIRE(ground_states.size() == expected_ground_states.size());
+
+            for (auto i = 0u; i < expected_ground_states.size(); ++i)
+            {
+                CHECK(ground_states[i].get_all_sidb_charges() == expected_ground_states[i].get_all_sidb_charges());
+                CHECK_THAT(ground_states[i].get_electrostatic_potential_energy(),
+                           Catch::Matchers::WithinAbs(expected_ground_states[i].get_electrostatic_potential_energy(),
+                                                      constants::ERROR_MARGIN));
+            }
+        }
+    };
+
+    SECTION("single SiDB")
+    {
+        TestType lyt{};
+
+        lyt.assign_cell_type({1, 2, 0}, TestType::cell_type::NORMAL);
+
+        check_equivalence_to_full_charge_distributions(
+            lyt, quickexact_params<cell<TestType>>{sidb_simulation_parameters{3, -0.25}});
+    }
+
+    SECTION("SiDBs that are all pre-assigned to be negatively charged")
+    {
+        TestType lyt{};
+
+        lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({100, 0, 0}, TestType::cell_type::NORMAL);
+
+        check_equivalence_to_full_charge_distributions(
+            lyt, quickexact_params<cell<TestType>>{sidb_simulation_parameters{2, -0.32}});
+    }
+
+    SECTION("2-state simulation of a Y-shaped SiDB OR gate with a distant perturber")
+    {
+        TestType lyt{};
+
+        lyt.assign_cell_type({6, 2, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({8, 3, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({12, 3, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({14, 2, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({10, 5, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({10, 6, 1}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({10, 8, 1}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({16, 1, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({60, 20, 0}, TestType::cell_type::NORMAL);
+
+        check_equivalence_to_full_charge_distributions(
+            lyt, quickexact_params<cell<TestType>>{sidb_simulation_parameters{2, -0.28}});
+    }
+
+    SECTION("3-state simulation of a dense SiDB wire")
+    {
+        TestType lyt{};
+
+        for (auto x = 0; x < 7; ++x)
+        {
+            lyt.assign_cell_type({x, 0, 0}, TestType::cell_type::NORMAL);
+        }
+
+        check_equivalence_to_full_charge_distributions(
+            lyt, quickexact_params<cell<TestType>>{sidb_simulation_parameters{3, -0.25}});
+    }
+}
+
+TEMPLATE_TEST_CASE("QuickExact batch simulation of layouts sharing a skeleton", "[quickexact]",
+                   (sidb_100_cell_clk_lyt_siqad), (cds_sidb_100_cell_clk_lyt_siqad))
+{
+    TestType skeleton{};
+
+    skeleton.assign_cell_type({6, 2, 0}, TestType::cell_type::NORMAL);
+    skeleton.assign_cell_type({8, 3, 0}, TestType::cell_type::NORMAL);
+    skeleton.assign_cell_type({12, 3, 0}, TestType::cell_type::NORMAL);
+    skeleton.assign_cell_type({14, 2, 0}, TestType::cell_type::NORMAL);
+    skeleton.assign_cell_type({10, 5, 0}, TestType::cell_type::NORMAL);
+    skeleton.assign_cell_type({10, 6, 1}, TestType::cell_type::NORMAL);
+    skeleton.assign_cell_type({10, 8, 1}, TestType::cell_type::NORMAL);
+    skeleton.assign_cell_type({16, 1, 0}, TestType::cell_type::NORMAL);
+
+    const std::vector<sidb_layout_delta<cell<TestType>>> deltas{
+        {},
+        {{{0, 0, 1}}, {{16, 1, 0}}},
+        {{{20, 0, 1}}, {{6, 2, 0}}},
+        {{{0, 0, 1}, {20, 0, 1}}, {{6, 2, 0}, {16, 1, 0}}},
+        {{{10, 10, 1}}, {}},
+        {{}, {{10, 8, 1}, {10, 6, 1}}}};
+
+    const auto check_equivalence_to_individual_simulations =
+        [&skeleton, &deltas](const quickexact_batch_params<cell<TestType>>& params)
+    {
+        const auto batch_results = quickexact_batch(skeleton, deltas, params);
+
+        REQUIRE(batch_results.size() == deltas.size());
+
+        for (auto i = 0u; i < deltas.size(); ++i)
+        {
+            auto lyt = skeleton.clone();
+
+            for (const auto& c : deltas[i].removed_sidbs)
+            {
+                lyt.assign_cell_type(c, TestType::cell_type::EMPTY);
+            }
+
+            for (const auto& c : deltas[i].added_sidbs)
+            {
+                lyt.assign_cell_type(c, TestType::cell_type::NORMAL);
+            }
+
+            const auto expected = quickexact(lyt, params.simulation_params);
+            const auto& actual  = batch_results[i];
+
+            CHECK(actual.algorithm_name == "QuickExact");
+            REQUIRE(actual.charge_distributions.size() == expected.charge_distributions.size());
+
+            for (auto j = 0u; j < expected.charge_distributions.size(); ++j)
+            {
+                const auto& expected_cds = expected.charge_distributions[j];
+                const auto& actual_cds   = actual.charge_distributions[j];
+
+                CHECK(actual_cds.num_cells() == lyt.num_cells());
+                CHECK(actual_cds.get_all_sidb_charges() == expected_cds.get_all_sidb_charges());
+                CHECK_THAT(actual_cds.get_electrostatic_potential_energy(),
+                           Catch::Matchers::WithinAbs(expected_cds.get_electrostatic_potential_energy(),
+                                                      constants::ERROR_MARGIN));
+            }
+        }
+    };
+
+    SECTION("empty batch")
+    {
+        CHECK(quickexact_batch(skeleton, std::vector<sidb_layout_delta<cell<TestType>>>{}).empty());
+    }
+
+    for (const auto num_threads : {uint64_t{0}, uint64_t{1}, uint64_t{3}, uint64_t{100}})
+    {
+        quickexact_batch_params<cell<TestType>> params{};
+        params.simulation_params = quickexact_params<cell<TestType>>{sidb_simulation_parameters{2, -0.28}};
+        params.number_of_threads = num_threads;
+
+        check_equivalence_to_individual_simulations(params);
+    }
+
+    SECTION("3-state simulation")
+    {
+        quickexact_batch_params<cell<TestType>> params{};
+        params.simulation_params = quickexact_params<cell<TestType>>{sidb_simulation_parameters{3, -0.32}};
+
+        check_equivalence_to_individual_simulations(params);
+    }
+}
+
+template <typename Lyt>
+static void check_branch_and_bound_equivalence(const Lyt& lyt, const quickexact_params<cell<Lyt>>& params)
+{
+    auto bnb_params        = params;
+    bnb_params.enumeration = quickexact_params<cell<Lyt>>::charge_enumeration::BRANCH_AND_BOUND;
+
+    const auto gray_code_result = quickexact<Lyt>(lyt, params);
+    const auto bnb_result       = quickexact<Lyt>(lyt, bnb_params);
+
+    // the charge distributions are found in a different order
+    const auto collect_charge_distributions = [](const std::vector<charge_distribution_surface<Lyt>>& cds)
+    {
+        std::map<uint64_t, double> charge_distributions{};
+
+        for (const auto& c : cds)
+        {
+            c.charge_distribution_to_index_general();
+            charge_distributions.emplace(c.get_charge_index_and_base().first, c.get_electrostatic_potential_energy());
+        }
+
+        return charge_distributions;
+    };
+
+    const auto expected = collect_charge_distributions(gray_code_result.charge_distributions);
+    const auto actual   = collect_charge_distributions(bnb_result.charge_distributions);
+
+    CHECK(bnb_result.algorithm_name == "QuickExact");
+    CHECK(bnb_result.charge_distributions.size() == gray_code_result.charge_distributions.size());
+    REQUIRE(actual.size() == expected.size());
+
+    for (const auto& [charge_index, energy] : expected)
+    {
+        REQUIRE(actual.contains(charge_index));
+        CHECK_THAT(actual.at(charge_index), Catch::Matchers::WithinAbs(energy, constants::ERROR_MARGIN));
+    }
+
+    // only the ground states are requested
+    bnb_params.result_mode = simulation_result_mode::GROUND_STATE_ONLY;
+
+    auto gray_code_selection_params        = params;
+    gray_code_selection_params.result_mode = simulation_result_mode::GROUND_STATE_ONLY;
+
+    const auto expected_ground_states = collect_charge_distributions(gray_code_result.groundstates());
+    const auto bnb_ground_states = collect_charge_distributions(quickexact<Lyt>(lyt, bnb_params).charge_distributions);
+    const auto gray_code_ground_states =
+        collect_charge_distributions(quickexact<Lyt>(lyt, gray_code_selection_params).charge_distributions);
+
+    CHECK(bnb_ground_states == expected_ground_states);
+    CHECK(gray_code_ground_states == expected_ground_states);
+
+    // only the charge distributions of the lowest energies are requested
+    std::vector<double> energies{};
+
+    for (const auto& cds : gray_code_result.charge_distributions)
+    {
+        energies.push_back(cds.get_electrostatic_potential_energy());
+    }
+
+    std::ranges::sort(energies);
+
+    for (const uint64_t k : {1u, 3u})
+    {
+        bnb_params.result_mode                                    = simulation_result_mode::LOWEST_K;
+        bnb_params.number_of_lowest_energy_states                 = k;
+        gray_code_selection_params.result_mode                    = simulation_result_mode::LOWEST_K;
+        gray_code_selection_params.number_of_lowest_energy_states = k;
+
+        const auto bnb_lowest       = quickexact<Lyt>(lyt, bnb_params).charge_distributions;
+        const auto gray_code_lowest = quickexact<Lyt>(lyt, gray_code_selection_params).charge_distributions;
+
+        REQUIRE(bnb_lowest.size() == std::min(k, static_cast<uint64_t>(energies.size())));
+        REQUIRE(gray_code_lowest.size() == bnb_lowest.size());
+
+        for (uint64_t i = 0; i < bnb_lowest.size(); ++i)
+        {
+            CHECK_THAT(bnb_lowest[i].get_electrostatic_potential_energy(),
+                       Catch::Matchers::WithinAbs(energies[i], constants::ERROR_MARGIN));
+            CHECK_THAT(gray_code_lowest[i].get_electrostatic_potential_energy(),
+                       Catch::Matchers::WithinAbs(energies[i], constants::ERROR_MARGIN));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("QuickExact simulation with branch-and-bound enumeration", "[quickexact]",
+                   (sidb_100_cell_clk_lyt_siqad), (cds_sidb_100_cell_clk_lyt_siqad))
+{
+    SECTION("single SiDB")
+    {
+        TestType lyt{};
+
+        lyt.assign_cell_type({1, 3, 0}, TestType::cell_type::NORMAL);
+
+        check_branch_and_bound_equivalence(
+            lyt, quickexact_params<cell<TestType>>{sidb_simulation_parameters{2, -0.32}});
+    }
+
+    SECTION("BDL pair with a perturber")
+    {
+        TestType lyt{};
+
+        lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({5, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({7, 0, 0}, TestType::cell_type::NORMAL);
+
+        check_branch_and_bound_equivalence(
+            lyt, quickexact_params<cell<TestType>>{sidb_simulation_parameters{2, -0.32}});
+    }
+
+    SECTION("2-state simulation of a Y-shaped SiDB OR gate")
+    {
+        TestType lyt{};
+
+        lyt.assign_cell_type({6, 2, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({8, 3, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({12, 3, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({14, 2, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({10, 5, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({10, 6, 1}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({10, 8, 1}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({16, 1, 0}, TestType::cell_type::NORMAL);
+
+        check_branch_and_bound_equivalence(
+            lyt, quickexact_params<cell<TestType>>{sidb_simulation_parameters{2, -0.28}});
+    }
+
+    SECTION("3-state simulation of closely spaced SiDBs")
+    {
+        TestType lyt{};
+
+        lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({4, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({6, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({11, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({12, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({11, 0, 1}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({12, 0, 1}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({18, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({20, 0, 0}, TestType::cell_type::NORMAL);
+
+        check_branch_and_bound_equivalence(
+            lyt, quickexact_params<cell<TestType>>{
+                     sidb_simulation_parameters{3, -0.32},
+                     quickexact_params<cell<TestType>>::automatic_base_number_detection::OFF});
+    }
+
+    SECTION("3-state simulation of a dense SiDB wire")
+    {
+        TestType lyt{};
+
+        for (auto x = 0; x < 7; ++x)
+        {
+            lyt.assign_cell_type({x, 0, 0}, TestType::cell_type::NORMAL);
+        }
+
+        check_branch_and_bound_equivalence(
+            lyt, quickexact_params<cell<TestType>>{sidb_simulation_parameters{3, -0.25}});
+    }
+
+    SECTION("external potentials")
+    {
+        TestType lyt{};
+
+        lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({3, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({5, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({8, 1, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({10, 1, 0}, TestType::cell_type::NORMAL);
+
+        quickexact_params<cell<TestType>> params{sidb_simulation_parameters{3, -0.32}};
+        params.global_potential = -0.05;
+        params.local_external_potential.insert({{3, 0, 0}, -0.2});
+        params.local_external_potential.insert({{10, 1, 0}, 0.1});
+
+        check_branch_and_bound_equivalence(lyt, params);
+    }
+}
+
+TEMPLATE_TEST_CASE("QuickExact simulation with branch-and-bound enumeration and a charge state hint", "[quickexact]",
+                   (sidb_100_cell_clk_lyt_siqad), (cds_sidb_100_cell_clk_lyt_siqad))
+{
+    TestType lyt{};
+
+    lyt.assign_cell_type({6, 2, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({8, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({12, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({14, 2, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 5, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 6, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 8, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({16, 1, 0}, TestType::cell_type::NORMAL);
+
+    quickexact_params<cell<TestType>> params{sidb_simulation_parameters{2, -0.28}};
+    params.enumeration = quickexact_params<cell<TestType>>::charge_enumeration::BRANCH_AND_BOUND;
+    params.result_mode = simulation_result_mode::GROUND_STATE_ONLY;
+
+    const auto ground_states_of = [&lyt](const quickexact_params<cell<TestType>>& ps)
+    {
+        std::set<std::vector<sidb_charge_state>> ground_states{};
+
+        for (const auto& gs : quickexact<TestType>(lyt, ps).groundstates())
+        {
+            ground_states.insert(gs.get_all_sidb_charges());
+        }
+
+        return ground_states;
+    };
+
+    const auto expected = ground_states_of(params);
+
+    REQUIRE(!expected.empty());
+
+    // a ground state at a slightly different chemical potential
+    auto neighbor_params                           = params;
+    neighbor_params.simulation_parameters.mu_minus = -0.30;
+
+    const auto neighbor_ground_state = quickexact<TestType>(lyt, neighbor_params).groundstates().front();
+
+    SECTION("hint of a neighboring ground state")
+    {
+        neighbor_ground_state.foreach_cell(
+            [&neighbor_ground_state, &params](const auto& c)
+            { params.charge_state_hint[c] = neighbor_ground_state.get_charge_state(c); });
+
+        CHECK(ground_states_of(params) == expected);
+    }
+    SECTION("hint of a physically invalid charge distribution")
+    {
+        lyt.foreach_cell([&params](const auto& c) { params.charge_state_hint[c] = sidb_charge_state::NEUTRAL; });
+
+        CHECK(ground_states_of(params) == expected);
+    }
+    SECTION("partial hint")
+    {
+        params.charge_state_hint[{10, 8, 1}] = sidb_charge_state::NEGATIVE;
+        params.charge_state_hint[{42, 0, 0}] = sidb_charge_state::NEUTRAL;
+
+        CHECK(ground_states_of(params) == expected);
+    }
+}
+
+TEMPLATE_TEST_CASE("QuickExact simulation with branch-and-bound enumeration and defects", "[quickexact]",
+                   (sidb_defect_surface<sidb_100_cell_clk_lyt_siqad>),
+                   (charge_distribution_surface<sidb_defect_surface<sidb_100_cell_clk_lyt_siqad>>))
+{
+    TestType lyt{};
+
+    lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({5, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({8, 1, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 1, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({16, 0, 0}, TestType::cell_type::NORMAL);
+
+    const quickexact_params<cell<TestType>> params{sidb_simulation_parameters{2, -0.25}};
+
+    lyt.assign_sidb_defect({7, 0, 0}, sidb_defect{sidb_defect_type::UNKNOWN, -1, params.simulation_parameters.epsilon_r,
+                                                  params.simulation_parameters.lambda_tf});
+    lyt.assign_sidb_defect({13, 2, 0}, sidb_defect{sidb_defect_type::UNKNOWN, 1, 9.7, 2.1});
+
+    check_branch_and_bound_equivalence(lyt, params);
+}
+
+TEMPLATE_TEST_CASE("QuickExact simulation with a selection of the charge distributions", "[quickexact]",
+                   (sidb_100_cell_clk_lyt_siqad), (cds_sidb_100_cell_clk_lyt_siqad))
+{
+    TestType lyt{};
+
+    // two rows of SiDBs with several degenerate ground states and metastable states
+    for (const auto x : {0, 4, 8, 12, 16})
+    {
+        lyt.assign_cell_type({x, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({x, 2, 0}, TestType::cell_type::NORMAL);
+    }
+
+    quickexact_params<cell<TestType>> params{sidb_simulation_parameters{2, -0.25}};
+
+    const auto all_valid = quickexact(lyt, params);
+
+    REQUIRE(all_valid.charge_distributions.size() > 3);
+
+    std::vector<double> energies{};
+
+    for (const auto& cds : all_valid.charge_distributions)
+    {
+        energies.push_back(cds.get_electrostatic_potential_energy());
+    }
+
+    std::ranges::sort(energies);
+
+    const auto ground_states = all_valid.groundstates();
+
+    for (const auto number_of_threads : {uint64_t{1}, uint64_t{4}})
+    {
+        for (const auto format : {charge_distribution_format::FULL, charge_distribution_format::COMPACT})
+        {
+            params.number_of_threads = number_of_threads;
+            params.result_format     = format;
+
+            params.result_mode = simulation_result_mode::GROUND_STATE_ONLY;
+
+            const auto ground_state_result = quickexact(lyt, params);
+
+            REQUIRE(ground_state_result.num_charge_distributions() == ground_states.size());
+
+            std::set<std::vector<sidb_charge_state>> expected_charges{};
+            std::set<std::vector<sidb_charge_state>> selected_charges{};
+
+            for (const auto& gs : ground_states)
+            {
+                expected_charges.insert(gs.get_all_sidb_charges());
+            }
+
+            for (const auto& gs : ground_state_result.groundstates())
+            {
+                selected_charges.insert(gs.get_all_sidb_charges());
+            }
+
+            CHECK(selected_charges == expected_charges);
+
+            params.result_mode                    = simulation_result_mode::LOWEST_K;
+            params.number_of_lowest_energy_states = 3;
+
+            const auto lowest_result = quickexact(lyt, params);
+
+            REQUIRE(lowest_result.num_charge_distributions() == 3);
+
+            for (uint64_t i = 0; i < 3; ++i)
+            {
+                const auto& compact = lowest_result.compact_charge_distributions;
+
+                const auto energy = format == charge_distribution_format::FULL ?
+                                        lowest_result.charge_distributions[i].get_electrostatic_potential_energy() :
+                                        compact[i].get_electrostatic_potential_energy();
+
+                CHECK_THAT(energy, Catch::Matchers::WithinAbs(energies[i], constants::ERROR_MARGIN));
+            }
+
+            params.result_mode = simulation_result_mode::ALL_VALID;
+
+            CHECK(quickexact(lyt, params).num_charge_distributions() == all_valid.charge_distributions.size());
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("QuickExact simulation with a ground state callback", "[quickexact]",
+                   (sidb_100_cell_clk_lyt_siqad), (cds_sidb_100_cell_clk_lyt_siqad))
+{
+    TestType lyt{};
+
+    for (const auto x : {0, 4, 8, 12, 16})
+    {
+        lyt.assign_cell_type({x, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({x, 2, 0}, TestType::cell_type::NORMAL);
+    }
+
+    quickexact_params<cell<TestType>> params{sidb_simulation_parameters{2, -0.25}};
+
+    std::set<std::vector<sidb_charge_state>> expected_charges{};
+
+    for (const auto& gs : quickexact(lyt, params).groundstates())
+    {
+        expected_charges.insert(gs.get_all_sidb_charges());
+    }
+
+    REQUIRE(expected_charges.size() > 1);
+
+    for (const auto enumeration : {quickexact_params<cell<TestType>>::charge_enumeration::GRAY_CODE,
+                                   quickexact_params<cell<TestType>>::charge_enumeration::BRANCH_AND_BOUND})
+    {
+        for (const auto mode : {simulation_result_mode::ALL_VALID, simulation_result_mode::GROUND_STATE_ONLY})
+        {
+            params.enumeration = enumeration;
+            params.result_mode = mode;
+
+            // all ground states are reported once
+            std::vector<std::vector<sidb_charge_state>> reported_charges{};
+
+            const auto result = quickexact(lyt, params,
+                                           [&reported_charges](const auto& gs)
+                                           {
+                                               reported_charges.push_back(gs.get_all_sidb_charges());
+                                               return true;
+                                           });
+
+            CHECK(reported_charges.size() == expected_charges.size());
+            CHECK(std::set<std::vector<sidb_charge_state>>{reported_charges.cbegin(), reported_charges.cend()} ==
+                  expected_charges);
+            CHECK(result.groundstates().size() == expected_charges.size());
+
+            // the simulation is aborted after the first ground state
+            uint64_t number_of_reports = 0;
+
+            const auto aborted_result = quickexact(lyt, params,
+                                                   [&number_of_reports, &expected_charges](const auto& gs)
+                                                   {
+                                                       ++number_of_reports;
+                                                       CHECK(expected_charges.contains(gs.get_all_sidb_charges()));
+                                                       return false;
+                                                   });
+
+            CHECK(number_of_reports == 1);
+            CHECK(aborted_result.num_charge_distributions() >= 1);
+        }
+    }
+}
+
 // to save runtime in the CI, this test is only run in RELEASE mode
 #ifdef NDEBUG
 TEMPLATE_TEST_CASE("QuickExact simulation of a Y-shaped SiDB OR gate with input 01", "[quickexact], [quality]",
@@ -363,6 +363,24 @@ TEMPLATE_TEST_CASE("QuickSim simulation of a Y-shaped SiDB arrangement with vary
         check_for_runtime_measurement(simulation_results.value());
         check_charge_configuration(simulation_results.value());
     }
+    SECTION("Mixed precision")
+    {
+        quicksim_params.precision = potential_precision::MIXED;
+
+        const auto simulation_results = quicksim<TestType>(lyt, quicksim_params);
+        REQUIRE(simulation_results.has_value());
+
+        check_for_absence_of_positive_charges(simulation_results.value());
+        check_for_runtime_measurement(simulation_results.value());
+        check_charge_configuration(simulation_results.value());
+
+        // the returned charge distributions are confirmed in double precision
+        for (const auto& cds : simulation_results.value().charge_distributions)
+        {
+            CHECK(cds.get_potential_precision() == potential_precision::DOUBLE);
+            CHECK(cds.is_physically_valid());
+        }
+    }
 }
 
 TEMPLATE_TEST_CASE("QuickSim simulation of a Y-shaped SiDB OR gate with input 01 and varying thread counts",
@@ -7,8 +7,12 @@
 
 #include <fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp>
 #include <fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp>
+#include <fiction/technology/charge_distribution_surface.hpp>
+#include <fiction/technology/compact_charge_distribution.hpp>
 #include <fiction/types.hpp>
 
+#include <memory>
+
 using namespace fiction;
 
 TEST_CASE("Determine the groundstate from simulation results", "[sidb-simulation-result]")
@@ -141,3 +145,62 @@ TEMPLATE_TEST_CASE("Determine the groundstate of a two BDL pair wire with input
     const auto ground_state = results.groundstates();
     REQUIRE(ground_state.size() == 2);
 }
+
+TEST_CASE("Determine the groundstate from compact simulation results", "[sidb-simulation-result]")
+{
+    using lattice = sidb_cell_clk_lyt;
+
+    lattice lyt{};
+
+    lyt.assign_cell_type({5, 4}, lattice::cell_type::NORMAL);
+    lyt.assign_cell_type({6, 4}, lattice::cell_type::NORMAL);
+
+    const charge_distribution_surface context{lyt};
+
+    charge_distribution_surface cds1{lyt};
+    cds1.assign_charge_state({5, 4}, sidb_charge_state::NEUTRAL);
+    cds1.assign_charge_state({6, 4}, sidb_charge_state::NEGATIVE);
+    cds1.update_after_charge_change();
+
+    charge_distribution_surface cds2{lyt};
+    cds2.assign_charge_state({5, 4}, sidb_charge_state::NEGATIVE);
+    cds2.assign_charge_state({6, 4}, sidb_charge_state::NEUTRAL);
+    cds2.update_after_charge_change();
+
+    charge_distribution_surface cds3{lyt};
+    cds3.assign_all_charge_states(sidb_charge_state::NEGATIVE);
+    cds3.update_after_charge_change();
+
+    sidb_simulation_result<lattice> results{};
+    results.compact_charge_distribution_context = std::make_shared<const charge_distribution_surface<lattice>>(context);
+    results.algorithm_name                      = "test";
+
+    SECTION("only compact charge distributions")
+    {
+        // cds2 is stored twice to check that duplicates are only returned once
+        results.compact_charge_distributions = {compact_charge_distribution{cds1}, compact_charge_distribution{cds2},
+                                                compact_charge_distribution{cds3}, compact_charge_distribution{cds2}};
+
+        CHECK(results.num_charge_distributions() == 4);
+        CHECK(results.materialize_charge_distributions().size() == 4);
+
+        const auto ground_states = results.groundstates();
+        REQUIRE(ground_states.size() == 2);
+        CHECK(ground_states[0].get_charge_index_and_base().first < ground_states[1].get_charge_index_and_base().first);
+        CHECK_THAT(ground_states[0].get_electrostatic_potential_energy(),
+                   Catch::Matchers::WithinAbs(cds1.get_electrostatic_potential_energy(), 0.00001));
+        CHECK_THAT(ground_states[1].get_electrostatic_potential_energy(),
+                   Catch::Matchers::WithinAbs(cds1.get_electrostatic_potential_energy(), 0.00001));
+    }
+    SECTION("full and compact charge distributions")
+    {
+        results.charge_distributions         = {cds3, cds2};
+        results.compact_charge_distributions = {compact_charge_distribution{cds1}, compact_charge_distribution{cds2}};
+
+        CHECK(results.num_charge_distributions() == 4);
+
+        const auto ground_states = results.groundstates();
+        REQUIRE(ground_states.size() == 2);
+        CHECK(ground_states[0].get_all_sidb_charges() != ground_states[1].get_all_sidb_charges());
+    }
+}
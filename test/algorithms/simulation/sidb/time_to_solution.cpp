@@ -255,3 +255,53 @@ TEMPLATE_TEST_CASE("time-to-solution test with fewer negatively charged SiDBs in
         CHECK(tts_stats_quicksim.time_to_solution < 10.0);
     }
 }
+
+TEMPLATE_TEST_CASE("time-to-solution test with parallel repetitions and layout batches", "[time-to-solution]",
+                   sidb_100_cell_clk_lyt_siqad)
+{
+    TestType lyt{};
+
+    lyt.assign_cell_type({1, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({5, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({12, 3, 0}, TestType::cell_type::NORMAL);
+
+    constexpr sidb_simulation_parameters params{2, -0.30};
+
+    quicksim_params quicksim_params{params};
+    quicksim_params.number_threads = 1;
+
+    time_to_solution_params tts_params{};
+    tts_params.repetitions       = 20;
+    tts_params.number_of_threads = 4;
+
+    SECTION("parallel repetitions")
+    {
+        time_to_solution_stats tts_stat{};
+        time_to_solution<TestType>(lyt, quicksim_params, tts_params, &tts_stat);
+
+        CHECK(tts_stat.acc == 100.0);
+        CHECK(tts_stat.single_runtimes.size() == tts_params.repetitions);
+        CHECK_THAT(tts_stat.time_to_solution - tts_stat.mean_single_runtime,
+                   Catch::Matchers::WithinAbs(0.0, constants::ERROR_MARGIN));
+    }
+    SECTION("layout batch")
+    {
+        const auto empty_lyt = TestType{};
+
+        const auto tts_stats = time_to_solution_batch(std::vector<TestType>{lyt, empty_lyt, lyt}, quicksim_params,
+                                                      tts_params);
+
+        REQUIRE(tts_stats.size() == 3);
+
+        // the statistics are returned in the order of the layouts
+        CHECK(tts_stats[0].acc == 100.0);
+        CHECK(tts_stats[0].single_runtimes.size() == tts_params.repetitions);
+        CHECK(tts_stats[1].acc == 0.0);
+        CHECK(std::isinf(tts_stats[1].time_to_solution));
+        CHECK(tts_stats[1].single_runtimes.empty());
+        CHECK(tts_stats[2].acc == 100.0);
+        CHECK(tts_stats[2].algorithm == "QuickExact");
+    }
+}
@@ -20,6 +20,8 @@
 
 #include <cmath>
 #include <cstdint>
+#include <utility>
+#include <vector>
 
 using namespace fiction;
 
@@ -2239,6 +2241,200 @@ TEST_CASE("Assign charge index", "[charge-distribution-surface]")
     }
 }
 
+TEST_CASE("Incremental update of a single charge flip", "[charge-distribution-surface]")
+{
+    using layout = sidb_100_cell_clk_lyt_siqad;
+
+    layout lyt{};
+    lyt.assign_cell_type({0, 0, 0}, layout::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 0, 0}, layout::cell_type::NORMAL);
+    lyt.assign_cell_type({6, 1, 0}, layout::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 0, 1}, layout::cell_type::NORMAL);
+    lyt.assign_cell_type({14, 2, 0}, layout::cell_type::NORMAL);
+    lyt.assign_cell_type({16, 3, 1}, layout::cell_type::NORMAL);
+
+    // sequence of (SiDB index, new charge state) pairs that is applied one after another
+    const std::vector<std::pair<uint64_t, sidb_charge_state>> flips{
+        {1, sidb_charge_state::NEUTRAL},  {3, sidb_charge_state::NEUTRAL},  {5, sidb_charge_state::POSITIVE},
+        {1, sidb_charge_state::NEGATIVE}, {0, sidb_charge_state::NEUTRAL},  {0, sidb_charge_state::NEUTRAL},
+        {2, sidb_charge_state::POSITIVE}, {3, sidb_charge_state::NEGATIVE}, {4, sidb_charge_state::NEUTRAL},
+        {5, sidb_charge_state::NEGATIVE}, {2, sidb_charge_state::NEGATIVE}, {0, sidb_charge_state::NEGATIVE}};
+
+    const auto check_flips = [&flips](auto& incremental_cds, const std::vector<layout::cell>& defect_cells = {})
+    {
+        incremental_cds.assign_all_charge_states(sidb_charge_state::NEGATIVE);
+        incremental_cds.update_after_charge_change();
+
+        auto reference_cds = incremental_cds;
+
+        for (const auto& [index, cs] : flips)
+        {
+            incremental_cds.flip_charge(index, cs);
+
+            reference_cds.assign_charge_state_by_index(index, cs);
+            reference_cds.update_after_charge_change();
+
+            CHECK(incremental_cds.get_all_sidb_charges() == reference_cds.get_all_sidb_charges());
+            CHECK(incremental_cds.is_physically_valid() == reference_cds.is_physically_valid());
+            CHECK_THAT(incremental_cds.get_electrostatic_potential_energy(),
+                       Catch::Matchers::WithinAbs(reference_cds.get_electrostatic_potential_energy(),
+                                                  constants::ERROR_MARGIN));
+
+            for (uint64_t i = 0; i < incremental_cds.num_cells(); ++i)
+            {
+                CHECK_THAT(incremental_cds.get_local_potential_by_index(i).value(),
+                           Catch::Matchers::WithinAbs(reference_cds.get_local_potential_by_index(i).value(),
+                                                      constants::ERROR_MARGIN));
+            }
+
+            for (const auto& c : defect_cells)
+            {
+                CHECK_THAT(incremental_cds.get_local_defect_potential(c).value(),
+                           Catch::Matchers::WithinAbs(reference_cds.get_local_defect_potential(c).value(),
+                                                      constants::ERROR_MARGIN));
+            }
+        }
+    };
+
+    SECTION("without defects")
+    {
+        charge_distribution_surface cds{lyt, sidb_simulation_parameters{3, -0.32}};
+
+        check_flips(cds);
+    }
+
+    SECTION("QuickSim engine")
+    {
+        charge_distribution_surface cds{lyt, sidb_simulation_parameters{3, -0.32}};
+        cds.set_sidb_simulation_engine(sidb_simulation_engine::QUICKSIM);
+
+        check_flips(cds);
+    }
+
+    SECTION("with external potential and defects")
+    {
+        sidb_defect_surface<layout> defect_lyt{lyt};
+        defect_lyt.assign_sidb_defect({8, 4, 0}, sidb_defect{sidb_defect_type::UNKNOWN, -1, 5.6, 5.0});
+        defect_lyt.assign_sidb_defect({20, 1, 1}, sidb_defect{sidb_defect_type::UNKNOWN, 1, 2.0, 3.0});
+
+        charge_distribution_surface cds{defect_lyt, sidb_simulation_parameters{3, -0.32}};
+        cds.assign_global_external_potential(-0.05);
+
+        check_flips(cds, {{8, 4, 0}, {20, 1, 1}});
+    }
+
+    SECTION("physically valid charge distribution")
+    {
+        layout pair_lyt{};
+        pair_lyt.assign_cell_type({0, 0, 0}, layout::cell_type::NORMAL);
+        pair_lyt.assign_cell_type({1, 0, 0}, layout::cell_type::NORMAL);
+
+        charge_distribution_surface cds{pair_lyt, sidb_simulation_parameters{2, -0.32}};
+        cds.update_after_charge_change();
+        CHECK_FALSE(cds.is_physically_valid());
+
+        cds.flip_charge(1, sidb_charge_state::NEUTRAL);
+        CHECK(cds.is_physically_valid());
+
+        cds.flip_charge(1, sidb_charge_state::NEGATIVE);
+        CHECK_FALSE(cds.is_physically_valid());
+    }
+
+    SECTION("keep the old physical validity")
+    {
+        layout pair_lyt{};
+        pair_lyt.assign_cell_type({0, 0, 0}, layout::cell_type::NORMAL);
+        pair_lyt.assign_cell_type({1, 0, 0}, layout::cell_type::NORMAL);
+
+        charge_distribution_surface cds{pair_lyt, sidb_simulation_parameters{2, -0.32}};
+        cds.update_after_charge_change();
+
+        cds.flip_charge(1, sidb_charge_state::NEUTRAL, validity_calculation::KEEP_OLD_VALIDITY);
+        CHECK_FALSE(cds.is_physically_valid());
+
+        // the potentials and the energy are updated nonetheless
+        auto reference_cds = cds;
+        reference_cds.update_after_charge_change();
+
+        CHECK_THAT(cds.get_electrostatic_potential_energy(),
+                   Catch::Matchers::WithinAbs(reference_cds.get_electrostatic_potential_energy(),
+                                              constants::ERROR_MARGIN));
+
+        cds.validity_check();
+        CHECK(cds.is_physically_valid());
+    }
+}
+
+TEST_CASE("Mixed-precision local potential updates", "[charge-distribution-surface]")
+{
+    using layout = sidb_100_cell_clk_lyt_siqad;
+
+    layout lyt{};
+    lyt.assign_cell_type({0, 0, 0}, layout::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 0, 0}, layout::cell_type::NORMAL);
+    lyt.assign_cell_type({6, 1, 0}, layout::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 0, 1}, layout::cell_type::NORMAL);
+    lyt.assign_cell_type({14, 2, 0}, layout::cell_type::NORMAL);
+
+    charge_distribution_surface cds_double{lyt, sidb_simulation_parameters{2, -0.32}};
+    cds_double.assign_charge_state_by_index(1, sidb_charge_state::NEUTRAL);
+    cds_double.assign_charge_state_by_index(3, sidb_charge_state::NEUTRAL);
+    cds_double.update_after_charge_change();
+
+    auto cds_mixed = cds_double;
+
+    CHECK(cds_mixed.get_potential_precision() == potential_precision::DOUBLE);
+    cds_mixed.assign_potential_precision(potential_precision::MIXED);
+    CHECK(cds_mixed.get_potential_precision() == potential_precision::MIXED);
+
+    const auto check_local_potentials = [&cds_double, &cds_mixed](const double tolerance)
+    {
+        for (uint64_t i = 0; i < cds_double.num_cells(); ++i)
+        {
+            const auto pot = cds_double.get_local_potential_by_index(i).value();
+
+            CHECK_THAT(cds_mixed.get_local_potential_by_index(i).value(),
+                       Catch::Matchers::WithinAbs(pot, tolerance * std::abs(pot)));
+        }
+    };
+
+    SECTION("full update")
+    {
+        cds_mixed.update_after_charge_change();
+
+        check_local_potentials(1E-6);
+        CHECK(cds_mixed.is_physically_valid() == cds_double.is_physically_valid());
+    }
+    SECTION("incremental update")
+    {
+        cds_mixed.update_after_charge_change();
+
+        cds_double.flip_charge(2, sidb_charge_state::NEUTRAL);
+        cds_mixed.flip_charge(2, sidb_charge_state::NEUTRAL);
+
+        check_local_potentials(1E-6);
+        CHECK_THAT(cds_mixed.get_electrostatic_potential_energy(),
+                   Catch::Matchers::WithinAbs(cds_double.get_electrostatic_potential_energy(), 1E-6));
+    }
+    SECTION("recomputation in double precision")
+    {
+        cds_mixed.update_after_charge_change();
+        cds_mixed.recompute_in_double_precision();
+
+        CHECK(cds_mixed.get_potential_precision() == potential_precision::MIXED);
+        check_local_potentials(0.0);
+        CHECK(cds_mixed.get_electrostatic_potential_energy() == cds_double.get_electrostatic_potential_energy());
+        CHECK(cds_mixed.is_physically_valid() == cds_double.is_physically_valid());
+    }
+    SECTION("switch back to double precision")
+    {
+        cds_mixed.assign_potential_precision(potential_precision::DOUBLE);
+        cds_mixed.update_after_charge_change();
+
+        check_local_potentials(0.0);
+    }
+}
+
 TEMPLATE_TEST_CASE("Charge distribution surface defect vs SiDB equivalence", "[charge-distribution-surface]",
                    sidb_100_cell_clk_lyt_siqad, cds_sidb_100_cell_clk_lyt_siqad)
 {
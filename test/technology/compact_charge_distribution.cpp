@@ -0,0 +1,106 @@
+//
+// Created by Jan Drewniok on 17.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <fiction/technology/charge_distribution_surface.hpp>
+#include <fiction/technology/compact_charge_distribution.hpp>
+#include <fiction/technology/constants.hpp>
+#include <fiction/technology/sidb_charge_state.hpp>
+#include <fiction/types.hpp>
+
+#include <cstdint>
+
+using namespace fiction;
+
+TEST_CASE("Compact charge distribution", "[compact-charge-distribution]")
+{
+    using layout = sidb_100_cell_clk_lyt_siqad;
+
+    SECTION("empty charge distribution")
+    {
+        const compact_charge_distribution compact_cds{};
+
+        CHECK(compact_cds.num_cells() == 0);
+        CHECK(compact_cds.get_all_sidb_charges().empty());
+        CHECK(compact_cds.get_electrostatic_potential_energy() == 0.0);
+    }
+
+    SECTION("charge states, energy, and charge index of three SiDBs")
+    {
+        layout lyt{};
+
+        lyt.assign_cell_type({0, 0, 0}, layout::cell_type::NORMAL);
+        lyt.assign_cell_type({3, 0, 0}, layout::cell_type::NORMAL);
+        lyt.assign_cell_type({6, 0, 0}, layout::cell_type::NORMAL);
+
+        charge_distribution_surface cds{lyt, sidb_simulation_parameters{3}};
+
+        cds.assign_charge_state({0, 0, 0}, sidb_charge_state::NEGATIVE);
+        cds.assign_charge_state({3, 0, 0}, sidb_charge_state::POSITIVE);
+        cds.assign_charge_state({6, 0, 0}, sidb_charge_state::NEUTRAL);
+        cds.update_after_charge_change();
+        cds.charge_distribution_to_index_general();
+
+        const compact_charge_distribution compact_cds{cds};
+
+        REQUIRE(compact_cds.num_cells() == 3);
+
+        for (uint64_t i = 0; i < 3; ++i)
+        {
+            CHECK(compact_cds.get_charge_state_by_index(i) == cds.get_charge_state_by_index(i));
+        }
+
+        CHECK(compact_cds.get_all_sidb_charges() == cds.get_all_sidb_charges());
+        CHECK(compact_cds.get_charge_index_and_base() == cds.get_charge_index_and_base());
+        CHECK_THAT(compact_cds.get_electrostatic_potential_energy(),
+                   Catch::Matchers::WithinAbs(cds.get_electrostatic_potential_energy(), constants::ERROR_MARGIN));
+
+        SECTION("restore the charge distribution")
+        {
+            charge_distribution_surface restored_cds{lyt, sidb_simulation_parameters{3}};
+            CHECK(restored_cds.get_all_sidb_charges() != cds.get_all_sidb_charges());
+
+            compact_cds.apply_to(restored_cds);
+
+            CHECK(restored_cds.get_all_sidb_charges() == cds.get_all_sidb_charges());
+            CHECK(restored_cds.get_charge_index_and_base() == cds.get_charge_index_and_base());
+            CHECK_THAT(restored_cds.get_electrostatic_potential_energy(),
+                       Catch::Matchers::WithinAbs(cds.get_electrostatic_potential_energy(), constants::ERROR_MARGIN));
+        }
+
+        SECTION("equality")
+        {
+            CHECK(compact_cds == compact_charge_distribution{cds});
+
+            cds.assign_charge_state({3, 0, 0}, sidb_charge_state::NEGATIVE);
+            cds.update_after_charge_change();
+
+            CHECK_FALSE(compact_cds == compact_charge_distribution{cds});
+        }
+    }
+
+    SECTION("charge states of more SiDBs than fit into a single word")
+    {
+        layout lyt{};
+
+        for (int32_t x = 0; x < 70; ++x)
+        {
+            lyt.assign_cell_type({x * 3, 0, 0}, layout::cell_type::NORMAL);
+        }
+
+        charge_distribution_surface cds{lyt, sidb_simulation_parameters{3}};
+
+        for (uint64_t i = 0; i < cds.num_cells(); ++i)
+        {
+            cds.assign_charge_state_by_index(i, sign_to_charge_state(static_cast<int8_t>((i % 3) - 1)));
+        }
+
+        const compact_charge_distribution compact_cds{cds};
+
+        REQUIRE(compact_cds.num_cells() == 70);
+        CHECK(compact_cds.get_all_sidb_charges() == cds.get_all_sidb_charges());
+    }
+}
@@ -0,0 +1,222 @@
+//
+// Created by Jan Drewniok on 17.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/physical_design/design_sidb_gates.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+#include <fiction/technology/sidb_defect_surface.hpp>
+#include <fiction/technology/sidb_defects.hpp>
+#include <fiction/technology/sidb_gate_design_cache.hpp>
+#include <fiction/types.hpp>
+#include <fiction/utils/truth_table_utils.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace fiction;
+
+using cell_lyt = sidb_100_cell_clk_lyt_cube;
+using cache    = sidb_gate_design_cache<4, 2>;
+
+TEST_CASE("SiDB gate design cache key", "[sidb-gate-design-cache]")
+{
+    sidb_defect_surface<cell_lyt> skeleton{};
+    skeleton.assign_cell_type({0, 0, 0}, sidb_technology::cell_type::INPUT);
+    skeleton.assign_cell_type({4, 2, 0}, sidb_technology::cell_type::NORMAL);
+    skeleton.assign_cell_type({8, 4, 0}, sidb_technology::cell_type::OUTPUT);
+
+    const design_sidb_gates_params<cell<cell_lyt>> params{};
+
+    const auto key = sidb_gate_design_cache_key(skeleton, std::vector<tt>{create_id_tt()}, params);
+
+    CHECK(key.find_first_of(" \t\n\r") == std::string::npos);
+
+    SECTION("Identical design problems")
+    {
+        sidb_defect_surface<cell_lyt> other{};
+        other.assign_cell_type({8, 4, 0}, sidb_technology::cell_type::OUTPUT);
+        other.assign_cell_type({4, 2, 0}, sidb_technology::cell_type::NORMAL);
+        other.assign_cell_type({0, 0, 0}, sidb_technology::cell_type::INPUT);
+
+        CHECK(sidb_gate_design_cache_key(other, std::vector<tt>{create_id_tt()}, params) == key);
+    }
+    SECTION("Different skeleton")
+    {
+        skeleton.assign_cell_type({4, 2, 0}, sidb_technology::cell_type::EMPTY);
+
+        CHECK(sidb_gate_design_cache_key(skeleton, std::vector<tt>{create_id_tt()}, params) != key);
+    }
+    SECTION("Different defects")
+    {
+        skeleton.assign_sidb_defect({10, 5, 0}, sidb_defect{sidb_defect_type::DB, -1, 4.1, 1.8});
+
+        const auto key_with_defect = sidb_gate_design_cache_key(skeleton, std::vector<tt>{create_id_tt()}, params);
+
+        CHECK(key_with_defect != key);
+
+        skeleton.assign_sidb_defect({10, 5, 0}, sidb_defect{sidb_defect_type::DB, -1, 4.1, 1.8000001});
+
+        CHECK(sidb_gate_design_cache_key(skeleton, std::vector<tt>{create_id_tt()}, params) != key_with_defect);
+    }
+    SECTION("Different specification")
+    {
+        CHECK(sidb_gate_design_cache_key(skeleton, std::vector<tt>{create_not_tt()}, params) != key);
+        CHECK(sidb_gate_design_cache_key(skeleton, std::vector<tt>{create_id_tt(), create_id_tt()}, params) != key);
+    }
+    SECTION("Different parameters")
+    {
+        auto other_params = params;
+
+        other_params.operational_params.simulation_parameters.mu_minus = -0.28;
+        CHECK(sidb_gate_design_cache_key(skeleton, std::vector<tt>{create_id_tt()}, other_params) != key);
+
+        other_params = params;
+
+        other_params.number_of_canvas_sidbs = 2;
+        CHECK(sidb_gate_design_cache_key(skeleton, std::vector<tt>{create_id_tt()}, other_params) != key);
+
+        other_params = params;
+
+        other_params.symmetry = design_sidb_gates_params<cell<cell_lyt>>::symmetry_reduction::CANONICAL_ONLY;
+        CHECK(sidb_gate_design_cache_key(skeleton, std::vector<tt>{create_id_tt()}, other_params) != key);
+    }
+}
+
+TEST_CASE("SiDB gate design cache", "[sidb-gate-design-cache]")
+{
+    using ct = sidb_technology::cell_type;
+
+    const cache::gate design{
+        {{ct::NORMAL, ct::EMPTY, ct::EMPTY, ct::LOGIC}, {ct::EMPTY, ct::INPUT, ct::OUTPUT, ct::EMPTY}}};
+
+    SECTION("In memory")
+    {
+        cache c{};
+
+        CHECK(c.size() == 0);
+        CHECK(!c.find("1").has_value());
+
+        c.insert("1", design);
+        c.insert("2", std::nullopt);
+
+        CHECK(c.size() == 2);
+
+        const auto hit = c.find("1");
+        REQUIRE(hit.has_value());
+        REQUIRE(hit->has_value());
+        CHECK(hit->value() == design);
+
+        const auto impossible = c.find("2");
+        REQUIRE(impossible.has_value());
+        CHECK(!impossible->has_value());
+
+        // existing entries are not overwritten
+        c.insert("2", design);
+        CHECK(!c.find("2")->has_value());
+    }
+    SECTION("Concurrent design of the same gate")
+    {
+        cache c{};
+
+        std::atomic<std::size_t> number_of_designs{0};
+
+        std::vector<std::thread> threads{};
+        threads.reserve(8);
+
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            threads.emplace_back(
+                [&c, &number_of_designs, &design]
+                {
+                    const auto result = c.find_or_design(
+                        "1",
+                        [&number_of_designs, &design]() -> std::optional<cache::gate>
+                        {
+                            ++number_of_designs;
+                            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+                            return design;
+                        });
+
+                    CHECK(result == design);
+                });
+        }
+
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        CHECK(number_of_designs == 1);
+        CHECK(c.size() == 1);
+
+        // cached outcomes are returned without designing
+        CHECK(c.find_or_design("1", []() -> std::optional<cache::gate> { return std::nullopt; }) == design);
+    }
+    SECTION("Failing design")
+    {
+        cache c{};
+
+        CHECK_THROWS_AS(c.find_or_design("1", []() -> std::optional<cache::gate> { throw std::runtime_error{"fail"}; }),
+                        std::runtime_error);
+
+        CHECK(c.size() == 0);
+
+        CHECK(c.find_or_design("1", [&design]() -> std::optional<cache::gate> { return design; }) == design);
+    }
+    SECTION("Persistent")
+    {
+        const auto filename = std::filesystem::temp_directory_path() / "fiction_sidb_gate_design_cache.txt";
+        std::filesystem::remove(filename);
+
+        sidb_defect_surface<cell_lyt> skeleton{};
+        skeleton.assign_cell_type({0, 0, 0}, sidb_technology::cell_type::INPUT);
+        skeleton.assign_sidb_defect({10, 5, 0}, sidb_defect{sidb_defect_type::DB, -1, 4.1, 1.8});
+
+        const auto key = sidb_gate_design_cache_key(skeleton, std::vector<tt>{create_id_tt()},
+                                                    design_sidb_gates_params<cell<cell_lyt>>{});
+
+        {
+            cache c{filename};
+
+            CHECK(c.size() == 0);
+
+            c.insert(key, design);
+            c.insert("3", std::nullopt);
+        }
+
+        // simulate an entry that was cut short by an interrupted run
+        {
+            std::ofstream file{filename, std::ofstream::app};
+            file << "4 x..l\n5 x..l.io?\n";
+        }
+
+        cache c{filename};
+
+        CHECK(c.size() == 2);
+
+        const auto hit = c.find(key);
+        REQUIRE(hit.has_value());
+        REQUIRE(hit->has_value());
+        CHECK(hit->value() == design);
+
+        const auto impossible = c.find("3");
+        REQUIRE(impossible.has_value());
+        CHECK(!impossible->has_value());
+
+        CHECK(!c.find("4").has_value());
+        CHECK(!c.find("5").has_value());
+
+        std::filesystem::remove(filename);
+    }
+}
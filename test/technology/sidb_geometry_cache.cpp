@@ -0,0 +1,180 @@
+//
+// Created by Jan Drewniok on 17.10.26.
+//
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/simulation/sidb/quickexact.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
+#include <fiction/technology/charge_distribution_surface.hpp>
+#include <fiction/technology/sidb_geometry_cache.hpp>
+#include <fiction/traits.hpp>
+#include <fiction/types.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+using namespace fiction;
+
+TEMPLATE_TEST_CASE("Geometry cache of an SiDB layout", "[sidb-geometry-cache]", (sidb_100_cell_clk_lyt_siqad),
+                   (sidb_111_cell_clk_lyt_siqad))
+{
+    TestType lyt{};
+
+    lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({5, 0, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({2, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({8, 1, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({11, 4, 0}, TestType::cell_type::NORMAL);
+
+    const auto geometry = std::make_shared<const sidb_geometry_cache<cell<TestType>>>(lyt);
+
+    REQUIRE(geometry->num_sidbs() == 5);
+
+    SECTION("SiDB order and distances")
+    {
+        const charge_distribution_surface cds{lyt};
+
+        CHECK(geometry->get_sidb_order() == cds.get_sidb_order());
+
+        for (uint64_t i = 0; i < cds.num_cells(); ++i)
+        {
+            CHECK(geometry->index_of(cds.get_sidb_order()[i]) == i);
+        }
+
+        CHECK(!geometry->index_of({1, 1, 1}).has_value());
+
+        for (uint64_t i = 0; i < cds.num_cells(); ++i)
+        {
+            for (uint64_t j = 0; j < cds.num_cells(); ++j)
+            {
+                CHECK(geometry->get_nm_distance_matrix()(i, j) == cds.get_nm_distance_by_indices(i, j));
+            }
+        }
+    }
+
+    SECTION("potentials are identical to the ones computed from scratch")
+    {
+        for (const auto& [epsilon_r, lambda_tf] :
+             {std::pair{5.6, 5.0}, std::pair{5.6, 2.5}, std::pair{8.0, 2.5}, std::pair{5.6, 5.0}})
+        {
+            const sidb_simulation_parameters params{2, -0.32, epsilon_r, lambda_tf};
+
+            const charge_distribution_surface cds{lyt, params};
+            const charge_distribution_surface cds_cached{lyt, params, geometry};
+
+            for (uint64_t i = 0; i < cds.num_cells(); ++i)
+            {
+                CHECK(cds_cached.get_local_internal_potential_by_index(i) ==
+                      cds.get_local_internal_potential_by_index(i));
+
+                for (uint64_t j = 0; j < cds.num_cells(); ++j)
+                {
+                    CHECK(cds_cached.get_chargeless_potential_by_indices(i, j) ==
+                          cds.get_chargeless_potential_by_indices(i, j));
+                    CHECK(cds_cached.get_nm_distance_by_indices(i, j) == cds.get_nm_distance_by_indices(i, j));
+                }
+            }
+
+            CHECK(cds_cached.get_electrostatic_potential_energy() == cds.get_electrostatic_potential_energy());
+        }
+    }
+
+    SECTION("memoized potential matrices")
+    {
+        const sidb_simulation_parameters params{2, -0.32, 5.6, 5.0};
+
+        const auto pot_mat = geometry->get_potential_matrix(params);
+
+        CHECK(geometry->get_potential_matrix(params) == pot_mat);
+        CHECK(geometry->get_potential_matrix(sidb_simulation_parameters{2, -0.25, 5.6, 5.0}) == pot_mat);
+        CHECK(geometry->get_potential_matrix(sidb_simulation_parameters{2, -0.32, 5.6, 4.0}) != pot_mat);
+    }
+
+    SECTION("physical parameters are reassigned")
+    {
+        charge_distribution_surface cds{lyt};
+        charge_distribution_surface cds_cached{lyt, sidb_simulation_parameters{}, geometry};
+
+        const sidb_simulation_parameters params{2, -0.28, 6.2, 3.5};
+
+        cds.assign_physical_parameters(params);
+        cds_cached.assign_physical_parameters(params);
+
+        for (uint64_t i = 0; i < cds.num_cells(); ++i)
+        {
+            for (uint64_t j = 0; j < cds.num_cells(); ++j)
+            {
+                CHECK(cds_cached.get_chargeless_potential_by_indices(i, j) ==
+                      cds.get_chargeless_potential_by_indices(i, j));
+            }
+        }
+    }
+
+    SECTION("layout with a subset of the cached SiDBs")
+    {
+        auto sub_lyt = lyt.clone();
+        sub_lyt.assign_cell_type({5, 0, 1}, TestType::cell_type::EMPTY);
+        sub_lyt.assign_cell_type({11, 4, 0}, TestType::cell_type::EMPTY);
+
+        const sidb_simulation_parameters params{2, -0.32, 5.6, 5.0};
+
+        const charge_distribution_surface cds{sub_lyt, params};
+        const charge_distribution_surface cds_cached{sub_lyt, params, geometry};
+
+        REQUIRE(cds_cached.num_cells() == 3);
+
+        for (uint64_t i = 0; i < cds.num_cells(); ++i)
+        {
+            for (uint64_t j = 0; j < cds.num_cells(); ++j)
+            {
+                CHECK(cds_cached.get_chargeless_potential_by_indices(i, j) ==
+                      cds.get_chargeless_potential_by_indices(i, j));
+                CHECK(cds_cached.get_nm_distance_by_indices(i, j) == cds.get_nm_distance_by_indices(i, j));
+            }
+        }
+    }
+
+    SECTION("layout with SiDBs that are not cached")
+    {
+        auto other_lyt = lyt.clone();
+        other_lyt.assign_cell_type({20, 0, 0}, TestType::cell_type::NORMAL);
+
+        const sidb_simulation_parameters params{2, -0.32, 5.6, 5.0};
+
+        const charge_distribution_surface cds{other_lyt, params};
+        const charge_distribution_surface cds_cached{other_lyt, params, geometry};
+
+        for (uint64_t i = 0; i < cds.num_cells(); ++i)
+        {
+            for (uint64_t j = 0; j < cds.num_cells(); ++j)
+            {
+                CHECK(cds_cached.get_chargeless_potential_by_indices(i, j) ==
+                      cds.get_chargeless_potential_by_indices(i, j));
+            }
+        }
+    }
+
+    SECTION("QuickExact")
+    {
+        quickexact_params<cell<TestType>> params{sidb_simulation_parameters{2, -0.32, 5.6, 5.0}};
+
+        const auto result = quickexact(lyt, params);
+
+        params.geometry_cache = geometry;
+
+        const auto result_cached = quickexact(lyt, params);
+
+        REQUIRE(result_cached.charge_distributions.size() == result.charge_distributions.size());
+
+        for (uint64_t i = 0; i < result.charge_distributions.size(); ++i)
+        {
+            CHECK(result_cached.charge_distributions[i].get_all_sidb_charges() ==
+                  result.charge_distributions[i].get_all_sidb_charges());
+            CHECK(result_cached.charge_distributions[i].get_electrostatic_potential_energy() ==
+                  result.charge_distributions[i].get_electrostatic_potential_energy());
+        }
+    }
+}
@@ -8,9 +8,14 @@
 #include <fiction/utils/combination_utils.hpp>
 #include <fiction/utils/math_utils.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <random>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace fiction;
@@ -293,3 +298,120 @@ TEST_CASE("Less entities than positions", "[determine-all-combinations-of-distri
     REQUIRE(result[1] == std::vector<std::size_t>{0, 2});
     REQUIRE(result[2] == std::vector<std::size_t>{1, 2});
 }
+
+TEST_CASE("Unranking combinations of distributing k entities on n positions",
+          "[unrank-combination-of-distributing-k-entities-on-n-positions]")
+{
+    for (const auto& [k, n] : std::vector<std::pair<std::size_t, std::size_t>>{{1, 1}, {2, 3}, {3, 5}, {4, 9}, {5, 5}})
+    {
+        const auto all_combinations = determine_all_combinations_of_distributing_k_entities_on_n_positions(k, n);
+
+        REQUIRE(all_combinations.size() == binomial_coefficient(n, k));
+
+        for (uint64_t rank = 0; rank < all_combinations.size(); ++rank)
+        {
+            CHECK(unrank_combination_of_distributing_k_entities_on_n_positions(rank, k, n) == all_combinations[rank]);
+        }
+    }
+
+    // the last of more than 10^11 combinations
+    CHECK(unrank_combination_of_distributing_k_entities_on_n_positions(binomial_coefficient(40, 20) - 1, 20, 40) ==
+          std::vector<std::size_t>{20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39});
+}
+
+TEST_CASE("Advancing combinations of distributing k entities on n positions",
+          "[next-combination-of-distributing-k-entities-on-n-positions]")
+{
+    for (const auto& [k, n] : std::vector<std::pair<std::size_t, std::size_t>>{{1, 1}, {2, 3}, {3, 5}, {4, 9}, {5, 5}})
+    {
+        const auto all_combinations = determine_all_combinations_of_distributing_k_entities_on_n_positions(k, n);
+
+        auto combination = unrank_combination_of_distributing_k_entities_on_n_positions(0, k, n);
+
+        for (std::size_t rank = 0; rank < all_combinations.size(); ++rank)
+        {
+            CHECK(combination == all_combinations[rank]);
+            CHECK(next_combination_of_distributing_k_entities_on_n_positions(combination, n) ==
+                  (rank + 1 < all_combinations.size()));
+        }
+
+        // the last combination is left unchanged
+        CHECK(combination == all_combinations.back());
+    }
+
+    // continuing from an arbitrary rank of more than 10^11 combinations
+    auto combination = unrank_combination_of_distributing_k_entities_on_n_positions(123456789, 20, 40);
+
+    REQUIRE(next_combination_of_distributing_k_entities_on_n_positions(combination, 40));
+    CHECK(combination == unrank_combination_of_distributing_k_entities_on_n_positions(123456790, 20, 40));
+}
+
+TEST_CASE("Unranking cartesian combinations", "[unrank-cartesian-combination]")
+{
+    SECTION("Agrees with cartesian_combinations")
+    {
+        const std::vector<std::vector<int>> input{{1, 2, 3}, {4}, {5, 6}, {7, 8, 9, 10}};
+
+        const auto all_combinations = cartesian_combinations(input);
+
+        REQUIRE(number_of_cartesian_combinations(input) == all_combinations.size());
+
+        for (uint64_t rank = 0; rank < all_combinations.size(); ++rank)
+        {
+            CHECK(unrank_cartesian_combination(input, rank) == all_combinations[rank]);
+        }
+    }
+
+    SECTION("Empty input and empty dimension")
+    {
+        CHECK(number_of_cartesian_combinations(std::vector<std::vector<int>>{}) == 1);
+        CHECK(unrank_cartesian_combination(std::vector<std::vector<int>>{}, 0).empty());
+        CHECK(number_of_cartesian_combinations(std::vector<std::vector<int>>{{1, 2}, {}}) == 0);
+    }
+
+    SECTION("Saturating count")
+    {
+        const std::vector<std::vector<int>> input(70, std::vector<int>{0, 1});
+
+        CHECK(number_of_cartesian_combinations(input) == std::numeric_limits<uint64_t>::max());
+
+        // the lowest 64 dimensions encode the rank in binary
+        const auto combination = unrank_cartesian_combination(input, std::numeric_limits<uint64_t>::max());
+
+        CHECK(std::count(combination.cbegin(), combination.cend(), 1) == 64);
+        CHECK(std::count(combination.cbegin(), combination.cbegin() + 6, 1) == 0);
+    }
+}
+
+TEST_CASE("Sampling distinct ranks", "[sample-distinct-ranks]")
+{
+    std::mt19937_64 generator{42};
+
+    for (const auto& [num_ranks, num_samples] : std::vector<std::pair<uint64_t, uint64_t>>{
+             {0, 0}, {0, 5}, {1, 1}, {10, 10}, {10, 3}, {1000, 999}, {std::numeric_limits<uint64_t>::max(), 100}})
+    {
+        const auto ranks = sample_distinct_ranks(num_ranks, num_samples, generator);
+
+        CHECK(ranks.size() == std::min(num_ranks, num_samples));
+        CHECK(std::is_sorted(ranks.cbegin(), ranks.cend()));
+        CHECK(std::set<uint64_t>(ranks.cbegin(), ranks.cend()).size() == ranks.size());
+        CHECK(std::all_of(ranks.cbegin(), ranks.cend(), [num_ranks](const auto r) { return r < num_ranks; }));
+    }
+
+    // all ranks are drawn equally likely
+    std::vector<std::size_t> frequencies(10, 0);
+
+    for (std::size_t i = 0; i < 10000; ++i)
+    {
+        for (const auto r : sample_distinct_ranks(10, 3, generator))
+        {
+            ++frequencies[r];
+        }
+    }
+
+    for (const auto f : frequencies)
+    {
+        CHECK(f > 2700);
+        CHECK(f < 3300);
+    }
+}
@@ -0,0 +1,159 @@
+//
+// Created by Jan Drewniok on 17.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <fiction/utils/aligned_matrix.hpp>
+#include <fiction/utils/simd_utils.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Dot product", "[simd-utils]")
+{
+    // lengths that cover empty arrays, pure remainders, and full vector registers plus remainders
+    for (const std::size_t n : {std::size_t{0}, std::size_t{1}, std::size_t{3}, std::size_t{4}, std::size_t{8},
+                                std::size_t{13}, std::size_t{64}, std::size_t{101}})
+    {
+        std::vector<double> x(n);
+        std::vector<double> y(n);
+
+        double expected = 0.0;
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            x[i] = 0.5 * static_cast<double>(i) - 3.0;
+            y[i] = static_cast<double>(static_cast<int64_t>(i % 3) - 1);
+
+            expected += x[i] * y[i];
+        }
+
+        CHECK_THAT(dot_product(x.data(), y.data(), n), Catch::Matchers::WithinAbs(expected, 1E-12));
+
+        // the entries of x are exactly representable in single precision
+        const std::vector<float> x_single(x.cbegin(), x.cend());
+
+        CHECK_THAT(dot_product(x_single.data(), y.data(), n), Catch::Matchers::WithinAbs(expected, 1E-12));
+    }
+}
+
+TEST_CASE("Scaled addition", "[simd-utils]")
+{
+    for (const std::size_t n : {std::size_t{0}, std::size_t{1}, std::size_t{5}, std::size_t{8}, std::size_t{19}})
+    {
+        std::vector<double> x(n);
+        std::vector<double> y(n);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            x[i] = static_cast<double>(i);
+            y[i] = 1.0;
+        }
+
+        scaled_addition(y.data(), x.data(), -2.0, n);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            CHECK_THAT(y[i], Catch::Matchers::WithinAbs(1.0 - 2.0 * static_cast<double>(i), 1E-12));
+        }
+
+        const std::vector<float> x_single(x.cbegin(), x.cend());
+
+        scaled_addition(y.data(), x_single.data(), 2.0, n);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            CHECK_THAT(y[i], Catch::Matchers::WithinAbs(1.0, 1E-12));
+        }
+    }
+}
+
+TEST_CASE("Aligned square matrix", "[simd-utils]")
+{
+    SECTION("empty matrix")
+    {
+        const aligned_square_matrix<double> mat{};
+
+        CHECK(mat.empty());
+        CHECK(mat.size() == 0);
+    }
+    SECTION("entries and row alignment")
+    {
+        aligned_square_matrix<double> mat{5, 1.0};
+
+        CHECK(!mat.empty());
+        CHECK(mat.size() == 5);
+
+        for (std::size_t i = 0; i < mat.size(); ++i)
+        {
+            // every row starts at a cache line boundary
+            CHECK(reinterpret_cast<std::uintptr_t>(mat.row(i)) % aligned_square_matrix<double>::ALIGNMENT == 0);
+
+            for (std::size_t j = 0; j < mat.size(); ++j)
+            {
+                CHECK(mat(i, j) == 1.0);
+                mat(i, j) = static_cast<double>(i * 10 + j);
+            }
+        }
+
+        CHECK(mat(3, 4) == 34.0);
+        CHECK(mat.row(2)[1] == 21.0);
+
+        const auto copy = mat;
+        CHECK(copy(4, 3) == 43.0);
+        CHECK(reinterpret_cast<std::uintptr_t>(copy.row(1)) % aligned_square_matrix<double>::ALIGNMENT == 0);
+    }
+}
+
+TEST_CASE("Minimum absolute difference", "[simd-utils]")
+{
+    // lengths that cover empty arrays, pure remainders, and full vector registers plus remainders
+    for (const std::size_t n : {std::size_t{0}, std::size_t{1}, std::size_t{3}, std::size_t{4}, std::size_t{8},
+                                std::size_t{13}, std::size_t{64}, std::size_t{101}})
+    {
+        std::vector<double> x(n);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            // the values repeat, such that the minimum is attained at several indices
+            x[i] = 0.25 * static_cast<double>((i * 7) % 11) - 1.0;
+        }
+
+        for (const double reference : {-2.0, -0.3, 0.0, 0.6, 5.0})
+        {
+            auto        expected       = std::numeric_limits<double>::infinity();
+            std::size_t expected_index = n;
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (std::abs(x[i] - reference) < expected)
+                {
+                    expected       = std::abs(x[i] - reference);
+                    expected_index = i;
+                }
+            }
+
+            const auto [minimum, index] = minimum_absolute_difference(x.data(), n, reference);
+
+            CHECK(minimum == expected);
+            CHECK(index == expected_index);
+        }
+    }
+
+    SECTION("Infinite values")
+    {
+        const std::vector<double> x(9, std::numeric_limits<double>::infinity());
+
+        const auto [minimum, index] = minimum_absolute_difference(x.data(), x.size(), 0.0);
+
+        CHECK(std::isinf(minimum));
+        CHECK(index == x.size());
+    }
+}
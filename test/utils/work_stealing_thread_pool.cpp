@@ -0,0 +1,142 @@
+//
+// Created by Jan Drewniok on 17.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/utils/work_stealing_thread_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Each task is executed exactly once", "[work-stealing-thread-pool]")
+{
+    for (const auto num_threads : {std::size_t{0}, std::size_t{1}, std::size_t{2}, std::size_t{7}})
+    {
+        work_stealing_thread_pool pool{num_threads};
+
+        CHECK(pool.num_threads() == std::max(num_threads, std::size_t{1}));
+
+        // the pool is reused for batches of different sizes
+        for (const auto num_tasks : {std::size_t{0}, std::size_t{1}, std::size_t{5}, std::size_t{1000}})
+        {
+            std::vector<std::atomic<std::size_t>> executions(num_tasks);
+
+            pool.for_each_index(num_tasks, [&executions](const std::size_t i) { ++executions[i]; });
+
+            for (const auto& e : executions)
+            {
+                CHECK(e == 1);
+            }
+        }
+    }
+}
+
+TEST_CASE("Tasks of unbalanced runtimes are stolen", "[work-stealing-thread-pool]")
+{
+    work_stealing_thread_pool pool{4};
+
+    std::vector<std::thread::id> executing_thread(64);
+
+    // all expensive tasks are in the range of the first thread
+    pool.for_each_index(executing_thread.size(),
+                        [&executing_thread](const std::size_t i)
+                        {
+                            if (i < 16)
+                            {
+                                std::this_thread::sleep_for(std::chrono::milliseconds{5});
+                            }
+
+                            executing_thread[i] = std::this_thread::get_id();
+                        });
+
+    std::size_t tasks_of_first_range_executed_elsewhere = 0;
+
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        if (executing_thread[i] != std::this_thread::get_id())
+        {
+            ++tasks_of_first_range_executed_elsewhere;
+        }
+    }
+
+    CHECK(tasks_of_first_range_executed_elsewhere > 0);
+}
+
+TEST_CASE("Nested batches and shared pools", "[work-stealing-thread-pool]")
+{
+    const auto hardware_threads = std::max(std::size_t{std::thread::hardware_concurrency()}, std::size_t{1});
+
+    auto& pool = shared_work_stealing_thread_pool(3);
+
+    CHECK(pool.num_threads() == std::min(std::size_t{3}, hardware_threads));
+    CHECK(&pool == &shared_work_stealing_thread_pool(3));
+
+    // requests beyond the hardware concurrency do not create further pools
+    CHECK(shared_work_stealing_thread_pool(hardware_threads + 1).num_threads() == hardware_threads);
+    CHECK(&shared_work_stealing_thread_pool(hardware_threads + 1) == &shared_work_stealing_thread_pool(1000));
+
+    std::atomic<std::size_t> executions{0};
+    std::atomic<std::size_t> inline_executions{0};
+
+    // a batch that is submitted from within a task of the same pool is executed by the calling thread
+    pool.for_each_index(4,
+                        [&pool, &executions, &inline_executions](const std::size_t)
+                        {
+                            const auto caller = std::this_thread::get_id();
+
+                            pool.for_each_index(10,
+                                                [&executions, &inline_executions, caller](const std::size_t)
+                                                {
+                                                    ++executions;
+
+                                                    if (std::this_thread::get_id() == caller)
+                                                    {
+                                                        ++inline_executions;
+                                                    }
+                                                });
+                        });
+
+    CHECK(executions == 40);
+    CHECK(inline_executions == 40);
+
+    executions = 0;
+
+    // batches alternate between two pools
+    auto& other_pool = shared_work_stealing_thread_pool(2);
+
+    pool.for_each_index(
+        4,
+        [&pool, &other_pool, &executions](const std::size_t)
+        {
+            other_pool.for_each_index(
+                3, [&pool, &executions](const std::size_t)
+                { pool.for_each_index(5, [&executions](const std::size_t) { ++executions; }); });
+        });
+
+    CHECK(executions == 60);
+
+    executions = 0;
+
+    // independent threads share the pool
+    std::vector<std::thread> threads{};
+
+    for (std::size_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&pool, &executions]
+                             { pool.for_each_index(100, [&executions](const std::size_t) { ++executions; }); });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    CHECK(executions == 400);
+}